@@ -32,7 +32,10 @@
 #include "AdvancedErrorManagement.h"
 #include "CLASSMETHODREGISTER.h"
 #include "EPICSCAOutput.h"
+#include "MemoryMapSynchronisedOutputBroker.h"
+#include "MemoryOperationsHelper.h"
 #include "RegisteredMethodsMessageFilter.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -43,7 +46,7 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 EPICSCAOutput::EPICSCAOutput() :
-        DataSourceI(), MessageI() {
+        DataSourceI(), MessageI(), EmbeddedServiceMethodBinderI(), executor(*this) {
     pvs = NULL_PTR(PVWrapper *);
     stackSize = THREADS_DEFAULT_STACKSIZE * 4u;
     cpuMask = 0xffu;
@@ -52,6 +55,12 @@ EPICSCAOutput::EPICSCAOutput() :
     threadContextSet = false;
     dbr64CastDouble = true;
     signalFlag = NULL_PTR(uint8*);
+    useRing = false;
+    publicationPeriod = 1u;
+    ringInputMemory = NULL_PTR(char8 *);
+    ringOffsets = NULL_PTR(uint32 *);
+    overruns = 0u;
+    coalescedUpdates = 0u;
     ReferenceT < RegisteredMethodsMessageFilter > filter = ReferenceT < RegisteredMethodsMessageFilter > (GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -60,8 +69,13 @@ EPICSCAOutput::EPICSCAOutput() :
     }
 }
 
-/*lint -e{1551} must free the memory allocated to the different PVs.*/
+/*lint -e{1551} must stop the publication thread and free the memory allocated to the different PVs.*/
 EPICSCAOutput::~EPICSCAOutput() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
     uint32 nOfSignals = GetNumberOfSignals();
     if (pvs != NULL_PTR(PVWrapper *)) {
         uint32 n;
@@ -78,6 +92,12 @@ EPICSCAOutput::~EPICSCAOutput() {
     if (signalFlag != NULL_PTR(uint8*)) {
         delete[] signalFlag;
     }
+    if (ringInputMemory != NULL_PTR(char8 *)) {
+        delete[] ringInputMemory;
+    }
+    if (ringOffsets != NULL_PTR(uint32 *)) {
+        delete[] ringOffsets;
+    }
 }
 
 void EPICSCAOutput::Purge(ReferenceContainer &purgeList) {
@@ -124,6 +144,27 @@ bool EPICSCAOutput::Initialise(StructuredDataI & data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported DBR64CastDouble = %s", dbr64CastDoubleStr.Buffer());
         }
     }
+    if (ok) {
+        uint8 ringU = 0u;
+        if (data.Read("Ring", ringU)) {
+            ok = (ringU < 2u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Ring shall be 0 or 1");
+            }
+        }
+        useRing = (ringU == 1u);
+    }
+    if ((ok) && (useRing)) {
+        ok = (numberOfBuffers > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfBuffers shall be > 0");
+        }
+        if (ok) {
+            if (!data.Read("PublicationPeriod", publicationPeriod)) {
+                REPORT_ERROR(ErrorManagement::Information, "No PublicationPeriod defined. Using default = %d", publicationPeriod);
+            }
+        }
+    }
     if (ok) {
         ok = data.MoveRelative("Signals");
         if (!ok) {
@@ -292,6 +333,21 @@ bool EPICSCAOutput::SetConfiguredDatabase(StructuredDataI & data) {
             }
         }
     }
+    if ((ok) && (useRing)) {
+        ringOffsets = new uint32[nOfSignals];
+        uint32 slotSize = 0u;
+        uint32 n;
+        for (n = 0u; (n < nOfSignals); n++) {
+            ringOffsets[n] = slotSize;
+            /*lint -e{613} pvs cannot be NULL as otherwise ok would be false*/
+            slotSize += pvs[n].memorySize;
+        }
+        ringInputMemory = new char8[slotSize];
+        ok = MemoryOperationsHelper::Set(ringInputMemory, '\0', slotSize);
+        if (ok) {
+            ok = ring.Initialise(numberOfBuffers, slotSize);
+        }
+    }
     return ok;
 }
 
@@ -310,8 +366,14 @@ bool EPICSCAOutput::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 b
         ok = (signalIdx < GetNumberOfSignals());
     }
     if (ok) {
-        //lint -e{613} pvs cannot as otherwise ok would be false
-        signalAddress = pvs[signalIdx].memory;
+        if (ringInputMemory != NULL_PTR(char8 *)) {
+            //lint -e{613} ringOffsets is allocated together with the ringInputMemory
+            signalAddress = &ringInputMemory[ringOffsets[signalIdx]];
+        }
+        else {
+            //lint -e{613} pvs cannot as otherwise ok would be false
+            signalAddress = pvs[signalIdx].memory;
+        }
     }
     return ok;
 }
@@ -320,7 +382,12 @@ bool EPICSCAOutput::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 b
 const char8* EPICSCAOutput::GetBrokerName(StructuredDataI& data, const SignalDirection direction) {
     const char8* brokerName = "";
     if (direction == OutputSignals) {
-        brokerName = "MemoryMapAsyncOutputBroker";
+        if (useRing) {
+            brokerName = "MemoryMapSynchronisedOutputBroker";
+        }
+        else {
+            brokerName = "MemoryMapAsyncOutputBroker";
+        }
     }
     return brokerName;
 }
@@ -331,17 +398,27 @@ bool EPICSCAOutput::GetInputBrokers(ReferenceContainer& inputBrokers, const char
 }
 
 bool EPICSCAOutput::GetOutputBrokers(ReferenceContainer& outputBrokers, const char8* const functionName, void* const gamMemPtr) {
-    broker = ReferenceT<MemoryMapAsyncOutputBroker>("MemoryMapAsyncOutputBroker");
-    bool ok = broker->InitWithBufferParameters(OutputSignals, *this, functionName, gamMemPtr, numberOfBuffers, cpuMask, stackSize);
-    if (ok) {
-        ok = outputBrokers.Insert(broker);
-        broker->SetIgnoreBufferOverrun(ignoreBufferOverrun == 1u);
+    bool ok;
+    if (useRing) {
+        ReferenceT<MemoryMapSynchronisedOutputBroker> ringBroker("MemoryMapSynchronisedOutputBroker");
+        ok = ringBroker->Init(OutputSignals, *this, functionName, gamMemPtr);
+        if (ok) {
+            ok = outputBrokers.Insert(ringBroker);
+        }
+    }
+    else {
+        broker = ReferenceT<MemoryMapAsyncOutputBroker>("MemoryMapAsyncOutputBroker");
+        ok = broker->InitWithBufferParameters(OutputSignals, *this, functionName, gamMemPtr, numberOfBuffers, cpuMask, stackSize);
+        if (ok) {
+            ok = outputBrokers.Insert(broker);
+            broker->SetIgnoreBufferOverrun(ignoreBufferOverrun == 1u);
+        }
     }
 
     return ok;
 }
 
-/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: NOOP at StateChange, independently of the function parameters.*/
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the currentStateName is not needed.*/
 bool EPICSCAOutput::PrepareNextState(const char8* const currentStateName, const char8* const nextStateName) {
     for (uint32 i = 0u; (i < numberOfSignals); i++) {
         uint32 numberOfProducers = 0u;
@@ -353,7 +430,19 @@ bool EPICSCAOutput::PrepareNextState(const char8* const currentStateName, const
             signalFlag[i] = 1u;
         }
     }
-    return true;
+    bool ok = true;
+    if (useRing) {
+        if (executor.GetStatus() == EmbeddedThreadI::OffState) {
+            executor.SetCPUMask(cpuMask);
+            executor.SetStackSize(stackSize);
+            executor.SetName(GetName());
+            ok = (executor.Start() == ErrorManagement::NoError);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the publication thread.");
+            }
+        }
+    }
+    return ok;
 }
 
 uint32 EPICSCAOutput::GetStackSize() const {
@@ -369,6 +458,74 @@ uint32 EPICSCAOutput::GetNumberOfBuffers() const {
 }
 
 bool EPICSCAOutput::Synchronise() {
+    bool ok = true;
+    if (ring.IsInitialised()) {
+        //Only copy the signals to the next free element of the ring
+        char8 *slot = ring.GetWriteSlot();
+        if (slot != NULL_PTR(char8 *)) {
+            ok = MemoryOperationsHelper::Copy(slot, ringInputMemory, ring.GetSampleSize());
+            ring.Commit();
+        }
+        else {
+            overruns++;
+            ok = (ignoreBufferOverrun == 1u);
+        }
+    }
+    else {
+        ok = Publish();
+    }
+    return ok;
+}
+
+uint32 EPICSCAOutput::ConsumeRing() {
+    uint32 consumed = 0u;
+    if ((ring.IsInitialised()) && (pvs != NULL_PTR(PVWrapper *))) {
+        consumed = ring.GetNumberOfSamples();
+        if (consumed > 0u) {
+            //Coalesce to the latest sample
+            const char8 *slot = ring.GetReadSlot(consumed - 1u);
+            uint32 nOfSignals = GetNumberOfSignals();
+            uint32 n;
+            for (n = 0u; n < nOfSignals; n++) {
+                /*lint -e{613} ringOffsets is allocated together with the ring. slot cannot be NULL as consumed > 0.*/
+                (void) MemoryOperationsHelper::Copy(pvs[n].memory, &slot[ringOffsets[n]], pvs[n].memorySize);
+            }
+            //Only now can Synchronise reuse the elements
+            ring.Release(consumed);
+            coalescedUpdates += (consumed - 1u);
+            if (!Publish()) {
+                REPORT_ERROR(ErrorManagement::Warning, "Failed to publish the latest sample");
+            }
+        }
+    }
+    return consumed;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the ring is consumed irrespectively of the execution stage.*/
+ErrorManagement::ErrorType EPICSCAOutput::Execute(ExecutionInfo &info) {
+    if (ConsumeRing() == 0u) {
+        Sleep::MSec(publicationPeriod);
+    }
+    return ErrorManagement::NoError;
+}
+
+bool EPICSCAOutput::IsRing() const {
+    return useRing;
+}
+
+uint32 EPICSCAOutput::GetPublicationPeriod() const {
+    return publicationPeriod;
+}
+
+uint32 EPICSCAOutput::GetNumberOfOverruns() const {
+    return overruns;
+}
+
+uint32 EPICSCAOutput::GetNumberOfCoalescedUpdates() const {
+    return coalescedUpdates;
+}
+
+bool EPICSCAOutput::Publish() {
     bool ok = true;
     uint32 n;
     uint32 nOfSignals = GetNumberOfSignals();
@@ -40,6 +40,7 @@
 #include "FastPollingMutexSem.h"
 #include "MemoryMapAsyncOutputBroker.h"
 #include "MessageI.h"
+#include "SampleRing.h"
 #include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
@@ -62,6 +63,8 @@ namespace MARTe {
  *     IgnoreBufferOverrun = 1 //Optional. If true no error will be triggered when the thread that writes into EPICS does not consume the data fast enough.
  *     NumberOfBuffers = 10 //Compulsory. Number of buffers in a circular buffer that asynchronously writes the PV values. Each buffer is capable of holding a copy of all the DataSourceI signals.
  *     DBR64CastDouble = "yes" //Optional, default=yes. DBR does not support 64 bit integers. If a 64 bit signal is added and DBR64CastDouble is set to "yes", the uint64/int64 signals will be cast to DBR_DOUBLE.
+ *     Ring = 1 //Optional, default=0. If 1 the real-time thread copies the signals to a lock-free ring of NumberOfBuffers elements (see below).
+ *     PublicationPeriod = 1 //Optional, default=1. Only used if Ring = 1. Time in ms that the publication thread sleeps when the ring is empty.
  *     Signals = {
  *          PV1 = { //At least one shall be defined
  *             PVName = My::PV1 //Compulsory. Name of the PV.
@@ -72,8 +75,13 @@ namespace MARTe {
  * }
  *
  * </pre>
+ *
+ * If Ring = 1 the signals are written by a MemoryMapSynchronisedOutputBroker and Synchronise (i.e. the real-time thread) only copies them
+ *  to a single-producer/single-consumer ring, without taking any lock. A publication thread (with the CPUs and StackSize above)
+ *  drains the ring in batches: if more than one sample is waiting, only the latest one is ca_put and the others are counted as coalesced updates.
+ *  If the ring is full the sample is dropped and counted as an overrun (Synchronise returns false if IgnoreBufferOverrun = 0).
  */
-class EPICSCAOutput: public DataSourceI, public MessageI {
+class EPICSCAOutput: public DataSourceI, public MessageI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -84,7 +92,7 @@ public:
 
     /**
      * @brief Destructor.
-     * @details Calls the ca_clear_channel method on the pvs, calls Free on the pvs and delete on the signalFlag.
+     * @details Stops the publication thread, calls the ca_clear_channel method on the pvs, calls Free on the pvs and delete on the signalFlag.
      */
     virtual ~EPICSCAOutput();
 
@@ -102,6 +110,7 @@ public:
 
     /**
      * @brief See DataSourceI::GetSignalMemoryBuffer.
+     * @details If Ring = 1 returns the address of the signal in the memory that is copied to the ring.
      * @pre
      *   SetConfiguredDatabase
      */
@@ -112,7 +121,7 @@ public:
     /**
      * @brief See DataSourceI::GetNumberOfMemoryBuffers.
      * @details Only OutputSignals are supported.
-     * @return MemoryMapAsyncOutputBroker.
+     * @return MemoryMapSynchronisedOutputBroker if Ring = 1, MemoryMapAsyncOutputBroker otherwise.
      */
     virtual const char8 *GetBrokerName(StructuredDataI &data,
             const SignalDirection direction);
@@ -135,8 +144,9 @@ public:
             void * const gamMemPtr);
 
     /**
-     * @brief See DataSourceI::PrepareNextState. NOOP.
-     * @return true.
+     * @brief See DataSourceI::PrepareNextState.
+     * @details Flags the signals that have producers in the next state and, if Ring = 1, starts the publication thread.
+     * @return true if the publication thread could be started.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
             const char8 * const nextStateName);
@@ -181,10 +191,49 @@ public:
      * @details Executes in the context of the MemoryMapAsyncOutputBroker thread the following EPICS calls:
      * ca_context_create, ca_create_channel, ca_create_subscription, ca_clear_subscription,
      * ca_clear_event, ca_clear_channel, ca_detach_context and ca_context_destroy
-     * @return true if all the EPICS calls return without any error.
+     * If Ring = 1 it is called by the real-time thread and only copies the signals to the next free element of the ring.
+     * @return true if all the EPICS calls return without any error (or if the signals could be copied to the ring or IgnoreBufferOverrun = 1).
      */
     virtual bool Synchronise();
 
+    /**
+     * @brief Publishes the latest sample available in the ring.
+     * @details Shall be called by a single thread (the publication thread). All the samples older than the latest one are discarded
+     *  and counted as coalesced updates.
+     * @return the number of samples removed from the ring.
+     */
+    uint32 ConsumeRing();
+
+    /**
+     * @brief Callback of the publication thread. Calls ConsumeRing and sleeps PublicationPeriod ms if the ring was empty.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Returns true if Ring = 1.
+     * @return true if Ring = 1.
+     */
+    bool IsRing() const;
+
+    /**
+     * @brief Gets the time in ms that the publication thread sleeps when the ring is empty.
+     * @return the time in ms that the publication thread sleeps when the ring is empty.
+     */
+    uint32 GetPublicationPeriod() const;
+
+    /**
+     * @brief Gets the number of samples which were dropped because the ring was full.
+     * @return the number of samples which were dropped because the ring was full.
+     */
+    uint32 GetNumberOfOverruns() const;
+
+    /**
+     * @brief Gets the number of samples which were not published because a newer sample was already in the ring.
+     * @return the number of samples which were not published because a newer sample was already in the ring.
+     */
+    uint32 GetNumberOfCoalescedUpdates() const;
+
     /**
      * @brief Gets if buffer overruns is being ignored (i.e. the consumer thread which writes into EPICS is not consuming the data fast enough).
      * @return if true no error is to be triggered when there is a buffer overrun.
@@ -205,6 +254,12 @@ public:
     virtual void Purge(ReferenceContainer &purgeList);
 
 private:
+    /**
+     * @brief ca_put of all the flagged signals (creating the EPICS context the first time it is called).
+     * @return true if all the EPICS calls return without any error.
+     */
+    bool Publish();
+
     /**
      * List of PVs.
      */
@@ -254,6 +309,46 @@ private:
      * Allow to cast to uint64/int64 to double?
      */
     bool dbr64CastDouble;
+
+    /**
+     * True if Ring = 1.
+     */
+    bool useRing;
+
+    /**
+     * Time in ms that the publication thread sleeps when the ring is empty.
+     */
+    uint32 publicationPeriod;
+
+    /**
+     * The publication thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * Memory written by the broker (all the signals) and copied to the ring by Synchronise.
+     */
+    char8 *ringInputMemory;
+
+    /**
+     * Offset of each signal in the ringInputMemory (and in each element of the ring).
+     */
+    uint32 *ringOffsets;
+
+    /**
+     * The ring (each element holds all the signals).
+     */
+    SampleRing ring;
+
+    /**
+     * Number of samples dropped because the ring was full. Only modified by Synchronise.
+     */
+    volatile uint32 overruns;
+
+    /**
+     * Number of samples discarded because a newer one was available. Only modified by ConsumeRing.
+     */
+    volatile uint32 coalescedUpdates;
 };
 }
 
@@ -27,6 +27,9 @@
 /*lint -efile(766,EPICSPVAOutput.cpp) MemoryMapAsyncOutputBroker.h is used in this file.*/
 #include "AdvancedErrorManagement.h"
 #include "EPICSPVAOutput.h"
+#include "MemoryMapSynchronisedOutputBroker.h"
+#include "MemoryOperationsHelper.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -36,19 +39,33 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 EPICSPVAOutput::EPICSPVAOutput() :
-        MemoryDataSourceI() {
+        MemoryDataSourceI(), EmbeddedServiceMethodBinderI(), executor(*this) {
     stackSize = THREADS_DEFAULT_STACKSIZE * 4u;
     cpuMask = 0xffu;
     numberOfBrokerBuffers = 0u;
     numberOfChannels = 0u;
     ignoreBufferOverrun = 1u;
     channelList = NULL_PTR(EPICSPVAChannelWrapper*);
+    useRing = false;
+    publicationPeriod = 1u;
+    ringInputMemory = NULL_PTR(uint8 *);
+    overruns = 0u;
+    coalescedUpdates = 0u;
 }
 
+/*lint -e{1551} the destructor must guarantee that the publication thread is stopped.*/
 EPICSPVAOutput::~EPICSPVAOutput() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
     if (channelList != NULL_PTR(EPICSPVAChannelWrapper*)) {
         delete[] channelList;
     }
+    if (ringInputMemory != NULL_PTR(uint8 *)) {
+        delete[] ringInputMemory;
+    }
 }
 
 bool EPICSPVAOutput::Initialise(StructuredDataI &data) {
@@ -71,6 +88,27 @@ bool EPICSPVAOutput::Initialise(StructuredDataI &data) {
         }
 
     }
+    if (ok) {
+        uint8 ringU = 0u;
+        if (data.Read("Ring", ringU)) {
+            ok = (ringU < 2u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Ring shall be 0 or 1");
+            }
+        }
+        useRing = (ringU == 1u);
+    }
+    if ((ok) && (useRing)) {
+        ok = (numberOfBrokerBuffers > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfBuffers shall be > 0");
+        }
+        if (ok) {
+            if (!data.Read("PublicationPeriod", publicationPeriod)) {
+                REPORT_ERROR(ErrorManagement::Information, "No PublicationPeriod defined. Using default = %d", publicationPeriod);
+            }
+        }
+    }
     if (ok) {
         ok = data.MoveRelative("Signals");
         if (!ok) {
@@ -164,10 +202,35 @@ bool EPICSPVAOutput::AllocateMemory() {
     for (n = 0u; (n < numberOfChannels) && (ok); n++) {
         ok = channelList[n].Setup(*this);
     }
+    //Only after the Setup, so that the channels are bound to the MemoryDataSourceI memory
+    if ((ok) && (useRing)) {
+        ringInputMemory = new uint8[totalMemorySize];
+        ok = MemoryOperationsHelper::Set(ringInputMemory, '\0', totalMemorySize);
+        if (ok) {
+            ok = ring.Initialise(numberOfBrokerBuffers, totalMemorySize);
+        }
+    }
 
     return ok;
 }
 
+bool EPICSPVAOutput::GetSignalMemoryBuffer(const uint32 signalIdx,
+                                           const uint32 bufferIdx,
+                                           void *&signalAddress) {
+    bool ok;
+    if (ringInputMemory != NULL_PTR(uint8 *)) {
+        ok = (signalIdx < GetNumberOfSignals());
+        if (ok) {
+            /*lint -e{613} signalOffsets is allocated by MemoryDataSourceI::AllocateMemory*/
+            signalAddress = &ringInputMemory[signalOffsets[signalIdx]];
+        }
+    }
+    else {
+        ok = MemoryDataSourceI::GetSignalMemoryBuffer(signalIdx, bufferIdx, signalAddress);
+    }
+    return ok;
+}
+
 uint32 EPICSPVAOutput::GetNumberOfMemoryBuffers() {
     return 1u;
 }
@@ -177,7 +240,12 @@ const char8* EPICSPVAOutput::GetBrokerName(StructuredDataI &data,
                                            const SignalDirection direction) {
     const char8 *brokerName = "";
     if (direction == OutputSignals) {
-        brokerName = "MemoryMapAsyncOutputBroker";
+        if (useRing) {
+            brokerName = "MemoryMapSynchronisedOutputBroker";
+        }
+        else {
+            brokerName = "MemoryMapAsyncOutputBroker";
+        }
     }
     return brokerName;
 }
@@ -185,20 +253,42 @@ const char8* EPICSPVAOutput::GetBrokerName(StructuredDataI &data,
 bool EPICSPVAOutput::GetOutputBrokers(ReferenceContainer &outputBrokers,
                                       const char8 *const functionName,
                                       void *const gamMemPtr) {
-    broker = ReferenceT<MemoryMapAsyncOutputBroker>("MemoryMapAsyncOutputBroker");
-    bool ok = broker->InitWithBufferParameters(OutputSignals, *this, functionName, gamMemPtr, numberOfBrokerBuffers, cpuMask, stackSize);
-    if (ok) {
-        ok = outputBrokers.Insert(broker);
-        broker->SetIgnoreBufferOverrun(ignoreBufferOverrun == 1u);
+    bool ok;
+    if (useRing) {
+        ReferenceT<MemoryMapSynchronisedOutputBroker> ringBroker("MemoryMapSynchronisedOutputBroker");
+        ok = ringBroker->Init(OutputSignals, *this, functionName, gamMemPtr);
+        if (ok) {
+            ok = outputBrokers.Insert(ringBroker);
+        }
+    }
+    else {
+        broker = ReferenceT<MemoryMapAsyncOutputBroker>("MemoryMapAsyncOutputBroker");
+        ok = broker->InitWithBufferParameters(OutputSignals, *this, functionName, gamMemPtr, numberOfBrokerBuffers, cpuMask, stackSize);
+        if (ok) {
+            ok = outputBrokers.Insert(broker);
+            broker->SetIgnoreBufferOverrun(ignoreBufferOverrun == 1u);
+        }
     }
 
     return ok;
 }
 
-/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: NOOP at StateChange, independently of the function parameters.*/
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the publication thread is started independently of the function parameters.*/
 bool EPICSPVAOutput::PrepareNextState(const char8 *const currentStateName,
                                       const char8 *const nextStateName) {
-    return true;
+    bool ok = true;
+    if (useRing) {
+        if (executor.GetStatus() == EmbeddedThreadI::OffState) {
+            executor.SetCPUMask(cpuMask);
+            executor.SetStackSize(stackSize);
+            executor.SetName(GetName());
+            ok = (executor.Start() == ErrorManagement::NoError);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the publication thread.");
+            }
+        }
+    }
+    return ok;
 }
 
 uint32 EPICSPVAOutput::GetStackSize() const {
@@ -211,13 +301,74 @@ uint32 EPICSPVAOutput::GetCPUMask() const {
 
 bool EPICSPVAOutput::Synchronise() {
     bool ok = true;
-    uint32 n;
-    for (n = 0u; (n < numberOfChannels) && (ok); n++) {
-        ok = channelList[n].Put();
+    if (ring.IsInitialised()) {
+        //Only copy the signals to the next free element of the ring
+        char8 *slot = ring.GetWriteSlot();
+        if (slot != NULL_PTR(char8 *)) {
+            ok = MemoryOperationsHelper::Copy(slot, ringInputMemory, totalMemorySize);
+            ring.Commit();
+        }
+        else {
+            overruns++;
+            ok = (ignoreBufferOverrun == 1u);
+        }
+    }
+    else {
+        uint32 n;
+        for (n = 0u; (n < numberOfChannels) && (ok); n++) {
+            ok = channelList[n].Put();
+        }
     }
     return ok;
 }
 
+uint32 EPICSPVAOutput::ConsumeRing() {
+    uint32 consumed = 0u;
+    if (ring.IsInitialised()) {
+        consumed = ring.GetNumberOfSamples();
+        if (consumed > 0u) {
+            //Coalesce to the latest sample
+            (void) MemoryOperationsHelper::Copy(memory, ring.GetReadSlot(consumed - 1u), totalMemorySize);
+            //Only now can Synchronise reuse the elements
+            ring.Release(consumed);
+            coalescedUpdates += (consumed - 1u);
+            bool ok = true;
+            uint32 n;
+            for (n = 0u; (n < numberOfChannels) && (ok); n++) {
+                ok = channelList[n].Put();
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::Warning, "Failed to publish the latest sample");
+            }
+        }
+    }
+    return consumed;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the ring is consumed irrespectively of the execution stage.*/
+ErrorManagement::ErrorType EPICSPVAOutput::Execute(ExecutionInfo &info) {
+    if (ConsumeRing() == 0u) {
+        Sleep::MSec(publicationPeriod);
+    }
+    return ErrorManagement::NoError;
+}
+
+bool EPICSPVAOutput::IsRing() const {
+    return useRing;
+}
+
+uint32 EPICSPVAOutput::GetPublicationPeriod() const {
+    return publicationPeriod;
+}
+
+uint32 EPICSPVAOutput::GetNumberOfOverruns() const {
+    return overruns;
+}
+
+uint32 EPICSPVAOutput::GetNumberOfCoalescedUpdates() const {
+    return coalescedUpdates;
+}
+
 bool EPICSPVAOutput::IsIgnoringBufferOverrun() const {
     return (ignoreBufferOverrun == 1u);
 }
@@ -36,6 +36,7 @@
 #include "EventSem.h"
 #include "MemoryDataSourceI.h"
 #include "MemoryMapAsyncOutputBroker.h"
+#include "SampleRing.h"
 #include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
@@ -58,6 +59,8 @@ namespace MARTe {
  *     CPUs = 0xff //Optional the affinity of the EmbeddedThread which actually performs the PVA puts.
  *     IgnoreBufferOverrun = 1 //Optional. If true no error will be triggered when the thread that writes into EPICS does not consume the data fast enough.
  *     NumberOfBuffers = 10 //Compulsory. Number of buffers in a circular buffer that asynchronously writes the values. Each buffer is capable of holding a copy of all the DataSourceI signals.
+ *     Ring = 1 //Optional, default=0. If 1 the real-time thread copies the signals to a lock-free ring of NumberOfBuffers elements (see below).
+ *     PublicationPeriod = 1 //Optional, default=1. Only used if Ring = 1. Time in ms that the publication thread sleeps when the ring is empty.
  *     Signals = {
  *         RecordOut1Value = {//Record name if the Alias field is not set
  *             Alias = "alternative::channel::name"
@@ -78,8 +81,13 @@ namespace MARTe {
  * }
  *
  * </pre>
+ *
+ * If Ring = 1 the signals are written by a MemoryMapSynchronisedOutputBroker and Synchronise (i.e. the real-time thread) only copies them
+ *  to a single-producer/single-consumer ring, without taking any lock. A publication thread (with the CPUs and StackSize above)
+ *  drains the ring in batches: if more than one sample is waiting, only the latest one is put and the others are counted as coalesced updates.
+ *  If the ring is full the sample is dropped and counted as an overrun (Synchronise returns false if IgnoreBufferOverrun = 0).
  */
-class EPICSPVAOutput: public MemoryDataSourceI {
+class EPICSPVAOutput: public MemoryDataSourceI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -90,7 +98,7 @@ EPICSPVAOutput    ();
 
     /**
      * @brief Destructor.
-     * @details Frees the allocated memory.
+     * @details Stops the publication thread and frees the allocated memory.
      */
     virtual ~EPICSPVAOutput();
 
@@ -103,14 +111,15 @@ EPICSPVAOutput    ();
     /**
      * @brief See DataSourceI::GetNumberOfMemoryBuffers.
      * @details Only OutputSignals are supported.
-     * @return MemoryMapAsyncOutputBroker.
+     * @return MemoryMapSynchronisedOutputBroker if Ring = 1, MemoryMapAsyncOutputBroker otherwise.
      */
     virtual const char8 *GetBrokerName(StructuredDataI &data,
             const SignalDirection direction);
 
     /**
-     * @brief See DataSourceI::PrepareNextState. NOOP.
-     * @return true.
+     * @brief See DataSourceI::PrepareNextState.
+     * @details If Ring = 1 starts the publication thread.
+     * @return true if the publication thread could be started.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
             const char8 * const nextStateName);
@@ -146,17 +155,65 @@ EPICSPVAOutput    ();
 
     /**
      * @brief Calls EPICSPVAChannelWrapper::Setup and start the threading service.
-     * @details see MemoryDataSourceI::AllocateMemory
+     * @details see MemoryDataSourceI::AllocateMemory. If Ring = 1 also allocates the ring.
      * @return true if the EPICSPVAChannelWrapper::Setup was successful and the service started.
      */
     virtual bool AllocateMemory();
 
+    /**
+     * @brief See MemoryDataSourceI::GetSignalMemoryBuffer.
+     * @details If Ring = 1 (and after AllocateMemory) returns the address of the signal in the memory that is copied to the ring.
+     *  The channels are always bound to the MemoryDataSourceI memory.
+     */
+    virtual bool GetSignalMemoryBuffer(const uint32 signalIdx,
+            const uint32 bufferIdx,
+            void *&signalAddress);
+
     /**
      * @brief Provides the context to execute all the EPICS calls.
-     * @return true if all the all the variables can be successfully set and exec.
+     * @details If Ring = 1 it is called by the real-time thread and only copies the signals to the next free element of the ring.
+     * @return true if all the all the variables can be successfully set and exec (or if the signals could be copied to the ring or IgnoreBufferOverrun = 1).
      */
     virtual bool Synchronise();
 
+    /**
+     * @brief Publishes the latest sample available in the ring.
+     * @details Shall be called by a single thread (the publication thread). All the samples older than the latest one are discarded
+     *  and counted as coalesced updates.
+     * @return the number of samples removed from the ring.
+     */
+    uint32 ConsumeRing();
+
+    /**
+     * @brief Callback of the publication thread. Calls ConsumeRing and sleeps PublicationPeriod ms if the ring was empty.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Returns true if Ring = 1.
+     * @return true if Ring = 1.
+     */
+    bool IsRing() const;
+
+    /**
+     * @brief Gets the time in ms that the publication thread sleeps when the ring is empty.
+     * @return the time in ms that the publication thread sleeps when the ring is empty.
+     */
+    uint32 GetPublicationPeriod() const;
+
+    /**
+     * @brief Gets the number of samples which were dropped because the ring was full.
+     * @return the number of samples which were dropped because the ring was full.
+     */
+    uint32 GetNumberOfOverruns() const;
+
+    /**
+     * @brief Gets the number of samples which were not published because a newer sample was already in the ring.
+     * @return the number of samples which were not published because a newer sample was already in the ring.
+     */
+    uint32 GetNumberOfCoalescedUpdates() const;
+
     /**
      * @brief See DataSourceI::GetOutputBrokers.
      * @details adds a memory MemoryMapOutputBroker instance to the outputBrokers
@@ -213,6 +270,41 @@ private:
      * The broker.
      */
     ReferenceT<MemoryMapAsyncOutputBroker> broker;
+
+    /**
+     * True if Ring = 1.
+     */
+    bool useRing;
+
+    /**
+     * Time in ms that the publication thread sleeps when the ring is empty.
+     */
+    uint32 publicationPeriod;
+
+    /**
+     * The publication thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * Memory written by the broker (totalMemorySize bytes) and copied to the ring by Synchronise.
+     */
+    uint8 *ringInputMemory;
+
+    /**
+     * The ring (each element holds all the signals).
+     */
+    SampleRing ring;
+
+    /**
+     * Number of samples dropped because the ring was full. Only modified by Synchronise.
+     */
+    volatile uint32 overruns;
+
+    /**
+     * Number of samples discarded because a newer one was available. Only modified by ConsumeRing.
+     */
+    volatile uint32 coalescedUpdates;
 };
 }
 
@@ -24,6 +24,11 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -33,6 +38,7 @@
 #include "Directory.h"
 #include "FileReader.h"
 #include "MemoryMapSynchronisedInputBroker.h"
+#include "Sleep.h"
 #include "TypeConversion.h"
 
 /*---------------------------------------------------------------------------*/
@@ -48,7 +54,9 @@ static const int32 FILE_FORMAT_CSV = 2;
 
 FileReader::FileReader() :
         DataSourceI(),
-        MessageI() {
+        MessageI(),
+        EmbeddedServiceMethodBinderT<FileReader>(*this, &FileReader::PrefetchThreadCallback),
+        prefetchService(*this) {
     dataSourceMemory = NULL_PTR(char8*);
     offsets = NULL_PTR(uint32*);
     numberOfBinaryBytes = 0u;
@@ -74,10 +82,48 @@ FileReader::FileReader() :
     allData.interalBufferIdx = 0u;
     allData.internalBuffer = NULL_PTR(char8*);
     allData.maxDataFileByteSize = 0u;
+    memoryMap = false;
+    mappedFile = NULL_PTR(void*);
+    mappedFileByteSize = 0u;
+    dataOffset = 0u;
+    pageSize = 4096u;
+    prefetchByteSize = 0u;
+    prefetchedIdx = 0u;
+    startSample = 0u;
+    hasStartTime = false;
+    startTime = 0u;
+    startFilePosition = 0u;
+    startBufferIdx = 0u;
+    binaryCache = false;
+    binaryCacheValid = false;
+    interpolationMode = InterpolationBroker;
+    interpolationLanes = NULL_PTR(FileReaderInterpolationLane*);
+    interpolationGroups = NULL_PTR(FileReaderInterpolationGroup*);
+    numberOfInterpolationGroups = 0u;
+    interpolationCoefficients = NULL_PTR(float64*);
+    numberOfCoefficientElements = 0u;
+    windowMemory = NULL_PTR(char8*);
+    uint32 slot;
+    for (slot = 0u; slot < 4u; slot++) {
+        window[slot] = NULL_PTR(char8*);
+        windowX[slot] = 0u;
+    }
+    lastWindowSlot = 2u;
+    windowInverseLength = 0.0;
+    interpolatedX = 0u;
+    windowPrimed = false;
+    windowAtEnd = false;
+    rewindSample = NULL_PTR(char8*);
+    rewindPending = false;
 }
 
 /*lint -e{1551} -e{1579} the destructor must guarantee that the memory is freed and the file is flushed and closed.. The brokerAsyncTrigger is freed by the ReferenceT */
 FileReader::~FileReader() {
+    if (prefetchService.Stop() != ErrorManagement::NoError) {
+        if (prefetchService.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the prefetch thread");
+        }
+    }
     if (dataSourceMemory != NULL_PTR(char8*)) {
         GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(dataSourceMemory));
     }
@@ -87,7 +133,22 @@ FileReader::~FileReader() {
     if (signalsAnyType != NULL_PTR(AnyType*)) {
         delete[] signalsAnyType;
     }
-    if (allData.internalBuffer != NULL_PTR(char8*)) {
+    if (interpolationLanes != NULL_PTR(FileReaderInterpolationLane*)) {
+        delete[] interpolationLanes;
+    }
+    if (interpolationGroups != NULL_PTR(FileReaderInterpolationGroup*)) {
+        delete[] interpolationGroups;
+    }
+    if (interpolationCoefficients != NULL_PTR(float64*)) {
+        delete[] interpolationCoefficients;
+    }
+    if (windowMemory != NULL_PTR(char8*)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(windowMemory));
+    }
+    if (mappedFile != NULL_PTR(void*)) {
+        (void) munmap(mappedFile, static_cast<size_t>(mappedFileByteSize));
+    }
+    else if (allData.internalBuffer != NULL_PTR(char8*)) {
         GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(allData.internalBuffer));
     }
     (void) CloseFile();
@@ -119,7 +180,7 @@ const char8* FileReader::GetBrokerName(StructuredDataI &data,
                                        const SignalDirection direction) {
     const char8 *brokerName = "";
     if (direction == InputSignals) {
-        if (interpolate) {
+        if ((interpolate) && (interpolationMode == InterpolationBroker)) {
             brokerName = "MemoryMapInterpolatedInputBroker";
         }
         else {
@@ -133,7 +194,7 @@ bool FileReader::GetInputBrokers(ReferenceContainer &inputBrokers,
                                  const char8 *const functionName,
                                  void *const gamMemPtr) {
     bool ok = true;
-    if (interpolate) {
+    if ((interpolate) && (interpolationMode == InterpolationBroker)) {
         ReferenceT<MemoryMapInterpolatedInputBroker> brokerNew("MemoryMapInterpolatedInputBroker");
         interpolatedInputBroker = brokerNew.operator ->();
         ok = interpolatedInputBroker->Init(InputSignals, *this, functionName, gamMemPtr);
@@ -208,27 +269,111 @@ void FileReader::ConvertXAxisSignal() {
     }
 }
 
-bool FileReader::Synchronise() {
-    bool ok = !fatalFileError;
-    bool resetInterpolation = false;
-    if (ok) {
-        bool lockAtLast = false;
-        if (preload) {
-            if (allData.interalBufferIdx == allData.dataFileByteSize) {
-                if (eofBehaviour == EOFRewind) { //move to the beginning
-                    allData.interalBufferIdx = 0u;
-                    resetInterpolation = true;
-                }
-                else if (eofBehaviour == EOFLast) {
-                    lockAtLast = true;
+/*lint -e{613} xAxisSignalPtr cannot be NULL as otherwise SetConfiguredDatabase would have failed.*/
+void FileReader::WriteXAxisSignal(const uint64 value) {
+    if (xAxisSignalType == UnsignedInteger8Bit) {
+        *reinterpret_cast<uint8*>(xAxisSignalPtr) = static_cast<uint8>(value);
+    }
+    else if (xAxisSignalType == SignedInteger8Bit) {
+        *reinterpret_cast<int8*>(xAxisSignalPtr) = static_cast<int8>(value);
+    }
+    else if (xAxisSignalType == UnsignedInteger16Bit) {
+        *reinterpret_cast<uint16*>(xAxisSignalPtr) = static_cast<uint16>(value);
+    }
+    else if (xAxisSignalType == SignedInteger16Bit) {
+        *reinterpret_cast<int16*>(xAxisSignalPtr) = static_cast<int16>(value);
+    }
+    else if (xAxisSignalType == UnsignedInteger32Bit) {
+        *reinterpret_cast<uint32*>(xAxisSignalPtr) = static_cast<uint32>(value);
+    }
+    else if (xAxisSignalType == SignedInteger32Bit) {
+        *reinterpret_cast<int32*>(xAxisSignalPtr) = static_cast<int32>(value);
+    }
+    else if (xAxisSignalType == UnsignedInteger64Bit) {
+        *reinterpret_cast<uint64*>(xAxisSignalPtr) = value;
+    }
+    else if (xAxisSignalType == SignedInteger64Bit) {
+        *reinterpret_cast<int64*>(xAxisSignalPtr) = static_cast<int64>(value);
+    }
+    else if (xAxisSignalType == Float32Bit) {
+        *reinterpret_cast<float32*>(xAxisSignalPtr) = static_cast<float32>(value);
+    }
+    else if (xAxisSignalType == Float64Bit) {
+        *reinterpret_cast<float64*>(xAxisSignalPtr) = static_cast<float64>(value);
+    }
+    else {
+        //Unreachable...
+    }
+}
+
+bool FileReader::ReadNextFileSample(bool &rewound,
+                                    bool &newSample) {
+    bool ok = true;
+    bool lockAtLast = false;
+    rewound = false;
+    if (preload || memoryMap) {
+        if (allData.interalBufferIdx == allData.dataFileByteSize) {
+            if (eofBehaviour == EOFRewind) { //move to the start sample
+                allData.interalBufferIdx = startBufferIdx;
+                rewound = true;
+            }
+            else if (eofBehaviour == EOFLast) {
+                lockAtLast = true;
+            }
+            else { //End of data && eofBehaviour = EOFError
+                fatalFileError = true;
+                ok = false;
+            }
+        }
+        if (fatalFileError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "End of data. No more attempts will be performed.");
+            if (fileRuntimeErrorMsg.IsValid()) {
+                //Reset any previous replies
+                fileRuntimeErrorMsg->SetAsReply(false);
+                if (!MessageI::SendMessage(fileRuntimeErrorMsg, this)) {
+                    StreamString destination = fileRuntimeErrorMsg->GetDestination();
+                    StreamString function = fileRuntimeErrorMsg->GetFunction();
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not send TreeRuntimeError message to %s [%s]", destination.Buffer(),
+                                 function.Buffer());
                 }
-                else { //End of data && eofBehaviour = EOFError
-                    fatalFileError = true;
-                    ok = false;
+            }
+        }
+        else {
+            if (!lockAtLast) {
+                ok = MemoryOperationsHelper::Copy(dataSourceMemory, &(allData.internalBuffer[allData.interalBufferIdx]), numberOfBinaryBytes);
+                allData.interalBufferIdx = allData.interalBufferIdx + numberOfBinaryBytes;
+
+            }
+        }
+    }
+    else {
+        if (inputFile.Position() == inputFile.Size()) {
+            if (eofBehaviour == EOFRewind) {
+                //The start position is already after the header
+                ok = inputFile.Seek(startFilePosition);
+                rewound = true;
+            }
+            else if (eofBehaviour == EOFLast) {
+                lockAtLast = true;
+            }
+            else {
+                //Unreachable by design.
+            }
+        }
+        if (!lockAtLast) {
+            if (fileFormat == FILE_FORMAT_BINARY) {
+                uint32 readSize = numberOfBinaryBytes;
+                ok = inputFile.Read(dataSourceMemory, readSize);
+                if (ok) {
+                    ok = (readSize == numberOfBinaryBytes);
                 }
             }
+            else {
+                ok = ReadLineCSVFormat();
+            }
+            fatalFileError = !ok;
             if (fatalFileError) {
-                REPORT_ERROR(ErrorManagement::FatalError, "End of data. No more attempts will be performed.");
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to read from file. No more attempts will be performed.");
                 if (fileRuntimeErrorMsg.IsValid()) {
                     //Reset any previous replies
                     fileRuntimeErrorMsg->SetAsReply(false);
@@ -240,88 +385,362 @@ bool FileReader::Synchronise() {
                     }
                 }
             }
-            else {
-                if (!lockAtLast) {
-                    ok = MemoryOperationsHelper::Copy(dataSourceMemory, &(allData.internalBuffer[allData.interalBufferIdx]), numberOfBinaryBytes);
-                    allData.interalBufferIdx = allData.interalBufferIdx + numberOfBinaryBytes;
+        }
+    }
+    newSample = ((ok) && (!lockAtLast));
+    return ok;
+}
 
+bool FileReader::Synchronise() {
+    bool ok = !fatalFileError;
+    if (ok) {
+        if (interpolationMode == InterpolationBroker) {
+            bool rewound = false;
+            bool newSample = false;
+            ok = ReadNextFileSample(rewound, newSample);
+            if (ok) {
+                if (interpolate) {
+                    ConvertXAxisSignal();
+                    if (rewound) {
+                        interpolatedInputBroker->Reset();
+                    }
                 }
             }
         }
         else {
-            if (inputFile.Position() == inputFile.Size()) {
-                if (eofBehaviour == EOFRewind) {
-                    if (fileFormat == FILE_FORMAT_BINARY) {
-                        const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
-                        uint32 headerSize = static_cast<uint32>(sizeof(uint16));
-                        headerSize += SIGNAL_NAME_MAX_SIZE;
-                        headerSize += static_cast<uint32>(sizeof(uint32));
-                        headerSize *= GetNumberOfSignals();
-                        headerSize += static_cast<uint32>(sizeof(uint32));
-                        ok = inputFile.Seek(0LLU);
-                        if (ok) {
-                            ok = inputFile.Seek(static_cast<uint64>(headerSize));
-                        }
-                    }
-                    else {
-                        ok = inputFile.Seek(0LLU);
-                        if (ok) {
-                            StreamString header;
-                            //Skip the header
-                            ok = inputFile.GetLine(header);
-                        }
-                    }
-                }
-                else if (eofBehaviour == EOFLast) {
-                    lockAtLast = true;
-                }
-                else {
-                    //Unreachable by design.
-                }
+            ok = InterpolateSample();
+        }
+    }
+    return ok;
+}
+
+bool FileReader::BuildInterpolationLanes() {
+    bool ok = true;
+    uint32 nOfSignals = GetNumberOfSignals();
+    interpolationLanes = new FileReaderInterpolationLane[nOfSignals];
+    interpolationGroups = new FileReaderInterpolationGroup[nOfSignals];
+    bool *assigned = new bool[nOfSignals];
+    uint32 n;
+    for (n = 0u; n < nOfSignals; n++) {
+        //The XAxisSignal is not interpolated but directly written
+        assigned[n] = (n == xAxisSignalIdx);
+    }
+    uint32 numberOfLanes = 0u;
+    numberOfInterpolationGroups = 0u;
+    numberOfCoefficientElements = 0u;
+    for (n = 0u; (n < nOfSignals) && (ok); n++) {
+        if (!assigned[n]) {
+            //One group per type with all the signals of this type. Signals which are consecutive in memory share the same lane.
+            TypeDescriptor type = GetSignalType(n);
+            bool numeric = ((type == UnsignedInteger8Bit) || (type == SignedInteger8Bit) || (type == UnsignedInteger16Bit) || (type == SignedInteger16Bit));
+            if (!numeric) {
+                numeric = ((type == UnsignedInteger32Bit) || (type == SignedInteger32Bit) || (type == UnsignedInteger64Bit) || (type == SignedInteger64Bit));
             }
-            if (!lockAtLast) {
-                if (fileFormat == FILE_FORMAT_BINARY) {
-                    uint32 readSize = numberOfBinaryBytes;
-                    ok = inputFile.Read(dataSourceMemory, readSize);
+            if (!numeric) {
+                numeric = ((type == Float32Bit) || (type == Float64Bit));
+            }
+            FileReaderInterpolationGroup &group = interpolationGroups[numberOfInterpolationGroups];
+            group.type = numeric ? type : InvalidType;
+            group.firstLane = numberOfLanes;
+            group.numberOfLanes = 0u;
+            uint32 m;
+            for (m = n; (m < nOfSignals) && (ok); m++) {
+                if ((!assigned[m]) && (GetSignalType(m) == type)) {
+                    assigned[m] = true;
+                    uint32 nElements = 0u;
+                    uint32 nBytes = 0u;
+                    ok = GetSignalNumberOfElements(m, nElements);
                     if (ok) {
-                        ok = (readSize == numberOfBinaryBytes);
+                        ok = GetSignalByteSize(m, nBytes);
                     }
-                }
-                else {
-                    ok = ReadLineCSVFormat();
-                }
-                fatalFileError = !ok;
-                if (fatalFileError) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "Failed to read from file. No more attempts will be performed.");
-                    if (fileRuntimeErrorMsg.IsValid()) {
-                        //Reset any previous replies
-                        fileRuntimeErrorMsg->SetAsReply(false);
-                        if (!MessageI::SendMessage(fileRuntimeErrorMsg, this)) {
-                            StreamString destination = fileRuntimeErrorMsg->GetDestination();
-                            StreamString function = fileRuntimeErrorMsg->GetFunction();
-                            REPORT_ERROR(ErrorManagement::FatalError, "Could not send TreeRuntimeError message to %s [%s]", destination.Buffer(),
-                                         function.Buffer());
+                    if (ok) {
+                        bool merge = (group.numberOfLanes > 0u);
+                        if (merge) {
+                            const FileReaderInterpolationLane &lastLane = interpolationLanes[numberOfLanes - 1u];
+                            /*lint -e{613} offsets cannot be NULL as otherwise SetConfiguredDatabase would have failed*/
+                            merge = ((lastLane.offset + lastLane.byteSize) == offsets[m]);
+                        }
+                        if (merge) {
+                            interpolationLanes[numberOfLanes - 1u].numberOfElements += nElements;
+                            interpolationLanes[numberOfLanes - 1u].byteSize += nBytes;
+                        }
+                        else {
+                            FileReaderInterpolationLane &lane = interpolationLanes[numberOfLanes];
+                            lane.offset = offsets[m];
+                            lane.numberOfElements = nElements;
+                            lane.byteSize = nBytes;
+                            lane.coefficientIdx = numberOfCoefficientElements;
+                            numberOfLanes++;
+                            group.numberOfLanes++;
+                        }
+                        if (numeric) {
+                            numberOfCoefficientElements += nElements;
                         }
                     }
                 }
             }
+            numberOfInterpolationGroups++;
+        }
+    }
+    delete[] assigned;
+    if (ok) {
+        uint32 numberOfPlanes = 0u;
+        if (interpolationMode == InterpolationLinear) {
+            numberOfPlanes = 2u;
+        }
+        else if (interpolationMode == InterpolationCubic) {
+            numberOfPlanes = 4u;
+        }
+        else {
+            //Hold does not need coefficients
+        }
+        if ((numberOfPlanes * numberOfCoefficientElements) > 0u) {
+            interpolationCoefficients = new float64[numberOfPlanes * numberOfCoefficientElements];
+        }
+        lastWindowSlot = (interpolationMode == InterpolationCubic) ? 3u : 2u;
+        //The four samples of the window and the first sample after a rewind
+        windowMemory = reinterpret_cast<char8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(5u * numberOfBinaryBytes));
+        ok = (windowMemory != NULL_PTR(char8*));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the interpolation window");
+        }
+    }
+    if (ok) {
+        uint32 slot;
+        for (slot = 0u; slot < 4u; slot++) {
+            window[slot] = &windowMemory[slot * numberOfBinaryBytes];
+        }
+        rewindSample = &windowMemory[4u * numberOfBinaryBytes];
+    }
+    return ok;
+}
+
+bool FileReader::ReadInterpolationWindowSlot(const uint32 slot,
+                                             bool &rewound) {
+    bool newSample = false;
+    bool ok = ReadNextFileSample(rewound, newSample);
+    if ((ok) && (rewound) && (slot > 2u)) {
+        //The lookahead sample is the first of the file. Keep it and only rewind after the last interval of the file.
+        ok = MemoryOperationsHelper::Copy(rewindSample, dataSourceMemory, numberOfBinaryBytes);
+        rewindPending = true;
+        rewound = false;
+        newSample = false;
+    }
+    if (ok) {
+        if (newSample) {
+            ok = MemoryOperationsHelper::Copy(window[slot], dataSourceMemory, numberOfBinaryBytes);
+            ConvertXAxisSignal();
+            windowX[slot] = xAxisSignal;
+        }
+        else {
+            //End of the data. The dataSourceMemory holds the last output and not the last sample.
+            ok = MemoryOperationsHelper::Copy(window[slot], window[slot - 1u], numberOfBinaryBytes);
+            windowX[slot] = windowX[slot - 1u];
+            windowAtEnd = (!rewindPending);
         }
+    }
+    return ok;
+}
+
+bool FileReader::PrimeInterpolationWindow(const bool sampleRead) {
+    bool ok = true;
+    bool rewound = false;
+    windowAtEnd = false;
+    rewindPending = false;
+    if (!sampleRead) {
+        bool newSample = false;
+        ok = ReadNextFileSample(rewound, newSample);
+    }
+    if (ok) {
+        //The previous sample is not known. Duplicate the first one.
+        ok = MemoryOperationsHelper::Copy(window[1u], dataSourceMemory, numberOfBinaryBytes);
         if (ok) {
-            if (interpolate) {
-                ConvertXAxisSignal();
-                if (resetInterpolation) {
-                    interpolatedInputBroker->Reset();
-                }
+            ok = MemoryOperationsHelper::Copy(window[0u], dataSourceMemory, numberOfBinaryBytes);
+        }
+        ConvertXAxisSignal();
+        windowX[0u] = xAxisSignal;
+        windowX[1u] = xAxisSignal;
+    }
+    uint32 slot;
+    //A rewind while priming is ignored (e.g. a file with a single sample).
+    for (slot = 2u; (slot <= lastWindowSlot) && (ok); slot++) {
+        ok = ReadInterpolationWindowSlot(slot, rewound);
+    }
+    if (ok) {
+        interpolatedX = windowX[1u];
+        ComputeInterpolationCoefficients();
+        windowPrimed = true;
+    }
+    return ok;
+}
+
+bool FileReader::AdvanceInterpolationWindow(bool &rewound) {
+    bool ok = true;
+    if (rewindPending) {
+        ok = MemoryOperationsHelper::Copy(dataSourceMemory, rewindSample, numberOfBinaryBytes);
+        if (ok) {
+            ok = PrimeInterpolationWindow(true);
+        }
+        rewound = true;
+    }
+    else {
+        //Rotate the window (only the pointers are moved)
+        char8 *const oldest = window[0u];
+        uint32 slot;
+        for (slot = 0u; slot < 3u; slot++) {
+            window[slot] = window[slot + 1u];
+            windowX[slot] = windowX[slot + 1u];
+        }
+        window[3u] = oldest;
+        ok = ReadInterpolationWindowSlot(lastWindowSlot, rewound);
+        if (ok) {
+            if (rewound) {
+                ok = PrimeInterpolationWindow(true);
+            }
+            else {
+                ComputeInterpolationCoefficients();
+            }
+        }
+    }
+    return ok;
+}
+
+void FileReader::ComputeInterpolationCoefficients() {
+    if (windowX[2u] > windowX[1u]) {
+        windowInverseLength = 1.0 / static_cast<float64>(windowX[2u] - windowX[1u]);
+    }
+    else {
+        windowInverseLength = 0.0;
+    }
+    if (interpolationMode != InterpolationHold) {
+        uint32 g;
+        for (g = 0u; g < numberOfInterpolationGroups; g++) {
+            const FileReaderInterpolationGroup &group = interpolationGroups[g];
+            if (group.type == UnsignedInteger8Bit) {
+                ComputeInterpolationCoefficientsTemplate<uint8>(group);
+            }
+            else if (group.type == SignedInteger8Bit) {
+                ComputeInterpolationCoefficientsTemplate<int8>(group);
+            }
+            else if (group.type == UnsignedInteger16Bit) {
+                ComputeInterpolationCoefficientsTemplate<uint16>(group);
+            }
+            else if (group.type == SignedInteger16Bit) {
+                ComputeInterpolationCoefficientsTemplate<int16>(group);
+            }
+            else if (group.type == UnsignedInteger32Bit) {
+                ComputeInterpolationCoefficientsTemplate<uint32>(group);
+            }
+            else if (group.type == SignedInteger32Bit) {
+                ComputeInterpolationCoefficientsTemplate<int32>(group);
             }
+            else if (group.type == UnsignedInteger64Bit) {
+                ComputeInterpolationCoefficientsTemplate<uint64>(group);
+            }
+            else if (group.type == SignedInteger64Bit) {
+                ComputeInterpolationCoefficientsTemplate<int64>(group);
+            }
+            else if (group.type == Float32Bit) {
+                ComputeInterpolationCoefficientsTemplate<float32>(group);
+            }
+            else if (group.type == Float64Bit) {
+                ComputeInterpolationCoefficientsTemplate<float64>(group);
+            }
+            else {
+                //Not interpolated
+            }
+        }
+    }
+}
+
+void FileReader::EvaluateInterpolation(const float64 dt) {
+    uint32 g;
+    for (g = 0u; g < numberOfInterpolationGroups; g++) {
+        const FileReaderInterpolationGroup &group = interpolationGroups[g];
+        if (group.type == UnsignedInteger8Bit) {
+            EvaluateInterpolationTemplate<uint8>(group, dt);
+        }
+        else if (group.type == SignedInteger8Bit) {
+            EvaluateInterpolationTemplate<int8>(group, dt);
+        }
+        else if (group.type == UnsignedInteger16Bit) {
+            EvaluateInterpolationTemplate<uint16>(group, dt);
+        }
+        else if (group.type == SignedInteger16Bit) {
+            EvaluateInterpolationTemplate<int16>(group, dt);
+        }
+        else if (group.type == UnsignedInteger32Bit) {
+            EvaluateInterpolationTemplate<uint32>(group, dt);
+        }
+        else if (group.type == SignedInteger32Bit) {
+            EvaluateInterpolationTemplate<int32>(group, dt);
+        }
+        else if (group.type == UnsignedInteger64Bit) {
+            EvaluateInterpolationTemplate<uint64>(group, dt);
+        }
+        else if (group.type == SignedInteger64Bit) {
+            EvaluateInterpolationTemplate<int64>(group, dt);
+        }
+        else if (group.type == Float32Bit) {
+            EvaluateInterpolationTemplate<float32>(group, dt);
+        }
+        else if (group.type == Float64Bit) {
+            EvaluateInterpolationTemplate<float64>(group, dt);
+        }
+        else {
+            //Not numeric (e.g. strings). Hold the start of the window.
+            const uint32 lastLane = group.firstLane + group.numberOfLanes;
+            uint32 l;
+            for (l = group.firstLane; l < lastLane; l++) {
+                const FileReaderInterpolationLane &lane = interpolationLanes[l];
+                (void) MemoryOperationsHelper::Copy(&dataSourceMemory[lane.offset], &window[1u][lane.offset], lane.byteSize);
+            }
+        }
+    }
+}
+
+bool FileReader::InterpolateSample() {
+    bool ok = true;
+    if (!windowPrimed) {
+        ok = PrimeInterpolationWindow(false);
+    }
+    bool rewound = false;
+    //The coefficients are only recomputed when the window moves, i.e. at the rate of the file samples.
+    while ((ok) && (!windowAtEnd) && (!rewound) && (interpolatedX > windowX[2u])) {
+        ok = AdvanceInterpolationWindow(rewound);
+    }
+    if (ok) {
+        if (interpolatedX >= windowX[2u]) {
+            //At the end of the window or after the end of the file (EOF = "Last")
+            ok = MemoryOperationsHelper::Copy(dataSourceMemory, window[2u], numberOfBinaryBytes);
+        }
+        else if (interpolationMode == InterpolationHold) {
+            ok = MemoryOperationsHelper::Copy(dataSourceMemory, window[1u], numberOfBinaryBytes);
         }
+        else {
+            EvaluateInterpolation(static_cast<float64>(interpolatedX - windowX[1u]));
+        }
+        if (interpolationMode != InterpolationHold) {
+            WriteXAxisSignal(interpolatedX);
+        }
+        interpolatedX += interpolationPeriod;
     }
     return ok;
 }
 
-/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: NOOP at StateChange, independently of the function parameters.*/
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the prefetch thread is started independently of the function parameters.*/
 bool FileReader::PrepareNextState(const char8 *const currentStateName,
                                   const char8 *const nextStateName) {
-    return true;
+    bool ok = true;
+    if ((memoryMap) && (prefetchByteSize > 0u)) {
+        if (prefetchService.GetStatus() == EmbeddedThreadI::OffState) {
+            ok = (prefetchService.Start() == ErrorManagement::NoError);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the prefetch thread");
+            }
+        }
+    }
+    return ok;
 }
 
 bool FileReader::Initialise(StructuredDataI &data) {
@@ -383,6 +802,78 @@ bool FileReader::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if (ok) {
+        StreamString memoryMapStr;
+        if (data.Read("MemoryMap", memoryMapStr)) {
+            if (memoryMapStr == "yes") {
+                memoryMap = true;
+            }
+            else if (memoryMapStr != "no") {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::ParametersError, "MemoryMap shall be specified as either yes or no");
+            }
+            else {
+                memoryMap = false;
+            }
+        }
+    }
+    if (ok) {
+        StreamString binaryCacheStr;
+        if (data.Read("BinaryCache", binaryCacheStr)) {
+            if (binaryCacheStr == "yes") {
+                binaryCache = true;
+            }
+            else if (binaryCacheStr != "no") {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::ParametersError, "BinaryCache shall be specified as either yes or no");
+            }
+            else {
+                binaryCache = false;
+            }
+        }
+        if (binaryCache) {
+            ok = (fileFormat == FILE_FORMAT_CSV);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "BinaryCache = yes is only valid if FileFormat = csv");
+            }
+        }
+    }
+    if (ok) {
+        if (memoryMap) {
+            ok = (!preload);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "MemoryMap = yes and Preload = yes cannot be set at the same time");
+            }
+            if (ok) {
+                ok = ((fileFormat == FILE_FORMAT_BINARY) || (binaryCache));
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "MemoryMap = yes requires FileFormat = binary or BinaryCache = yes");
+                }
+            }
+            if (ok) {
+                if (!data.Read("PrefetchByteSize", prefetchByteSize)) {
+                    prefetchByteSize = 0u;
+                }
+                uint32 cpuMaskIn;
+                if (data.Read("PrefetchCPUMask", cpuMaskIn)) {
+                    prefetchService.SetCPUMask(ProcessorType(cpuMaskIn));
+                }
+            }
+        }
+    }
+    if (ok) {
+        bool hasStartSample = data.Read("StartSample", startSample);
+        if (!hasStartSample) {
+            startSample = 0u;
+        }
+        hasStartTime = data.Read("StartTime", startTime);
+        if (hasStartTime) {
+            ok = (!hasStartSample);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "StartSample and StartTime cannot be set at the same time");
+            }
+        }
+    }
     if (ok) {
         StreamString interpolateStr;
         ok = data.Read("Interpolate", interpolateStr);
@@ -401,6 +892,29 @@ bool FileReader::Initialise(StructuredDataI &data) {
             REPORT_ERROR(ErrorManagement::ParametersError, "Interpolate shall be specified as either yes or no");
         }
     }
+    if (ok) {
+        if (data.Read("InterpolationMode", interpolationModeStr)) {
+            ok = interpolate;
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "InterpolationMode is only valid if Interpolate = yes");
+            }
+            if (ok) {
+                if (interpolationModeStr == "Linear") {
+                    interpolationMode = InterpolationLinear;
+                }
+                else if (interpolationModeStr == "Hold") {
+                    interpolationMode = InterpolationHold;
+                }
+                else if (interpolationModeStr == "Cubic") {
+                    interpolationMode = InterpolationCubic;
+                }
+                else {
+                    ok = false;
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Unknown InterpolationMode %s", interpolationModeStr.Buffer());
+                }
+            }
+        }
+    }
     if (ok) {
         if (interpolate) {
             if (!data.Read("XAxisSignal", xAxisSignalName)) {
@@ -414,6 +928,16 @@ bool FileReader::Initialise(StructuredDataI &data) {
                         "Interpolate=yes and the InterpolationPeriod was not specified. This will fail if none of the signals interacting with this FileReader has Frequency > 0");
             }
         }
+        else if (hasStartTime) {
+            if (!data.Read("XAxisSignal", xAxisSignalName)) {
+                REPORT_ERROR(
+                        ErrorManagement::Warning,
+                        "StartTime was set and the XAxisSignal was not specified. This will fail if none of the signals interacting with this FileReader has Frequency > 0");
+            }
+        }
+        else {
+            //The XAxisSignal is not needed
+        }
     }
     if (ok) {
         StreamString eofStr;
@@ -471,6 +995,25 @@ bool FileReader::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if ((ok) && (binaryCache)) {
+        binaryCacheFilename = filename;
+        binaryCacheFilename += ".bin";
+        struct stat csvStatus;
+        struct stat cacheStatus;
+        if ((stat(filename.Buffer(), &csvStatus) == 0) && (stat(binaryCacheFilename.Buffer(), &cacheStatus) == 0)) {
+            //The sidecar is only valid if it was written after the last modification of the csv file
+            if (cacheStatus.st_mtim.tv_sec == csvStatus.st_mtim.tv_sec) {
+                binaryCacheValid = (cacheStatus.st_mtim.tv_nsec >= csvStatus.st_mtim.tv_nsec);
+            }
+            else {
+                binaryCacheValid = (cacheStatus.st_mtim.tv_sec > csvStatus.st_mtim.tv_sec);
+            }
+        }
+        if (binaryCacheValid) {
+            fileFormat = FILE_FORMAT_BINARY;
+            REPORT_ERROR(ErrorManagement::Information, "Reading %s from the binary cache %s", filename.Buffer(), binaryCacheFilename.Buffer());
+        }
+    }
     if (ok) {
         ok = signalsDatabase.MoveRelative("Signals");
         if (!ok) {
@@ -567,7 +1110,7 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
 
     }
     //Look for the XAxisSignal
-    if (interpolate) {
+    if ((ok) && ((interpolate) || (hasStartTime))) {
         ok = GetSignalIndex(xAxisSignalIdx, xAxisSignalName.Buffer());
         if (ok) {
             ok = GetSignalIndex(xAxisSignalIdx, xAxisSignalName.Buffer());
@@ -593,15 +1136,55 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
     //Allocate memory
     if (ok) {
         dataSourceMemory = reinterpret_cast<char8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(numberOfBinaryBytes));
+        if ((interpolate) || (hasStartTime)) {
+            /*lint -e{613} offsets cannot be NULL as otherwise ok would be false*/
+            xAxisSignalPtr = &dataSourceMemory[offsets[xAxisSignalIdx]];
+        }
+    }
+    if ((ok) && (interpolationMode != InterpolationBroker)) {
+        ok = (interpolationPeriod > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The InterpolationPeriod shall be > 0");
+        }
+        if (ok) {
+            ok = BuildInterpolationLanes();
+        }
+    }
+    //If the type is text prepare the Printf properties in advanced
+    if (fileFormat == FILE_FORMAT_CSV) {
+        uint32 nOfSignals = GetNumberOfSignals();
+        uint32 n;
+        if (ok) {
+            signalsAnyType = new AnyType[nOfSignals];
+        }
+
+        for (n = 0u; (n < nOfSignals) && (ok); n++) {
+            uint8 nDimensions = 0u;
+            uint32 nElements = 0u;
+            ok = GetSignalNumberOfDimensions(n, nDimensions);
+            if (ok) {
+                ok = GetSignalNumberOfElements(n, nElements);
+            }
+            /*lint -e{613} signalsAnyType, dataSourceMemory and offsets cannot be null as otherwise ok would be false*/
+            if (ok) {
+                char8 *memPtr = &dataSourceMemory[offsets[n]];
+                void *signalAddress = reinterpret_cast<void*&>(memPtr);
+                signalsAnyType[n] = AnyType(GetSignalType(n), 0u, signalAddress);
+                signalsAnyType[n].SetNumberOfDimensions(nDimensions);
+                signalsAnyType[n].SetNumberOfElements(0u, nElements);
+            }
+        }
+    }
+    if ((ok) && (binaryCache) && (!binaryCacheValid)) {
+        ok = WriteBinaryCache();
+    }
+    if ((ok) && (memoryMap)) {
+        ok = MapFile();
+    }
+    if (ok) {
         if (preload) { //Get the size of the file and allocate memory
             if (fileFormat == FILE_FORMAT_BINARY) {
-                const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
-                uint32 headerSize = static_cast<uint32>(sizeof(uint16));
-                headerSize += SIGNAL_NAME_MAX_SIZE;
-                headerSize += static_cast<uint32>(sizeof(uint32));
-                headerSize *= GetNumberOfSignals();
-                headerSize += static_cast<uint32>(sizeof(uint32));
-                allData.dataFileByteSize = inputFile.Size() - static_cast<uint64>(headerSize);
+                allData.dataFileByteSize = inputFile.Size() - dataOffset;
                 //check file size is multiple of numberOfBinaryBytes
                 //lint -e{414} Possible division by 0. numberOfBinaryBytes is different from 0 due to ok is true.
                 uint64 aux = allData.dataFileByteSize / numberOfBinaryBytes;
@@ -648,31 +1231,6 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
             }
         }
     }
-    //If the type is text prepare the Printf properties in advanced
-    if (fileFormat == FILE_FORMAT_CSV) {
-        uint32 nOfSignals = GetNumberOfSignals();
-        uint32 n;
-        if (ok) {
-            signalsAnyType = new AnyType[nOfSignals];
-        }
-
-        for (n = 0u; (n < nOfSignals) && (ok); n++) {
-            uint8 nDimensions = 0u;
-            uint32 nElements = 0u;
-            ok = GetSignalNumberOfDimensions(n, nDimensions);
-            if (ok) {
-                ok = GetSignalNumberOfElements(n, nElements);
-            }
-            /*lint -e{613} signalsAnyType, dataSourceMemory and offsets cannot be null as otherwise ok would be false*/
-            if (ok) {
-                char8 *memPtr = &dataSourceMemory[offsets[n]];
-                void *signalAddress = reinterpret_cast<void*&>(memPtr);
-                signalsAnyType[n] = AnyType(GetSignalType(n), 0u, signalAddress);
-                signalsAnyType[n].SetNumberOfDimensions(nDimensions);
-                signalsAnyType[n].SetNumberOfElements(0u, nElements);
-            }
-        }
-    }
     if (ok && preload) { //Read all the file
         if (fileFormat == FILE_FORMAT_BINARY) {
             ok = inputFile.Seek(inputFile.Size() - allData.dataFileByteSize);
@@ -726,17 +1284,21 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
         }
         allData.interalBufferIdx = 0u;
     }
+    if (ok) {
+        ok = SeekStart();
+    }
 
     return ok;
 }
 
 ErrorManagement::ErrorType FileReader::OpenFile(StructuredDataI &cdb) {
-    REPORT_ERROR(ErrorManagement::Information, "Going to open file with name %s", filename.Buffer());
+    const char8 *const inputFilename = binaryCacheValid ? binaryCacheFilename.Buffer() : filename.Buffer();
+    REPORT_ERROR(ErrorManagement::Information, "Going to open file with name %s", inputFilename);
     //File already exists!
-    fatalFileError = !inputFile.Open(filename.Buffer(), (BasicFile::ACCESS_MODE_R));
+    fatalFileError = !inputFile.Open(inputFilename, (BasicFile::ACCESS_MODE_R));
     if (fatalFileError) {
         (void) inputFile.Close();
-        REPORT_ERROR(ErrorManagement::FatalError, "Failed to open File %s", filename.Buffer());
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to open File %s", inputFilename);
     }
 
     if (!fatalFileError) {
@@ -860,13 +1422,46 @@ ErrorManagement::ErrorType FileReader::OpenFile(StructuredDataI &cdb) {
                     fatalFileError = !inputFile.Read(reinterpret_cast<char8*>(&nOfElements), readSize);
                 }
                 if (!fatalFileError) {
-                    fatalFileError = !cdb.CreateRelative(signalName.Buffer());
+                    if (!cdb.CreateRelative(signalName.Buffer())) {
+                        //The signals of a csv file may have been declared and are still there when reading from its binary cache
+                        fatalFileError = !binaryCacheValid;
+                        if (!fatalFileError) {
+                            fatalFileError = !cdb.MoveRelative(signalName.Buffer());
+                        }
+                    }
                 }
                 if (!fatalFileError) {
-                    fatalFileError = !cdb.Write("Type", TypeDescriptor::GetTypeNameFromTypeDescriptor(signalType));
+                    if (!cdb.Write("Type", TypeDescriptor::GetTypeNameFromTypeDescriptor(signalType))) {
+                        StreamString declaredType;
+                        fatalFileError = !binaryCacheValid;
+                        if (!fatalFileError) {
+                            fatalFileError = !cdb.Read("Type", declaredType);
+                        }
+                        if (!fatalFileError) {
+                            fatalFileError = (declaredType != TypeDescriptor::GetTypeNameFromTypeDescriptor(signalType));
+                        }
+                    }
                 }
                 if (!fatalFileError) {
-                    fatalFileError = !cdb.Write("NumberOfElements", nOfElements);
+                    if (!cdb.Write("NumberOfElements", nOfElements)) {
+                        uint32 declaredElements;
+                        fatalFileError = !binaryCacheValid;
+                        if (!fatalFileError) {
+                            fatalFileError = !cdb.Read("NumberOfElements", declaredElements);
+                        }
+                        if (!fatalFileError) {
+                            fatalFileError = (nOfElements != declaredElements);
+                        }
+                    }
+                }
+                if ((!fatalFileError) && (binaryCacheValid) && (nOfElements > 1u)) {
+                    if (!cdb.Write("NumberOfDimensions", 1u)) {
+                        uint32 declaredDimensions;
+                        fatalFileError = !cdb.Read("NumberOfDimensions", declaredDimensions);
+                        if (!fatalFileError) {
+                            fatalFileError = (declaredDimensions != 1u);
+                        }
+                    }
                 }
                 if (!fatalFileError) {
                     fatalFileError = !cdb.MoveToAncestor(1u);
@@ -876,6 +1471,10 @@ ErrorManagement::ErrorType FileReader::OpenFile(StructuredDataI &cdb) {
                                  TypeDescriptor::GetTypeNameFromTypeDescriptor(signalType), nOfElements);
                 }
             }
+            if (!fatalFileError) {
+                //The samples start after the header
+                dataOffset = inputFile.Position();
+            }
         }
 
     }
@@ -968,6 +1567,318 @@ bool FileReader::ReadLineCSVFormat() {
     }
     return ok;
 }
+bool FileReader::MapFile() {
+    const char8 *const mapFilename = binaryCache ? binaryCacheFilename.Buffer() : filename.Buffer();
+    /*lint -e{9130} O_RDONLY is a POSIX flag*/
+    int32 fileDescriptor = open(mapFilename, O_RDONLY);
+    bool ok = (fileDescriptor >= 0);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::OSError, "Failed to open %s for memory mapping", mapFilename);
+    }
+    if (ok) {
+        struct stat fileStatus;
+        ok = (fstat(fileDescriptor, &fileStatus) == 0);
+        if (ok) {
+            mappedFileByteSize = static_cast<uint64>(fileStatus.st_size);
+            ok = (mappedFileByteSize > dataOffset);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The file %s does not contain any sample", mapFilename);
+        }
+    }
+    if (ok) {
+        allData.dataFileByteSize = mappedFileByteSize - dataOffset;
+        ok = ((allData.dataFileByteSize % numberOfBinaryBytes) == 0u);
+        if (!ok) {
+            REPORT_ERROR(
+                    ErrorManagement::InitialisationError,
+                    "The total data file size is not a multiple of the data to read each cycle. allData.dataFileByteSize = %u, data to read for each cycle = %u ",
+                    allData.dataFileByteSize, numberOfBinaryBytes);
+        }
+    }
+    if (ok) {
+        void *address = mmap(NULL_PTR(void *), static_cast<size_t>(mappedFileByteSize), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        /*lint -e{923} MAP_FAILED is defined by POSIX as a cast of -1*/
+        ok = (address != MAP_FAILED);
+        if (ok) {
+            mappedFile = address;
+            allData.internalBuffer = &(reinterpret_cast<char8*>(address)[dataOffset]);
+            allData.interalBufferIdx = 0u;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::OSError, "Failed to map the file %s", mapFilename);
+        }
+    }
+    if (ok) {
+        //Ask the kernel for an aggressive read ahead
+        if (madvise(mappedFile, static_cast<size_t>(mappedFileByteSize), MADV_SEQUENTIAL) != 0) {
+            REPORT_ERROR(ErrorManagement::Warning, "Failed to set the read ahead hint on %s", mapFilename);
+        }
+        int64 systemPageSize = static_cast<int64>(sysconf(_SC_PAGESIZE));
+        if (systemPageSize > 0) {
+            pageSize = static_cast<uint64>(systemPageSize);
+        }
+    }
+    if (fileDescriptor >= 0) {
+        //The mapping remains valid after closing the descriptor
+        (void) close(fileDescriptor);
+    }
+    return ok;
+}
+
+bool FileReader::WriteBinaryCache() {
+    const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
+    StreamString temporaryFilename = binaryCacheFilename;
+    temporaryFilename += ".tmp";
+    Directory temporaryFile(temporaryFilename.Buffer());
+    (void) temporaryFile.Delete();
+    File cacheFile;
+    //Written to a temporary file first so that an interrupted conversion never leaves a valid looking sidecar
+    bool ok = cacheFile.Open(temporaryFilename.Buffer(), (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT));
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::OSError, "Failed to create the binary cache %s", temporaryFilename.Buffer());
+    }
+    uint32 nOfSignals = GetNumberOfSignals();
+    if (ok) {
+        uint32 writeSize = static_cast<uint32>(sizeof(uint32));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Write function.*/
+        ok = cacheFile.Write(reinterpret_cast<const char8*>(&nOfSignals), writeSize);
+    }
+    uint32 n;
+    for (n = 0u; (n < nOfSignals) && (ok); n++) {
+        TypeDescriptor signalType = GetSignalType(n);
+        uint32 writeSize = static_cast<uint32>(sizeof(uint16));
+        /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Write function.*/
+        ok = cacheFile.Write(reinterpret_cast<const char8*>(&signalType.all), writeSize);
+        char8 signalNameMemory[SIGNAL_NAME_MAX_SIZE];
+        StreamString signalName;
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(&signalNameMemory[0], '\0', SIGNAL_NAME_MAX_SIZE);
+        }
+        if (ok) {
+            ok = GetSignalName(n, signalName);
+        }
+        if (ok) {
+            uint32 signalNameSize = static_cast<uint32>(signalName.Size());
+            if (signalNameSize > SIGNAL_NAME_MAX_SIZE) {
+                signalNameSize = SIGNAL_NAME_MAX_SIZE;
+            }
+            ok = MemoryOperationsHelper::Copy(&signalNameMemory[0], signalName.Buffer(), signalNameSize);
+        }
+        if (ok) {
+            writeSize = SIGNAL_NAME_MAX_SIZE;
+            ok = cacheFile.Write(&signalNameMemory[0], writeSize);
+        }
+        uint32 nOfElements = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(n, nOfElements);
+        }
+        if (ok) {
+            writeSize = static_cast<uint32>(sizeof(uint32));
+            /*lint -e{928}  [MISRA C++ Rule 5-2-7]. Justification: Need to cast to the type expected by the Write function.*/
+            ok = cacheFile.Write(reinterpret_cast<const char8*>(&nOfElements), writeSize);
+        }
+    }
+    uint64 headerSize = 0u;
+    if (ok) {
+        headerSize = cacheFile.Position();
+    }
+    //The csv header was already consumed by OpenFile
+    while ((ok) && (inputFile.Position() < inputFile.Size())) {
+        ok = ReadLineCSVFormat();
+        if (ok) {
+            uint32 writeSize = numberOfBinaryBytes;
+            ok = cacheFile.Write(dataSourceMemory, writeSize);
+        }
+    }
+    if (cacheFile.IsOpen()) {
+        if (!cacheFile.Close()) {
+            ok = false;
+        }
+    }
+    if (ok) {
+        ok = (rename(temporaryFilename.Buffer(), binaryCacheFilename.Buffer()) == 0);
+    }
+    if (ok) {
+        (void) inputFile.Close();
+        ok = inputFile.Open(binaryCacheFilename.Buffer(), BasicFile::ACCESS_MODE_R);
+    }
+    if (ok) {
+        dataOffset = headerSize;
+        ok = inputFile.Seek(dataOffset);
+    }
+    if (ok) {
+        fileFormat = FILE_FORMAT_BINARY;
+        binaryCacheValid = true;
+        REPORT_ERROR(ErrorManagement::Information, "Converted %s into the binary cache %s", filename.Buffer(), binaryCacheFilename.Buffer());
+    }
+    else {
+        (void) temporaryFile.Delete();
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to write the binary cache %s", binaryCacheFilename.Buffer());
+    }
+    return ok;
+}
+
+bool FileReader::ReadSample(const uint64 sample) {
+    bool ok;
+    uint64 samplePosition = sample * numberOfBinaryBytes;
+    if ((preload) || (memoryMap)) {
+        ok = MemoryOperationsHelper::Copy(dataSourceMemory, &(allData.internalBuffer[samplePosition]), numberOfBinaryBytes);
+    }
+    else {
+        ok = inputFile.Seek(dataOffset + samplePosition);
+        if (ok) {
+            uint32 readSize = numberOfBinaryBytes;
+            ok = inputFile.Read(dataSourceMemory, readSize);
+            if (ok) {
+                ok = (readSize == numberOfBinaryBytes);
+            }
+        }
+    }
+    return ok;
+}
+
+bool FileReader::SeekStart() {
+    bool ok = true;
+    if ((startSample == 0u) && (!hasStartTime)) {
+        startFilePosition = inputFile.Position();
+        startBufferIdx = 0u;
+    }
+    else if ((preload) || (memoryMap) || (fileFormat == FILE_FORMAT_BINARY)) {
+        //All the samples have the same size: the start position is computed and not scanned.
+        uint64 numberOfSamples;
+        if ((preload) || (memoryMap)) {
+            numberOfSamples = allData.dataFileByteSize / numberOfBinaryBytes;
+        }
+        else {
+            numberOfSamples = (inputFile.Size() - dataOffset) / numberOfBinaryBytes;
+        }
+        if (hasStartTime) {
+            //First sample with XAxisSignal >= StartTime. Assumes that the XAxisSignal is monotonic.
+            uint64 lowSample = 0u;
+            uint64 highSample = numberOfSamples;
+            while ((ok) && (lowSample < highSample)) {
+                uint64 middleSample = lowSample + ((highSample - lowSample) / 2u);
+                ok = ReadSample(middleSample);
+                if (ok) {
+                    ConvertXAxisSignal();
+                    if (xAxisSignal < startTime) {
+                        lowSample = middleSample + 1u;
+                    }
+                    else {
+                        highSample = middleSample;
+                    }
+                }
+            }
+            startSample = lowSample;
+        }
+        if (ok) {
+            ok = (startSample < numberOfSamples);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The start sample %u is after the last sample of the file (%u samples)", startSample,
+                             numberOfSamples);
+            }
+        }
+        if (ok) {
+            startBufferIdx = startSample * numberOfBinaryBytes;
+            if ((preload) || (memoryMap)) {
+                allData.interalBufferIdx = startBufferIdx;
+            }
+            else {
+                startFilePosition = dataOffset + startBufferIdx;
+                ok = inputFile.Seek(startFilePosition);
+            }
+        }
+    }
+    else {
+        //The lines of a csv file do not have the same size and have to be scanned (use BinaryCache = yes to avoid this)
+        uint64 sample = 0u;
+        bool found = false;
+        startFilePosition = inputFile.Position();
+        while ((ok) && (!found)) {
+            if (!hasStartTime) {
+                found = (sample == startSample);
+            }
+            if (!found) {
+                ok = (inputFile.Position() < inputFile.Size());
+                if (ok) {
+                    if (hasStartTime) {
+                        ok = ReadLineCSVFormat();
+                        if (ok) {
+                            ConvertXAxisSignal();
+                            found = (xAxisSignal >= startTime);
+                        }
+                    }
+                    else {
+                        StreamString line;
+                        ok = inputFile.GetLine(line);
+                    }
+                }
+                if ((ok) && (!found)) {
+                    startFilePosition = inputFile.Position();
+                    sample++;
+                }
+            }
+        }
+        if (ok) {
+            ok = (startFilePosition < inputFile.Size());
+        }
+        if (ok) {
+            startSample = sample;
+            ok = inputFile.Seek(startFilePosition);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The start sample could not be found in the file");
+        }
+    }
+    return ok;
+}
+
+void FileReader::PrefetchRange(const uint64 begin,
+                               const uint64 end) {
+    if (end > begin) {
+        //madvise requires a page aligned address
+        uint64 firstByte = ((dataOffset + begin) / pageSize) * pageSize;
+        uint64 lastByte = dataOffset + end;
+        char8 *mappedBytes = reinterpret_cast<char8*>(mappedFile);
+        (void) madvise(&mappedBytes[firstByte], static_cast<size_t>(lastByte - firstByte), MADV_WILLNEED);
+        //MADV_WILLNEED only schedules the read. Touching each page guarantees that it is resident.
+        uint64 i;
+        for (i = firstByte; i < lastByte; i += pageSize) {
+            volatile const char8 *page = &mappedBytes[i];
+            (void) *page;
+        }
+    }
+}
+
+/*lint -e{1764} function prototype is derived from upper class*/
+ErrorManagement::ErrorType FileReader::PrefetchThreadCallback(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        //Only written by the real-time thread
+        uint64 readIdx = allData.interalBufferIdx;
+        uint64 windowEnd = readIdx + prefetchByteSize;
+        if (windowEnd > allData.dataFileByteSize) {
+            if (eofBehaviour == EOFRewind) {
+                //The samples read after the rewind
+                uint64 wrappedEnd = startBufferIdx + (windowEnd - allData.dataFileByteSize);
+                if (wrappedEnd > readIdx) {
+                    wrappedEnd = readIdx;
+                }
+                PrefetchRange(startBufferIdx, wrappedEnd);
+            }
+            windowEnd = allData.dataFileByteSize;
+        }
+        if ((prefetchedIdx < readIdx) || (prefetchedIdx > windowEnd)) {
+            //Either the first call, lagging behind the reader or the file was rewound
+            prefetchedIdx = readIdx;
+        }
+        PrefetchRange(prefetchedIdx, windowEnd);
+        prefetchedIdx = windowEnd;
+        Sleep::MSec(1u);
+    }
+    return ErrorManagement::NoError;
+}
+
 ErrorManagement::ErrorType FileReader::CloseFile() {
     ErrorManagement::ErrorType err;
     if (inputFile.IsOpen()) {
@@ -1000,6 +1911,22 @@ uint64 FileReader::GetInterpolationPeriod() const {
     return interpolationPeriod;
 }
 
+const StreamString& FileReader::GetInterpolationMode() const {
+    return interpolationModeStr;
+}
+
+bool FileReader::IsMemoryMapped() const {
+    return memoryMap;
+}
+
+uint64 FileReader::GetStartSample() const {
+    return startSample;
+}
+
+bool FileReader::IsBinaryCacheInUse() const {
+    return binaryCacheValid;
+}
+
 CLASS_REGISTER(FileReader, "1.0")
 CLASS_METHOD_REGISTER(FileReader, CloseFile)
 
@@ -27,21 +27,70 @@
 /*---------------------------------------------------------------------------*/
 /*                        Standard header includes                           */
 /*---------------------------------------------------------------------------*/
+#include <limits>
 
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderT.h"
 #include "File.h"
 #include "MemoryMapInterpolatedInputBroker.h"
 #include "MessageI.h"
 #include "ProcessorType.h"
 #include "RegisteredMethodsMessageFilter.h"
+#include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+
+/**
+ * @brief Set of consecutive signals (in the dataSourceMemory) of the same type which are interpolated by the FileReader in a single loop.
+ */
+struct FileReaderInterpolationLane {
+    /**
+     * Offset of the first signal in the dataSourceMemory.
+     */
+    uint32 offset;
+
+    /**
+     * Total number of elements of the signals.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * Total number of bytes of the signals.
+     */
+    uint32 byteSize;
+
+    /**
+     * Index of the first element in each of the interpolation coefficient planes.
+     */
+    uint32 coefficientIdx;
+};
+
+/**
+ * @brief Lanes that share the same type, so that the type is only resolved once per group.
+ */
+struct FileReaderInterpolationGroup {
+    /**
+     * The type of all the signals of the group.
+     */
+    TypeDescriptor type;
+
+    /**
+     * Index of the first lane of the group.
+     */
+    uint32 firstLane;
+
+    /**
+     * Number of lanes of the group.
+     */
+    uint32 numberOfLanes;
+};
+
 /**
  * @brief A DataSourceI interface which allows to read signals from a file.
  *
@@ -62,10 +111,33 @@ namespace MARTe {
  *  by exactly 32 bytes to encode the signal name, followed by 4 bytes which store the number of elements of a given signal.
  *  Following the header, the signal samples are consecutively stored in binary format.
  *
+ * If MemoryMap = "yes" the data section of a binary file is mapped (mmap) in memory and, at every Synchronise, the next sample is copied
+ *  from the mapping. The kernel is told that the file is read sequentially (madvise) so that it reads ahead, and, if PrefetchByteSize is set,
+ *  a background thread keeps the next PrefetchByteSize bytes resident so that the real-time thread does not block on a page fault.
+ *  Contrary to Preload = "yes" the size of the file is not limited by the available memory.
+ *
+ * The replay can start at a given sample (StartSample) or at the first sample whose XAxisSignal is greater or equal than a given value (StartTime).
+ *  Given that in the binary format all the samples have the same size, the start position is computed (or, for StartTime, binary searched
+ *  assuming a monotonic XAxisSignal) without scanning the file. If EOF = "Rewind", the file is rewound to the start position.
+ *
+ * If BinaryCache = "yes" the csv file is converted once into a binary file (sidecar) named Filename.bin. Any later execution will read the sidecar
+ *  (with all the binary format options, including MemoryMap) as long as it is newer than the csv file.
+ *
  * This DataSourceI has the function CloseFile registered as an RPCs.
  *
  * Only one and one GAM is allowed to read from this DataSourceI.
  *
+ * If InterpolationMode is set (requires Interpolate = "yes"), the interpolation is not performed by the MemoryMapInterpolatedInputBroker
+ *  but by the FileReader itself, for all the signals at once, in the Synchronise (and a MemoryMapSynchronisedInputBroker is used instead).
+ *  The signals are grouped by type (consecutive signals of the same type are merged) and the interpolation coefficients are only
+ *  recomputed when a new sample is read from the file, so that each cycle costs one contiguous loop per group. The possible modes are:
+ *  "Linear" (linear interpolation between the two samples that bracket the interpolated XAxisSignal), "Hold" (the last sample whose
+ *  XAxisSignal is less or equal than the interpolated XAxisSignal) and "Cubic" (Catmull-Rom spline through the previous, the two bracketing and
+ *  the next sample). Integer signals are rounded to the nearest integer and saturated to the range of the signal type and
+ *  uint64/int64 signals are interpolated relative to the start of the window, so that values above 2^53 are not truncated by the float64
+ *  arithmetic. Signals which are not numeric (e.g. strings) are held.
+ *  With "Linear" and "Cubic" the XAxisSignal is set to the interpolated value, with "Hold" the held sample is copied as is.
+ *
  * If any of the signals reading from this DataSourceI asks for a Frequency > 0, the InterpolationPeriod
  * defined below will be ignored and replaced by Frequency * 1e9 and the XAxisSignal will be replaced by this signal name.
  *
@@ -79,9 +151,16 @@ namespace MARTe {
  *     CSVSeparator = "," //Compulsory if Format=csv. Sets the file separator type.
  *     XAxisSignal = "Time" //Compulsory if Interpolate = "yes" and none of the signals interacting with this FileReader has Frequency > 0. Name of the signal containing the independent variable to generate the interpolation samples.
  *     InterpolationPeriod = 1000 //Compulsory if Interpolate = "yes" and none of the signals interacting with this FileReader has Frequency > 0. InterpolatedXAxisSignal += InterpolationPeriod. It will be read as an uint64.
+ *     InterpolationMode = "Linear" //Optional. Only valid if Interpolate = "yes". Possible values are: "Linear", "Hold" and "Cubic". If not set the interpolation is performed by the MemoryMapInterpolatedInputBroker.
  *     EOF = "Rewind" //Optional behaviour to have when reaching the end of the file. If not set EOF = "Rewind". Possible options are: "Error", "Rewind" and "Last". If "Rewind" the file will be read from the start; if "Error" an error will be issues when EOF is reached; if "Last" the last read values are sent.
  *     Preload = "yes" //Optional. Default no. If set the file is load in memory when configuring.
  *     MaxFileByteSize = 1000000 //Optional. Default 4 GB. The maximum data file size to be loaded in Bytes.
+ *     MemoryMap = "yes" //Optional. Default no. If set the binary data is read from a memory mapping of the file. Cannot be set together with Preload = "yes". Requires FileFormat = "binary" or BinaryCache = "yes".
+ *     PrefetchByteSize = 1048576 //Optional. Only valid if MemoryMap = "yes". Default 0 (no prefetch thread). Number of bytes, ahead of the current sample, that a background thread keeps resident in memory.
+ *     PrefetchCPUMask = 0x1 //Optional. CPU affinity of the prefetch thread.
+ *     StartSample = 1000 //Optional. Default 0. Index of the first sample to be read. Cannot be set together with StartTime.
+ *     StartTime = 2000000 //Optional. The first sample to be read is the first one whose XAxisSignal >= StartTime. It will be read as an uint64. Requires the XAxisSignal.
+ *     BinaryCache = "yes" //Optional. Default no. Shall be "yes" or "no". Only valid if FileFormat = "csv". Converts (once) the csv file into a binary sidecar file which is then used in its place.
  *     //All the signals are automatically added against the information stored in the header of the input file (format described above).
  *     +Messages = { //Optional. If set a message will be fired every time one of the events below occur
  *         Class = ReferenceContainer
@@ -96,7 +175,7 @@ namespace MARTe {
  * }
  * </pre>
  */
-class FileReader: public DataSourceI, public MessageI {
+class FileReader: public DataSourceI, public MessageI, public EmbeddedServiceMethodBinderT<FileReader> {
 public:CLASS_REGISTER_DECLARATION()
 
     /**
@@ -136,14 +215,14 @@ public:CLASS_REGISTER_DECLARATION()
     /**
      * @brief See DataSourceI::GetBrokerName.
      * @details Only InputSignals are supported.
-     * @return MemoryMapSynchronisedInputBroker if interpolate = false, MemoryMapInterpolatedInputBroker otherwise.
+     * @return MemoryMapInterpolatedInputBroker if interpolate = true and the InterpolationMode is not set, MemoryMapSynchronisedInputBroker otherwise.
      */
     virtual const char8* GetBrokerName(StructuredDataI &data,
                                        const SignalDirection direction);
 
     /**
      * @brief See DataSourceI::GetInputBrokers.
-     * @details If interpolate == yes adds a MemoryMapInterpolatedInputBroker instance to
+     * @details If interpolate == yes and the InterpolationMode is not set adds a MemoryMapInterpolatedInputBroker instance to
      *  the inputBrokers, otherwise adds a MemoryMapSynchronisedInputBroker instance to the intputBrokers.
      * @pre
      *   GetNumberOfFunctions() == 1u
@@ -162,13 +241,15 @@ public:CLASS_REGISTER_DECLARATION()
 
     /**
      * @brief Reads into the buffer data the data from the specified file in the specified format.
+     * @details If the InterpolationMode is set, computes the next interpolated sample.
      * @return true if the data can be successfully read from the file.
      */
     virtual bool Synchronise();
 
     /**
-     * @brief See DataSourceI::PrepareNextState. NOOP.
-     * @return true.
+     * @brief See DataSourceI::PrepareNextState.
+     * @details Starts the prefetch thread (if MemoryMap = "yes" and PrefetchByteSize > 0).
+     * @return true if the prefetch thread could be started.
      */
     virtual bool PrepareNextState(const char8 *const currentStateName,
                                   const char8 *const nextStateName);
@@ -233,6 +314,44 @@ public:CLASS_REGISTER_DECLARATION()
      */
     uint64 GetInterpolationPeriod() const;
 
+    /**
+     * @brief Returns the InterpolationMode.
+     * @return the InterpolationMode (empty if the interpolation is performed by the MemoryMapInterpolatedInputBroker).
+     */
+    const StreamString& GetInterpolationMode() const;
+
+    /**
+     * @brief Returns true if the data is read from a memory mapping of the file.
+     * @return true if the data is read from a memory mapping of the file.
+     */
+    bool IsMemoryMapped() const;
+
+    /**
+     * @brief Returns the index of the first sample to be read.
+     * @details If StartTime was set, this is the sample found by the search.
+     * @return the index of the first sample to be read.
+     * @pre
+     *   SetConfiguredDatabase
+     */
+    uint64 GetStartSample() const;
+
+    /**
+     * @brief Returns true if the data of the csv file is read from its binary sidecar.
+     * @return true if the data of the csv file is read from its binary sidecar.
+     * @pre
+     *   SetConfiguredDatabase
+     */
+    bool IsBinaryCacheInUse() const;
+
+    /**
+     * @brief Callback of the prefetch thread.
+     * @details Touches the pages of the memory mapped file, from the last prefetched position and up to PrefetchByteSize bytes ahead
+     *  of the sample being read, so that they are resident when the Synchronise needs them. Runs every millisecond.
+     * @param[in] info see EmbeddedServiceMethodBinderI.
+     * @return ErrorManagement::NoError.
+     */
+    ErrorManagement::ErrorType PrefetchThreadCallback(ExecutionInfo &info);
+
 private:
 
     /**
@@ -240,6 +359,124 @@ private:
      */
     void ConvertXAxisSignal();
 
+    /**
+     * @brief Writes \a value into the xAxis signal of the data source memory (converting it to the xAxis signal type).
+     * @param[in] value the value to write.
+     */
+    void WriteXAxisSignal(const uint64 value);
+
+    /**
+     * @brief Reads the next sample from the file (or from the preloaded or memory mapped data) into the dataSourceMemory.
+     * @details Handles the EOF behaviour.
+     * @param[out] rewound true if the file was rewound to the start sample.
+     * @param[out] newSample false if EOF = "Last" and the end of the file was reached, i.e. if nothing was read.
+     * @return true if the sample could be read.
+     */
+    bool ReadNextFileSample(bool &rewound,
+                            bool &newSample);
+
+    /**
+     * @brief Groups the signals into interpolation lanes and allocates the interpolation window and coefficients.
+     * @return true if the memory could be allocated.
+     */
+    bool BuildInterpolationLanes();
+
+    /**
+     * @brief Computes the next interpolated sample into the dataSourceMemory.
+     * @details Moves the interpolation window while the interpolated XAxisSignal is after the end of the window.
+     * @return true if the file samples could be read.
+     */
+    bool InterpolateSample();
+
+    /**
+     * @brief Fills the interpolation window starting from the next sample of the file.
+     * @details The previous sample is not known and is set as a duplicate of the first sample.
+     * @param[in] sampleRead true if the first sample of the window was already read into the dataSourceMemory.
+     * @return true if the file samples could be read.
+     */
+    bool PrimeInterpolationWindow(const bool sampleRead);
+
+    /**
+     * @brief Moves the interpolation window by one file sample (or primes it again after a rewind).
+     * @param[out] rewound true if the file was rewound (in which case the window is primed again).
+     * @return true if the file sample could be read.
+     */
+    bool AdvanceInterpolationWindow(bool &rewound);
+
+    /**
+     * @brief Reads the next file sample into the slot \a slot of the interpolation window.
+     * @details If nothing was read (EOF = "Last") the previous slot is duplicated. If the lookahead sample was read after a rewind it is
+     *  kept in the rewindSample (and the previous slot is duplicated), so that the last interval of the file is still interpolated.
+     * @param[in] slot the window slot.
+     * @param[out] rewound true if the file was rewound.
+     * @return true if the file sample could be read.
+     */
+    bool ReadInterpolationWindowSlot(const uint32 slot,
+                                     bool &rewound);
+
+    /**
+     * @brief Recomputes the interpolation coefficients of all the groups for the current interpolation window.
+     */
+    void ComputeInterpolationCoefficients();
+
+    /**
+     * @brief Evaluates the interpolation of all the groups at \a dt after the start of the interpolation window.
+     * @param[in] dt distance between the interpolated XAxisSignal and the start of the window.
+     */
+    void EvaluateInterpolation(const float64 dt);
+
+    /**
+     * @brief Computes the interpolation coefficients of all the lanes of a group.
+     * @param[in] group the group.
+     */
+    template<typename T>
+    void ComputeInterpolationCoefficientsTemplate(const FileReaderInterpolationGroup &group);
+
+    /**
+     * @brief Evaluates the interpolation of all the lanes of a group.
+     * @param[in] group the group.
+     * @param[in] dt distance between the interpolated XAxisSignal and the start of the window.
+     */
+    template<typename T>
+    void EvaluateInterpolationTemplate(const FileReaderInterpolationGroup &group,
+                                       const float64 dt);
+
+    /**
+     * @brief Converts an interpolated value to T. If T is an integer the value is rounded to the nearest integer and saturated to the range of T.
+     * @param[in] value the interpolated value.
+     * @return the converted value.
+     */
+    template<typename T>
+    static inline T SaturateInterpolated(const float64 value);
+
+    /**
+     * @brief Returns true if T has more digits than the float64 mantissa (i.e. uint64 and int64), in which case the interpolation is
+     *  computed relative to the start of the window (see InterpolationDelta and OffsetInterpolated) so that no precision is lost.
+     * @return true if T cannot be exactly represented by a float64.
+     */
+    template<typename T>
+    static inline bool IsWideInterpolated();
+
+    /**
+     * @brief Computes \a value - \a base without overflowing T (exact as long as the difference fits in the float64 mantissa).
+     * @param[in] value the sample value.
+     * @param[in] base the value at the start of the window.
+     * @return \a value - \a base.
+     */
+    template<typename T>
+    static inline float64 InterpolationDelta(const T value,
+                                             const T base);
+
+    /**
+     * @brief Computes \a base + \a offset, rounding the offset to the nearest integer and saturating the result to the range of T.
+     * @param[in] base the value at the start of the window.
+     * @param[in] offset the interpolated value relative to \a base.
+     * @return \a base + \a offset.
+     */
+    template<typename T>
+    static inline T OffsetInterpolated(const T base,
+                                       const float64 offset);
+
     /**
      * @brief Opens a new File, parses the header and registers the signals in the cdb.
      * @param[out] cdb the ConfigurationDatabase where signals will be written into.
@@ -247,6 +484,40 @@ private:
      */
     ErrorManagement::ErrorType OpenFile(StructuredDataI &cdb);
 
+    /**
+     * @brief Maps the data section of the (binary) input file in memory.
+     * @return true if the file could be mapped and if its size is a multiple of the sample size.
+     */
+    bool MapFile();
+
+    /**
+     * @brief Converts the csv input file into the binary sidecar and reopens the latter as the input file.
+     * @return true if the sidecar could be written and reopened.
+     */
+    bool WriteBinaryCache();
+
+    /**
+     * @brief Copies the sample with index \a sample into the dataSourceMemory.
+     * @details Only valid for the binary format (or if the data is preloaded or memory mapped).
+     * @param[in] sample the sample index.
+     * @return true if the sample could be read.
+     */
+    bool ReadSample(const uint64 sample);
+
+    /**
+     * @brief Moves the reading position to the StartSample (or to the sample matching the StartTime).
+     * @return true if the start sample exists.
+     */
+    bool SeekStart();
+
+    /**
+     * @brief Prefetches the bytes [begin, end[ of the memory mapped data.
+     * @param[in] begin the first byte (relative to the start of the data section).
+     * @param[in] end the byte after the last one to prefetch.
+     */
+    void PrefetchRange(const uint64 begin,
+                       const uint64 end);
+
     /**
      * Offset of each signal in the dataSourceMemory
      */
@@ -398,12 +669,377 @@ private:
 
     bool ReadLineCSVFormat();
 
+    /**
+     * True if the data is read from a memory mapping of the file (the allData.internalBuffer points at the mapping).
+     */
+    bool memoryMap;
+
+    /**
+     * The address returned by mmap.
+     */
+    void *mappedFile;
+
+    /**
+     * The size of the mapping.
+     */
+    uint64 mappedFileByteSize;
+
+    /**
+     * The size of the binary header, i.e. where the samples start in a binary file.
+     */
+    uint64 dataOffset;
+
+    /**
+     * The memory page size.
+     */
+    uint64 pageSize;
+
+    /**
+     * Number of bytes to be kept resident ahead of the sample being read.
+     */
+    uint32 prefetchByteSize;
+
+    /**
+     * Position (relative to allData.internalBuffer) up to which the data was already prefetched.
+     */
+    uint64 prefetchedIdx;
+
+    /**
+     * The thread which prefetches the memory mapped data.
+     */
+    SingleThreadService prefetchService;
+
+    /**
+     * The first sample to be read.
+     */
+    uint64 startSample;
+
+    /**
+     * True if StartTime was set.
+     */
+    bool hasStartTime;
+
+    /**
+     * The XAxisSignal value of the first sample to be read.
+     */
+    uint64 startTime;
+
+    /**
+     * The file position of the first sample to be read (when neither preloaded nor memory mapped).
+     */
+    uint64 startFilePosition;
+
+    /**
+     * The allData.internalBuffer position of the first sample to be read (when preloaded or memory mapped).
+     */
+    uint64 startBufferIdx;
+
+    /**
+     * True if BinaryCache = "yes".
+     */
+    bool binaryCache;
+
+    /**
+     * True if the binary sidecar is up to date and is read instead of the csv file.
+     */
+    bool binaryCacheValid;
+
+    /**
+     * The name of the binary sidecar.
+     */
+    StreamString binaryCacheFilename;
+
+    /**
+     * The possible interpolation modes.
+     */
+    enum InterpolationMode {
+        /**
+         * Interpolation (if any) performed by the MemoryMapInterpolatedInputBroker.
+         */
+        InterpolationBroker = 0,
+        /**
+         * Linear interpolation.
+         */
+        InterpolationLinear = 1,
+        /**
+         * Sample and hold.
+         */
+        InterpolationHold = 2,
+        /**
+         * Catmull-Rom cubic interpolation.
+         */
+        InterpolationCubic = 3
+    };
+
+    /**
+     * The interpolation mode.
+     */
+    InterpolationMode interpolationMode;
+
+    /**
+     * The interpolation mode as text.
+     */
+    StreamString interpolationModeStr;
+
+    /**
+     * The interpolation lanes (grouped by type).
+     */
+    FileReaderInterpolationLane *interpolationLanes;
+
+    /**
+     * The interpolation groups.
+     */
+    FileReaderInterpolationGroup *interpolationGroups;
+
+    /**
+     * Number of interpolation groups.
+     */
+    uint32 numberOfInterpolationGroups;
+
+    /**
+     * The interpolation coefficient planes (2 for Linear and 4 for Cubic), each with numberOfCoefficientElements.
+     */
+    float64 *interpolationCoefficients;
+
+    /**
+     * Number of numeric elements to be interpolated.
+     */
+    uint32 numberOfCoefficientElements;
+
+    /**
+     * Memory of the interpolation window (4 samples).
+     */
+    char8 *windowMemory;
+
+    /**
+     * The samples of the interpolation window: previous, start, end and next. Rotated as new samples are read.
+     */
+    char8 *window[4];
+
+    /**
+     * The XAxisSignal of each of the samples of the interpolation window.
+     */
+    uint64 windowX[4];
+
+    /**
+     * The last slot of the window that is read from the file (2 for Linear and Hold, 3 for Cubic).
+     */
+    uint32 lastWindowSlot;
+
+    /**
+     * 1 / (windowX[2] - windowX[1]), or 0 if the window has no length.
+     */
+    float64 windowInverseLength;
+
+    /**
+     * The interpolated XAxisSignal.
+     */
+    uint64 interpolatedX;
+
+    /**
+     * True if the interpolation window was filled.
+     */
+    bool windowPrimed;
+
+    /**
+     * True if EOF = "Last" and the end of the file was reached while filling the window.
+     */
+    bool windowAtEnd;
+
+    /**
+     * The first sample of the file, when it was read (after a rewind) as the lookahead sample of the window.
+     */
+    char8 *rewindSample;
+
+    /**
+     * True if the window shall be primed with the rewindSample when it is next moved.
+     */
+    bool rewindPending;
+
 };
 }
 
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+template<typename T>
+T FileReader::SaturateInterpolated(const float64 value) {
+    T ret;
+    if (std::numeric_limits<T>::is_integer) {
+        const float64 maxValue = static_cast<float64>(std::numeric_limits<T>::max());
+        const float64 minValue = static_cast<float64>(std::numeric_limits<T>::min());
+        if (value >= maxValue) {
+            ret = std::numeric_limits<T>::max();
+        }
+        else if (value <= minValue) {
+            ret = std::numeric_limits<T>::min();
+        }
+        else if (value >= 0.0) {
+            ret = static_cast<T>(value + 0.5);
+        }
+        else {
+            ret = static_cast<T>(value - 0.5);
+        }
+    }
+    else {
+        ret = static_cast<T>(value);
+    }
+    return ret;
+}
+
+template<typename T>
+bool FileReader::IsWideInterpolated() {
+    return (std::numeric_limits<T>::digits > std::numeric_limits<float64>::digits);
+}
+
+template<typename T>
+float64 FileReader::InterpolationDelta(const T value,
+                                       const T base) {
+    float64 ret;
+    if (std::numeric_limits<T>::is_integer) {
+        //The difference is computed in modulo 2^64 arithmetic, where it is always exact
+        if (value >= base) {
+            ret = static_cast<float64>(static_cast<uint64>(value) - static_cast<uint64>(base));
+        }
+        else {
+            ret = -static_cast<float64>(static_cast<uint64>(base) - static_cast<uint64>(value));
+        }
+    }
+    else {
+        ret = static_cast<float64>(value) - static_cast<float64>(base);
+    }
+    return ret;
+}
+
+template<typename T>
+T FileReader::OffsetInterpolated(const T base,
+                                 const float64 offset) {
+    T ret = base;
+    //2^64, i.e. the first float64 which does not fit in an uint64
+    const float64 maxOffset = 18446744073709551616.0;
+    const uint64 baseU = static_cast<uint64>(base);
+    if (offset >= 0.5) {
+        const float64 rounded = offset + 0.5;
+        const uint64 headroom = static_cast<uint64>(std::numeric_limits<T>::max()) - baseU;
+        if (rounded >= maxOffset) {
+            ret = std::numeric_limits<T>::max();
+        }
+        else {
+            const uint64 r = static_cast<uint64>(rounded);
+            ret = (r >= headroom) ? (std::numeric_limits<T>::max()) : (static_cast<T>(baseU + r));
+        }
+    }
+    else if (offset <= -0.5) {
+        const float64 rounded = 0.5 - offset;
+        const uint64 room = baseU - static_cast<uint64>(std::numeric_limits<T>::min());
+        if (rounded >= maxOffset) {
+            ret = std::numeric_limits<T>::min();
+        }
+        else {
+            const uint64 r = static_cast<uint64>(rounded);
+            ret = (r >= room) ? (std::numeric_limits<T>::min()) : (static_cast<T>(baseU - r));
+        }
+    }
+    else {
+        //Closer to base than to any other integer
+    }
+    return ret;
+}
+
+/*lint -e{826} the window and the dataSourceMemory hold samples with the layout given by the lanes.*/
+template<typename T>
+void FileReader::ComputeInterpolationCoefficientsTemplate(const FileReaderInterpolationGroup &group) {
+    const bool wide = IsWideInterpolated<T>();
+    float64 *const plane0 = &interpolationCoefficients[0u];
+    float64 *const plane1 = &interpolationCoefficients[numberOfCoefficientElements];
+    const uint32 lastLane = group.firstLane + group.numberOfLanes;
+    for (uint32 l = group.firstLane; l < lastLane; l++) {
+        const FileReaderInterpolationLane &lane = interpolationLanes[l];
+        const uint32 nElements = lane.numberOfElements;
+        const T *const p1 = reinterpret_cast<const T*>(&window[1u][lane.offset]);
+        const T *const p2 = reinterpret_cast<const T*>(&window[2u][lane.offset]);
+        float64 *const c0 = &plane0[lane.coefficientIdx];
+        float64 *const c1 = &plane1[lane.coefficientIdx];
+        if (interpolationMode == InterpolationCubic) {
+            const T *const p0 = reinterpret_cast<const T*>(&window[0u][lane.offset]);
+            const T *const p3 = reinterpret_cast<const T*>(&window[3u][lane.offset]);
+            float64 *const c2 = &c1[numberOfCoefficientElements];
+            float64 *const c3 = &c2[numberOfCoefficientElements];
+            //At the start (end) of the data the previous (next) sample is a duplicate and is linearly extrapolated instead.
+            const bool startOfData = (windowX[0u] == windowX[1u]);
+            const bool endOfData = (windowX[3u] == windowX[2u]);
+            for (uint32 e = 0u; e < nElements; e++) {
+                //Wide types are interpolated relative to the start of the window (see EvaluateInterpolationTemplate)
+                const float64 y1 = wide ? 0.0 : static_cast<float64>(p1[e]);
+                const float64 y2 = wide ? InterpolationDelta<T>(p2[e], p1[e]) : static_cast<float64>(p2[e]);
+                const float64 y0 = startOfData ? ((2.0 * y1) - y2) : (wide ? InterpolationDelta<T>(p0[e], p1[e]) : static_cast<float64>(p0[e]));
+                const float64 y3 = endOfData ? ((2.0 * y2) - y1) : (wide ? InterpolationDelta<T>(p3[e], p1[e]) : static_cast<float64>(p3[e]));
+                c0[e] = (((-0.5 * y0) + (1.5 * y1)) - (1.5 * y2)) + (0.5 * y3);
+                c1[e] = ((y0 - (2.5 * y1)) + (2.0 * y2)) - (0.5 * y3);
+                c2[e] = 0.5 * (y2 - y0);
+                c3[e] = y1;
+            }
+        }
+        else {
+            //The slope is already divided by the window length so that the evaluation only needs the dt
+            for (uint32 e = 0u; e < nElements; e++) {
+                const float64 y1 = wide ? 0.0 : static_cast<float64>(p1[e]);
+                const float64 y2 = wide ? InterpolationDelta<T>(p2[e], p1[e]) : static_cast<float64>(p2[e]);
+                c0[e] = y1;
+                c1[e] = (y2 - y1) * windowInverseLength;
+            }
+        }
+    }
+}
+
+/*lint -e{826} the dataSourceMemory holds samples with the layout given by the lanes.*/
+template<typename T>
+void FileReader::EvaluateInterpolationTemplate(const FileReaderInterpolationGroup &group,
+                                               const float64 dt) {
+    const bool wide = IsWideInterpolated<T>();
+    const float64 *const plane0 = &interpolationCoefficients[0u];
+    const float64 *const plane1 = &interpolationCoefficients[numberOfCoefficientElements];
+    const uint32 lastLane = group.firstLane + group.numberOfLanes;
+    for (uint32 l = group.firstLane; l < lastLane; l++) {
+        const FileReaderInterpolationLane &lane = interpolationLanes[l];
+        const uint32 nElements = lane.numberOfElements;
+        T *const dst = reinterpret_cast<T*>(&dataSourceMemory[lane.offset]);
+        const T *const base = reinterpret_cast<const T*>(&window[1u][lane.offset]);
+        const float64 *const c0 = &plane0[lane.coefficientIdx];
+        const float64 *const c1 = &plane1[lane.coefficientIdx];
+        if (interpolationMode == InterpolationCubic) {
+            const float64 *const c2 = &c1[numberOfCoefficientElements];
+            const float64 *const c3 = &c2[numberOfCoefficientElements];
+            const float64 t = dt * windowInverseLength;
+            if (wide) {
+                for (uint32 e = 0u; e < nElements; e++) {
+                    dst[e] = OffsetInterpolated<T>(base[e], (((((c0[e] * t) + c1[e]) * t) + c2[e]) * t) + c3[e]);
+                }
+            }
+            else {
+                for (uint32 e = 0u; e < nElements; e++) {
+                    dst[e] = SaturateInterpolated<T>((((((c0[e] * t) + c1[e]) * t) + c2[e]) * t) + c3[e]);
+                }
+            }
+        }
+        else {
+            if (wide) {
+                for (uint32 e = 0u; e < nElements; e++) {
+                    dst[e] = OffsetInterpolated<T>(base[e], c0[e] + (c1[e] * dt));
+                }
+            }
+            else {
+                for (uint32 e = 0u; e < nElements; e++) {
+                    dst[e] = SaturateInterpolated<T>(c0[e] + (c1[e] * dt));
+                }
+            }
+        }
+    }
+}
+
+}
 
 #endif /* FILEDATASOURCE_FILEREADER_H_ */
 
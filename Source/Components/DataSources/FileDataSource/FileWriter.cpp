@@ -32,6 +32,7 @@
 #include "CLASSMETHODREGISTER.h"
 #include "Directory.h"
 #include "FileWriter.h"
+#include "HighResolutionTimer.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -44,6 +45,216 @@ namespace MARTe {
 static const int32 FILE_FORMAT_BINARY = 1;
 static const int32 FILE_FORMAT_CSV = 2;
 
+/**
+ * Identifiers of the type specialised csv print routines.
+ */
+static const uint8 CSV_KIND_PRINTF = 0u;
+static const uint8 CSV_KIND_UINT8 = 1u;
+static const uint8 CSV_KIND_UINT16 = 2u;
+static const uint8 CSV_KIND_UINT32 = 3u;
+static const uint8 CSV_KIND_UINT64 = 4u;
+static const uint8 CSV_KIND_INT8 = 5u;
+static const uint8 CSV_KIND_INT16 = 6u;
+static const uint8 CSV_KIND_INT32 = 7u;
+static const uint8 CSV_KIND_INT64 = 8u;
+static const uint8 CSV_KIND_FLOAT32 = 9u;
+static const uint8 CSV_KIND_FLOAT64 = 10u;
+
+/**
+ * Size of the memory block where the csv lines are accumulated before being written into the file.
+ */
+static const uint32 CSV_BLOCK_SIZE = 65536u;
+
+/**
+ * Maximum number of characters produced by the type specialised routines for one element.
+ */
+static const uint32 CSV_MAX_ELEMENT_SIZE = 32u;
+
+/**
+ * Absolute value below which floats are printed by FixedToChars. value * 1e6 is then below 2^50, so that the scaled value and its
+ * fractional part are known with an error below 1/16 of a digit. Any other float is printed with the standard printf.
+ */
+static const float64 CSV_FIXED_LIMIT = 1e9;
+
+/**
+ * Distance to a rounding tie of the seventh decimal digit below which FixedToChars does not decide the rounding (and lets the
+ * standard printf do it). Larger than the error of the scaled value.
+ */
+static const float64 CSV_FIXED_TIE_MARGIN = 0.125;
+
+/**
+ * @brief Writes the decimal representation of \a value in \a out.
+ * @return the number of characters written.
+ */
+static uint32 UnsignedToChars(uint64 value,
+                              char8 * const out) {
+    char8 digits[20u];
+    uint32 n = 0u;
+    do {
+        digits[n] = static_cast<char8>('0' + static_cast<char8>(value % 10u));
+        value /= 10u;
+        n++;
+    }
+    while (value > 0u);
+    for (uint32 i = 0u; i < n; i++) {
+        out[i] = digits[n - 1u - i];
+    }
+    return n;
+}
+
+/**
+ * @brief Writes the decimal representation of \a value in \a out.
+ * @return the number of characters written.
+ */
+static uint32 SignedToChars(const int64 value,
+                            char8 * const out) {
+    uint32 n = 0u;
+    uint64 magnitude = static_cast<uint64>(value);
+    if (value < 0) {
+        out[0] = '-';
+        n = 1u;
+        magnitude = (~magnitude) + 1u;
+    }
+    return n + UnsignedToChars(magnitude, &out[n]);
+}
+
+/**
+ * @brief Writes \a value in \a out in fixed point notation with six decimal digits, as "%f" does.
+ * @details The value is scaled by 1e6 and rounded to the nearest integer, whose digits are then written with the decimal point
+ * before the last six. The values which are not finite, |value| >= CSV_FIXED_LIMIT, the negative values that round to zero
+ * (whose sign printf keeps) and the values within CSV_FIXED_TIE_MARGIN of a rounding tie are not handled.
+ * @return false if the value is not handled.
+ */
+static bool FixedToChars(const float64 value,
+                         char8 * const out,
+                         uint32 &size) {
+    //Also false for NaN
+    bool ok = ((value > -CSV_FIXED_LIMIT) && (value < CSV_FIXED_LIMIT));
+    uint64 bits = 0u;
+    (void) MemoryOperationsHelper::Copy(&bits, &value, static_cast<uint32>(sizeof(float64)));
+    //The sign bit, so that -0.0 is also negative
+    const bool negative = ((bits >> 63u) != 0u);
+    uint64 scaled = 0u;
+    if (ok) {
+        const float64 magnitude = (negative ? -value : value) * 1e6;
+        scaled = static_cast<uint64>(magnitude);
+        const float64 fraction = magnitude - static_cast<float64>(scaled);
+        ok = ((fraction < (0.5 - CSV_FIXED_TIE_MARGIN)) || (fraction > (0.5 + CSV_FIXED_TIE_MARGIN)));
+        if (fraction > 0.5) {
+            scaled++;
+        }
+    }
+    if ((ok) && (negative)) {
+        ok = (scaled > 0u);
+    }
+    if (ok) {
+        size = 0u;
+        if (negative) {
+            out[0] = '-';
+            size = 1u;
+        }
+        size += UnsignedToChars(scaled / 1000000u, &out[size]);
+        out[size] = '.';
+        size++;
+        uint64 decimals = scaled % 1000000u;
+        for (uint32 i = 6u; i > 0u; i--) {
+            out[size + i - 1u] = static_cast<char8>('0' + static_cast<char8>(decimals % 10u));
+            decimals /= 10u;
+        }
+        size += 6u;
+    }
+    return ok;
+}
+
+/**
+ * @brief Prints the element at \a address in \a out using the routine identified by \a kind.
+ * @return false if the element cannot be printed by a type specialised routine.
+ */
+/*lint -e{927} -e{826} the address is known to point at an element of the type identified by kind.*/
+static bool ElementToChars(const uint8 kind,
+                           const char8 * const address,
+                           char8 * const out,
+                           uint32 &size) {
+    bool ok = true;
+    switch (kind) {
+    case CSV_KIND_UINT8:
+        size = UnsignedToChars(*reinterpret_cast<const uint8 *>(address), out);
+        break;
+    case CSV_KIND_UINT16:
+        size = UnsignedToChars(*reinterpret_cast<const uint16 *>(address), out);
+        break;
+    case CSV_KIND_UINT32:
+        size = UnsignedToChars(*reinterpret_cast<const uint32 *>(address), out);
+        break;
+    case CSV_KIND_UINT64:
+        size = UnsignedToChars(*reinterpret_cast<const uint64 *>(address), out);
+        break;
+    case CSV_KIND_INT8:
+        size = SignedToChars(*reinterpret_cast<const int8 *>(address), out);
+        break;
+    case CSV_KIND_INT16:
+        size = SignedToChars(*reinterpret_cast<const int16 *>(address), out);
+        break;
+    case CSV_KIND_INT32:
+        size = SignedToChars(*reinterpret_cast<const int32 *>(address), out);
+        break;
+    case CSV_KIND_INT64:
+        size = SignedToChars(*reinterpret_cast<const int64 *>(address), out);
+        break;
+    case CSV_KIND_FLOAT32:
+        ok = FixedToChars(static_cast<float64>(*reinterpret_cast<const float32 *>(address)), out, size);
+        break;
+    case CSV_KIND_FLOAT64:
+        ok = FixedToChars(*reinterpret_cast<const float64 *>(address), out, size);
+        break;
+    default:
+        ok = false;
+        break;
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the identifier of the type specialised routine that prints the \a type with the default format.
+ */
+static uint8 GetCSVKind(const TypeDescriptor &type) {
+    uint8 kind = CSV_KIND_PRINTF;
+    if (type == UnsignedInteger8Bit) {
+        kind = CSV_KIND_UINT8;
+    }
+    else if (type == UnsignedInteger16Bit) {
+        kind = CSV_KIND_UINT16;
+    }
+    else if (type == UnsignedInteger32Bit) {
+        kind = CSV_KIND_UINT32;
+    }
+    else if (type == UnsignedInteger64Bit) {
+        kind = CSV_KIND_UINT64;
+    }
+    else if (type == SignedInteger8Bit) {
+        kind = CSV_KIND_INT8;
+    }
+    else if (type == SignedInteger16Bit) {
+        kind = CSV_KIND_INT16;
+    }
+    else if (type == SignedInteger32Bit) {
+        kind = CSV_KIND_INT32;
+    }
+    else if (type == SignedInteger64Bit) {
+        kind = CSV_KIND_INT64;
+    }
+    else if (type == Float32Bit) {
+        kind = CSV_KIND_FLOAT32;
+    }
+    else if (type == Float64Bit) {
+        kind = CSV_KIND_FLOAT64;
+    }
+    else {
+        kind = CSV_KIND_PRINTF;
+    }
+    return kind;
+}
+
 FileWriter::FileWriter() :
         DataSourceI(),
         MessageI() {
@@ -63,6 +274,14 @@ FileWriter::FileWriter() :
     refreshContent = 0u;
     fullNotation =0u;
     signalsAnyType = NULL_PTR(AnyType *);
+    csvFormatters = NULL_PTR(FileWriterCSVFormatter *);
+    cyclesPerWrite = 1u;
+    writeBlock = NULL_PTR(char8 *);
+    writeBlockSize = 0u;
+    writeBlockCapacity = 0u;
+    bytesWritten = 0u;
+    writeTicks = 0u;
+    writeBlockMux.Create();
     filter = ReferenceT < RegisteredMethodsMessageFilter > (GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -86,6 +305,12 @@ FileWriter::~FileWriter() {
         delete[] signalsAnyType;
     }
     (void) CloseFile();
+    if (csvFormatters != NULL_PTR(FileWriterCSVFormatter *)) {
+        delete[] csvFormatters;
+    }
+    if (writeBlock != NULL_PTR(char8 *)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(writeBlock));
+    }
 }
 
 bool FileWriter::AllocateMemory() {
@@ -164,10 +389,18 @@ bool FileWriter::Synchronise() {
         }
 
         if (fileFormat == FILE_FORMAT_BINARY) {
-            uint32 writeSize = numberOfBinaryBytes;
-            ok = outputFile.Write(dataSourceMemory, writeSize);
-            if (ok) {
-                ok = (writeSize == numberOfBinaryBytes);
+            if (cyclesPerWrite > 1u) {
+                ok = (writeBlockMux.FastLock() == ErrorManagement::NoError);
+                if (ok) {
+                    ok = AppendToBlock(dataSourceMemory, numberOfBinaryBytes);
+                    if ((ok) && (writeBlockSize == writeBlockCapacity)) {
+                        ok = WriteBlock();
+                    }
+                    writeBlockMux.FastUnLock();
+                }
+            }
+            else {
+                ok = WriteToFile(dataSourceMemory, numberOfBinaryBytes);
             }
         }
         else {
@@ -179,7 +412,11 @@ bool FileWriter::Synchronise() {
                 }
             }
             else {
-                ok = outputFile.PrintFormatted(csvPrintfFormat.Buffer(), signalsAnyType);
+                ok = (writeBlockMux.FastLock() == ErrorManagement::NoError);
+                if (ok) {
+                    ok = PrintCSVLine();
+                    writeBlockMux.FastUnLock();
+                }
             }
             if (refreshContent > 0u) {
                 ok = outputFile.Flush();
@@ -341,6 +578,21 @@ bool FileWriter::Initialise(StructuredDataI& data) {
         //    fullNotation = 0u;
         //}
     }
+    if (ok) {
+        if (!data.Read("CyclesPerWrite", cyclesPerWrite)) {
+            cyclesPerWrite = 1u;
+        }
+        ok = (cyclesPerWrite > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "CyclesPerWrite shall be > 0u");
+        }
+        if ((ok) && (cyclesPerWrite > 1u)) {
+            ok = ((fileFormat == FILE_FORMAT_BINARY) && (refreshContent == 0u));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "CyclesPerWrite > 1 is only supported with FileFormat=binary and RefreshContent=0");
+            }
+        }
+    }
 
     if (ok) {
         ok = data.MoveRelative("Signals");
@@ -450,6 +702,22 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
     if (ok) {
         dataSourceMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(numberOfBinaryBytes));
     }
+    if (ok) {
+        if (cyclesPerWrite > 1u) {
+            writeBlockCapacity = (numberOfBinaryBytes * cyclesPerWrite);
+            REPORT_ERROR(ErrorManagement::Information, "Writing blocks of %u cycles (%u bytes)", cyclesPerWrite, writeBlockCapacity);
+        }
+        else if ((fileFormat == FILE_FORMAT_CSV) && (fullNotation == 0u)) {
+            writeBlockCapacity = CSV_BLOCK_SIZE;
+        }
+        else {
+            writeBlockCapacity = 0u;
+        }
+        if (writeBlockCapacity > 0u) {
+            writeBlock = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(writeBlockCapacity));
+            ok = (writeBlock != NULL_PTR(char8 *));
+        }
+    }
 
     //If the type is text prepare the Printf properties in advanced
     if (fileFormat == FILE_FORMAT_CSV) {
@@ -457,6 +725,7 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
         uint32 n;
         if (ok) {
             signalsAnyType = new AnyType[nOfSignals];
+            csvFormatters = new FileWriterCSVFormatter[nOfSignals];
         }
 
         for (n = 0u; (n < nOfSignals) && (ok); n++) {
@@ -490,6 +759,15 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
                 signalsAnyType[n] = AnyType(GetSignalType(n), 0u, signalAddress);
                 signalsAnyType[n].SetNumberOfDimensions(nDimensions);
                 signalsAnyType[n].SetNumberOfElements(0u, nElements);
+                csvFormatters[n].address = &dataSourceMemory[offsets[n]];
+                csvFormatters[n].isArray = (nDimensions > 0u);
+                csvFormatters[n].numberOfElements = nElements;
+                csvFormatters[n].elementSize = (GetSignalType(n).numberOfBits / 8u);
+                //Matrices and custom formats are printed with the standard printf
+                csvFormatters[n].kind = CSV_KIND_PRINTF;
+                if ((!customFormat) && (nDimensions < 2u)) {
+                    csvFormatters[n].kind = GetCSVKind(GetSignalType(n));
+                }
             }
 
             TypeDescriptor signalType = GetSignalType(n);
@@ -501,6 +779,9 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
                 if (ok) {
                     ok = csvPrintfFormat.Printf("%s%s", "%", format.Buffer());
                 }
+                if (ok) {
+                    ok = csvFormatters[n].printfFormat.Printf("%s%s", "%", format.Buffer());
+                }
                 else {
                     ok = false;
                     StreamString signalName;
@@ -514,18 +795,21 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
                 bool isFloat = (signalType.type == Float);
                 if (ok) {
                     if (isUnsignedInteger) {
-                        ok = csvPrintfFormat.Printf("%s", "%u");
+                        ok = csvFormatters[n].printfFormat.Printf("%s", "%u");
                     }
                     else if (isSignedInteger) {
-                        ok = csvPrintfFormat.Printf("%s", "%d");
+                        ok = csvFormatters[n].printfFormat.Printf("%s", "%d");
                     }
                     else if (isFloat) {
-                        ok = csvPrintfFormat.Printf("%s", "%f");
+                        ok = csvFormatters[n].printfFormat.Printf("%s", "%f");
                     }
                     else {
                         ok = false;
                         REPORT_ERROR(ErrorManagement::ParametersError, "Unsupported signal type.");
                     }
+                    if (ok) {
+                        ok = csvPrintfFormat.Printf("%s", csvFormatters[n].printfFormat.Buffer());
+                    }
                 }
             }
         }
@@ -561,6 +845,9 @@ ErrorManagement::ErrorType FileWriter::OpenFile(StreamString filenameIn) {
         fatalFileError = !outputFile.Open(filename.Buffer(), (BasicFile::ACCESS_MODE_W | BasicFile::FLAG_CREAT));
     }
 
+    writeBlockSize = 0u;
+    bytesWritten = 0u;
+    writeTicks = 0u;
     if (!fatalFileError) {
         uint32 n;
         uint32 nOfSignals = GetNumberOfSignals();
@@ -678,6 +965,9 @@ ErrorManagement::ErrorType FileWriter::CloseFile() {
     ErrorManagement::ErrorType err = FlushFile();
     if (err.ErrorsCleared()) {
         if (outputFile.IsOpen()) {
+            if (bytesWritten > 0u) {
+                REPORT_ERROR(ErrorManagement::Information, "Write throughput was %f MB/s", GetWriteThroughput());
+            }
             err = !outputFile.Close();
         }
         if (err.ErrorsCleared()) {
@@ -707,6 +997,15 @@ ErrorManagement::ErrorType FileWriter::FlushFile() {
             ok = brokerAsyncNoTrigger->Flush();
         }
     }
+    if (ok) {
+        if ((outputFile.IsOpen()) && (writeBlock != NULL_PTR(char8 *)) && (!fatalFileError)) {
+            ok = (writeBlockMux.FastLock() == ErrorManagement::NoError);
+            if (ok) {
+                ok = WriteBlock();
+                writeBlockMux.FastUnLock();
+            }
+        }
+    }
     if (ok) {
         if (outputFile.IsOpen()) {
             ok = outputFile.Flush();
@@ -758,6 +1057,124 @@ bool FileWriter::IsOverwrite() const {
     return overwrite;
 }
 
+uint32 FileWriter::GetCyclesPerWrite() const {
+    return cyclesPerWrite;
+}
+
+float64 FileWriter::GetWriteThroughput() const {
+    float64 throughput = 0.0;
+    if (writeTicks > 0u) {
+        float64 elapsed = static_cast<float64>(writeTicks) * HighResolutionTimer::Period();
+        throughput = (static_cast<float64>(bytesWritten) / elapsed) / 1e6;
+    }
+    return throughput;
+}
+
+bool FileWriter::WriteToFile(const char8 * const buffer,
+                             const uint32 size) {
+    uint32 writeSize = size;
+    uint64 tStart = HighResolutionTimer::Counter();
+    bool ok = outputFile.Write(buffer, writeSize);
+    writeTicks += (HighResolutionTimer::Counter() - tStart);
+    if (ok) {
+        ok = (writeSize == size);
+    }
+    if (ok) {
+        bytesWritten += size;
+    }
+    return ok;
+}
+
+bool FileWriter::WriteBlock() {
+    bool ok = true;
+    if (writeBlockSize > 0u) {
+        ok = WriteToFile(writeBlock, writeBlockSize);
+        writeBlockSize = 0u;
+    }
+    return ok;
+}
+
+bool FileWriter::AppendToBlock(const char8 * const buffer,
+                               const uint32 size) {
+    bool ok = true;
+    if ((writeBlockSize + size) > writeBlockCapacity) {
+        ok = WriteBlock();
+    }
+    if (ok) {
+        if (size > writeBlockCapacity) {
+            ok = WriteToFile(buffer, size);
+        }
+        else {
+            /*lint -e{613} writeBlock cannot be NULL if writeBlockCapacity > 0*/
+            ok = MemoryOperationsHelper::Copy(&writeBlock[writeBlockSize], buffer, size);
+            writeBlockSize += size;
+        }
+    }
+    return ok;
+}
+
+/*lint -e{613} csvFormatters and signalsAnyType cannot be NULL if the file format is csv*/
+bool FileWriter::PrintCSVLine() {
+    bool ok = true;
+    const uint32 separatorSize = static_cast<uint32>(csvSeparator.Size());
+    char8 element[CSV_MAX_ELEMENT_SIZE];
+    for (uint32 n = 0u; (n < numberOfSignals) && (ok); n++) {
+        if (n != 0u) {
+            ok = AppendToBlock(csvSeparator.Buffer(), separatorSize);
+        }
+        const FileWriterCSVFormatter &formatter = csvFormatters[n];
+        if (formatter.kind == CSV_KIND_PRINTF) {
+            //Printed over the previous content, so that the memory of the csvElementPrinted is reused
+            if (ok) {
+                ok = csvElementPrinted.Seek(0LLU);
+            }
+            if (ok) {
+                ok = csvElementPrinted.Printf(formatter.printfFormat.Buffer(), signalsAnyType[n]);
+            }
+            if (ok) {
+                ok = AppendToBlock(csvElementPrinted.Buffer(), static_cast<uint32>(csvElementPrinted.Position()));
+            }
+        }
+        else {
+            if ((ok) && (formatter.isArray)) {
+                ok = AppendToBlock("{ ", 2u);
+            }
+            for (uint32 e = 0u; (e < formatter.numberOfElements) && (ok); e++) {
+                const char8 * const address = &formatter.address[e * formatter.elementSize];
+                uint32 size = 0u;
+                if (ElementToChars(formatter.kind, address, &element[0], size)) {
+                    ok = AppendToBlock(&element[0], size);
+                }
+                else {
+                    //Not representable by the fixed notation routine (i.e. not finite, very large, negative zero or a rounding tie)
+                    ok = csvElementPrinted.Seek(0LLU);
+                    if (ok) {
+                        if (formatter.kind == CSV_KIND_FLOAT32) {
+                            ok = csvElementPrinted.Printf("%f", *reinterpret_cast<const float32 *>(address));
+                        }
+                        else {
+                            ok = csvElementPrinted.Printf("%f", *reinterpret_cast<const float64 *>(address));
+                        }
+                    }
+                    if (ok) {
+                        ok = AppendToBlock(csvElementPrinted.Buffer(), static_cast<uint32>(csvElementPrinted.Position()));
+                    }
+                }
+                if ((ok) && (formatter.isArray)) {
+                    ok = AppendToBlock(" ", 1u);
+                }
+            }
+            if ((ok) && (formatter.isArray)) {
+                ok = AppendToBlock("} ", 2u);
+            }
+        }
+    }
+    if (ok) {
+        ok = AppendToBlock("\n", 1u);
+    }
+    return ok;
+}
+
 void FileWriter::Purge(ReferenceContainer &purgeList) {
     if (FlushFile() != ErrorManagement::NoError) {
         REPORT_ERROR(ErrorManagement::FatalError, "Failed to Flush the File");
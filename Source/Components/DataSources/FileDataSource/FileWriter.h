@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "FastPollingMutexSem.h"
 #include "File.h"
 #include "MemoryMapAsyncOutputBroker.h"
 #include "MemoryMapAsyncTriggerOutputBroker.h"
@@ -43,6 +44,41 @@
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * @brief Precompiled description of how a signal is printed in a csv line.
+ */
+struct FileWriterCSVFormatter {
+    /**
+     * The address of the signal in the dataSourceMemory.
+     */
+    const char8 *address;
+
+    /**
+     * The identifier of the type specialised routine used to print each element (see FileWriter.cpp).
+     */
+    uint8 kind;
+
+    /**
+     * True if the signal has one or more dimensions and has to be printed between curly brackets.
+     */
+    bool isArray;
+
+    /**
+     * Number of elements of the signal.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * Size in bytes of each element.
+     */
+    uint32 elementSize;
+
+    /**
+     * The printf format used if the signal cannot be printed by a type specialised routine (e.g. custom Format).
+     */
+    StreamString printfFormat;
+};
+
 /**
  * @brief A DataSourceI interface which allows to store signals in a file.
  *
@@ -55,12 +91,17 @@ namespace MARTe {
  * e.g."#Trigger (uint8)[1];Time (uint32)[1];SignalUInt8 (uint8)[1];SignalUInt16 (uint16)[4]", where ; is the CSVSeparator.
  * A new line will be added every time all the signal samples are written.
  * The default number formats for a csv file are "%u" for unsigned integers, "%d" for signed integers and "%f" for floats.
+ * Signals with the default format are printed by type specialised routines which are selected once in SetConfiguredDatabase and which write
+ * into a memory block that is flushed into the file in large chunks.
  * A custom format can be chosen for each signal via the parameter "Format" (see signal SignalUInt16F in the example below) 
  *
  * If the format is binary an header with the following information is created: the first 4 bytes
  * contain the number of signals. Then, for each signal, the signal type will be encoded in two bytes, followed
  *  by 32 bytes to encode the signal name, followed by 4 bytes which store the number of elements of a given signal.
  *  Following the header the signal samples are consecutively stored in binary format.
+ * If the format is binary, the samples of CyclesPerWrite consecutive cycles can be accumulated in a memory block which is then written
+ *  to the file with a single write operation, thus reducing the number of system calls. A partially filled block is written when the file is flushed
+ *  or closed. The achieved write throughput (in MB/s) is reported when the file is closed and can be queried with GetWriteThroughput().
  *
  * This DataSourceI has the functions FlushFile, OpenFile and CloseFile registered as RPCs.
  *
@@ -80,6 +121,7 @@ namespace MARTe {
  *     CSVSeparator = "," //Compulsory if Format=csv. Sets the file separator type.
  *     StoreOnTrigger = 1 //Compulsory. If 0 all the data in the circular buffer is continuously stored. If 1 data is stored when the Trigger signal is 1 (see below).
  *     RefreshContent = 0 //Optional. If set, new data will always overwrite old data, keeping always the last snapshot. Also enables header pretty-printing, which is referred as "Full Notation".
+ *     CyclesPerWrite = 1 //Optional. Only valid if FileFormat is "binary" and RefreshContent = 0. Number of cycles to accumulate before writing into the file. Default = 1.
  *     NumberOfPreTriggers = 2 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store before the trigger.
  *     NumberOfPostTriggers = 1 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store after the trigger.
  *
@@ -222,6 +264,7 @@ public:
 
     /**
      * @brief Flushes the file.
+     * @details Any partially filled write block (see CyclesPerWrite and csv format) is also written into the file.
      * @return true if the file can be successfully flushed.
      */
     ErrorManagement::ErrorType FlushFile();
@@ -299,6 +342,18 @@ public:
      */
     bool IsOverwrite() const;
 
+    /**
+     * @brief Gets the number of cycles that are accumulated before writing into the file.
+     * @return the number of cycles that are accumulated before writing into the file.
+     */
+    uint32 GetCyclesPerWrite() const;
+
+    /**
+     * @brief Gets the write throughput, computed as the number of bytes written divided by the time spent writing.
+     * @return the binary write throughput in MB/s (0 if nothing was written yet).
+     */
+    float64 GetWriteThroughput() const;
+
     /**
      * @see DataSourceI::Purge()
      */
@@ -306,6 +361,42 @@ public:
 
 private:
 
+    /**
+     * @brief Writes \a size bytes into the output file and updates the throughput statistics.
+     * @param[in] buffer the data to write.
+     * @param[in] size the number of bytes to write.
+     * @return true if all the bytes were successfully written.
+     */
+    bool WriteToFile(const char8 * const buffer,
+                     const uint32 size);
+
+    /**
+     * @brief Writes the data accumulated in the write block into the output file.
+     * @pre
+     *   writeBlockMux is locked.
+     * @return true if the block was successfully written.
+     */
+    bool WriteBlock();
+
+    /**
+     * @brief Appends \a size bytes to the write block, writing the block into the file first if there is not enough space.
+     * @param[in] buffer the data to append.
+     * @param[in] size the number of bytes to append.
+     * @pre
+     *   writeBlockMux is locked.
+     * @return true if the data was successfully appended.
+     */
+    bool AppendToBlock(const char8 * const buffer,
+                       const uint32 size);
+
+    /**
+     * @brief Prints the current value of all the signals as a csv line in the write block, using the csvFormatters.
+     * @pre
+     *   writeBlockMux is locked.
+     * @return true if the line was successfully printed.
+     */
+    bool PrintCSVLine();
+
     /**
      * Copy of the original signal information. 
      * Needed to retrieve the "Format" parameter of the signals, not copied in configuredDatabase
@@ -392,6 +483,17 @@ private:
      */
     AnyType *signalsAnyType;
 
+    /**
+     * The precompiled csv formatter of each signal.
+     */
+    FileWriterCSVFormatter *csvFormatters;
+
+    /**
+     * Where the elements that are not printed by the type specialised routines are printed. Reused for every element, so that no
+     * memory is allocated once it has grown to the largest element.
+     */
+    StreamString csvElementPrinted;
+
     /**
      * If a fatal file error occurred do not try to flush segments nor do further writes.
      */
@@ -409,6 +511,41 @@ private:
      */
     File outputFile;
 
+    /**
+     * Number of cycles to accumulate before writing into the file.
+     */
+    uint32 cyclesPerWrite;
+
+    /**
+     * Memory holding the accumulated cycles when cyclesPerWrite > 1 or the csv lines to be written.
+     */
+    char8 *writeBlock;
+
+    /**
+     * Number of bytes currently accumulated in the writeBlock.
+     */
+    uint32 writeBlockSize;
+
+    /**
+     * Size in bytes of the writeBlock.
+     */
+    uint32 writeBlockCapacity;
+
+    /**
+     * Protects the writeBlock against concurrent flushes.
+     */
+    FastPollingMutexSem writeBlockMux;
+
+    /**
+     * Total number of bytes written by WriteToFile.
+     */
+    uint64 bytesWritten;
+
+    /**
+     * Total number of HighResolutionTimer ticks spent in WriteToFile.
+     */
+    uint64 writeTicks;
+
     /**
      * Refresh the content at each cycle
      */
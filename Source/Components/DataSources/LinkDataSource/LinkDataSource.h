@@ -49,6 +49,9 @@ namespace MARTe {
  * "IsWriter" that defines if this data source has to write or reads its signals memory from/to the linked
  * MemoryGate within the Synchronise() function.
  *
+ * @details To link signals between different processes, the Link shall point to a SharedMemoryGate, which keeps
+ * the buffers in a POSIX shared memory object. The configuration of the LinkDataSource does not change.
+ *
  * @details Follows an example of configuration.
  * <pre>
  *  +InputDataSource1 = {
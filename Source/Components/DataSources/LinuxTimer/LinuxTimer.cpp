@@ -31,11 +31,14 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "CLASSMETHODREGISTER.h"
 #include "HighResolutionTimeProvider.h"
 #include "LinuxTimer.h"
 #include "MemoryMapSynchronisedInputBroker.h"
 #include "ObjectRegistryDatabase.h"
 #include "ReferenceContainerFilterReferences.h"
+#include "RegisteredMethodsMessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -55,6 +58,20 @@ const uint32 LINUX_TIMER_EXEC_MODE_SPAWNED = 2u;
  * @brief Maximum phase of the signal (default)
  */
 const uint32 USEC_IN_SEC = 1000000u;
+
+/**
+ * @brief Maximum number of attempts to read a consistent copy of the statistics.
+ */
+const uint32 LINUX_TIMER_STATISTICS_MAX_RETRIES = 1000u;
+}
+
+namespace {
+/**
+ * @brief Saturates a value to the largest uint32.
+ */
+MARTe::uint32 LinuxTimerSaturateU32(const MARTe::uint64 value) {
+    return (value > 0xFFFFFFFFull) ? (0xFFFFFFFFu) : (static_cast<MARTe::uint32>(value));
+}
 }
 
 /*---------------------------------------------------------------------------*/
@@ -85,10 +102,31 @@ LinuxTimer::LinuxTimer() :
     phaseBackup = phase;
     trigRephase = 0u;
     resyncPhase = false;
+    nsPerTick = 0.;
+    statisticsSignals[0] = 0u;
+    statisticsSignals[1] = 0u;
+    statisticsSignals[2] = 0u;
+    statistics.numberOfCycles = 0u;
+    statistics.missedPeriods = 0u;
+    statistics.lastLateness = 0u;
+    statistics.maxLateness = 0u;
+    statistics.sumLateness = 0u;
+    statistics.maxOverrun = 0u;
+    latenessHistogram = NULL_PTR(volatile uint32 *);
+    latenessHistogramNumberOfBins = 16u;
+    latenessHistogramBinWidth = 1000u;
+    statisticsSequence = 0;
+    statisticsResetRequested = 0;
 
     if (!synchSem.Create()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
     }
+    ReferenceT<RegisteredMethodsMessageFilter> filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
 }
 
 /*lint -e{1551} the destructor must guarantee that the Timer SingleThreadService is stopped.*/
@@ -101,6 +139,9 @@ LinuxTimer::~LinuxTimer() {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
         }
     }
+    if (latenessHistogram != NULL_PTR(volatile uint32 *)) {
+        delete[] latenessHistogram;
+    }
 }
 
 bool LinuxTimer::AllocateMemory() {
@@ -270,6 +311,26 @@ bool LinuxTimer::Initialise(StructuredDataI &data) {
 
         if (ok) {
             ticksPerUs = (static_cast<float64>(timeProvider->Frequency()) / 1.0e6);
+            nsPerTick = (1.0e9 / static_cast<float64>(timeProvider->Frequency()));
+        }
+
+        if (ok) {
+            if (!data.Read("LatenessHistogramBinWidth", latenessHistogramBinWidth)) {
+                latenessHistogramBinWidth = 1000u;
+            }
+            if (!data.Read("LatenessHistogramNumberOfBins", latenessHistogramNumberOfBins)) {
+                latenessHistogramNumberOfBins = 16u;
+            }
+            ok = ((latenessHistogramBinWidth > 0u) && (latenessHistogramNumberOfBins > 0u));
+            if (ok) {
+                latenessHistogram = new uint32[latenessHistogramNumberOfBins];
+                for (uint32 i = 0u; i < latenessHistogramNumberOfBins; i++) {
+                    latenessHistogram[i] = 0u;
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "LatenessHistogramBinWidth and LatenessHistogramNumberOfBins shall be > 0");
+            }
         }
     }
     else {
@@ -284,10 +345,10 @@ bool LinuxTimer::SetConfiguredDatabase(StructuredDataI &data) {
     uint32 tempNumOfSignals = GetNumberOfSignals();
 
     if (ok) {
-        ok = (tempNumOfSignals >= 2u) && (tempNumOfSignals <= 5u);
+        ok = (tempNumOfSignals >= 2u) && (tempNumOfSignals <= 8u);
     }
     if (!ok) {
-        REPORT_ERROR(ErrorManagement::ParametersError, "Number of signal must be between 2 and 5");
+        REPORT_ERROR(ErrorManagement::ParametersError, "Number of signal must be between 2 and 8");
     }
     if (ok) {
         ok = (GetSignalType(0u).numberOfBits == 32u);
@@ -346,6 +407,14 @@ bool LinuxTimer::SetConfiguredDatabase(StructuredDataI &data) {
         }
     }
 
+    //Lateness, MaxOverrun and MissedPeriods
+    for (uint32 i = 5u; (i < tempNumOfSignals) && (ok); i++) {
+        ok = ((GetSignalType(i).type == UnsignedInteger) && (GetSignalType(i).numberOfBits == 32u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The signal %d must be a 32 bit unsigned integer", i);
+        }
+    }
+
     if (ok) {
         ReferenceContainer result;
         ReferenceContainerFilterReferences filter(1, ReferenceContainerFilterMode::PATH, this);
@@ -381,6 +450,9 @@ bool LinuxTimer::GetSignalMemoryBuffer(const uint32 signalIdx,
     else if (signalIdx == 4u) {
         signalAddress = &trigRephase;
     }
+    else if (signalIdx < 8u) {
+        signalAddress = &statisticsSignals[signalIdx - 5u];
+    }
     else {
         ok = false;
     }
@@ -556,6 +628,9 @@ ErrorManagement::ErrorType LinuxTimer::Execute(ExecutionInfo &info) {
     sleepTimeTicksT = sleepTimeTicks[appIndex];
 
     uint64 cycleEndTicks = timeProvider->Counter();
+    //Start of the period that follows the previous cycle (only meaningful if the phase is not changed)
+    uint64 nextPeriodTicks = startTimeTicks + sleepTimeTicksT;
+    bool rephased = ((trigRephase > 0u) || (resyncPhase));
 
     if (trigRephase > 0u) {
         startTimeTicks = cycleEndTicks;
@@ -610,6 +685,7 @@ ErrorManagement::ErrorType LinuxTimer::Execute(ExecutionInfo &info) {
         uint64 microsecs = static_cast<uint64>(seconds) * static_cast<uint64>(USEC_IN_SEC);
         deltaTime = (microsecs - absoluteTime_1);
         absoluteTime_1 = microsecs;
+        UpdateStatistics(cycleEndTicks, nextPeriodTicks, newCounter, nCycles, rephased);
     }
 
     if (executionMode == LINUX_TIMER_EXEC_MODE_SPAWNED) {
@@ -631,6 +707,155 @@ uint32 LinuxTimer::GetSleepPercentage() const {
     return sleepPercentage;
 }
 
+void LinuxTimer::UpdateStatistics(const uint64 cycleEndTicks,
+                                  const uint64 nextPeriodTicks,
+                                  const uint64 wakeUpTicks,
+                                  const uint32 nCycles,
+                                  const bool rephased) {
+    //startTimeTicks is the ideal start of the period that was waited for
+    uint64 latenessTicks = (wakeUpTicks > startTimeTicks) ? (wakeUpTicks - startTimeTicks) : (0u);
+    uint64 lateness = static_cast<uint64>(static_cast<float64>(latenessTicks) * nsPerTick);
+    uint64 overrun = 0u;
+    uint64 missed = 0u;
+    if (!rephased) {
+        if (cycleEndTicks > nextPeriodTicks) {
+            overrun = static_cast<uint64>(static_cast<float64>(cycleEndTicks - nextPeriodTicks) * nsPerTick);
+        }
+        if (nCycles > 1u) {
+            missed = static_cast<uint64>(nCycles) - 1u;
+        }
+    }
+
+    //Odd while updating
+    (void) Atomic::Increment(&statisticsSequence);
+    if (statisticsResetRequested != 0) {
+        (void) Atomic::Exchange(&statisticsResetRequested, 0);
+        statistics.numberOfCycles = 0u;
+        statistics.missedPeriods = 0u;
+        statistics.maxLateness = 0u;
+        statistics.sumLateness = 0u;
+        statistics.maxOverrun = 0u;
+        for (uint32 i = 0u; i < latenessHistogramNumberOfBins; i++) {
+            /*lint -e{613} latenessHistogram is allocated in Initialise*/
+            latenessHistogram[i] = 0u;
+        }
+    }
+    statistics.numberOfCycles++;
+    statistics.missedPeriods += missed;
+    statistics.lastLateness = lateness;
+    statistics.sumLateness += lateness;
+    if (lateness > statistics.maxLateness) {
+        statistics.maxLateness = lateness;
+    }
+    if (overrun > statistics.maxOverrun) {
+        statistics.maxOverrun = overrun;
+    }
+    if (latenessHistogram != NULL_PTR(volatile uint32 *)) {
+        uint64 bin = lateness / latenessHistogramBinWidth;
+        if (bin >= latenessHistogramNumberOfBins) {
+            bin = latenessHistogramNumberOfBins - 1u;
+        }
+        latenessHistogram[bin]++;
+    }
+    statisticsSignals[0] = LinuxTimerSaturateU32(lateness);
+    statisticsSignals[1] = LinuxTimerSaturateU32(statistics.maxOverrun);
+    statisticsSignals[2] = LinuxTimerSaturateU32(statistics.missedPeriods);
+    (void) Atomic::Increment(&statisticsSequence);
+}
+
+bool LinuxTimer::GetStatistics(LinuxTimerStatistics &stats,
+                               uint32 * const histogram,
+                               const uint32 numberOfBins) const {
+    bool ok = (histogram == NULL_PTR(uint32 *));
+    if (!ok) {
+        ok = ((numberOfBins == latenessHistogramNumberOfBins) && (latenessHistogram != NULL_PTR(volatile uint32 *)));
+    }
+    bool consistent = false;
+    for (uint32 retries = 0u; (retries < LINUX_TIMER_STATISTICS_MAX_RETRIES) && (ok) && (!consistent); retries++) {
+        int32 sequence = statisticsSequence;
+        if ((sequence & 1) == 0) {
+            stats.numberOfCycles = statistics.numberOfCycles;
+            stats.missedPeriods = statistics.missedPeriods;
+            stats.lastLateness = statistics.lastLateness;
+            stats.maxLateness = statistics.maxLateness;
+            stats.sumLateness = statistics.sumLateness;
+            stats.maxOverrun = statistics.maxOverrun;
+            if (histogram != NULL_PTR(uint32 *)) {
+                for (uint32 i = 0u; i < numberOfBins; i++) {
+                    /*lint -e{613} latenessHistogram cannot be NULL as otherwise ok would be false*/
+                    histogram[i] = latenessHistogram[i];
+                }
+            }
+            consistent = (sequence == statisticsSequence);
+        }
+    }
+    return (ok) && (consistent);
+}
+
+uint32 LinuxTimer::GetLatenessHistogramNumberOfBins() const {
+    return latenessHistogramNumberOfBins;
+}
+
+uint32 LinuxTimer::GetLatenessHistogramBinWidth() const {
+    return latenessHistogramBinWidth;
+}
+
+ErrorManagement::ErrorType LinuxTimer::ReportStatistics(ReferenceContainer &message) {
+    ErrorManagement::ErrorType ret = ErrorManagement::NoError;
+
+    // Assume one ReferenceT<StructuredDataI> contained in the message
+    bool ok = (message.Size() == 1u);
+    ReferenceT<StructuredDataI> data = message.Get(0u);
+    if (ok) {
+        ok = data.IsValid();
+    }
+    if (!ok) {
+        ret = ErrorManagement::ParametersError;
+        REPORT_ERROR(ret, "Message does not contain a ReferenceT<StructuredDataI>");
+    }
+    LinuxTimerStatistics stats;
+    Vector<uint32> histogram(latenessHistogramNumberOfBins);
+    if (ok) {
+        ok = GetStatistics(stats, static_cast<uint32 *>(histogram.GetDataPointer()), latenessHistogramNumberOfBins);
+        if (!ok) {
+            ret = ErrorManagement::Timeout;
+            REPORT_ERROR(ret, "Could not read a consistent copy of the statistics");
+        }
+    }
+    if (ok) {
+        uint64 meanLateness = (stats.numberOfCycles > 0u) ? (stats.sumLateness / stats.numberOfCycles) : (0u);
+        ok = data->Write("NumberOfCycles", stats.numberOfCycles);
+        if (ok) {
+            ok = data->Write("MissedPeriods", stats.missedPeriods);
+        }
+        if (ok) {
+            ok = data->Write("LastLateness", stats.lastLateness);
+        }
+        if (ok) {
+            ok = data->Write("MaxLateness", stats.maxLateness);
+        }
+        if (ok) {
+            ok = data->Write("MeanLateness", meanLateness);
+        }
+        if (ok) {
+            ok = data->Write("MaxOverrun", stats.maxOverrun);
+        }
+        if (ok) {
+            ok = data->Write("LatenessHistogram", histogram);
+        }
+        if (!ok) {
+            ret = ErrorManagement::FatalError;
+            REPORT_ERROR(ret, "Could not write the statistics");
+        }
+    }
+    return ret;
+}
+
+ErrorManagement::ErrorType LinuxTimer::ResetStatistics() {
+    (void) Atomic::Exchange(&statisticsResetRequested, 1);
+    return ErrorManagement::NoError;
+}
+
 void LinuxTimer::Purge(ReferenceContainer &purgeList) {
     if (rtApp.IsValid()) {
         rtApp->Purge(purgeList);
@@ -639,6 +864,8 @@ void LinuxTimer::Purge(ReferenceContainer &purgeList) {
 }
 
 CLASS_REGISTER(LinuxTimer, "1.0")
+CLASS_METHOD_REGISTER(LinuxTimer, ReportStatistics)
+CLASS_METHOD_REGISTER(LinuxTimer, ResetStatistics)
 
 }
 
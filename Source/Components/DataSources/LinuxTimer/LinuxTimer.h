@@ -34,6 +34,7 @@
 #include "DataSourceI.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
+#include "MessageI.h"
 #include "RealTimeApplication.h"
 #include "SingleThreadService.h"
 #include "TimeProvider.h"
@@ -43,6 +44,41 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * @brief Statistics of the LinuxTimer wake-ups (all the times are in nanoseconds).
+ */
+struct LinuxTimerStatistics {
+    /**
+     * Number of cycles since the last reset.
+     */
+    uint64 numberOfCycles;
+
+    /**
+     * Number of periods that were skipped because the previous cycle took longer than the period.
+     */
+    uint64 missedPeriods;
+
+    /**
+     * Wake-up lateness (w.r.t. the ideal start of the period) of the last cycle.
+     */
+    uint64 lastLateness;
+
+    /**
+     * Maximum wake-up lateness.
+     */
+    uint64 maxLateness;
+
+    /**
+     * Sum of the wake-up lateness of all the cycles (the mean is sumLateness / numberOfCycles).
+     */
+    uint64 sumLateness;
+
+    /**
+     * Maximum time by which a cycle returned to the timer after the start of the next period.
+     */
+    uint64 maxOverrun;
+};
+
 /**
  * @brief A DataSource which provides a timing source for a MARTe application.
  * @details The LinuxTimer provides a timing generation facility where generators can be conveniently plugged in.
@@ -90,7 +126,18 @@ namespace MARTe {
  *         TrigRephase = { //Optional, can be omitted
  *             Type = uint8 //Only type supported
  *         }*
+ *         Lateness = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
+ *         MaxOverrun = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
+ *         MissedPeriods = { //Optional, can be omitted
+ *             Type = uint32 //Only type supported
+ *         }
  *     }
+ *     LatenessHistogramBinWidth = 1000 //Optional, defaults to 1000. Width in ns of each bin of the lateness histogram.
+ *     LatenessHistogramNumberOfBins = 16 //Optional, defaults to 16. Number of bins of the lateness histogram (the last bin counts all the larger values).
  * }
  * </pre>
  *
@@ -108,11 +155,20 @@ namespace MARTe {
  *   - AbsoluteTime: uses TimeProvider::Counter and TimeProvider::Period to get an absolute time
  *   - DeltaTime: time difference between two cycles
  *   - TrigRephase: if equal to 1 rephases the time synchronisation when the Execute method is called.
+ *   - Lateness: wake-up lateness in ns of the current cycle w.r.t. the ideal start of the period.
+ *   - MaxOverrun: maximum time in ns by which a cycle returned to the timer after the start of the next period.
+ *   - MissedPeriods: number of periods that were skipped because a cycle took longer than the period.
+ *
+ * @details The statistics (see LinuxTimerStatistics) and a histogram of the wake-up lateness (i.e. of the jitter) are always updated
+ *  by the thread that waits for the period (a few integer operations per cycle). They are published in a lock-free block (sequence counter
+ *  incremented before and after each update) which can be read by any thread with GetStatistics, or by sending a message to the registered
+ *  method ReportStatistics (which writes NumberOfCycles, MissedPeriods, LastLateness, MaxLateness, MeanLateness, MaxOverrun and
+ *  LatenessHistogram in the StructuredDataI of the message). The registered method ResetStatistics resets them at the next cycle.
  *
  * @details When TrigRephase is equal to 1, the phase changes and it is kept across a state change if the data source is consumed in both current and next state.
  * If the data source is not used in the current state the phase will be reset to the configured one before the next state execution.
  */
-class LinuxTimer: public DataSourceI, public EmbeddedServiceMethodBinderI {
+class LinuxTimer: public DataSourceI, public EmbeddedServiceMethodBinderI, public MessageI {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
@@ -213,6 +269,7 @@ public:
      * @brief Verifies that two, and only two, signal are set with the correct type.
      * @details Verifies that two, and only two, signal are set; that the signals are
      * 32 bits in size with a SignedInteger or UnsignedInteger type and that a Frequency > 0 was set in one of the two signals.
+     * Up to six additional signals can be set with the types listed in the class description.
      * @param[in] data see DataSourceI::SetConfiguredDatabase
      * @return true if the rules above are met.
      */
@@ -241,8 +298,58 @@ public:
     */
     virtual void Purge(ReferenceContainer &purgeList);
 
+    /**
+     * @brief Gets a consistent copy of the statistics. Can be called by any thread while the timer is running.
+     * @param[out] stats the statistics.
+     * @param[out] histogram if not NULL, where to copy the lateness histogram.
+     * @param[in] numberOfBins number of elements of \a histogram. Shall be equal to GetLatenessHistogramNumberOfBins if \a histogram is not NULL.
+     * @return true if a consistent copy could be read (it is retried while the timer is updating the statistics).
+     */
+    bool GetStatistics(LinuxTimerStatistics &stats,
+                       uint32 * const histogram,
+                       const uint32 numberOfBins) const;
+
+    /**
+     * @brief Gets the number of bins of the lateness histogram.
+     * @return the number of bins of the lateness histogram.
+     */
+    uint32 GetLatenessHistogramNumberOfBins() const;
+
+    /**
+     * @brief Gets the width in ns of each bin of the lateness histogram.
+     * @return the width in ns of each bin of the lateness histogram.
+     */
+    uint32 GetLatenessHistogramBinWidth() const;
+
+    /**
+     * @brief Registered method which writes the statistics (see class description) in the StructuredDataI of the message.
+     * @param[in] message shall contain one ReferenceT<StructuredDataI>.
+     * @return ErrorManagement::NoError if the statistics could be read and written.
+     */
+    ErrorManagement::ErrorType ReportStatistics(ReferenceContainer &message);
+
+    /**
+     * @brief Registered method which requests the statistics to be reset at the next cycle.
+     * @return ErrorManagement::NoError.
+     */
+    ErrorManagement::ErrorType ResetStatistics();
+
 private:
 
+    /**
+     * @brief Updates the statistics and the statistics signals after the sleep.
+     * @param[in] cycleEndTicks the counter when Execute was called.
+     * @param[in] nextPeriodTicks the counter of the start of the period that followed the previous cycle.
+     * @param[in] wakeUpTicks the counter after the sleep.
+     * @param[in] nCycles the number of periods elapsed since the previous cycle.
+     * @param[in] rephased true if the phase was changed in this cycle (no overrun is computed).
+     */
+    void UpdateStatistics(const uint64 cycleEndTicks,
+                          const uint64 nextPeriodTicks,
+                          const uint64 wakeUpTicks,
+                          const uint32 nCycles,
+                          const bool rephased);
+
     /**
      * @brief The two supported sleep natures.
      */
@@ -364,6 +471,46 @@ private:
      * @brief Trigger a phase resync
      */
     bool resyncPhase;
+
+    /**
+     * @brief Number of ns in a tick.
+     */
+    float64 nsPerTick;
+
+    /**
+     * @brief The Lateness, MaxOverrun and MissedPeriods signals.
+     */
+    uint32 statisticsSignals[3];
+
+    /**
+     * @brief The statistics. Only written by the thread that waits for the period.
+     */
+    volatile LinuxTimerStatistics statistics;
+
+    /**
+     * @brief The lateness histogram.
+     */
+    volatile uint32 *latenessHistogram;
+
+    /**
+     * @brief Number of bins of the lateness histogram.
+     */
+    uint32 latenessHistogramNumberOfBins;
+
+    /**
+     * @brief Width in ns of each bin of the lateness histogram.
+     */
+    uint32 latenessHistogramBinWidth;
+
+    /**
+     * @brief Incremented before and after each update of the statistics (odd while updating).
+     */
+    volatile int32 statisticsSequence;
+
+    /**
+     * @brief Set to 1 to reset the statistics at the next cycle.
+     */
+    volatile int32 statisticsResetRequested;
 };
 }
 
@@ -32,7 +32,9 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "CompilerTypes.h"
+#include "HighResolutionTimer.h"
 #include "LoggerBroker.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -47,9 +49,18 @@ LoggerBroker::LoggerBroker() :
     outputSignals = NULL_PTR(AnyType *);
     cycleCounter = 0u;
     cyclePeriod = 0u;
+    copySignalIdx = NULL_PTR(uint32 *);
+    slotOffsets = NULL_PTR(uint32 *);
+    droppedSamples = 0u;
+    reportedDroppedSamples = 0u;
+    filters = NULL_PTR(LoggerBrokerSignalFilter *);
+    decimationCounters = NULL_PTR(uint32 *);
+    lastPrintCounts = NULL_PTR(uint64 *);
+    printed = NULL_PTR(bool *);
+    lastPrintedValues = NULL_PTR(char8 *);
 }
 
-/*lint -e{1551} the destructor must guarantee that the signalNames and outputSignals are freed.*/
+/*lint -e{1551} the destructor must guarantee that the signalNames, outputSignals and the slotOffsets are freed.*/
 LoggerBroker::~LoggerBroker() {
     if (signalNames != NULL_PTR(StreamString *)) {
         delete[] signalNames;
@@ -57,6 +68,27 @@ LoggerBroker::~LoggerBroker() {
     if (outputSignals != NULL_PTR(AnyType *)) {
         delete[] outputSignals;
     }
+    if (copySignalIdx != NULL_PTR(uint32 *)) {
+        delete[] copySignalIdx;
+    }
+    if (slotOffsets != NULL_PTR(uint32 *)) {
+        delete[] slotOffsets;
+    }
+    if (filters != NULL_PTR(LoggerBrokerSignalFilter *)) {
+        delete[] filters;
+    }
+    if (decimationCounters != NULL_PTR(uint32 *)) {
+        delete[] decimationCounters;
+    }
+    if (lastPrintCounts != NULL_PTR(uint64 *)) {
+        delete[] lastPrintCounts;
+    }
+    if (printed != NULL_PTR(bool *)) {
+        delete[] printed;
+    }
+    if (lastPrintedValues != NULL_PTR(char8 *)) {
+        delete[] lastPrintedValues;
+    }
 }
 
 bool LoggerBroker::Init(SignalDirection const direction,
@@ -70,6 +102,7 @@ bool LoggerBroker::Init(SignalDirection const direction,
     if (ok) {
         outputSignals = new AnyType[numberOfCopies];
         signalNames = new StreamString[numberOfCopies];
+        copySignalIdx = new uint32[numberOfCopies];
     }
     //Find the function
     uint32 functionIdx = 0u;
@@ -125,6 +158,10 @@ bool LoggerBroker::Init(SignalDirection const direction,
                 ok = signalNames[c].Printf("%s [%d:%d]", signalAlias.Buffer(), startIdx, endIdx - 1u);
             }
 
+            if (copySignalIdx != NULL_PTR(uint32 *)) {
+                copySignalIdx[c] = signalIdx;
+            }
+
             AnyType printType(signalDesc, 0u, GetFunctionPointer(c));
             if (outputSignals != NULL_PTR(AnyType *)) {
                 outputSignals[c] = printType;
@@ -141,15 +178,128 @@ void LoggerBroker::SetPeriod(const uint32 cyclePeriodIn) {
     cyclePeriod = cyclePeriodIn;
 }
 
+/*lint -e{613} copySignalIdx cannot be NULL after Init.*/
+bool LoggerBroker::EnableDeferred(const uint32 numberOfBuffersIn,
+                                  const LoggerBrokerSignalFilter * const filtersIn) {
+    bool ok = ((numberOfBuffersIn > 0u) && (!ring.IsInitialised()) && (copySignalIdx != NULL_PTR(uint32 *)));
+    if (ok) {
+        slotOffsets = new uint32[numberOfCopies];
+        filters = new LoggerBrokerSignalFilter[numberOfCopies];
+        decimationCounters = new uint32[numberOfCopies];
+        lastPrintCounts = new uint64[numberOfCopies];
+        printed = new bool[numberOfCopies];
+        uint32 slotSize = 0u;
+        uint32 n;
+        for (n = 0u; n < numberOfCopies; n++) {
+            slotOffsets[n] = slotSize;
+            slotSize += GetCopyByteSize(n);
+            if (filtersIn != NULL_PTR(const LoggerBrokerSignalFilter *)) {
+                filters[n] = filtersIn[copySignalIdx[n]];
+            }
+            else {
+                filters[n].decimation = 1u;
+                filters[n].onChange = false;
+                filters[n].minimumPeriodCounts = 0u;
+            }
+            if (filters[n].decimation == 0u) {
+                filters[n].decimation = 1u;
+            }
+            //So that the first sample is printed
+            decimationCounters[n] = filters[n].decimation - 1u;
+            lastPrintCounts[n] = 0u;
+            printed[n] = false;
+        }
+        lastPrintedValues = new char8[slotSize];
+        ok = ring.Initialise(numberOfBuffersIn, slotSize);
+    }
+    return ok;
+}
+
+bool LoggerBroker::IsDeferred() const {
+    return ring.IsInitialised();
+}
+
+uint32 LoggerBroker::GetNumberOfDroppedSamples() const {
+    return droppedSamples;
+}
+
+/*lint -e{613} all the arrays are allocated by EnableDeferred.*/
+uint32 LoggerBroker::ConsumeSamples() {
+    uint32 consumed = 0u;
+    if ((ring.IsInitialised()) && (outputSignals != NULL_PTR(AnyType *)) && (signalNames != NULL_PTR(StreamString *))) {
+        const char8 *slot = ring.GetReadSlot(0u);
+        while (slot != NULL_PTR(const char8 *)) {
+            uint32 n;
+            for (n = 0u; n < numberOfCopies; n++) {
+                const char8 *value = &slot[slotOffsets[n]];
+                uint32 size = GetCopyByteSize(n);
+                decimationCounters[n]++;
+                bool print = (decimationCounters[n] >= filters[n].decimation);
+                if (print) {
+                    decimationCounters[n] = 0u;
+                    if ((filters[n].onChange) && (printed[n])) {
+                        print = (MemoryOperationsHelper::Compare(value, &lastPrintedValues[slotOffsets[n]], size) != 0);
+                    }
+                }
+                uint64 nowCounts = 0u;
+                if ((print) && (filters[n].minimumPeriodCounts > 0u)) {
+                    nowCounts = HighResolutionTimer::Counter();
+                    if (printed[n]) {
+                        print = ((nowCounts - lastPrintCounts[n]) >= filters[n].minimumPeriodCounts);
+                    }
+                }
+                if (print) {
+                    AnyType printType(outputSignals[n].GetTypeDescriptor(), 0u, value);
+                    printType.SetNumberOfDimensions(outputSignals[n].GetNumberOfDimensions());
+                    printType.SetNumberOfElements(0u, outputSignals[n].GetNumberOfElements(0u));
+                    REPORT_ERROR(ErrorManagement::Information, "%s:%!", signalNames[n].Buffer(), printType);
+                    if (filters[n].onChange) {
+                        (void) MemoryOperationsHelper::Copy(&lastPrintedValues[slotOffsets[n]], value, size);
+                    }
+                    lastPrintCounts[n] = nowCounts;
+                    printed[n] = true;
+                }
+            }
+            //Only now can Execute reuse the slot
+            ring.Release(1u);
+            consumed++;
+            slot = ring.GetReadSlot(0u);
+        }
+        uint32 dropped = droppedSamples;
+        if (dropped != reportedDroppedSamples) {
+            REPORT_ERROR(ErrorManagement::Warning, "Dropped %d samples (ring full)", (dropped - reportedDroppedSamples));
+            reportedDroppedSamples = dropped;
+        }
+    }
+    return consumed;
+}
+
 bool LoggerBroker::Execute() {
 
     cycleCounter++;
     if (cycleCounter >= cyclePeriod) {
 
-        uint32 n;
-        for (n = 0u; n < numberOfCopies; n++) {
-            if ((signalNames != NULL_PTR(StreamString *)) && (outputSignals != NULL_PTR(AnyType *))) {
-                REPORT_ERROR(ErrorManagement::Information, "%s:%!", signalNames[n].Buffer(), outputSignals[n]);
+        if (ring.IsInitialised()) {
+            //Deferred: only copy the signals to the next free slot
+            char8 *slot = ring.GetWriteSlot();
+            if (slot != NULL_PTR(char8 *)) {
+                uint32 n;
+                for (n = 0u; n < numberOfCopies; n++) {
+                    /*lint -e{613} slotOffsets is allocated together with the ring*/
+                    (void) MemoryOperationsHelper::Copy(&slot[slotOffsets[n]], GetFunctionPointer(n), GetCopyByteSize(n));
+                }
+                ring.Commit();
+            }
+            else {
+                droppedSamples++;
+            }
+        }
+        else {
+            uint32 n;
+            for (n = 0u; n < numberOfCopies; n++) {
+                if ((signalNames != NULL_PTR(StreamString *)) && (outputSignals != NULL_PTR(AnyType *))) {
+                    REPORT_ERROR(ErrorManagement::Information, "%s:%!", signalNames[n].Buffer(), outputSignals[n]);
+                }
             }
         }
         cycleCounter = 0u;
@@ -32,16 +32,41 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "BrokerI.h"
+#include "SampleRing.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * @brief Filter applied to a signal before it is printed by the LoggerBroker in deferred mode.
+ */
+struct LoggerBrokerSignalFilter {
+    /**
+     * Only print one out of every decimation samples (1 means print all the samples).
+     */
+    uint32 decimation;
+
+    /**
+     * Only print the sample if its value changed since the last time it was printed.
+     */
+    bool onChange;
+
+    /**
+     * Minimum number of HighResolutionTimer counts between two prints (0 means no limit).
+     */
+    uint64 minimumPeriodCounts;
+};
+
 /**
  * @brief a BrokerI implementation for the LoggerDataSource.
  * @details The Execute method prints to the REPORT_ERROR stream the value of all
  *  the registered signals, using the AnyType Printf.
+ *
+ * If EnableDeferred is called, the Execute method only copies the signals to a single-producer/single-consumer
+ *  ring of samples and the printing is performed by ConsumeSamples, which is expected to be called by a low priority thread.
+ *  When the ring is full the sample is dropped (and the number of dropped samples reported by ConsumeSamples).
  */
 class LoggerBroker: public BrokerI {
 
@@ -73,10 +98,45 @@ public:
             void *gamMemoryAddress);
 
 
+    /**
+     * @brief Sets the number of cycles that must pass before the signals are printed (or copied to the ring in deferred mode).
+     * @param[in] cyclePeriodIn the number of cycles.
+     */
     void SetPeriod(const uint32 cyclePeriodIn);
 
+    /**
+     * @brief Allocates the ring of samples so that the signals are printed by ConsumeSamples instead of Execute.
+     * @param[in] numberOfBuffersIn the number of samples that the ring can hold.
+     * @param[in] filtersIn the filter of each signal of the DataSourceI (indexed by the signal index in the DataSourceI).
+     * @return true if numberOfBuffersIn > 0.
+     * @pre
+     *   Init()
+     */
+    bool EnableDeferred(const uint32 numberOfBuffersIn,
+                        const LoggerBrokerSignalFilter * const filtersIn);
+
+    /**
+     * @brief Returns true if EnableDeferred was successfully called.
+     * @return true if EnableDeferred was successfully called.
+     */
+    bool IsDeferred() const;
+
+    /**
+     * @brief Prints (after applying the signal filters) all the samples available in the ring.
+     * @details Shall be called by a single thread.
+     * @return the number of samples removed from the ring.
+     */
+    uint32 ConsumeSamples();
+
+    /**
+     * @brief Returns the number of samples which were dropped because the ring was full.
+     * @return the number of samples which were dropped because the ring was full.
+     */
+    uint32 GetNumberOfDroppedSamples() const;
+
     /**
      * @brief For all the signals print their AnyType value in the logger stream.
+     * @details In deferred mode the signals are only copied to the ring.
      * @return true.
      */
     virtual bool Execute();
@@ -102,6 +162,56 @@ private:
      * Holds the period of cycles must pass before logger produces an output.
      */
     uint32 cyclePeriod;
+
+    /**
+     * Index of each copy signal in the DataSourceI.
+     */
+    uint32 *copySignalIdx;
+
+    /**
+     * The ring of samples (each sample holds all the copies).
+     */
+    SampleRing ring;
+
+    /**
+     * Offset of each copy in a sample.
+     */
+    uint32 *slotOffsets;
+
+    /**
+     * Number of samples dropped because the ring was full. Only modified by Execute.
+     */
+    volatile uint32 droppedSamples;
+
+    /**
+     * Value of droppedSamples the last time it was reported by ConsumeSamples.
+     */
+    uint32 reportedDroppedSamples;
+
+    /**
+     * The filter of each copy.
+     */
+    LoggerBrokerSignalFilter *filters;
+
+    /**
+     * Samples consumed since the last decimated print of each copy.
+     */
+    uint32 *decimationCounters;
+
+    /**
+     * HighResolutionTimer counter of the last print of each copy.
+     */
+    uint64 *lastPrintCounts;
+
+    /**
+     * True if the copy was printed at least once.
+     */
+    bool *printed;
+
+    /**
+     * Last printed value of each copy (same layout of a slot).
+     */
+    char8 *lastPrintedValues;
 };
 
 }
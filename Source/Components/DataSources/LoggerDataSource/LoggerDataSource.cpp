@@ -30,8 +30,11 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
 #include "LoggerBroker.h"
 #include "LoggerDataSource.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -39,12 +42,78 @@
 
 namespace MARTe {
 
+/**
+ * @brief Reads the Decimation, OnChange and MaxRate parameters, keeping the current value of the filter if not set.
+ * @return true if the parameters are valid.
+ */
+static bool LoggerDataSourceReadFilter(StructuredDataI &data,
+                                       LoggerBrokerSignalFilter &filter) {
+    bool ok = true;
+    uint32 decimation;
+    if (data.Read("Decimation", decimation)) {
+        ok = (decimation > 0u);
+        if (ok) {
+            filter.decimation = decimation;
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Decimation shall be > 0");
+        }
+    }
+    uint8 onChange;
+    if ((ok) && (data.Read("OnChange", onChange))) {
+        ok = (onChange < 2u);
+        if (ok) {
+            filter.onChange = (onChange == 1u);
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "OnChange shall be 0 or 1");
+        }
+    }
+    float64 maxRate;
+    if ((ok) && (data.Read("MaxRate", maxRate))) {
+        ok = (maxRate >= 0.0);
+        if (ok) {
+            filter.minimumPeriodCounts = 0u;
+            if (maxRate > 0.0) {
+                float64 periodCounts = static_cast<float64>(HighResolutionTimer::Frequency()) / maxRate;
+                filter.minimumPeriodCounts = static_cast<uint64>(periodCounts);
+            }
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "MaxRate shall be >= 0");
+        }
+    }
+    return ok;
+}
+
 LoggerDataSource::LoggerDataSource() :
-    DataSourceI() {
+    DataSourceI(),
+    EmbeddedServiceMethodBinderI(),
+    executor(*this) {
     cyclePeriod = 0u;
+    deferred = false;
+    numberOfBuffers = 64u;
+    consumerPeriod = 10u;
+    cpuMask = 0xffu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    defaultFilter.decimation = 1u;
+    defaultFilter.onChange = false;
+    defaultFilter.minimumPeriodCounts = 0u;
+    filters = NULL_PTR(LoggerBrokerSignalFilter *);
 }
 
+/*lint -e{1551} the destructor must guarantee that the consumer thread is stopped.*/
 LoggerDataSource::~LoggerDataSource() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    //Print what is left in the rings
+    (void) ConsumeSamples();
+    if (filters != NULL_PTR(LoggerBrokerSignalFilter *)) {
+        delete[] filters;
+    }
 }
 
 bool LoggerDataSource::Initialise(StructuredDataI & data) {
@@ -53,6 +122,73 @@ bool LoggerDataSource::Initialise(StructuredDataI & data) {
         if (!data.Read("CyclePeriod", cyclePeriod)) {
             cyclePeriod = 0u;
         }
+        uint8 deferredU = 0u;
+        if (data.Read("Deferred", deferredU)) {
+            ret = (deferredU < 2u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Deferred shall be 0 or 1");
+            }
+        }
+        deferred = (deferredU == 1u);
+    }
+    if ((ret) && (deferred)) {
+        if (data.Read("NumberOfBuffers", numberOfBuffers)) {
+            ret = (numberOfBuffers > 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfBuffers shall be > 0");
+            }
+        }
+    }
+    if ((ret) && (deferred)) {
+        if (!data.Read("ConsumerPeriod", consumerPeriod)) {
+            consumerPeriod = 10u;
+        }
+        if (!data.Read("CPUMask", cpuMask)) {
+            cpuMask = 0xffu;
+        }
+        if (data.Read("StackSize", stackSize)) {
+            ret = (stackSize > 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "StackSize shall be > 0");
+            }
+        }
+    }
+    if ((ret) && (deferred)) {
+        ret = LoggerDataSourceReadFilter(data, defaultFilter);
+    }
+    if ((ret) && (deferred)) {
+        if (data.MoveRelative("Signals")) {
+            ret = data.Copy(signalsConfiguration);
+            if (ret) {
+                ret = data.MoveToAncestor(1u);
+            }
+        }
+    }
+    return ret;
+}
+
+bool LoggerDataSource::SetConfiguredDatabase(StructuredDataI & data) {
+    bool ret = DataSourceI::SetConfiguredDatabase(data);
+    if ((ret) && (deferred)) {
+        uint32 nOfSignals = GetNumberOfSignals();
+        filters = new LoggerBrokerSignalFilter[nOfSignals];
+        uint32 n;
+        for (n = 0u; (n < nOfSignals) && (ret); n++) {
+            filters[n] = defaultFilter;
+            StreamString signalName;
+            ret = GetSignalName(n, signalName);
+            if (ret) {
+                ret = signalsConfiguration.MoveToRoot();
+            }
+            if (ret) {
+                if (signalsConfiguration.MoveRelative(signalName.Buffer())) {
+                    ret = LoggerDataSourceReadFilter(signalsConfiguration, filters[n]);
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "Invalid filter for signal %s", signalName.Buffer());
+                    }
+                }
+            }
+        }
     }
     return ret;
 }
@@ -98,13 +234,55 @@ bool LoggerDataSource::GetOutputBrokers(ReferenceContainer& outputBrokers,
         broker->SetPeriod(cyclePeriod);
         ok = outputBrokers.Insert(broker);
     }
+    if ((ok) && (deferred)) {
+        ok = broker->EnableDeferred(numberOfBuffers, filters);
+        if (ok) {
+            ok = brokers.Insert(broker);
+        }
+    }
     return ok;
 }
 
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: this DataSourceI implementation is independent of the states being changed.*/
 bool LoggerDataSource::PrepareNextState(const char8 * const currentStateName,
                                         const char8 * const nextStateName) {
-    return true;
+    bool ok = true;
+    if (deferred) {
+        if (executor.GetStatus() == EmbeddedThreadI::OffState) {
+            executor.SetCPUMask(cpuMask);
+            executor.SetStackSize(stackSize);
+            executor.SetName(GetName());
+            ok = (executor.Start() == ErrorManagement::NoError);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the consumer thread.");
+            }
+        }
+    }
+    return ok;
+}
+
+uint32 LoggerDataSource::ConsumeSamples() {
+    uint32 consumed = 0u;
+    uint32 n;
+    uint32 nOfBrokers = brokers.Size();
+    for (n = 0u; n < nOfBrokers; n++) {
+        ReferenceT<LoggerBroker> broker = brokers.Get(n);
+        if (broker.IsValid()) {
+            consumed += broker->ConsumeSamples();
+        }
+    }
+    return consumed;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the samples are consumed irrespectively of the execution stage.*/
+ErrorManagement::ErrorType LoggerDataSource::Execute(ExecutionInfo &info) {
+    (void) ConsumeSamples();
+    Sleep::MSec(consumerPeriod);
+    return ErrorManagement::NoError;
+}
+
+bool LoggerDataSource::IsDeferred() const {
+    return deferred;
 }
 
 CLASS_REGISTER(LoggerDataSource, "1.0")
@@ -31,7 +31,11 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "LoggerBroker.h"
+#include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -47,11 +51,27 @@ namespace MARTe {
  *     Class = LoggerDataSource
  *     CyclePeriod = 0u //Optional, defaults to 0. Period of cycles must pass before logger produces an output.
  *                      //CyclePeriod = 0u means print every sample received.
+ *     Deferred = 1 //Optional, defaults to 0. If 1 the real-time thread only copies the signals to a ring and the
+ *                  //signals are printed by a separate thread (see below).
+ *     NumberOfBuffers = 64 //Optional, defaults to 64. Only used if Deferred = 1. Number of samples in the ring. If the ring is full, the sample is dropped.
+ *     ConsumerPeriod = 10 //Optional, defaults to 10. Only used if Deferred = 1. Time in ms between two checks of the ring.
+ *     CPUMask = 0x1 //Optional, defaults to 0xff. Only used if Deferred = 1. Affinity of the thread that prints the signals.
+ *     StackSize = 1048576 //Optional, defaults to THREADS_DEFAULT_STACKSIZE. Only used if Deferred = 1. Stack size of the thread that prints the signals.
+ *     Decimation = 1 //Optional, defaults to 1. Only used if Deferred = 1. Default of the signal property below.
+ *     OnChange = 0 //Optional, defaults to 0. Only used if Deferred = 1. Default of the signal property below.
+ *     MaxRate = 0 //Optional, defaults to 0. Only used if Deferred = 1. Default of the signal property below.
+ *     Signals = { //Optional.
+ *         Signal1 = {
+ *             Decimation = 10 //Optional. Only print one out of every Decimation samples of the ring.
+ *             OnChange = 1 //Optional. If 1 only print the signal if its value changed since the last print.
+ *             MaxRate = 2 //Optional. Maximum number of prints per second (0 means no limit).
+ *         }
+ *     }
  * }
  *
  * A signal will be added for each GAM signal that writes to this instance of the DataSourceI.
  */
-class LoggerDataSource: public DataSourceI {
+class LoggerDataSource: public DataSourceI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
@@ -60,13 +80,23 @@ public:
 LoggerDataSource    ();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor.
+     * @details Stops the consumer thread and prints the samples that are still in the rings.
      */
     virtual ~LoggerDataSource();
 
-
+    /**
+     * @brief Loads and verifies the configuration parameters detailed in the class description.
+     * @return true if all the specified parameters have valid values.
+     */
     virtual bool Initialise(StructuredDataI & data);
 
+    /**
+     * @brief Computes the filter of each signal (see class description).
+     * @return true if DataSourceI::SetConfiguredDatabase returns true and all the signal filters are valid.
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI & data);
+
     /**
      * @brief NOOP.
      * @return true.
@@ -112,6 +142,7 @@ LoggerDataSource    ();
 
     /**
      * @brief Creates a new instance of a LoggerBroker and adds it to \a outputBrokers.
+     * @details If Deferred = 1, LoggerBroker::EnableDeferred is called.
      * @param[out] outputBrokers where the BrokerI instances have to be added to.
      * @param[in] functionName name of the function being queried.
      * @param[in] gamMemPtr the GAM memory where the signals will be written to.
@@ -122,17 +153,85 @@ LoggerDataSource    ();
             void * const gamMemPtr);
 
     /**
-     * @brief NOOP.
-     * @return true.
+     * @brief If Deferred = 1 starts the thread that prints the signals (if not already running).
+     * @return true if the thread is successfully started.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
             const char8 * const nextStateName);
 
+    /**
+     * @brief Calls LoggerBroker::ConsumeSamples on all the deferred brokers.
+     * @return the total number of samples that were consumed.
+     */
+    uint32 ConsumeSamples();
+
+    /**
+     * @brief Callback of the consumer thread. Calls ConsumeSamples and sleeps ConsumerPeriod ms.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Returns true if Deferred = 1.
+     * @return true if Deferred = 1.
+     */
+    bool IsDeferred() const;
+
 protected:
     /**
      * @brief Holds the period of cycles must pass before logger produces an output.
      */
     uint32 cyclePeriod;
+
+    /**
+     * True if the signals are to be printed by the consumer thread.
+     */
+    bool deferred;
+
+    /**
+     * Number of samples in the ring of each broker.
+     */
+    uint32 numberOfBuffers;
+
+    /**
+     * Time in ms between two checks of the rings.
+     */
+    uint32 consumerPeriod;
+
+    /**
+     * The affinity of the consumer thread.
+     */
+    uint32 cpuMask;
+
+    /**
+     * The stack size of the consumer thread.
+     */
+    uint32 stackSize;
+
+    /**
+     * Copy of the Signals section, to read the signal filters.
+     */
+    ConfigurationDatabase signalsConfiguration;
+
+    /**
+     * Default filter of the signals.
+     */
+    LoggerBrokerSignalFilter defaultFilter;
+
+    /**
+     * The filter of each signal.
+     */
+    LoggerBrokerSignalFilter *filters;
+
+    /**
+     * The deferred brokers.
+     */
+    ReferenceContainer brokers;
+
+    /**
+     * The consumer thread.
+     */
+    SingleThreadService executor;
 };
 }
 
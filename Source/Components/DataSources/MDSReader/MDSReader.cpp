@@ -34,6 +34,7 @@
 #include "AdvancedErrorManagement.h"
 #include "MDSReader.h"
 #include "MemoryMapSynchronisedInputBroker.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -48,7 +49,9 @@
 namespace MARTe {
 
 MDSReader::MDSReader() :
-        DataSourceI() {
+        DataSourceI(),
+        EmbeddedServiceMethodBinderT<MDSReader>(*this, &MDSReader::PrefetchThreadCallback),
+        prefetchService(*this) {
     tree = NULL_PTR(MDSplus::Tree *);
     nodeName = NULL_PTR(StreamString *);
     nodes = NULL_PTR(MDSplus::TreeNode **);
@@ -78,10 +81,59 @@ MDSReader::MDSReader() :
     elementsConsumed = NULL_PTR(uint32 *);
     endNode = NULL_PTR(bool *);
     nodeSamplingTime = NULL_PTR(float64 *);
+    segmentsTMin = NULL_PTR(float64 **);
+    segmentsTMax = NULL_PTR(float64 **);
+    prefetchSegments = 0u;
+    cacheEntriesPerNode = 0u;
+    segmentCache = NULL_PTR(MDSReaderSegmentCacheEntry *);
+    firstSegmentInUse = NULL_PTR(volatile uint32 *);
+    cacheHits = 0u;
+    cacheMisses = 0u;
+    treeMux.Create();
 }
 
 /*lint -e{1551} the destructor must guarantee that the MDSplus are deleted and the shared memory freed*/
 MDSReader::~MDSReader() {
+    if (prefetchService.Stop() != ErrorManagement::NoError) {
+        if (prefetchService.Stop() != ErrorManagement::NoError) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the prefetch thread");
+        }
+    }
+    if (segmentCache != NULL_PTR(MDSReaderSegmentCacheEntry *)) {
+        uint32 nEntries = numberOfNodeNames * cacheEntriesPerNode;
+        for (uint32 i = 0u; i < nEntries; i++) {
+            if (segmentCache[i].data != NULL_PTR(char8 *)) {
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(segmentCache[i].data));
+            }
+            if (segmentCache[i].time != NULL_PTR(float64 *)) {
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(segmentCache[i].time));
+            }
+        }
+        delete[] segmentCache;
+        segmentCache = NULL_PTR(MDSReaderSegmentCacheEntry *);
+    }
+    if (firstSegmentInUse != NULL_PTR(volatile uint32 *)) {
+        delete[] firstSegmentInUse;
+        firstSegmentInUse = NULL_PTR(volatile uint32 *);
+    }
+    if (segmentsTMin != NULL_PTR(float64 **)) {
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            if (segmentsTMin[i] != NULL_PTR(float64 *)) {
+                delete[] segmentsTMin[i];
+            }
+        }
+        delete[] segmentsTMin;
+        segmentsTMin = NULL_PTR(float64 **);
+    }
+    if (segmentsTMax != NULL_PTR(float64 **)) {
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            if (segmentsTMax[i] != NULL_PTR(float64 *)) {
+                delete[] segmentsTMax[i];
+            }
+        }
+        delete[] segmentsTMax;
+        segmentsTMax = NULL_PTR(float64 **);
+    }
 
     if (tree != NULL_PTR(MDSplus::Tree *)) {
         delete tree;
@@ -209,6 +261,15 @@ bool MDSReader::Initialise(StructuredDataI& data) {
             period = 1.0 / frequency;
         }
     }
+    if (ok) {
+        if (!data.Read("PrefetchSegments", prefetchSegments)) {
+            prefetchSegments = 0u;
+        }
+        uint32 cpuMaskIn;
+        if (data.Read("PrefetchCPUMask", cpuMaskIn)) {
+            prefetchService.SetCPUMask(ProcessorType(cpuMaskIn));
+        }
+    }
     if (ok) {
         ok = data.MoveRelative("Signals");
         if (!ok) {
@@ -533,6 +594,23 @@ bool MDSReader::SetConfiguredDatabase(StructuredDataI & data) {
             ok = false;
         }
     }
+    if (ok) { //read the limits of all the segments once, so that finding the segment of a given time does not access the tree
+        segmentsTMin = new float64*[numberOfNodeNames];
+        segmentsTMax = new float64*[numberOfNodeNames];
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            segmentsTMin[i] = new float64[maxNumberOfSegments[i]];
+            segmentsTMax[i] = new float64[maxNumberOfSegments[i]];
+            for (uint32 s = 0u; s < maxNumberOfSegments[i]; s++) {
+                MDSplus::Data *tminD;
+                MDSplus::Data *tmaxD;
+                nodes[i]->getSegmentLimits(static_cast<int32>(s), &tminD, &tmaxD);
+                segmentsTMin[i][s] = tminD->getDouble();
+                segmentsTMax[i][s] = tmaxD->getDouble();
+                MDSplus::deleteData(tminD);
+                MDSplus::deleteData(tmaxD);
+            }
+        }
+    }
     if (ok) { //read DataManagement from originalSignalInformation
         dataManagement = new uint8[numberOfNodeNames];
         nodeSamplingTime = new float64[numberOfNodeNames];
@@ -630,6 +708,25 @@ bool MDSReader::SetConfiguredDatabase(StructuredDataI & data) {
             endNode[i] = false;
         }
     }
+    if (ok) { //allocate the segment cache
+        firstSegmentInUse = new uint32[numberOfNodeNames];
+        for (uint32 i = 0u; i < numberOfNodeNames; i++) {
+            firstSegmentInUse[i] = 0u;
+        }
+        if (prefetchSegments > 0u) {
+            cacheEntriesPerNode = prefetchSegments + 1u;
+            uint32 nEntries = numberOfNodeNames * cacheEntriesPerNode;
+            segmentCache = new MDSReaderSegmentCacheEntry[nEntries];
+            for (uint32 i = 0u; i < nEntries; i++) {
+                segmentCache[i].segment = 0u;
+                segmentCache[i].state = MDSReaderSegmentCacheFree;
+                segmentCache[i].nElements = 0;
+                segmentCache[i].data = NULL_PTR(char8 *);
+                segmentCache[i].time = NULL_PTR(float64 *);
+                segmentCache[i].capacity = 0u;
+            }
+        }
+    }
     return ok;
 }
 
@@ -687,10 +784,19 @@ bool MDSReader::AllNodesEnd() const {
     return ret;
 }
 
-/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: NOOP at StateChange, independently of the function parameters.*/
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the prefetch thread is started independently of the function parameters.*/
 bool MDSReader::PrepareNextState(const char8 * const currentStateName,
                                  const char8 * const nextStateName) {
-    return true;
+    bool ok = true;
+    if (segmentCache != NULL_PTR(MDSReaderSegmentCacheEntry *)) {
+        if (prefetchService.GetStatus() == EmbeddedThreadI::OffState) {
+            ok = (prefetchService.Start() == ErrorManagement::NoError);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the prefetch thread");
+            }
+        }
+    }
+    return ok;
 }
 
 bool MDSReader::AllocateMemory() {
@@ -905,6 +1011,8 @@ bool MDSReader::GetDataNode(const uint32 nodeNumber) {
     ok = (errorCodeMinSegment != -1);
     uint32 numberOfDiscontinuities = 0u;
     if (ok) {
+        //Tells the prefetch thread which cached segments can be reused (the copy may start one segment before minSegment)
+        firstSegmentInUse[nodeNumber] = minSegment;
         errorCodeMaxSegment = FindSegment(timeCycle + period, maxSegment, nodeNumber);
         numberOfDiscontinuities = CheckDiscontinuityOfTheSegments(nodeNumber, minSegment, maxSegment);
     }
@@ -952,17 +1060,13 @@ int8 MDSReader::FindSegment(const float64 t,
                             uint32 &segment,
                             const uint32 nodeIdx) {
     bool find = false;
-    MDSplus::Data *tminD;
-    MDSplus::Data *tmaxD;
     int8 retVal = -1;
     float64 tmax = 0.0;
     float64 tmin = 0.0;
     for (uint32 i = lastSegment[nodeIdx]; (i < maxNumberOfSegments[nodeIdx]) && (!find); i++) {
-        nodes[nodeIdx]->getSegmentLimits(static_cast<int32>(i), &tminD, &tmaxD);
-        tmax = tmaxD->getDouble();
+        GetSegmentLimits(nodeIdx, i, tmin, tmax);
         if (t <= tmax) {
             find = true;
-            tmin = tminD->getDouble();
             if (t < (tmin - (nodeSamplingTime[nodeIdx] / 2.0))) { // (nodeSamplingTime[nodeIdx] / 2.0)) is due to float64 numeric errors
                 //look the tmax Previous segment and verify if the difference is smaller than the
                 if (i < 2u) {
@@ -973,13 +1077,9 @@ int8 MDSReader::FindSegment(const float64 t,
                     lastSegment[nodeIdx] = i;
                 }
                 else {
-                    MDSplus::Data *tminPreviousD;
-                    MDSplus::Data *tmaxPreviousD;
+                    float64 tminPrevious;
                     float64 tmaxPrevious;
-//                    float64 nodeSamplingTime = 0.0;
-                    nodes[nodeIdx]->getSegmentLimits(static_cast<int32>(i) - 1, &tminPreviousD, &tmaxPreviousD);
-                    tmaxPrevious = tmaxPreviousD->getDouble();
-//                    GetNodeSamplingTime(nodeIdx, nodeSamplingTime);
+                    GetSegmentLimits(nodeIdx, i - 1u, tminPrevious, tmaxPrevious);
                     if ((tmin - tmaxPrevious) > (nodeSamplingTime[nodeIdx] * 1.5)) { //1.5 due o numeric errors. if a samples i s not saved the difference should be nodeSamplingTime * 2
                         retVal = 0;
                         //It is very important. Even the segment does not exist the index must be updated saying the next segment to be look for is this one.
@@ -992,8 +1092,6 @@ int8 MDSReader::FindSegment(const float64 t,
                         segment = i;
                         lastSegment[nodeIdx] = i;
                     }
-                    MDSplus::deleteData(tminPreviousD);
-                    MDSplus::deleteData(tmaxPreviousD);
                 }
             }
             else {
@@ -1002,8 +1100,6 @@ int8 MDSReader::FindSegment(const float64 t,
                 lastSegment[nodeIdx] = i;
             }
         }
-        MDSplus::deleteData(tminD);
-        MDSplus::deleteData(tmaxD);
     }
     return retVal;
 }
@@ -1013,29 +1109,18 @@ uint32 MDSReader::CheckDiscontinuityOfTheSegments(const uint32 nodeNumber,
                                                   const uint32 initialSegment,
                                                   const uint32 finalSegment) const {
     uint32 counter = 0u;
-    int32 maxSegment = static_cast<int32>(finalSegment) + 1;
-    MDSplus::Data *tminD = NULL_PTR(MDSplus::Data *);
-    MDSplus::Data *tmaxD = NULL_PTR(MDSplus::Data *);
-
     float64 tmin = 0.0;
     float64 tmax;
+    float64 tmaxPrevious;
 
-//    float64 nodeTimeDiff;
-//    GetNodeSamplingTime(nodeNumber, nodeTimeDiff);
-    nodes[nodeNumber]->getSegmentLimits(static_cast<int32>(initialSegment), &tminD, &tmaxD);
-    tmax = tmaxD->getDouble();
-    for (int32 currentSegment = static_cast<int32>(initialSegment) + 1; currentSegment < maxSegment; currentSegment++) {
-        MDSplus::deleteData(tminD);
-        MDSplus::deleteData(tmaxD);
-        nodes[nodeNumber]->getSegmentLimits(currentSegment, &tminD, &tmaxD);
-        tmin = tminD->getDouble();
-        if ((tmin - tmax) > (nodeSamplingTime[nodeNumber] * 1.5)) {
+    GetSegmentLimits(nodeNumber, initialSegment, tmin, tmaxPrevious);
+    for (uint32 currentSegment = initialSegment + 1u; currentSegment <= finalSegment; currentSegment++) {
+        GetSegmentLimits(nodeNumber, currentSegment, tmin, tmax);
+        if ((tmin - tmaxPrevious) > (nodeSamplingTime[nodeNumber] * 1.5)) {
             counter++;
         }
-        tmax = tmaxD->getDouble();
+        tmaxPrevious = tmax;
     }
-    MDSplus::deleteData(tminD);
-    MDSplus::deleteData(tmaxD);
     return counter;
 }
 
@@ -1408,42 +1493,27 @@ bool MDSReader::FindDiscontinuity(const uint32 nodeNumber,
                                   float64 &beginningTime,
                                   float64 &endTime) const {
     bool find = false;
-//    bool error;
-    MDSplus::Data *tminD = NULL_PTR(MDSplus::Data *);
-    MDSplus::Data *tmaxD = NULL_PTR(MDSplus::Data *);
-
     float64 tmin;
     float64 tmax;
 
-//    float64 nodeTimeDiff;
-//    error = !GetNodeSamplingTime(nodeNumber, nodeTimeDiff);
-    nodes[nodeNumber]->getSegmentLimits(static_cast<int32>(segment), &tminD, &tmaxD);
-    tmin = tminD->getDouble();
+    GetSegmentLimits(nodeNumber, segment, tmin, tmax);
 //Playing with tolerances
     float64 auxDiff = tmin - currentTime;
     if (auxDiff > 0.00000001) {                        //tolerance is 1/100MHz
         endTime = tmin;
         find = true;
-        MDSplus::deleteData(tminD);
-        MDSplus::deleteData(tmaxD);
     }
     else {
-        tmax = tmaxD->getDouble();
-        MDSplus::deleteData(tminD);
-        MDSplus::deleteData(tmaxD);
-        int32 initialSemgnet = static_cast<int32>(segment) + 1;
-        for (int32 currentSegment = initialSemgnet; (currentSegment < static_cast<int32>(maxNumberOfSegments[nodeNumber])) && (!find); currentSegment++) {
-            nodes[nodeNumber]->getSegmentLimits(currentSegment, &tminD, &tmaxD);
-            tmin = tminD->getDouble();
-            if ((tmin - tmax) > (nodeSamplingTime[nodeNumber] * 1.5)) {
-                beginningTime = tmax;
+        float64 tmaxPrevious = tmax;
+        for (uint32 currentSegment = segment + 1u; (currentSegment < maxNumberOfSegments[nodeNumber]) && (!find); currentSegment++) {
+            GetSegmentLimits(nodeNumber, currentSegment, tmin, tmax);
+            if ((tmin - tmaxPrevious) > (nodeSamplingTime[nodeNumber] * 1.5)) {
+                beginningTime = tmaxPrevious;
                 endTime = tmin;
                 find = true;
             }
-            tmax = tmaxD->getDouble();
-            segment = static_cast<uint32>(currentSegment);
-            MDSplus::deleteData(tminD);
-            MDSplus::deleteData(tmaxD);
+            tmaxPrevious = tmax;
+            segment = currentSegment;
         }
     }
     return find;
@@ -1606,6 +1676,138 @@ bool MDSReader::CopyRemainingData(const uint32 nodeNumber,
     return ret;
 }
 
+//lint -e{613} Possible use of null pointer. Not possible. If initialisation fails this function is not called.
+void MDSReader::GetSegmentLimits(const uint32 nodeIdx,
+                                 const uint32 segment,
+                                 float64 &tmin,
+                                 float64 &tmax) const {
+    tmin = segmentsTMin[nodeIdx][segment];
+    tmax = segmentsTMax[nodeIdx][segment];
+}
+
+const MDSReaderSegmentCacheEntry *MDSReader::GetCachedSegment(const uint32 nodeNumber,
+                                                              const uint32 segment) {
+    const MDSReaderSegmentCacheEntry *ret = NULL_PTR(const MDSReaderSegmentCacheEntry *);
+    if (segmentCache != NULL_PTR(MDSReaderSegmentCacheEntry *)) {
+        const MDSReaderSegmentCacheEntry *entries = &segmentCache[nodeNumber * cacheEntriesPerNode];
+        for (uint32 e = 0u; (e < cacheEntriesPerNode) && (ret == NULL_PTR(const MDSReaderSegmentCacheEntry *)); e++) {
+            if ((entries[e].state == MDSReaderSegmentCacheReady) && (entries[e].segment == segment)) {
+                ret = &entries[e];
+            }
+        }
+        if (ret != NULL_PTR(const MDSReaderSegmentCacheEntry *)) {
+            //Pairs with the barrier issued by the prefetch thread before marking the entry as ready
+            __sync_synchronize();
+            cacheHits++;
+        }
+        else {
+            cacheMisses++;
+        }
+    }
+    return ret;
+}
+
+//lint -e{613} Possible use of null pointer. Not possible. If initialisation fails this function is not called.
+bool MDSReader::FillSegmentCache(const uint32 nodeNumber,
+                                 const uint32 segment,
+                                 MDSReaderSegmentCacheEntry &entry) {
+    bool ok = true;
+    if (type[nodeNumber] == UnsignedInteger8Bit) {
+        ok = FillSegmentCacheTemplate<uint8>(nodeNumber, segment, entry);
+    }
+    else if (type[nodeNumber] == SignedInteger8Bit) {
+        ok = FillSegmentCacheTemplate<int8>(nodeNumber, segment, entry);
+    }
+    else if (type[nodeNumber] == UnsignedInteger16Bit) {
+        ok = FillSegmentCacheTemplate<uint16>(nodeNumber, segment, entry);
+    }
+    else if (type[nodeNumber] == SignedInteger16Bit) {
+        ok = FillSegmentCacheTemplate<int16>(nodeNumber, segment, entry);
+    }
+    else if (type[nodeNumber] == UnsignedInteger32Bit) {
+        ok = FillSegmentCacheTemplate<uint32>(nodeNumber, segment, entry);
+    }
+    else if (type[nodeNumber] == SignedInteger32Bit) {
+        ok = FillSegmentCacheTemplate<int32>(nodeNumber, segment, entry);
+    }
+    else if (type[nodeNumber] == UnsignedInteger64Bit) {
+        ok = FillSegmentCacheTemplate<uint64>(nodeNumber, segment, entry);
+    }
+    else if (type[nodeNumber] == SignedInteger64Bit) {
+        ok = FillSegmentCacheTemplate<int64>(nodeNumber, segment, entry);
+    }
+    else if (type[nodeNumber] == Float32Bit) {
+        ok = FillSegmentCacheTemplate<float32>(nodeNumber, segment, entry);
+    }
+    else if (type[nodeNumber] == Float64Bit) {
+        ok = FillSegmentCacheTemplate<float64>(nodeNumber, segment, entry);
+    }
+    else {
+        ok = false;
+    }
+    return ok;
+}
+
+//lint -e{613} Possible use of null pointer. Not possible. The thread is only started if the cache was allocated.
+ErrorManagement::ErrorType MDSReader::PrefetchThreadCallback(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        bool loaded = false;
+        for (uint32 n = 0u; n < numberOfNodeNames; n++) {
+            //Only written by the real-time thread and never decreases
+            uint32 inUse = firstSegmentInUse[n];
+            uint32 endSegment = inUse + prefetchSegments;
+            if (endSegment > maxNumberOfSegments[n]) {
+                endSegment = maxNumberOfSegments[n];
+            }
+            MDSReaderSegmentCacheEntry *entries = &segmentCache[n * cacheEntriesPerNode];
+            for (uint32 s = inUse; s < endSegment; s++) {
+                bool cached = false;
+                uint32 freeIdx = cacheEntriesPerNode;
+                for (uint32 e = 0u; (e < cacheEntriesPerNode) && (!cached); e++) {
+                    if (entries[e].state == MDSReaderSegmentCacheReady) {
+                        if (entries[e].segment == s) {
+                            cached = true;
+                        }
+                        else if ((entries[e].segment + 1u) < inUse) {
+                            //Already consumed by the real-time thread
+                            freeIdx = e;
+                        }
+                        else {
+                        }
+                    }
+                    else {
+                        freeIdx = e;
+                    }
+                }
+                if ((!cached) && (freeIdx < cacheEntriesPerNode)) {
+                    entries[freeIdx].state = MDSReaderSegmentCacheLoading;
+                    __sync_synchronize();
+                    if (FillSegmentCache(n, s, entries[freeIdx])) {
+                        __sync_synchronize();
+                        entries[freeIdx].state = MDSReaderSegmentCacheReady;
+                        loaded = true;
+                    }
+                    else {
+                        entries[freeIdx].state = MDSReaderSegmentCacheFree;
+                    }
+                }
+            }
+        }
+        if (!loaded) {
+            Sleep::MSec(1u);
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+uint64 MDSReader::GetCacheHits() const {
+    return cacheHits;
+}
+
+uint64 MDSReader::GetCacheMisses() const {
+    return cacheMisses;
+}
+
 CLASS_REGISTER(MDSReader, "1.0")
 }
 
@@ -36,7 +36,11 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderT.h"
+#include "FastPollingMutexSem.h"
 #include "MessageI.h"
+#include "ProcessorType.h"
+#include "SingleThreadService.h"
 #include "StreamString.h"
 
 /*---------------------------------------------------------------------------*/
@@ -45,6 +49,56 @@
 
 namespace MARTe {
 
+/**
+ * @brief Decoded copy of one MDSplus segment (data and time base) prepared by the MDSReader prefetch thread.
+ */
+struct MDSReaderSegmentCacheEntry {
+    /**
+     * Index of the cached segment. Only meaningful when state is MDSReaderSegmentCacheReady.
+     */
+    uint32 segment;
+
+    /**
+     * MDSReaderSegmentCacheFree, MDSReaderSegmentCacheLoading or MDSReaderSegmentCacheReady.
+     */
+    volatile uint32 state;
+
+    /**
+     * Number of samples of the segment.
+     */
+    int32 nElements;
+
+    /**
+     * The decoded samples (nElements * bytesType).
+     */
+    char8 *data;
+
+    /**
+     * The time base of the segment (nElements).
+     */
+    float64 *time;
+
+    /**
+     * Number of samples that data and time can hold.
+     */
+    uint32 capacity;
+};
+
+/**
+ * The cache entry does not hold any segment.
+ */
+const uint32 MDSReaderSegmentCacheFree = 0u;
+
+/**
+ * The cache entry is being written by the prefetch thread.
+ */
+const uint32 MDSReaderSegmentCacheLoading = 1u;
+
+/**
+ * The cache entry holds a segment which can be read by the real-time thread.
+ */
+const uint32 MDSReaderSegmentCacheReady = 2u;
+
 /**
  * @brief MDSReader is a data source which allows to read data from a MDSplus tree.
  * @details MDSReader is an input data source which takes data from MDSPlus nodes (as many as desired) and publishes it on a real time application.
@@ -67,6 +121,12 @@ namespace MARTe {
  * <li>1 --> MDSReader fills the absence of data with the last value.</li>
  * </ul>
  *
+ * The segment limits (tmin, tmax) of all the nodes are read once in SetConfiguredDatabase, so that finding the segment of a given time
+ * does not access the tree. If PrefetchSegments is set, a background thread (started in PrepareNextState) reads and decodes, for every node, the
+ * segment in use and the next PrefetchSegments - 1 segments (data and time base) into a per-node cache. The copy, interpolation and hold
+ * algorithms then only work on memory. A segment which is not (yet) in the cache is read from the tree by the real-time thread (cache miss).
+ * The number of cache hits and misses can be queried with GetCacheHits() and GetCacheMisses().
+ *
  * Even if the MDSReader can deal with the absence of data, the sampling time must be constant with-in the node, however the sampling time between
  * nodes can be different.
  *
@@ -103,6 +163,8 @@ namespace MARTe {
  *     TreeName = "test_tree" //Compulsory. Name of the MDSplus tree.
  *     ShotNumber = 1 //Compulsory. 0 --> last shot number (to use 0 shotid.sys must exist)
  *     Frequency = 1000 // in Hz. Is the cycle time of the real time application.
+ *     PrefetchSegments = 4 //Optional. Default 0 (no prefetch thread). Number of segments per node, from the one being read, that are kept decoded in memory.
+ *     PrefetchCPUMask = 0x1 //Optional. CPU affinity of the prefetch thread.
  *
  *     Signals = {
  *         S_uint8 = {
@@ -129,7 +191,7 @@ namespace MARTe {
  * }
  * </pre>
  */
-class MDSReader: public DataSourceI {
+class MDSReader: public DataSourceI, public EmbeddedServiceMethodBinderT<MDSReader> {
 //TODO Add the macro DLL_API to the class declaration (i.e. class DLL_API MDSReader)
 public:
     CLASS_REGISTER_DECLARATION()
@@ -160,6 +222,7 @@ public:
      * <li>Reads the shot number </li>
      * <li>Opens the tree with the shot number </li>
      * <li>Reads the real-time thread Frequency parameter.</li>
+     * <li>Reads the optional PrefetchSegments and PrefetchCPUMask parameters.</li>
      * </ul>
      * @param[in] data is the configuration file.
      * @return true if all parameters can be read and the values are valid
@@ -177,6 +240,8 @@ public:
      * <li>Gets number of elements per node (or signal).
      * <li>Gets the the size of the type in bytes</li>
      * <li>Allocates memory
+     * <li>Reads the limits of all the segments of all the nodes</li>
+     * <li>Allocates the segment cache (if PrefetchSegments > 0)</li>
      * </ul>
      * @param[in] data is the configuration file.
      * @return true if all parameters can be read and the values are valid
@@ -185,8 +250,8 @@ public:
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
 
     /**
-     * @brief Do nothing
-     * @return true
+     * @brief Starts the prefetch thread (if PrefetchSegments > 0).
+     * @return true if the prefetch thread could be started.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
                                   const char8 * const nextStateName);
@@ -235,6 +300,27 @@ public:
     virtual bool GetOutputBrokers(ReferenceContainer &outputBrokers,
                                   const char8* const functionName,
                                   void * const gamMemPtr);
+
+    /**
+     * @brief Callback of the prefetch thread.
+     * @details For each node, reads and decodes into the cache the segments which are not yet cached, from the segment in use and up to
+     * PrefetchSegments segments ahead. Cache entries holding segments already consumed by the real-time thread are reused.
+     * @param[in] info see EmbeddedServiceMethodBinderI.
+     * @return ErrorManagement::NoError.
+     */
+    ErrorManagement::ErrorType PrefetchThreadCallback(ExecutionInfo &info);
+
+    /**
+     * @brief Gets the number of segments read from the cache by the real-time thread.
+     * @return the number of cache hits.
+     */
+    uint64 GetCacheHits() const;
+
+    /**
+     * @brief Gets the number of segments that the real-time thread had to read from the tree because they were not in the cache.
+     * @return the number of cache misses (always 0 if PrefetchSegments = 0).
+     */
+    uint64 GetCacheMisses() const;
 private:
     /**
      * @brief Open MDS tree
@@ -319,6 +405,65 @@ private:
     bool GetNodeSamplingTime(const uint32 idx,
                              float64 &tDiff) const;
 
+    /**
+     * @brief Gets the limits of a segment from the limits read in SetConfiguredDatabase.
+     * @param[in] nodeIdx the node index.
+     * @param[in] segment the segment index.
+     * @param[out] tmin the time of the first sample of the segment.
+     * @param[out] tmax the time of the last sample of the segment.
+     */
+    void GetSegmentLimits(const uint32 nodeIdx,
+                          const uint32 segment,
+                          float64 &tmin,
+                          float64 &tmax) const;
+
+    /**
+     * @brief Looks for a segment in the cache of a node and updates the hit/miss counters.
+     * @param[in] nodeNumber the node index.
+     * @param[in] segment the segment index.
+     * @return the cache entry holding the segment or NULL if the segment is not cached.
+     */
+    const MDSReaderSegmentCacheEntry *GetCachedSegment(const uint32 nodeNumber,
+                                                       const uint32 segment);
+
+    /**
+     * @brief Reads a segment of a node into a cache entry.
+     * @details this function decides the type of data and then calls FillSegmentCacheTemplate().
+     * @param[in] nodeNumber the node index.
+     * @param[in] segment the segment index.
+     * @param[out] entry the cache entry to be written.
+     * @return true if the segment could be read.
+     */
+    bool FillSegmentCache(const uint32 nodeNumber,
+                          const uint32 segment,
+                          MDSReaderSegmentCacheEntry &entry);
+
+    /**
+     * @brief Template function which reads a segment of a node into a cache entry.
+     */
+    template<typename T>
+    bool FillSegmentCacheTemplate(uint32 nodeNumber,
+                                  uint32 segment,
+                                  MDSReaderSegmentCacheEntry &entry);
+
+    /**
+     * @brief Reads a segment (and optionally its time base) from the tree.
+     * @details The arrays are allocated by MDSplus and shall be deleted by the caller. When the prefetch thread is enabled the tree access is
+     * serialised with the prefetch thread.
+     * @param[in] nodeNumber the node index.
+     * @param[in] segment the segment index.
+     * @param[out] timeNode the time base of the segment (only if readTime is true).
+     * @param[out] nElements the number of samples of the segment.
+     * @param[in] readTime if true the time base is also read.
+     * @return the samples of the segment.
+     */
+    template<typename T>
+    T *ReadSegmentTemplate(uint32 nodeNumber,
+                           uint32 segment,
+                           float64 *&timeNode,
+                           int32 &nElements,
+                           bool readTime);
+
     /**
      * @brief Copy the same value as many times as indicated.
      * @details this function decides the type of data to copy and then calls the MDSReader::CopyTheSameValue()
@@ -635,6 +780,56 @@ private:
     bool *endNode;
     float64 *nodeSamplingTime;
 
+    /**
+     * Time of the first sample of each segment of each node. segmentsTMin[node][segment].
+     */
+    float64 **segmentsTMin;
+
+    /**
+     * Time of the last sample of each segment of each node. segmentsTMax[node][segment].
+     */
+    float64 **segmentsTMax;
+
+    /**
+     * Number of segments per node kept in the cache ahead of the segment in use. 0 disables the prefetch thread.
+     */
+    uint32 prefetchSegments;
+
+    /**
+     * Number of cache entries per node (prefetchSegments + 1, the additional entry keeps the previous segment).
+     */
+    uint32 cacheEntriesPerNode;
+
+    /**
+     * The segment cache. The entries of node i are segmentCache[i * cacheEntriesPerNode, (i + 1) * cacheEntriesPerNode[.
+     */
+    MDSReaderSegmentCacheEntry *segmentCache;
+
+    /**
+     * Segment (per node) from where the real-time thread is copying data. Cached segments before this one minus one can be reused.
+     */
+    volatile uint32 *firstSegmentInUse;
+
+    /**
+     * Number of segments read from the cache.
+     */
+    uint64 cacheHits;
+
+    /**
+     * Number of segments read from the tree by the real-time thread while the prefetch thread is enabled.
+     */
+    uint64 cacheMisses;
+
+    /**
+     * Serialises the tree access between the prefetch thread and the real-time thread.
+     */
+    FastPollingMutexSem treeMux;
+
+    /**
+     * The thread which prefetches the segments.
+     */
+    SingleThreadService prefetchService;
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -657,7 +852,7 @@ uint32 MDSReader::MakeRawCopyTemplate(uint32 nodeNumber,
                                       uint32 SamplesToCopy,
                                       uint32 OffsetSamples) {
 
-    MDSplus::Data *dataD = NULL_PTR(MDSplus::Data *);
+    float64 *timeNode = NULL_PTR(float64 *);
     int32 nElements = 0u;
     uint32 bytesToCopy = 0u;
     uint32 extraOffset = OffsetSamples * bytesType[nodeNumber];
@@ -666,38 +861,14 @@ uint32 MDSReader::MakeRawCopyTemplate(uint32 nodeNumber,
     uint32 remainingSamplesOnTheSegment = 0u;
     T* data = NULL_PTR(T *);
     for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (SamplesToCopy != 0); currentSegment++) {
-        dataD = nodes[nodeNumber]->getSegment(currentSegment);
-        if (type[nodeNumber] == UnsignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntUnsignedArray(&nElements));
+        const MDSReaderSegmentCacheEntry *cached = GetCachedSegment(nodeNumber, currentSegment);
+        if (cached != NULL_PTR(const MDSReaderSegmentCacheEntry *)) {
+            data = reinterpret_cast<T *>(cached->data);
+            nElements = cached->nElements;
         }
-        else if (type[nodeNumber] == SignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntArray(&nElements));
+        else {
+            data = ReadSegmentTemplate<T>(nodeNumber, currentSegment, timeNode, nElements, false);
         }
-        else if (type[nodeNumber] == UnsignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float32Bit) {
-            data = reinterpret_cast<T *>(dataD->getFloatArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float64Bit) {
-            data = reinterpret_cast<T *>(dataD->getDoubleArray(&nElements));
-        }
-
         remainingSamplesOnTheSegment = static_cast<uint32>(nElements) - elementsConsumed[nodeNumber];
         endSegment = remainingSamplesOnTheSegment <= SamplesToCopy;
         if (!endSegment) {        // no end of segment but no more data need to be copied
@@ -724,8 +895,9 @@ uint32 MDSReader::MakeRawCopyTemplate(uint32 nodeNumber,
             elementsConsumed[nodeNumber] = 0u;
         }
         *reinterpret_cast<T *>(&lastValue[offsetLastValue[nodeNumber]]) = data[nElements - 1];
-        MDSplus::deleteData (dataD);
-        delete[] data; //Valgrind complains and in theory I do not know who memory was allocated so lets assume valgrind knows.....
+        if (cached == NULL_PTR(const MDSReaderSegmentCacheEntry *)) {
+            delete[] data; //Valgrind complains and in theory I do not know who memory was allocated so lets assume valgrind knows.....
+        }
 
     }
     return samplesCopied;
@@ -737,8 +909,6 @@ uint32 MDSReader::LinearInterpolationCopyTemplate(uint32 nodeNumber,
                                                   uint32 samplesToCopy,
                                                   uint32 offsetSamples) {
 
-    MDSplus::Array *dataD = NULL_PTR(MDSplus::Array *);
-    MDSplus::Data *timeNodeD = NULL_PTR(MDSplus::Data *);
     float64 *timeNode = NULL_PTR(float64 *);
     int32 nElements = 0u;
     uint32 extraOffset = offsetSamples * bytesType[nodeNumber];
@@ -749,40 +919,15 @@ uint32 MDSReader::LinearInterpolationCopyTemplate(uint32 nodeNumber,
 
     T* data = NULL_PTR(T *);
     for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (samplesToCopy != 0); currentSegment++) {
-        //nodes[nodeNumber]->getSegmentAndDimension(currentSegment, dataD, timeNodeD);
-        dataD = nodes[nodeNumber]->getSegment(currentSegment);
-        timeNodeD = nodes[nodeNumber]->getSegmentDim(currentSegment);
-        if (type[nodeNumber] == UnsignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntUnsignedArray(&nElements));
+        const MDSReaderSegmentCacheEntry *cached = GetCachedSegment(nodeNumber, currentSegment);
+        if (cached != NULL_PTR(const MDSReaderSegmentCacheEntry *)) {
+            data = reinterpret_cast<T *>(cached->data);
+            timeNode = cached->time;
+            nElements = cached->nElements;
         }
-        else if (type[nodeNumber] == SignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntArray(&nElements));
+        else {
+            data = ReadSegmentTemplate<T>(nodeNumber, currentSegment, timeNode, nElements, true);
         }
-        else if (type[nodeNumber] == UnsignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float32Bit) {
-            data = reinterpret_cast<T *>(dataD->getFloatArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float64Bit) {
-            data = reinterpret_cast<T *>(dataD->getDoubleArray(&nElements));
-        }
-        timeNode = timeNodeD->getDoubleArray(&nElements);
         float64 auxTime = timeNode[nElements - 1] + samplingTime[nodeNumber];
         remainingSamplesOnTheSegment = ComputeSamplesToCopy(nodeNumber, currentTime, auxTime); //static_cast<uint32>(1 + ((timeNode[nElements - 1] - currentTime) / samplingTime[nodeNumber]));
         endSegment = (remainingSamplesOnTheSegment <= samplesToCopy);
@@ -823,10 +968,10 @@ uint32 MDSReader::LinearInterpolationCopyTemplate(uint32 nodeNumber,
             lastTime[nodeNumber] = timeNode[nElements - 1];
             elementsConsumed[nodeNumber] = 0u;
         }
-        MDSplus::deleteData (dataD);
-        MDSplus::deleteData (timeNodeD);
-        delete[] data;
-        delete[] timeNode;
+        if (cached == NULL_PTR(const MDSReaderSegmentCacheEntry *)) {
+            delete[] data;
+            delete[] timeNode;
+        }
     }
     return samplesCopied;
 
@@ -838,8 +983,6 @@ uint32 MDSReader::HoldCopyTemplate(uint32 nodeNumber,
                                    uint32 samplesToCopy,
                                    uint32 samplesOffset) {
 
-    MDSplus::Array *dataD = NULL_PTR(MDSplus::Array *);
-    MDSplus::Data *timeNodeD = NULL_PTR(MDSplus::Data *);
     float64 *timeNode = NULL_PTR(float64 *);
     int32 nElements = 0u;
     uint32 extraOffset = samplesOffset * bytesType[nodeNumber];
@@ -850,40 +993,15 @@ uint32 MDSReader::HoldCopyTemplate(uint32 nodeNumber,
 
     T* data = NULL_PTR(T *);
     for (uint32 currentSegment = minSeg; (currentSegment < maxNumberOfSegments[nodeNumber]) && (samplesToCopy != 0); currentSegment++) {
-        //nodes[nodeNumber]->getSegmentAndDimension(currentSegment, dataD, timeNodeD);
-        dataD = nodes[nodeNumber]->getSegment(currentSegment);
-        timeNodeD = nodes[nodeNumber]->getSegmentDim(currentSegment);
-        if (type[nodeNumber] == UnsignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger8Bit) {
-            data = reinterpret_cast<T *>(dataD->getByteArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger16Bit) {
-            data = reinterpret_cast<T *>(dataD->getShortArray(&nElements));
-        }
-        else if (type[nodeNumber] == UnsignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntUnsignedArray(&nElements));
-        }
-        else if (type[nodeNumber] == SignedInteger32Bit) {
-            data = reinterpret_cast<T *>(dataD->getIntArray(&nElements));
+        const MDSReaderSegmentCacheEntry *cached = GetCachedSegment(nodeNumber, currentSegment);
+        if (cached != NULL_PTR(const MDSReaderSegmentCacheEntry *)) {
+            data = reinterpret_cast<T *>(cached->data);
+            timeNode = cached->time;
+            nElements = cached->nElements;
         }
-        else if (type[nodeNumber] == UnsignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongUnsignedArray(&nElements));
+        else {
+            data = ReadSegmentTemplate<T>(nodeNumber, currentSegment, timeNode, nElements, true);
         }
-        else if (type[nodeNumber] == SignedInteger64Bit) {
-            data = reinterpret_cast<T *>(dataD->getLongArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float32Bit) {
-            data = reinterpret_cast<T *>(dataD->getFloatArray(&nElements));
-        }
-        else if (type[nodeNumber] == Float64Bit) {
-            data = reinterpret_cast<T *>(dataD->getDoubleArray(&nElements));
-        }
-        timeNode = timeNodeD->getDoubleArray(&nElements);
         float64 auxTime = timeNode[nElements - 1] + samplingTime[nodeNumber];
         remainingSamplesOnTheSegment = ComputeSamplesToCopy(nodeNumber, currentTime, auxTime); //static_cast<uint32>(1 + ((timeNode[nElements - 1] - currentTime) / samplingTime[nodeNumber]));
         endSegment = (remainingSamplesOnTheSegment <= samplesToCopy);
@@ -929,12 +1047,116 @@ uint32 MDSReader::HoldCopyTemplate(uint32 nodeNumber,
             lastTime[nodeNumber] = timeNode[nElements - 1];
             elementsConsumed[nodeNumber] = 0u;
         }
-        MDSplus::deleteData (dataD);
+        if (cached == NULL_PTR(const MDSReaderSegmentCacheEntry *)) {
+            delete[] data;
+            delete[] timeNode;
+        }
+    }
+    return samplesCopied;
+}
+
+template<typename T>
+T *MDSReader::ReadSegmentTemplate(uint32 nodeNumber,
+                                 uint32 segment,
+                                 float64 *&timeNode,
+                                 int32 &nElements,
+                                 bool readTime) {
+    T* data = NULL_PTR(T *);
+    bool serialise = (prefetchSegments > 0u);
+    if (serialise) {
+        (void) treeMux.FastLock();
+    }
+    MDSplus::Data *dataD = nodes[nodeNumber]->getSegment(static_cast<int32>(segment));
+    if (type[nodeNumber] == UnsignedInteger8Bit) {
+        data = reinterpret_cast<T *>(dataD->getByteUnsignedArray(&nElements));
+    }
+    else if (type[nodeNumber] == SignedInteger8Bit) {
+        data = reinterpret_cast<T *>(dataD->getByteArray(&nElements));
+    }
+    else if (type[nodeNumber] == UnsignedInteger16Bit) {
+        data = reinterpret_cast<T *>(dataD->getShortUnsignedArray(&nElements));
+    }
+    else if (type[nodeNumber] == SignedInteger16Bit) {
+        data = reinterpret_cast<T *>(dataD->getShortArray(&nElements));
+    }
+    else if (type[nodeNumber] == UnsignedInteger32Bit) {
+        data = reinterpret_cast<T *>(dataD->getIntUnsignedArray(&nElements));
+    }
+    else if (type[nodeNumber] == SignedInteger32Bit) {
+        data = reinterpret_cast<T *>(dataD->getIntArray(&nElements));
+    }
+    else if (type[nodeNumber] == UnsignedInteger64Bit) {
+        data = reinterpret_cast<T *>(dataD->getLongUnsignedArray(&nElements));
+    }
+    else if (type[nodeNumber] == SignedInteger64Bit) {
+        data = reinterpret_cast<T *>(dataD->getLongArray(&nElements));
+    }
+    else if (type[nodeNumber] == Float32Bit) {
+        data = reinterpret_cast<T *>(dataD->getFloatArray(&nElements));
+    }
+    else if (type[nodeNumber] == Float64Bit) {
+        data = reinterpret_cast<T *>(dataD->getDoubleArray(&nElements));
+    }
+    MDSplus::deleteData (dataD);
+    if (readTime) {
+        MDSplus::Data *timeNodeD = nodes[nodeNumber]->getSegmentDim(static_cast<int32>(segment));
+        timeNode = timeNodeD->getDoubleArray(&nElements);
         MDSplus::deleteData (timeNodeD);
+    }
+    if (serialise) {
+        treeMux.FastUnLock();
+    }
+    return data;
+}
+
+template<typename T>
+bool MDSReader::FillSegmentCacheTemplate(uint32 nodeNumber,
+                                         uint32 segment,
+                                         MDSReaderSegmentCacheEntry &entry) {
+    float64 *timeNode = NULL_PTR(float64 *);
+    int32 nElements = 0;
+    T *data = ReadSegmentTemplate<T>(nodeNumber, segment, timeNode, nElements, true);
+    bool ok = ((data != NULL_PTR(T *)) && (timeNode != NULL_PTR(float64 *)) && (nElements > 0));
+    uint32 nSamples = 0u;
+    if (ok) {
+        nSamples = static_cast<uint32>(nElements);
+        if (entry.capacity < nSamples) {
+            HeapI *heap = GlobalObjectsDatabase::Instance()->GetStandardHeap();
+            if (entry.data != NULL_PTR(char8 *)) {
+                heap->Free(reinterpret_cast<void *&>(entry.data));
+                entry.data = NULL_PTR(char8 *);
+            }
+            if (entry.time != NULL_PTR(float64 *)) {
+                heap->Free(reinterpret_cast<void *&>(entry.time));
+                entry.time = NULL_PTR(float64 *);
+            }
+            entry.capacity = 0u;
+            entry.data = reinterpret_cast<char8 *>(heap->Malloc(nSamples * bytesType[nodeNumber]));
+            entry.time = reinterpret_cast<float64 *>(heap->Malloc(nSamples * static_cast<uint32>(sizeof(float64))));
+            ok = ((entry.data != NULL_PTR(char8 *)) && (entry.time != NULL_PTR(float64 *)));
+            if (ok) {
+                entry.capacity = nSamples;
+            }
+        }
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(reinterpret_cast<void *>(entry.data), reinterpret_cast<void *>(data), nSamples * bytesType[nodeNumber]);
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Copy(reinterpret_cast<void *>(entry.time), reinterpret_cast<void *>(timeNode),
+                                          nSamples * static_cast<uint32>(sizeof(float64)));
+    }
+    if (ok) {
+        entry.nElements = nElements;
+        entry.segment = segment;
+    }
+    if (data != NULL_PTR(T *)) {
         delete[] data;
+    }
+    if (timeNode != NULL_PTR(float64 *)) {
         delete[] timeNode;
     }
-    return samplesCopied;
+    return ok;
 }
 
 template<typename T>
@@ -43,9 +43,21 @@ namespace MARTe {
 
 static const int32 MDS_UNDEFINED_PULSE_NUMBER = -3;
 
+/**
+ * Maximum time (in ms) that a writer thread waits before checking again for pending segments.
+ */
+static const uint32 MDS_WRITER_TIMEOUT = 100u;
+
+/**
+ * Default maximum time (in ms) that the broker thread waits for a writer thread to commit a segment.
+ */
+static const uint32 MDS_SEGMENT_WRITE_TIMEOUT = 10000u;
+
 MDSWriter::MDSWriter() :
         DataSourceI(),
-        MessageI() {
+        MessageI(),
+        EmbeddedServiceMethodBinderI(),
+        writers(*this) {
     storeOnTrigger = false;
     numberOfPreTriggers = 0u;
     numberOfPostTriggers = 0u;
@@ -64,6 +76,9 @@ MDSWriter::MDSWriter() :
     lastTimeRefreshCount = 0u;
     refreshEveryCounts = 0u;
     fatalTreeNodeError = false;
+    numberOfWriterThreads = 0u;
+    segmentWriteTimeout = MDS_SEGMENT_WRITE_TIMEOUT;
+    writerSems = NULL_PTR(EventSem *);
     filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -78,6 +93,14 @@ MDSWriter::~MDSWriter() {
     if (FlushSegments() != ErrorManagement::NoError) {
         REPORT_ERROR(ErrorManagement::FatalError, "Failed to Flush the MDSWriterNodes");
     }
+    if (!writers.Stop()) {
+        if (!writers.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop the writer threads.");
+        }
+    }
+    if (writerSems != NULL_PTR(EventSem *)) {
+        delete[] writerSems;
+    }
     if (nodes != NULL_PTR(MDSWriterNode **)) {
         uint32 n;
         for (n = 0u; (n < numberOfMDSSignals); n++) {
@@ -162,6 +185,14 @@ bool MDSWriter::Synchronise() {
     if (nodes != NULL_PTR(MDSWriterNode **)) {
         for (n = 0u; (n < numberOfMDSSignals) && (!fatalTreeNodeError); n++) {
             fatalTreeNodeError = !nodes[n]->Execute();
+            if (numberOfWriterThreads > 0u) {
+                if (nodes[n]->IsSegmentPending()) {
+                    /*lint -e{613} writerSems != NULL if numberOfWriterThreads > 0*/
+                    if (!writerSems[n % numberOfWriterThreads].Post()) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "Could not wake the writer thread");
+                    }
+                }
+            }
             if (fatalTreeNodeError) {
                 if (treeRuntimeErrorMsg.IsValid()) {
                     //Reset any previous replies
@@ -272,6 +303,18 @@ bool MDSWriter::Initialise(StructuredDataI& data) {
         //Optional parameter
         (void) (data.Read("PulseNumber", pulseNumber));
     }
+    if (ok) {
+        if (!data.Read("NumberOfWriterThreads", numberOfWriterThreads)) {
+            numberOfWriterThreads = 0u;
+        }
+        if (!data.Read("SegmentWriteTimeout", segmentWriteTimeout)) {
+            segmentWriteTimeout = MDS_SEGMENT_WRITE_TIMEOUT;
+        }
+        ok = (segmentWriteTimeout > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "SegmentWriteTimeout shall be > 0");
+        }
+    }
     if (ok) {
         ok = data.MoveRelative("Signals");
         if (!ok) {
@@ -544,6 +587,39 @@ bool MDSWriter::SetConfiguredDatabase(StructuredDataI& data) {
             }
         }
     }
+    if ((ok) && (numberOfWriterThreads > 0u)) {
+        //There is no advantage in having more threads than signals
+        if (numberOfWriterThreads > numberOfMDSSignals) {
+            REPORT_ERROR(ErrorManagement::Warning, "NumberOfWriterThreads limited to the number of MDS signals (%d)", numberOfMDSSignals);
+            numberOfWriterThreads = numberOfMDSSignals;
+        }
+        writerSems = new EventSem[numberOfWriterThreads];
+        uint32 t;
+        for (t = 0u; (t < numberOfWriterThreads) && (ok); t++) {
+            ok = writerSems[t].Create();
+            if (ok) {
+                ok = writerSems[t].Reset();
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
+            }
+        }
+        uint32 n;
+        for (n = 0u; (n < numberOfMDSSignals) && (ok); n++) {
+            /*lint -e{613} nodes != NULL as numberOfMDSSignals > 0*/
+            ok = nodes[n]->EnableSegmentPipeline(segmentWriteTimeout);
+        }
+        if (ok) {
+            writers.SetNumberOfPoolThreads(numberOfWriterThreads);
+            writers.SetCPUMask(cpuMask);
+            writers.SetStackSize(stackSize);
+            writers.SetName(GetName());
+            ok = (writers.Start() == ErrorManagement::NoError);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the writer threads.");
+            }
+        }
+    }
     if (ok) {
         if (pulseNumber != MDS_UNDEFINED_PULSE_NUMBER) {
             ok = (OpenTree(pulseNumber) == ErrorManagement::NoError);
@@ -724,6 +800,20 @@ ErrorManagement::ErrorType MDSWriter::FlushSegments() {
                 REPORT_ERROR(ErrorManagement::FatalError, "Failed to flush MDSWriterNode");
             }
         }
+        if (numberOfWriterThreads > 0u) {
+            uint32 t;
+            for (t = 0u; t < numberOfWriterThreads; t++) {
+                /*lint -e{613} writerSems != NULL if numberOfWriterThreads > 0*/
+                (void) writerSems[t].Post();
+            }
+            //Wait for all the segments (even if a flush failed), so that the nodes can be safely reallocated
+            for (n = 0u; n < numberOfMDSSignals; n++) {
+                if (!nodes[n]->WaitForSegmentWritten()) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Failed to store the segments of MDSWriterNode");
+                    ok = false;
+                }
+            }
+        }
     }
     if (ok) {
         if (treeFlushedMsg.IsValid()) {
@@ -786,6 +876,43 @@ int32 MDSWriter::GetTimeSignalIdx() const {
     return timeSignalIdx;
 }
 
+uint32 MDSWriter::GetNumberOfWriterThreads() const {
+    return numberOfWriterThreads;
+}
+
+uint32 MDSWriter::GetSegmentWriteTimeout() const {
+    return segmentWriteTimeout;
+}
+
+uint32 MDSWriter::GetNumberOfPipelineStalls() const {
+    uint32 stalls = 0u;
+    if (nodes != NULL_PTR(MDSWriterNode **)) {
+        uint32 n;
+        for (n = 0u; n < numberOfMDSSignals; n++) {
+            stalls += nodes[n]->GetNumberOfPipelineStalls();
+        }
+    }
+    return stalls;
+}
+
+/*lint -e{613} writerSems and nodes cannot be NULL if the writer threads are running*/
+ErrorManagement::ErrorType MDSWriter::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        const uint32 thread = info.GetThreadNumber();
+        //On timeout the pending segments are also checked
+        (void) writerSems[thread].Wait(TimeoutType(MDS_WRITER_TIMEOUT));
+        //A Post received before the Reset is not lost, as its segment is already pending and is checked below
+        (void) writerSems[thread].Reset();
+        uint32 n;
+        for (n = thread; n < numberOfMDSSignals; n += numberOfWriterThreads) {
+            if (!nodes[n]->WritePendingSegment()) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Failed to store a segment of node %s", nodes[n]->GetNodeName().Buffer());
+            }
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
 const StreamString& MDSWriter::GetTreeName() const {
     return treeName;
 }
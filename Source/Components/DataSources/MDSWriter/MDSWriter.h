@@ -32,10 +32,13 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
 #include "MDSWriterNode.h"
 #include "MemoryMapAsyncOutputBroker.h"
 #include "MemoryMapAsyncTriggerOutputBroker.h"
 #include "MessageI.h"
+#include "MultiThreadService.h"
 #include "ProcessorType.h"
 #include "RegisteredMethodsMessageFilter.h"
 
@@ -53,6 +56,13 @@ namespace MARTe {
  *
  * This DataSourceI has the functions FlushSegments and OpenTree registered as an RPC.
  *
+ * By default the segments are committed to the tree in the context of the asynchronous broker thread, which cannot
+ * copy more data from the circular buffer while a segment is being written. If NumberOfWriterThreads > 0, each
+ * MDSWriterNode buffers the next segment while the previous one is committed by a pool of writer threads (each thread
+ * is responsible for a fixed subset of the signals). The broker thread only waits if a signal fills a new segment before
+ * the previous one was committed (see GetNumberOfPipelineStalls). If the writer does not commit it within SegmentWriteTimeout,
+ * the new segment is dropped and an error is reported.
+ *
  * The configuration syntax is (names are only given as an example):
  *
  * <pre>
@@ -61,6 +71,8 @@ namespace MARTe {
  *     NumberOfBuffers = 10 //Compulsory. Number of buffers in the circular buffer defined above. Each buffer is capable of holding a copy of all the DataSourceI signals.
  *     CPUMask = 15 //Compulsory. Affinity assigned to the threads responsible for asynchronously flush data into the MDSplus database.
  *     StackSize = 10000000 //Compulsory. Stack size of the thread above.
+ *     NumberOfWriterThreads = 2 //Optional. Default = 0. Number of threads that commit the segments to the MDSplus database. If 0 the segments are committed by the thread above. Limited to the number of MDS signals. Use the CPUMask and StackSize above.
+ *     SegmentWriteTimeout = 1000 //Optional. Default = 10000. Only used if NumberOfWriterThreads > 0. Maximum time in ms that the broker thread (and FlushSegments) waits for a writer thread to commit a segment.
  *     TreeName = "mds_m2test" //Compulsory. Name of the MDSplus tree.
  *     PulseNumber = 1 //Optional. If -1 a new pulse will be created and the MDSplus pulse number incremented.
  *     StoreOnTrigger = 1 //Compulsory. If 0 all the data in the circular buffer is continuously stored. If 1 data is stored when the Trigger signal is 1 (see below).
@@ -86,6 +98,7 @@ namespace MARTe {
  *             DecimatedNodeName = "SIGUINT16D" //Optional. The node where MDSplus stores the automatically computed decimated signal. When AutomaticSegmentation = 1 this field is ignored.
  *             MinMaxResampleFactor = 4 //Compulsory if DecimatedNodeName is set. Decimation factor that MDSplus applies to the decimated version of the signal. AutomaticSegmentation = 1 this field is ignored.
  *             SamplePhase = 0 //Optional. Shift the time vector by SamplePhase * Period
+ *             CompressSegments = 0 //Optional. Default = 0. If 1 MDSplus compresses (lossless) the segments of this signal (most effective with integer data).
  *             DiscontinuityFactor = 0. //Optional. A discontinuity is considered if the delta between two consecutive samples is greater than T+DiscontinuityFactor*T (where T is the nominal period) or
  *                                                  minor than max(T-DiscontinuityFactor*T, 0). If a discontinuity is detected, the samples will be flushed and a new segment created for the next ones.
  *         }
@@ -115,7 +128,7 @@ namespace MARTe {
  * }
  * </pre>
  */
-class MDSWriter: public DataSourceI, public MessageI {
+class MDSWriter: public DataSourceI, public MessageI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -215,6 +228,7 @@ MDSWriter    ();
     /**
      * @brief Calls MDSTreeNode::Flush on all the MDSplus signals, constraining the creation of a new segment even if the number of
      *  cycles is less than MakeSegmentAfterNWrites
+     * @details If NumberOfWriterThreads > 0 waits for the writer threads to commit all the segments.
      * @return true if all the MDSTreeNode::Flush return no error.
      */
     ErrorManagement::ErrorType FlushSegments();
@@ -298,6 +312,32 @@ MDSWriter    ();
      */
     int32 GetTimeSignalIdx() const;
 
+    /**
+     * @brief Gets the number of threads that commit the segments to the MDSplus database.
+     * @return the number of threads that commit the segments to the MDSplus database (0 if committed by the broker thread).
+     */
+    uint32 GetNumberOfWriterThreads() const;
+
+    /**
+     * @brief Gets the maximum time waiting for a writer thread to commit a segment.
+     * @return the maximum time in ms waiting for a writer thread to commit a segment.
+     */
+    uint32 GetSegmentWriteTimeout() const;
+
+    /**
+     * @brief Gets the number of times the broker thread had to wait for a writer thread.
+     * @return the sum of MDSWriterNode::GetNumberOfPipelineStalls for all the MDS signals.
+     */
+    uint32 GetNumberOfPipelineStalls() const;
+
+    /**
+     * @brief Callback function for the writer threads.
+     * @details Commits the pending segments of the signals assigned to the thread (i.e. the signals whose index modulo
+     * NumberOfWriterThreads is the thread number).
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
     /**
      * @see DataSourceI::Purge()
      */
@@ -375,6 +415,26 @@ private:
      */
     uint32 stackSize;
 
+    /**
+     * The number of threads that commit the segments into MDSplus.
+     */
+    uint32 numberOfWriterThreads;
+
+    /**
+     * Maximum time (in ms) that the broker thread waits for a writer thread to commit a segment.
+     */
+    uint32 segmentWriteTimeout;
+
+    /**
+     * The threads that commit the segments into MDSplus.
+     */
+    MultiThreadService writers;
+
+    /**
+     * One semaphore for each writer thread, posted when one of its signals has a segment to be committed.
+     */
+    EventSem *writerSems;
+
     /**
      * If a fatal tree node error occurred do not try to flush segments nor do further writes.
      */
@@ -29,7 +29,9 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "MDSWriterNode.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -79,6 +81,18 @@ MDSWriterNode::MDSWriterNode() {
     segmentDim[1] = 0;
     segmentDim[2] = 0;
     discontinuityFactor = 0.;
+
+    compressSegments = false;
+    segmentData = NULL_PTR(void*);
+    pendingSegment.data = NULL_PTR(void*);
+    pendingSegment.numberOfSamples = 0u;
+    pendingSegment.start = 0.;
+    pendingSegment.end = 0.;
+    pendingSegment.period = 0.;
+    segmentPending = 0;
+    segmentWriteError = false;
+    numberOfPipelineStalls = 0u;
+    segmentWriteTimeout = 0u;
 }
 
 /*lint -e{1551} -e{1740} the destructor must guarantee that the MDSplus TreeNode is deleted and the shared memory freed. The signalMemory and the timeSignalMemory are freed by the framework */
@@ -94,6 +108,9 @@ MDSWriterNode::~MDSWriterNode() {
     if (bufferedData != NULL_PTR(void*)) {
         GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(bufferedData));
     }
+    if (segmentData != NULL_PTR(void*)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(segmentData);
+    }
 }
 
 bool MDSWriterNode::Initialise(StructuredDataI &data) {
@@ -146,6 +163,19 @@ bool MDSWriterNode::Initialise(StructuredDataI &data) {
         if (!data.Read("DiscontinuityFactor", discontinuityFactor)) {
             discontinuityFactor = 0.;
         }
+        uint8 auxCompress;
+        if (data.Read("CompressSegments", auxCompress)) {
+            if (auxCompress == 1u) {
+                compressSegments = true;
+            }
+            else if (auxCompress == 0u) {
+                compressSegments = false;
+            }
+            else {
+                REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "CompressSegments must be 0 (false) or 1 (true)");
+                ok = false;
+            }
+        }
 
         signalTypeDescriptor = TypeDescriptor::GetTypeDescriptorFromTypeName(signalType.Buffer());
     }
@@ -308,6 +338,10 @@ bool MDSWriterNode::Initialise(StructuredDataI &data) {
 
 bool MDSWriterNode::AllocateTreeNode(MDSplus::Tree *const tree) {
     bool ok = (tree != NULL_PTR(MDSplus::Tree*));
+    //The writer shall not be using the node which is about to be deleted
+    if (!WaitForSegmentWritten()) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "The last segment of node with name %s was not stored", nodeName.Buffer());
+    }
     try {
         if (node != NULL_PTR(MDSplus::TreeNode*)) {
             delete node;
@@ -317,6 +351,9 @@ bool MDSWriterNode::AllocateTreeNode(MDSplus::Tree *const tree) {
         if (ok) {
             node = tree->getNode(nodeName.Buffer());
             node->deleteData();
+            if (compressSegments) {
+                node->setCompressSegments(true);
+            }
         }
     }
     catch (const MDSplus::MdsException &exc) {
@@ -427,12 +464,7 @@ bool MDSWriterNode::Execute() {
     }
     //Sufficient data to make a segment
     if ((ok) && (storeNow)) {
-        if (automaticSegmentation) {
-            ok = AddDataToSegment();
-        }
-        else {
-            ok = ForceSegment();
-        }
+        ok = StoreSegment();
         nOfExecuteCalls++;
 
         //discontuityFound will only be triggered if makeSegmentAfterNWrites > 1, so Execute will be called again later
@@ -464,73 +496,199 @@ bool MDSWriterNode::Execute() {
     return ok;
 }
 
-//lint -e{429} startD, endD, dimension are freed by MDSplus upon deletion of dimension
-bool MDSWriterNode::ForceSegment() {
+bool MDSWriterNode::EnableSegmentPipeline(const uint32 timeoutMSec) {
+    segmentWriteTimeout = timeoutMSec;
+    bool ok = (bufferedData != NULL_PTR(char8*));
+    if ((ok) && (segmentData == NULL_PTR(void*))) {
+        uint32 bufferedDataSize = static_cast<uint32>(typeMultiplier);
+        bufferedDataSize *= numberOfElements * makeSegmentAfterNWrites * numberOfSamples;
+        segmentData = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(bufferedDataSize);
+        ok = (segmentData != NULL_PTR(void*));
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Could not allocate the segment pipeline buffer for node with name %s", nodeName.Buffer());
+    }
+    return ok;
+}
+
+bool MDSWriterNode::IsSegmentPipelineEnabled() const {
+    return (segmentData != NULL_PTR(void*));
+}
+
+bool MDSWriterNode::IsSegmentPending() const {
+    return (segmentPending != 0);
+}
+
+bool MDSWriterNode::WritePendingSegment() {
     bool ok = true;
+    if (segmentPending != 0) {
+        if (automaticSegmentation) {
+            ok = AddDataToSegment(pendingSegment);
+        }
+        else {
+            ok = ForceSegment(pendingSegment);
+        }
+        if (!ok) {
+            segmentWriteError = true;
+        }
+        //Only now can Execute reuse the buffer
+        Atomic::Decrement(&segmentPending);
+    }
+    return ok;
+}
+
+bool MDSWriterNode::WaitForSegmentPending() {
+    uint32 elapsed = 0u;
+    while ((segmentPending != 0) && (elapsed < segmentWriteTimeout)) {
+        Sleep::MSec(1u);
+        elapsed++;
+    }
+    bool ok = (segmentPending == 0);
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Timeout, "The writer did not store the segment of node with name %s within %d ms", nodeName.Buffer(),
+                            segmentWriteTimeout);
+    }
+    return ok;
+}
+
+bool MDSWriterNode::WaitForSegmentWritten() {
+    bool ok = WaitForSegmentPending();
+    if (ok) {
+        ok = !segmentWriteError;
+        segmentWriteError = false;
+    }
+    return ok;
+}
+
+uint32 MDSWriterNode::GetNumberOfPipelineStalls() const {
+    return numberOfPipelineStalls;
+}
+
+bool MDSWriterNode::IsCompressSegments() const {
+    return compressSegments;
+}
+
+void MDSWriterNode::PrepareSegment(MDSWriterNodeSegment &segment) {
     //Notice that currentBuffer is not incremented if a discontinuity is found
-    int32 numberOfSamplesPerSegment = static_cast<int32>(numberOfSamples) * static_cast<int32>(currentBuffer);
-    segmentDim[0] = numberOfSamplesPerSegment;
-    int32 numberOfSamplesPerSegmentM1 = numberOfSamplesPerSegment - 1;
-    float64 numberOfSamplesPerSegmentF = static_cast<float64>(numberOfSamplesPerSegmentM1);
-    float64 end = 0.;
-    float64 newPeriod = period;
-    if (!useTimeVector) {
-        end = start + (numberOfSamplesPerSegmentF * period);
+    segment.numberOfSamples = numberOfSamples * currentBuffer;
+    segment.data = bufferedData;
+    segment.start = start;
+    segment.end = 0.;
+    segment.period = period;
+    if (automaticSegmentation) {
+        //The time of each row is computed by AddDataToSegment
+        if (useTimeVector) {
+            segment.period = 0.;
+        }
+        else {
+            for (uint32 i = 0u; i < segment.numberOfSamples; i++) {
+                start += period;
+            }
+        }
     }
     else {
-        end = static_cast<float64>(lastWriteTimeSignal) * timeSignalMultiplier;
-        float64 periodDelta = period;
-        uint32 numberOfSamplesM1 = numberOfSamples - 1u;
-        periodDelta *= static_cast<float64>(numberOfSamplesM1);
-        end += periodDelta;
-        if (!IsEqual(end, start)) {
-            if (numberOfSamplesPerSegmentF > 0.) {
-                newPeriod = (end - start) / numberOfSamplesPerSegmentF;
+        int32 numberOfSamplesPerSegmentM1 = static_cast<int32>(segment.numberOfSamples) - 1;
+        float64 numberOfSamplesPerSegmentF = static_cast<float64>(numberOfSamplesPerSegmentM1);
+        if (!useTimeVector) {
+            segment.end = start + (numberOfSamplesPerSegmentF * period);
+            start += static_cast<float64>(segment.numberOfSamples) * period;
+        }
+        else {
+            segment.end = static_cast<float64>(lastWriteTimeSignal) * timeSignalMultiplier;
+            float64 periodDelta = period;
+            uint32 numberOfSamplesM1 = numberOfSamples - 1u;
+            periodDelta *= static_cast<float64>(numberOfSamplesM1);
+            segment.end += periodDelta;
+            if (!IsEqual(segment.end, start)) {
+                if (numberOfSamplesPerSegmentF > 0.) {
+                    segment.period = (segment.end - start) / numberOfSamplesPerSegmentF;
+                }
             }
         }
     }
+}
+
+bool MDSWriterNode::StoreSegment() {
+    bool ok = true;
+    if (segmentData == NULL_PTR(void*)) {
+        MDSWriterNodeSegment segment;
+        PrepareSegment(segment);
+        if (automaticSegmentation) {
+            ok = AddDataToSegment(segment);
+        }
+        else {
+            ok = ForceSegment(segment);
+        }
+    }
+    else {
+        //The writer is still busy with the previous segment of this node.
+        if (segmentPending != 0) {
+            numberOfPipelineStalls++;
+        }
+        //If the writer is stuck the buffered data is lost (the writer still owns the other buffer)
+        bool written = WaitForSegmentPending();
+        ok = !segmentWriteError;
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Failed to store a previous segment of node with name %s", nodeName.Buffer());
+            segmentWriteError = false;
+        }
+        if (written) {
+            PrepareSegment(pendingSegment);
+            //Continue filling the buffer which was just written by the writer
+            bufferedData = reinterpret_cast<char8*>(segmentData);
+            segmentData = pendingSegment.data;
+            Atomic::Increment(&segmentPending);
+        }
+        else {
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+//lint -e{429} startD, endD, dimension are freed by MDSplus upon deletion of dimension
+bool MDSWriterNode::ForceSegment(const MDSWriterNodeSegment &segment) {
+    bool ok = true;
+    segmentDim[0] = static_cast<int32>(segment.numberOfSamples);
     //lint -e{429} freed by MDSplus upon deletion of dimension
-    MDSplus::Data *startD = new MDSplus::Float64(start);
+    MDSplus::Data *startD = new MDSplus::Float64(segment.start);
     //lint -e{429} freed by MDSplus upon deletion of dimension
-    MDSplus::Data *endD = new MDSplus::Float64(end);
+    MDSplus::Data *endD = new MDSplus::Float64(segment.end);
 
     //lint -e{429} freed by MDSplus upon deletion of dimension
-    MDSplus::Data *dimension = new MDSplus::Range(startD, endD, new MDSplus::Float64(newPeriod));
+    MDSplus::Data *dimension = new MDSplus::Range(startD, endD, new MDSplus::Float64(segment.period));
     //lint -e{429, 578} freed by MDSplus upon deletion of array. Ignore collision of array name with mdsplus header file.
     MDSplus::Array *array = NULL_PTR(MDSplus::Array*);
 
-    if (!useTimeVector) {
-        start += static_cast<float64>(numberOfSamplesPerSegment) * newPeriod;
-    }
     if (nodeType == DTYPE_B) {
-        array = new MDSplus::Int8Array(reinterpret_cast<char8*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Int8Array(reinterpret_cast<char8*>(segment.data), 2, &segmentDim[0]);
     }
     else if (nodeType == DTYPE_BU) {
-        array = new MDSplus::Uint8Array(reinterpret_cast<uint8*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Uint8Array(reinterpret_cast<uint8*>(segment.data), 2, &segmentDim[0]);
     }
     else if (nodeType == DTYPE_W) {
-        array = new MDSplus::Int16Array(reinterpret_cast<int16*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Int16Array(reinterpret_cast<int16*>(segment.data), 2, &segmentDim[0]);
     }
     else if (nodeType == DTYPE_WU) {
-        array = new MDSplus::Uint16Array(reinterpret_cast<uint16*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Uint16Array(reinterpret_cast<uint16*>(segment.data), 2, &segmentDim[0]);
     }
     else if (nodeType == DTYPE_L) {
-        array = new MDSplus::Int32Array(reinterpret_cast<int32*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Int32Array(reinterpret_cast<int32*>(segment.data), 2, &segmentDim[0]);
     }
     else if (nodeType == DTYPE_LU) {
-        array = new MDSplus::Uint32Array(reinterpret_cast<uint32*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Uint32Array(reinterpret_cast<uint32*>(segment.data), 2, &segmentDim[0]);
     }
     else if (nodeType == DTYPE_Q) {
-        array = new MDSplus::Int64Array(reinterpret_cast<int64_t*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Int64Array(reinterpret_cast<int64_t*>(segment.data), 2, &segmentDim[0]);
     }
     else if (nodeType == DTYPE_QU) {
-        array = new MDSplus::Uint64Array(reinterpret_cast<uint64_t*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Uint64Array(reinterpret_cast<uint64_t*>(segment.data), 2, &segmentDim[0]);
     }
     else if (nodeType == DTYPE_FLOAT) {
-        array = new MDSplus::Float32Array(reinterpret_cast<float32*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Float32Array(reinterpret_cast<float32*>(segment.data), 2, &segmentDim[0]);
     }
     else if (nodeType == DTYPE_DOUBLE) {
-        array = new MDSplus::Float64Array(reinterpret_cast<float64*>(bufferedData), 2, &segmentDim[0]);
+        array = new MDSplus::Float64Array(reinterpret_cast<float64*>(segment.data), 2, &segmentDim[0]);
     }
     else {
         //An invalid nodeType is trapped before.
@@ -586,50 +744,48 @@ bool MDSWriterNode::ForceSegment() {
 }
 
 /*lint -e{613} -e{429} function only called if bufferedData != NULL. Custodial pointer value freed by mds+*/
-bool MDSWriterNode::AddDataToSegment() {
+bool MDSWriterNode::AddDataToSegment(const MDSWriterNodeSegment &segment) {
     bool ok = true;
 
-    //Notice that currentBuffer is not incremented if a discontinuity is found
-    uint32 numberOfSamplesPerSegment = numberOfSamples * currentBuffer;
     //MDSpluse::putRow() only save one sample at the time
     segmentDim[0] = 1;
-    for (uint32 i = 0u; i < numberOfSamplesPerSegment; i++) {
-        int64_t auxCurrentTime = static_cast<int64>(start);
-        if (!useTimeVector) {
-            start += period;
-        }
+    //segment.period is zero when the time vector is used
+    float64 rowTime = segment.start;
+    for (uint32 i = 0u; i < segment.numberOfSamples; i++) {
+        int64_t auxCurrentTime = static_cast<int64>(rowTime);
+        rowTime += segment.period;
         if (numberOfElements > 1u) {
             int32 numberElementsInt32 = static_cast<int32>(numberOfElements);
             MDSplus::Array *value = NULL_PTR(MDSplus::Array*);
             if (nodeType == DTYPE_B) {
-                value = new MDSplus::Int8Array(&(reinterpret_cast<char8*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Int8Array(&(reinterpret_cast<char8*>(segment.data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_BU) {
-                value = new MDSplus::Uint8Array(&(reinterpret_cast<uint8*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Uint8Array(&(reinterpret_cast<uint8*>(segment.data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_W) {
-                value = new MDSplus::Int16Array(&(reinterpret_cast<int16*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Int16Array(&(reinterpret_cast<int16*>(segment.data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_WU) {
-                value = new MDSplus::Uint16Array(&(reinterpret_cast<uint16*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Uint16Array(&(reinterpret_cast<uint16*>(segment.data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_L) {
-                value = new MDSplus::Int32Array(&(reinterpret_cast<int32*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Int32Array(&(reinterpret_cast<int32*>(segment.data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_LU) {
-                value = new MDSplus::Uint32Array(&(reinterpret_cast<uint32*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Uint32Array(&(reinterpret_cast<uint32*>(segment.data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_Q) {
-                value = new MDSplus::Int64Array(&(reinterpret_cast<int64_t*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Int64Array(&(reinterpret_cast<int64_t*>(segment.data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_QU) {
-                value = new MDSplus::Uint64Array(&(reinterpret_cast<uint64_t*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Uint64Array(&(reinterpret_cast<uint64_t*>(segment.data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_FLOAT) {
-                value = new MDSplus::Float32Array(&(reinterpret_cast<float32*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Float32Array(&(reinterpret_cast<float32*>(segment.data)[i]), numberElementsInt32);
             }
             else if (nodeType == DTYPE_DOUBLE) {
-                value = new MDSplus::Float64Array(&(reinterpret_cast<float64*>(bufferedData)[i]), numberElementsInt32);
+                value = new MDSplus::Float64Array(&(reinterpret_cast<float64*>(segment.data)[i]), numberElementsInt32);
             }
             else {
                 //An invalid nodeType is trapped before.
@@ -649,34 +805,34 @@ bool MDSWriterNode::AddDataToSegment() {
         else {
             MDSplus::Scalar *value = NULL_PTR(MDSplus::Scalar*);
             if (nodeType == DTYPE_B) {
-                value = new MDSplus::Int8(reinterpret_cast<char8*>(bufferedData)[i]);
+                value = new MDSplus::Int8(reinterpret_cast<char8*>(segment.data)[i]);
             }
             else if (nodeType == DTYPE_BU) {
-                value = new MDSplus::Uint8(reinterpret_cast<uint8*>(bufferedData)[i]);
+                value = new MDSplus::Uint8(reinterpret_cast<uint8*>(segment.data)[i]);
             }
             else if (nodeType == DTYPE_W) {
-                value = new MDSplus::Int16(reinterpret_cast<int16*>(bufferedData)[i]);
+                value = new MDSplus::Int16(reinterpret_cast<int16*>(segment.data)[i]);
             }
             else if (nodeType == DTYPE_WU) {
-                value = new MDSplus::Uint16(reinterpret_cast<uint16*>(bufferedData)[i]);
+                value = new MDSplus::Uint16(reinterpret_cast<uint16*>(segment.data)[i]);
             }
             else if (nodeType == DTYPE_L) {
-                value = new MDSplus::Int32(reinterpret_cast<int32*>(bufferedData)[i]);
+                value = new MDSplus::Int32(reinterpret_cast<int32*>(segment.data)[i]);
             }
             else if (nodeType == DTYPE_LU) {
-                value = new MDSplus::Uint32(reinterpret_cast<uint32*>(bufferedData)[i]);
+                value = new MDSplus::Uint32(reinterpret_cast<uint32*>(segment.data)[i]);
             }
             else if (nodeType == DTYPE_Q) {
-                value = new MDSplus::Int64(reinterpret_cast<int64_t*>(bufferedData)[i]);
+                value = new MDSplus::Int64(reinterpret_cast<int64_t*>(segment.data)[i]);
             }
             else if (nodeType == DTYPE_QU) {
-                value = new MDSplus::Uint64(reinterpret_cast<uint64_t*>(bufferedData)[i]);
+                value = new MDSplus::Uint64(reinterpret_cast<uint64_t*>(segment.data)[i]);
             }
             else if (nodeType == DTYPE_FLOAT) {
-                value = new MDSplus::Float32(reinterpret_cast<float32*>(bufferedData)[i]);
+                value = new MDSplus::Float32(reinterpret_cast<float32*>(segment.data)[i]);
             }
             else if (nodeType == DTYPE_DOUBLE) {
-                value = new MDSplus::Float64(reinterpret_cast<float64*>(bufferedData)[i]);
+                value = new MDSplus::Float64(reinterpret_cast<float64*>(segment.data)[i]);
             }
             else {
                 //An invalid nodeType is trapped before.
@@ -40,6 +40,36 @@
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * @brief Describes a segment which is ready to be committed to the MDSplus::TreeNode.
+ */
+struct MDSWriterNodeSegment {
+    /**
+     * Buffer holding the segment samples.
+     */
+    void *data;
+
+    /**
+     * Number of time samples in the segment.
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * Time of the first sample.
+     */
+    float64 start;
+
+    /**
+     * Time of the last sample (only used when the segment is created with makeSegment).
+     */
+    float64 end;
+
+    /**
+     * Time between consecutive samples.
+     */
+    float64 period;
+};
+
 /**
  * @brief Provides an interface between a MARTe signal and an MDSplus::TreeNode.
  * @details This class allocates a shared memory area capable of storing several time samples of a MARTe signal.
@@ -50,6 +80,12 @@ namespace MARTe {
  * A segment will be created when GetNumberOfExecuteCalls() == GetMakeSegmentAfterNWrites() or, in case
  * IsUseTimeVector() == true, when a discontinuity on the time signal is detected, i.e., when the distance between
  *  two time samples is greater than GetExecutePeriod.
+ *
+ * By default the segment is committed to the tree in the context of Execute. If EnableSegmentPipeline is called, the node
+ * allocates a second buffer: when a segment is complete, Execute hands over the filled buffer, which is committed by
+ * WritePendingSegment (called by a writer thread), and continues filling the other buffer. If the previous segment
+ * is still being committed when the next one is complete, Execute waits for it (see GetNumberOfPipelineStalls). If the writer does not
+ * commit it within the timeout given to EnableSegmentPipeline, Execute drops the new segment and returns false.
  */
 class MDSWriterNode {
 public:
@@ -90,6 +126,7 @@ public:
      *  - SamplePhase (optional): shift the time vector by SamplePhase * Period
      *  - MakeSegmentAfterNWrites (>0): a segment will be written after MakeSegmentAfterNWrites time samples are available (which in practice means after the Execute method has been called MakeSegmentAfterNWrites)
      *  - MinMaxResampleFactor (>0): the decimation factor to be applied by MDS+ when a DecimatedNodeName is specified
+     *  - CompressSegments (optional, default 0): if 1 MDS+ compresses (lossless) the segments when they are written. Most effective with integer data.
      * @param data the StructuredDataI with all the parameters described above.
      * @return true if all the parameters above are correctly specified.
      */
@@ -135,10 +172,59 @@ public:
 
     /**
      * @brief Forces the creation of a segment even if no sufficient time samples have been created.
+     * @details If the segment pipeline is enabled the segment is only handed over to the writer (see WaitForSegmentWritten).
      * @return Execute()
      */
     bool Flush();
 
+    /**
+     * @brief Allocates the second segment buffer so that the segments are committed by WritePendingSegment instead of Execute.
+     * @details Shall only be called if a thread is going to call WritePendingSegment.
+     * @param[in] timeoutMSec maximum time that Execute and WaitForSegmentWritten wait for the writer to commit the pending segment.
+     * @return true if the buffer can be allocated.
+     * @pre
+     *   Initialise()
+     */
+    bool EnableSegmentPipeline(const uint32 timeoutMSec);
+
+    /**
+     * @brief Returns true if EnableSegmentPipeline was successfully called.
+     * @return true if EnableSegmentPipeline was successfully called.
+     */
+    bool IsSegmentPipelineEnabled() const;
+
+    /**
+     * @brief Returns true if a segment was handed over by Execute and was not yet committed to the tree.
+     * @return true if a segment is waiting to be committed to the tree.
+     */
+    bool IsSegmentPending() const;
+
+    /**
+     * @brief Commits the segment handed over by Execute (if any) to the tree.
+     * @details To be called by the writer thread. A failure is reported by the next Execute.
+     * @return true if there was no segment pending or if the segment was successfully committed.
+     */
+    bool WritePendingSegment();
+
+    /**
+     * @brief Waits until the pending segment (if any) is committed to the tree.
+     * @return true if all the segments were successfully committed and the writer did not take more than the timeout
+     * given to EnableSegmentPipeline.
+     */
+    bool WaitForSegmentWritten();
+
+    /**
+     * @brief Returns the number of times Execute had to wait for the writer to commit the previous segment.
+     * @return the number of times Execute had to wait for the writer to commit the previous segment.
+     */
+    uint32 GetNumberOfPipelineStalls() const;
+
+    /**
+     * @brief Returns true if MDS+ is to compress the segments.
+     * @return true if MDS+ is to compress the segments.
+     */
+    bool IsCompressSegments() const;
+
     /**
      * @brief Returns true if MDS+ is to automatically compute a decimated version of the stored signal.
      * @return true if MDS+ is to automatically compute a decimated version of the stored signal.
@@ -382,20 +468,75 @@ private:
      */
     float64 discontinuityFactor;
 
+    /**
+     * True if the segments are to be compressed by MDS+.
+     */
+    bool compressSegments;
+
+    /**
+     * Buffer with the segment being committed by the writer (only used with the segment pipeline).
+     */
+    void *segmentData;
+
+    /**
+     * The segment handed over to the writer.
+     */
+    MDSWriterNodeSegment pendingSegment;
+
+    /**
+     * 1 while pendingSegment is waiting to be (or being) committed by the writer.
+     */
+    volatile int32 segmentPending;
+
+    /**
+     * Set by the writer if a segment could not be committed.
+     */
+    volatile bool segmentWriteError;
+
+    /**
+     * Number of times Execute had to wait for the writer.
+     */
+    uint32 numberOfPipelineStalls;
+
+    /**
+     * Maximum time (in ms) waiting for the writer to commit the pending segment.
+     */
+    uint32 segmentWriteTimeout;
+
+    /**
+     * @brief Waits (at most segmentWriteTimeout ms) for the writer to commit the pending segment.
+     * @return true if no segment is pending.
+     */
+    bool WaitForSegmentPending();
+
+    /**
+     * @brief Computes the time information of the segment with the data currently buffered and advances the start of the next segment.
+     * @param[out] segment the segment description.
+     */
+    void PrepareSegment(MDSWriterNodeSegment &segment);
+
+    /**
+     * @brief Commits the data currently buffered, either directly or by handing it over to the writer (see EnableSegmentPipeline).
+     * @return true if the segment was committed (or handed over) and no previous segment failed to be committed.
+     */
+    bool StoreSegment();
+
     /**
      * @brief Save data in MDSplus using MDSplus::makeSegment() or MDSPlus::makeSegmentMaxMin()
      * @details the number of different time values per segment depends on Samples and the makeSegmentAfterNWrites
+     * @param[in] segment the segment to be stored.
      * @return true if the data can be copied to the MDSplus database
      */
-    bool ForceSegment();
+    bool ForceSegment(const MDSWriterNodeSegment &segment);
 
     /**
      * @brief Save data in MDSplus tree using MDSplus::putRow()
      * @details the number of different time values per segment is automatically adjusted by MDSplus engine, they are directly
      * related with Samples.
+     * @param[in] segment the segment to be stored.
      * @return true if the data can be copied to the MDSplus database.
      */
-    bool AddDataToSegment();
+    bool AddDataToSegment(const MDSWriterNodeSegment &segment);
 };
 }
 
@@ -62,6 +62,10 @@ RealTimeThreadAsyncBridge::RealTimeThreadAsyncBridge() :
         REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
     }
     blockingMode = 0u;
+    waitFree = 0u;
+    newestBuffer = NULL_PTR(volatile int32 *);
+    readerRetries = 0;
+    staleReads = 0;
 }
 
 RealTimeThreadAsyncBridge::~RealTimeThreadAsyncBridge() {
@@ -81,6 +85,10 @@ RealTimeThreadAsyncBridge::~RealTimeThreadAsyncBridge() {
         delete[] whatIsNewestGlobCounter;
         whatIsNewestGlobCounter = NULL_PTR(uint32 *);
     }
+    if (newestBuffer != NULL_PTR(volatile int32 *)) {
+        delete[] newestBuffer;
+        newestBuffer = NULL_PTR(volatile int32 *);
+    }
 }
 
 bool RealTimeThreadAsyncBridge::Initialise(StructuredDataI &data) {
@@ -106,6 +114,21 @@ bool RealTimeThreadAsyncBridge::Initialise(StructuredDataI &data) {
         if (!data.Read("ResetMSecTimeout", resetTimeoutT)) {
             resetTimeout = TTInfiniteWait;
         }
+        if (!data.Read("WaitFree", waitFree)) {
+            waitFree = 0u;
+        }
+        if (waitFree > 0u) {
+            ret = (blockingMode == 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "WaitFree cannot be used with BlockingMode");
+            }
+            if (ret) {
+                ret = (numberOfBuffers >= 3u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "WaitFree requires NumberOfBuffers >= 3");
+                }
+            }
+        }
     }
 
     return ret;
@@ -163,6 +186,26 @@ bool RealTimeThreadAsyncBridge::SetConfiguredDatabase(StructuredDataI & data) {
         }
     }
 
+    //each reader can hold one buffer, the newest buffer is never written and one more buffer is needed by the writer
+    if ((ret) && (waitFree > 0u)) {
+        uint32 numberOfReaders = 0u;
+        uint32 numberOfFunctions = GetNumberOfFunctions();
+        for (uint32 i = 0u; (i < numberOfFunctions) && (ret); i++) {
+            uint32 numberOfFunctionSignals = 0u;
+            ret = GetFunctionNumberOfSignals(InputSignals, i, numberOfFunctionSignals);
+            if ((ret) && (numberOfFunctionSignals > 0u)) {
+                numberOfReaders++;
+            }
+        }
+        if (ret) {
+            ret = (numberOfBuffers >= (numberOfReaders + 2u));
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "WaitFree requires NumberOfBuffers (%u) >= number of readers (%u) + 2", numberOfBuffers,
+                             numberOfReaders);
+            }
+        }
+    }
+
     if (ret) {
         if (spinlocksRead == NULL_PTR(volatile int32 *)) {
             uint32 index = (numberOfSignals * numberOfBuffers);
@@ -191,6 +234,12 @@ bool RealTimeThreadAsyncBridge::SetConfiguredDatabase(StructuredDataI & data) {
                 ret = (whatIsNewestGlobCounter != NULL_PTR(uint32 *));
             }
         }
+        if (ret) {
+            if (newestBuffer == NULL_PTR(volatile int32 *)) {
+                newestBuffer = new volatile int32[numberOfSignals];
+                ret = (newestBuffer != NULL_PTR(volatile int32 *));
+            }
+        }
         if (ret) {
             uint32 numberOfElements = (numberOfSignals * numberOfBuffers);
             for (uint32 i = 0u; i < numberOfElements; i++) {
@@ -199,6 +248,7 @@ bool RealTimeThreadAsyncBridge::SetConfiguredDatabase(StructuredDataI & data) {
                 whatIsNewestCounter[i] = 0u;
                 if (i < numberOfSignals) {
                     whatIsNewestGlobCounter[i] = 0u;
+                    newestBuffer[i] = 0;
                 }
             }
         }
@@ -224,6 +274,23 @@ bool RealTimeThreadAsyncBridge::GetInputOffset(const uint32 signalIdx,
             ok = true;
         }
     }
+    else if (waitFree > 0u) {
+        //the writer can claim the newest buffer only after a newer one has been published, so give a chance to all buffers
+        for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
+            uint32 bufferIdx = static_cast<uint32>(newestBuffer[signalIdx]);
+            uint32 index = (signalIdx * numberOfBuffers) + bufferIdx;
+            //the increment is a full barrier: either the writer sees this reader or this reader sees the writer
+            Atomic::Increment(&spinlocksRead[index]);
+            if (!spinlocksWrite[index].Locked()) {
+                offset = (signalSize[signalIdx] * bufferIdx);
+                ok = true;
+            }
+            else {
+                Atomic::Decrement(&spinlocksRead[index]);
+                Atomic::Increment(&readerRetries);
+            }
+        }
+    }
     else {
         //possibly give a chance to all buffers
         for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
@@ -273,6 +340,30 @@ bool RealTimeThreadAsyncBridge::GetOutputOffset(const uint32 signalIdx,
             offset = 0u;
         }
     }
+    else if (waitFree > 0u) {
+        uint32 newestIdx = static_cast<uint32>(newestBuffer[signalIdx]);
+        for (uint32 k = 1u; (k < numberOfBuffers) && (!ok); k++) {
+            //never claim the newest buffer so that the readers always find it
+            uint32 bufferIdx = ((newestIdx + k) % numberOfBuffers);
+            uint32 index = (signalIdx * numberOfBuffers) + bufferIdx;
+            if (spinlocksRead[index] == 0) {
+                if (spinlocksWrite[index].FastTryLock()) {
+                    //the lock is a full barrier: check again that no reader registered in the meantime
+                    if (spinlocksRead[index] == 0) {
+                        offset = (signalSize[signalIdx] * bufferIdx);
+                        //needed in case of ranges. The newest buffer is never written, so it can be safely copied
+                        uint32 destOffset = signalOffsets[signalIdx] + offset;
+                        uint32 srcOffset = signalOffsets[signalIdx] + (signalSize[signalIdx] * newestIdx);
+                        (void) MemoryOperationsHelper::Copy(&memory[destOffset], &memory[srcOffset], signalSize[signalIdx]);
+                        ok = true;
+                    }
+                    else {
+                        spinlocksWrite[index].FastUnLock();
+                    }
+                }
+            }
+        }
+    }
     else {
 
         for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
@@ -331,6 +422,11 @@ bool RealTimeThreadAsyncBridge::TerminateInputCopy(const uint32 signalIdx,
 
     uint32 buffNumber = (offset / signalSize[signalIdx]);
     uint32 index = (signalIdx * numberOfBuffers) + buffNumber;
+    if (waitFree > 0u) {
+        if (static_cast<uint32>(newestBuffer[signalIdx]) != buffNumber) {
+            Atomic::Increment(&staleReads);
+        }
+    }
     Atomic::Decrement(&spinlocksRead[index]);
     return true;
 }
@@ -343,39 +439,46 @@ bool RealTimeThreadAsyncBridge::TerminateOutputCopy(const uint32 signalIdx,
     uint32 buffNumber = (offset / signalSize[signalIdx]);
 
     uint32 index = (signalIdx * numberOfBuffers) + buffNumber;
-    whatIsNewestGlobCounter[signalIdx]++;
-    whatIsNewestCounter[index] = whatIsNewestGlobCounter[signalIdx];
+    if (waitFree > 0u) {
+        spinlocksWrite[index].FastUnLock();
+        //publish only after having released the buffer, so that readers never have to retry on the newest buffer
+        (void) Atomic::Exchange(&newestBuffer[signalIdx], static_cast<int32>(buffNumber));
+    }
+    else {
+        whatIsNewestGlobCounter[signalIdx]++;
+        whatIsNewestCounter[index] = whatIsNewestGlobCounter[signalIdx];
 
-    //overflow... subtract the smaller one
-    if (whatIsNewestGlobCounter[signalIdx] == 0u) {
+        //overflow... subtract the smaller one
+        if (whatIsNewestGlobCounter[signalIdx] == 0u) {
 
-        uint32 min = 0xFFFFFFFFu;
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-            if (h != buffNumber) {
-                uint32 index1 = (signalIdx * numberOfBuffers) + h;
-                if (whatIsNewestCounter[index1] < min) {
-                    min = whatIsNewestCounter[index1];
+            uint32 min = 0xFFFFFFFFu;
+            for (uint32 h = 0u; (h < numberOfBuffers); h++) {
+                if (h != buffNumber) {
+                    uint32 index1 = (signalIdx * numberOfBuffers) + h;
+                    if (whatIsNewestCounter[index1] < min) {
+                        min = whatIsNewestCounter[index1];
+                    }
                 }
-            }
 
-        }
+            }
 
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-            uint32 index1 = (signalIdx * numberOfBuffers) + h;
-            if (h != buffNumber) {
-                bool blocked = spinlocksWrite[index1].FastLock(resetTimeout);
-                if (blocked) {
-                    whatIsNewestCounter[index1] -= min;
-                    spinlocksWrite[index1].FastUnLock();
+            for (uint32 h = 0u; (h < numberOfBuffers); h++) {
+                uint32 index1 = (signalIdx * numberOfBuffers) + h;
+                if (h != buffNumber) {
+                    bool blocked = spinlocksWrite[index1].FastLock(resetTimeout);
+                    if (blocked) {
+                        whatIsNewestCounter[index1] -= min;
+                        spinlocksWrite[index1].FastUnLock();
+                    }
                 }
             }
-        }
 
-        whatIsNewestGlobCounter[signalIdx] -= min;
-        whatIsNewestCounter[index] -= min;
+            whatIsNewestGlobCounter[signalIdx] -= min;
+            whatIsNewestCounter[index] -= min;
 
+        }
+        spinlocksWrite[index].FastUnLock();
     }
-    spinlocksWrite[index].FastUnLock();
 
     return true;
 }
@@ -438,11 +541,22 @@ ErrorManagement::ErrorType RealTimeThreadAsyncBridge::ResetSignalValue() {
             whatIsNewestCounter[index] = 0u;
         }
         whatIsNewestGlobCounter[i]=0u;
+        if (newestBuffer != NULL_PTR(volatile int32 *)) {
+            newestBuffer[i] = 0;
+        }
     }
     err = !ret;
     return err;
 }
 
+uint32 RealTimeThreadAsyncBridge::GetReaderRetries() const {
+    return static_cast<uint32>(readerRetries);
+}
+
+uint32 RealTimeThreadAsyncBridge::GetStaleReads() const {
+    return static_cast<uint32>(staleReads);
+}
+
 CLASS_REGISTER(RealTimeThreadAsyncBridge, "1.0")
 CLASS_METHOD_REGISTER(RealTimeThreadAsyncBridge, ResetSignalValue)
 }
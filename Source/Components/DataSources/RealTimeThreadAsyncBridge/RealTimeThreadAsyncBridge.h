@@ -55,6 +55,13 @@ namespace MARTe {
  * If BlockingMode==2, the access to all the signals is regulated by a global spinlock mutex. This can be used to ensure consistency between signals for instance
  * in communication between two GAMs belonging to different threads.
  *
+ * @details If WaitFree==1 neither the writer nor the readers ever block. For each signal the index of the newest written buffer is published
+ * atomically at the end of the write operation. The writer takes any buffer which is neither the newest nor being read, while each reader registers
+ * on the newest buffer and retries (on the new newest buffer) if the writer has claimed it in the meantime. Having at least
+ * (number of reader GAMs + 2) buffers (i.e. one per reader, the newest and the one being written) guarantees that the writer always finds a free buffer. The number of reader retries and the number of stale reads
+ * (i.e. reads whose buffer was superseded by a newer one before the copy was terminated) are counted and can be queried with
+ * GetReaderRetries() and GetStaleReads().
+ *
  * The RPC method ResetSignalValue allows to reset all the signal values.
  *
   * <pre>
@@ -69,6 +76,7 @@ namespace MARTe {
  *                                                               be increased to a large number. If instead the reader does not mind to get oldest buffer (instead of the newest) while this reset operation
  *                                                               is being performed, the ResetMSecTimeout should be set to 0.
  *                                                               This overflow will occur every 2**32-1 writes, which at e.g. 1 kHz frequency, will occur every ~49 days).
+ *    WaitFree = 1 //Optional. Default = 0. If 1 the readers and the writer never block (see above). Requires BlockingMode = 0 and NumberOfBuffers >= (number of GAMs reading from this DataSource + 2), i.e. at least 3.
  *    Signals = {
  *        +*NAME = {
  *            +Type = BasicType|StructuredType
@@ -102,13 +110,15 @@ RealTimeThreadAsyncBridge    ();
      *   overflows and needs to be reset. If the read should wait for this counter to be properly reset then the ResetMSecTimeout should
      *   be increased to a large number. If instead the reader does not mind to get oldest buffer (instead of the newest) while this reset operation
      *    is being performed, the ResetMSecTimeout should be set to 0.
-     *   This overflow will occur every 2**32-1 writes, which at e.g. 1 kHz frequency, will occur every ~49 days).
+     *   This overflow will occur every 2**32-1 writes, which at e.g. 1 kHz frequency, will occur every ~49 days).\n
+     *   WaitFree = 0|1 (if 1, BlockingMode must be 0 and NumberOfBuffers must be at least 3).
      */
     virtual bool Initialise(StructuredDataI &data);
 
     /**
      * @brief Allocates the memory for the state variables.
      * @details Checks that the signals have not defined the "Samples" field, because this data source does not support samples.
+     * If WaitFree = 1 checks that NumberOfBuffers >= (number of GAMs reading from this DataSource + 2).
      * @return true if for each signal "Samples" is not defined and if the memory is allocated with no errors for the state variables.
      * It returns false otherwse.
      */
@@ -134,6 +144,8 @@ RealTimeThreadAsyncBridge    ();
      * @see DataSourceI::GetInputOffset
      * @details Checks the last written available buffer and returns its offset. The atomic variable \a spinlocksRead, denoting the number
      * of readers on that buffer is incremented. The writer can not write on that buffer if this atomic variable is greater than zero.
+     * @details If WaitFree==1 the atomic variable \a spinlocksRead of the newest published buffer is incremented and, if the writer
+     * has claimed that buffer in the meantime, the registration is withdrawn and the operation is retried on the new newest buffer.
      * @return false if no buffer is available. This happens only if only one buffer is defined and the writer is writing on it.
      */
     virtual bool GetInputOffset(const uint32 signalIdx,
@@ -143,6 +155,7 @@ RealTimeThreadAsyncBridge    ();
      * @see DataSourceI::GetOutputOffset
      * @details Checks the oldest written available buffer and returns its offset. the semaphore \a spinlocksWrite, is locked
      * on that buffer. The readers can not read on that buffer while the semaphore is locked.
+     * @details If WaitFree==1 the writer claims (without blocking) any buffer that is neither the newest published nor being read.
      * @return false if no buffer is available because the readers are using all of them.
      */
     virtual bool GetOutputOffset(const uint32 signalIdx,
@@ -151,6 +164,7 @@ RealTimeThreadAsyncBridge    ();
     /**
      * @see DataSourceI::TerminateInputCopy
      * @details Decrements the atomic variable \a spinlocksRead for the buffer that has just been read.
+     * If WaitFree==1 and a newer buffer has been published while copying, the stale reads counter is incremented.
      */
     virtual bool TerminateInputCopy(const uint32 signalIdx, const uint32 offset,
             const uint32 numberOfSamples);
@@ -160,6 +174,7 @@ RealTimeThreadAsyncBridge    ();
      * @details If all the write operations for the signal \a signalIdx have been terminated, it increments the
      * \a whatIsNewestCounter setting the buffer as the last written. The spinlocksWrite variable is unlocked for the
      * buffer that have just been written.
+     * If WaitFree==1 the buffer is unlocked and atomically published as the newest one.
      */
     virtual bool TerminateOutputCopy(const uint32 signalIdx,
             const uint32 offset, const uint32 numberOfSamples);
@@ -187,6 +202,18 @@ RealTimeThreadAsyncBridge    ();
      */
     ErrorManagement::ErrorType ResetSignalValue();
 
+    /**
+     * @brief Gets the number of times that a reader had to retry because the writer claimed the buffer.
+     * @return the number of reader retries (only updated if WaitFree==1).
+     */
+    uint32 GetReaderRetries() const;
+
+    /**
+     * @brief Gets the number of reads whose buffer was superseded by a newer one before the copy was terminated.
+     * @return the number of stale reads (only updated if WaitFree==1).
+     */
+    uint32 GetStaleReads() const;
+
 protected:
 
     /**
@@ -228,6 +255,26 @@ protected:
      * Global mutex for all signals if \a blockingMode==2
      */
     FastPollingMutexSem globMux;
+
+    /**
+     * If 1 neither the readers nor the writer block.
+     */
+    uint8 waitFree;
+
+    /**
+     * The index of the newest published buffer for each signal (only used if \a waitFree==1).
+     */
+    volatile int32 *newestBuffer;
+
+    /**
+     * Number of times that a reader had to retry.
+     */
+    volatile int32 readerRetries;
+
+    /**
+     * Number of reads that were superseded by a newer write before terminating.
+     */
+    volatile int32 staleReads;
 };
 
 }
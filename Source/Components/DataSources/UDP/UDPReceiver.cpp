@@ -24,17 +24,32 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
 #include "MemoryMapInputBroker.h"
 #include "UDPReceiver.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+#ifndef SO_BUSY_POLL
+#define SO_BUSY_POLL 46
+#endif
+
+namespace {
+/**
+ * Maximum number of datagrams received with a single system call.
+ */
+const MARTe::uint32 UDP_RECEIVER_MAX_BATCH_SIZE = 1024u;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -57,6 +72,24 @@ UDPReceiver::UDPReceiver() :
     muxIThread.Create();
     copyInProgress = false;
     memoryIndependentThread = NULL_PTR(void *);
+    batchSize = 1u;
+    cyclesPerPacket = 1u;
+    busyPoll = 0u;
+    batchMemory = NULL_PTR(uint8 *);
+    messageHeaders = NULL_PTR(void *);
+    messageVectors = NULL_PTR(void *);
+    queueMemory = NULL_PTR(uint8 *);
+    queueTimes = NULL_PTR(uint64 *);
+    queueSize = 0u;
+    queueReadIdx = 0;
+    queueWriteIdx = 0;
+    numberOfBatches = 0u;
+    numberOfPackets = 0u;
+    lastBatchSize = 0u;
+    maxBatchSize = 0u;
+    numberOfDrops = 0u;
+    lastLatency = 0u;
+    maxLatency = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the thread and servers are closed.*/
@@ -77,10 +110,32 @@ UDPReceiver::~UDPReceiver() {
     if (memoryIndependentThread != NULL_PTR(void *)) {
         GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(memoryIndependentThread);
     }
+    if (batchMemory != NULL_PTR(uint8 *)) {
+        void *mem = reinterpret_cast<void *>(batchMemory);
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(mem);
+    }
+    if (queueMemory != NULL_PTR(uint8 *)) {
+        void *mem = reinterpret_cast<void *>(queueMemory);
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(mem);
+    }
+    if (queueTimes != NULL_PTR(uint64 *)) {
+        delete[] queueTimes;
+    }
+    if (messageHeaders != NULL_PTR(void *)) {
+        delete[] reinterpret_cast<struct mmsghdr *>(messageHeaders);
+    }
+    if (messageVectors != NULL_PTR(void *)) {
+        delete[] reinterpret_cast<struct iovec *>(messageVectors);
+    }
 }
 
 bool UDPReceiver::AllocateMemory() {
     bool ok = MemoryDataSourceI::AllocateMemory();
+    if (ok) {
+        if (IsBatched()) {
+            ok = AllocateBatchMemory();
+        }
+    }
     if (executionMode == UDPReceiverExecutionModeIndependent) {
         memoryIndependentThread = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(totalMemorySize);
         if (ok) {
@@ -91,6 +146,38 @@ bool UDPReceiver::AllocateMemory() {
     return ok;
 }
 
+bool UDPReceiver::AllocateBatchMemory() {
+    bool ok = (totalMemorySize > 0u);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "No memory allocated for the signals");
+    }
+    uint32 datagramSize = cyclesPerPacket * totalMemorySize;
+    if (ok) {
+        batchMemory = reinterpret_cast<uint8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(batchSize * datagramSize));
+        queueSize = batchSize * cyclesPerPacket;
+        queueMemory = reinterpret_cast<uint8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(queueSize * totalMemorySize));
+        ok = ((batchMemory != NULL_PTR(uint8 *)) && (queueMemory != NULL_PTR(uint8 *)));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the batch memory");
+        }
+    }
+    if (ok) {
+        queueTimes = new uint64[queueSize];
+        struct mmsghdr *headers = new struct mmsghdr[batchSize];
+        struct iovec *vectors = new struct iovec[batchSize];
+        ok = MemoryOperationsHelper::Set(headers, '\0', static_cast<uint32>(sizeof(struct mmsghdr)) * batchSize);
+        for (uint32 i = 0u; i < batchSize; i++) {
+            vectors[i].iov_base = &batchMemory[i * datagramSize];
+            vectors[i].iov_len = datagramSize;
+            headers[i].msg_hdr.msg_iov = &vectors[i];
+            headers[i].msg_hdr.msg_iovlen = 1u;
+        }
+        messageHeaders = headers;
+        messageVectors = vectors;
+    }
+    return ok;
+}
+
 bool UDPReceiver::BrokerCopyTerminated() {
     if (muxIThread.FastLock() == ErrorManagement::NoError) {
         copyInProgress = false;
@@ -167,6 +254,29 @@ bool UDPReceiver::Initialise(StructuredDataI &data) {
             timeout.SetTimeoutSec(timeoutVal);
         }
     }
+    if (ok) {
+        if (!data.Read("BatchSize", batchSize)) {
+            batchSize = 1u;
+        }
+        ok = ((batchSize > 0u) && (batchSize <= UDP_RECEIVER_MAX_BATCH_SIZE));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "BatchSize shall be in [1, %d]", UDP_RECEIVER_MAX_BATCH_SIZE);
+        }
+    }
+    if (ok) {
+        if (!data.Read("CyclesPerPacket", cyclesPerPacket)) {
+            cyclesPerPacket = 1u;
+        }
+        ok = (cyclesPerPacket > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "CyclesPerPacket shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("BusyPoll", busyPoll)) {
+            busyPoll = 0u;
+        }
+    }
     if (executionMode == UDPReceiverExecutionModeIndependent) {
         if (ok) {
             ok = data.Read("CPUMask", cpuMask);
@@ -227,6 +337,39 @@ bool UDPReceiver::SetConfiguredDatabase(StructuredDataI &data) {
             ok = socket->Listen(port);
         }
     }
+    if (ok) {
+        /*lint -e{613} socket cannot be NULL as ok == true*/
+        int32 socketHandle = static_cast<int32>(socket->GetReadHandle());
+        if (busyPoll > 0u) {
+            int32 busyPollValue = static_cast<int32>(busyPoll);
+            if (setsockopt(socketHandle, SOL_SOCKET, SO_BUSY_POLL, &busyPollValue, static_cast<socklen_t>(sizeof(busyPollValue))) != 0) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not set SO_BUSY_POLL (CAP_NET_ADMIN may be required). Busy polling disabled.");
+            }
+        }
+        if (IsBatched()) {
+            /* The batches are received with a blocking recvmmsg, so that the kernel can busy poll, which waits at most timeout for the first datagram */
+            int32 flags = fcntl(socketHandle, F_GETFL, 0);
+            ok = (flags >= 0);
+            if (ok) {
+                /*lint -e{9130} -e{9027} the fcntl flags are defined as int*/
+                ok = (fcntl(socketHandle, F_SETFL, flags & ~O_NONBLOCK) == 0);
+            }
+            if (ok) {
+                struct timeval receiveTimeout;
+                receiveTimeout.tv_sec = 0;
+                receiveTimeout.tv_usec = 0;
+                if (timeout != TTInfiniteWait) {
+                    uint32 timeoutMSec = timeout.GetTimeoutMSec();
+                    receiveTimeout.tv_sec = static_cast<time_t>(timeoutMSec / 1000u);
+                    receiveTimeout.tv_usec = static_cast<suseconds_t>((timeoutMSec % 1000u) * 1000u);
+                }
+                ok = (setsockopt(socketHandle, SOL_SOCKET, SO_RCVTIMEO, &receiveTimeout, static_cast<socklen_t>(sizeof(receiveTimeout))) == 0);
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not configure the socket for batch reception");
+            }
+        }
+    }
     if (executionMode == UDPReceiverExecutionModeIndependent) {
         executor.SetPriorityClass(Threads::RealTimePriorityClass);
         executor.SetCPUMask(cpuMask);
@@ -238,7 +381,10 @@ bool UDPReceiver::SetConfiguredDatabase(StructuredDataI &data) {
 
 bool UDPReceiver::Synchronise() {
     bool ok = true;
-    if (executionMode == UDPReceiverExecutionModeIndependent) {
+    if (IsBatched()) {
+        ok = SynchroniseBatch();
+    }
+    else if (executionMode == UDPReceiverExecutionModeIndependent) {
         if (muxIThread.FastLock() == ErrorManagement::NoError) {
             copyInProgress = true;
         }
@@ -250,6 +396,100 @@ bool UDPReceiver::Synchronise() {
             //Do not overwrite the read memory size
             uint32 sizeToRead = totalMemorySize;
             ok = socket->Read(dataBuffer, sizeToRead, timeout);
+            if (ok) {
+                numberOfBatches++;
+                numberOfPackets++;
+                lastBatchSize = 1u;
+                maxBatchSize = 1u;
+            }
+        }
+    }
+    return ok;
+}
+
+/*lint -estring(526,__sync_bool_compare_and_swap) -estring(628,__sync_bool_compare_and_swap) -estring(746,__sync_bool_compare_and_swap) -estring(1055,__sync_bool_compare_and_swap) The __sync_bool_compare_and_swap function is a GCC built-in function, so it does not have declaration.*/
+bool UDPReceiver::SynchroniseBatch() {
+    bool ok = true;
+    if (executionMode == UDPReceiverExecutionModeRealTime) {
+        if (queueReadIdx == queueWriteIdx) {
+            ok = ReceiveBatch();
+        }
+    }
+    bool done = false;
+    //Each failed attempt means that the receiver thread has just dropped the cycle, so that the retries are bounded by the queue size
+    for (uint32 attempt = 0u; (attempt <= queueSize) && (ok) && (!done); attempt++) {
+        const int32 readIdx = queueReadIdx;
+        done = (readIdx == queueWriteIdx);
+        if (!done) {
+            const uint32 slot = (static_cast<uint32>(readIdx) % queueSize);
+            ok = MemoryOperationsHelper::Copy(memory, &queueMemory[slot * totalMemorySize], totalMemorySize);
+            const uint64 receiveTime = queueTimes[slot];
+            //Only consume the cycle if the receiver thread did not drop it (and possibly overwrite it) during the copy
+            done = __sync_bool_compare_and_swap(&queueReadIdx, readIdx, static_cast<int32>(static_cast<uint32>(readIdx) + 1u));
+            if (done) {
+                uint64 elapsed = HighResolutionTimer::Counter() - receiveTime;
+                lastLatency = static_cast<uint32>(static_cast<float64>(elapsed) * HighResolutionTimer::Period() * 1e6);
+                if (lastLatency > maxLatency) {
+                    maxLatency = lastLatency;
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+bool UDPReceiver::ReceiveBatch() {
+    struct mmsghdr *headers = reinterpret_cast<struct mmsghdr *>(messageHeaders);
+    bool ok = (socket != NULL_PTR(BasicUDPSocket*)) && (headers != NULL_PTR(struct mmsghdr *));
+    int32 nReceived = 0;
+    if (ok) {
+        /*lint -e{613} socket cannot be NULL as ok == true*/
+        int32 socketHandle = static_cast<int32>(socket->GetReadHandle());
+        /* Blocks (at most timeout) for the first datagram and then takes all the datagrams already queued in the socket */
+        nReceived = recvmmsg(socketHandle, headers, batchSize, MSG_WAITFORONE, NULL_PTR(struct timespec *));
+        ok = (nReceived > 0);
+    }
+    if (ok) {
+        uint64 receiveTime = HighResolutionTimer::Counter();
+        uint32 nDatagrams = static_cast<uint32>(nReceived);
+        numberOfBatches++;
+        numberOfPackets += nDatagrams;
+        lastBatchSize = nDatagrams;
+        if (lastBatchSize > maxBatchSize) {
+            maxBatchSize = lastBatchSize;
+        }
+        uint32 datagramSize = cyclesPerPacket * totalMemorySize;
+        //Only this thread writes the queueWriteIdx
+        uint32 writeIdx = static_cast<uint32>(queueWriteIdx);
+        for (uint32 i = 0u; i < nDatagrams; i++) {
+            uint32 receivedSize = static_cast<uint32>(headers[i].msg_len);
+            bool valid = ((headers[i].msg_hdr.msg_flags & MSG_TRUNC) == 0);
+            if (valid) {
+                valid = ((receivedSize > 0u) && ((receivedSize % totalMemorySize) == 0u));
+            }
+            if (valid) {
+                uint32 nCycles = receivedSize / totalMemorySize;
+                for (uint32 c = 0u; c < nCycles; c++) {
+                    const int32 readIdx = queueReadIdx;
+                    if ((writeIdx - static_cast<uint32>(readIdx)) == queueSize) {
+                        /* Drop the oldest cycle. If the consumer takes it first the queue is no longer full. */
+                        if (__sync_bool_compare_and_swap(&queueReadIdx, readIdx, static_cast<int32>(static_cast<uint32>(readIdx) + 1u))) {
+                            numberOfDrops++;
+                        }
+                    }
+                    const uint32 slot = (writeIdx % queueSize);
+                    (void) MemoryOperationsHelper::Copy(&queueMemory[slot * totalMemorySize], &batchMemory[(i * datagramSize) + (c * totalMemorySize)],
+                                                        totalMemorySize);
+                    queueTimes[slot] = receiveTime;
+                    writeIdx++;
+                    //Publish the cycle
+                    (void) Atomic::Exchange(&queueWriteIdx, static_cast<int32>(writeIdx));
+                }
+            }
+            else {
+                numberOfDrops++;
+            }
+            headers[i].msg_hdr.msg_flags = 0;
         }
     }
     return ok;
@@ -272,19 +512,33 @@ bool UDPReceiver::PrepareNextState(const char8 *const currentStateName,
 ErrorManagement::ErrorType UDPReceiver::Execute(ExecutionInfo &info) {
     ErrorManagement::ErrorType err = ErrorManagement::NoError;
     if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
-        char8 *const dataBuffer = reinterpret_cast<char8*>(memoryIndependentThread);
-        if (socket != NULL_PTR(BasicUDPSocket*)) {
-            //Do not overwrite the read memory size
-            uint32 sizeToRead = totalMemorySize;
-            err.timeout = !socket->Read(dataBuffer, sizeToRead, timeout);
+        if (IsBatched()) {
+            err.timeout = !ReceiveBatch();
         }
-        bool canCopyMemory = false;
-        if (muxIThread.FastLock() == ErrorManagement::NoError) {
-            canCopyMemory = !copyInProgress;
-        }
-        muxIThread.FastUnLock();
-        if (canCopyMemory) {
-            err.fatalError = !MemoryOperationsHelper::Copy(memory, dataBuffer, totalMemorySize);
+        else {
+            char8 *const dataBuffer = reinterpret_cast<char8*>(memoryIndependentThread);
+            if (socket != NULL_PTR(BasicUDPSocket*)) {
+                //Do not overwrite the read memory size
+                uint32 sizeToRead = totalMemorySize;
+                err.timeout = !socket->Read(dataBuffer, sizeToRead, timeout);
+                if (!err.timeout) {
+                    numberOfBatches++;
+                    numberOfPackets++;
+                    lastBatchSize = 1u;
+                    maxBatchSize = 1u;
+                }
+            }
+            bool canCopyMemory = false;
+            if (muxIThread.FastLock() == ErrorManagement::NoError) {
+                canCopyMemory = !copyInProgress;
+            }
+            muxIThread.FastUnLock();
+            if (canCopyMemory) {
+                err.fatalError = !MemoryOperationsHelper::Copy(memory, dataBuffer, totalMemorySize);
+            }
+            else if (!err.timeout) {
+                numberOfDrops++;
+            }
         }
     }
     return err;
@@ -310,6 +564,50 @@ const UDPReceiverExecutionMode UDPReceiver::GetExecutionMode() const {
     return executionMode;
 }
 
+uint32 UDPReceiver::GetBatchSize() const {
+    return batchSize;
+}
+
+uint32 UDPReceiver::GetCyclesPerPacket() const {
+    return cyclesPerPacket;
+}
+
+uint32 UDPReceiver::GetBusyPoll() const {
+    return busyPoll;
+}
+
+uint32 UDPReceiver::GetNumberOfBatches() const {
+    return numberOfBatches;
+}
+
+uint32 UDPReceiver::GetNumberOfPackets() const {
+    return numberOfPackets;
+}
+
+uint32 UDPReceiver::GetLastBatchSize() const {
+    return lastBatchSize;
+}
+
+uint32 UDPReceiver::GetMaxBatchSize() const {
+    return maxBatchSize;
+}
+
+uint32 UDPReceiver::GetNumberOfDrops() const {
+    return numberOfDrops;
+}
+
+uint32 UDPReceiver::GetLastLatency() const {
+    return lastLatency;
+}
+
+uint32 UDPReceiver::GetMaxLatency() const {
+    return maxLatency;
+}
+
+bool UDPReceiver::IsBatched() const {
+    return ((batchSize > 1u) || (cyclesPerPacket > 1u));
+}
+
 CLASS_REGISTER(UDPReceiver, "1.0")
 
 }
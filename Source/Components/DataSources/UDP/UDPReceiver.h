@@ -65,6 +65,9 @@ typedef enum {
  *       If ExecutionMode == RealTimeThread the DataSource socket read is blocking and handled in the context of the real-time thread.
  *     CPUMask = 0x1
  *     StackSize = 10000000
+ *     BatchSize = 8 //Optional. Maximum number of datagrams received with a single system call (recvmmsg). Default: 1
+ *     CyclesPerPacket = 4 //Optional. Maximum number of cycles (i.e. of copies of the Signals structure) coalesced by the sender in a datagram. Default: 1
+ *     BusyPoll = 50 //Optional (microseconds). If > 0 the socket busy polls the device queue (SO_BUSY_POLL) while waiting for data. Default: 0
  *     Signals = {
  *          Signal2 = {
  *             Type = uint32 //Any MARTe2 type
@@ -74,6 +77,17 @@ typedef enum {
  * }
  *
  * The Signals section is in practice a description of the structure of the UDP Packet read.
+ *
+ * If BatchSize > 1 or CyclesPerPacket > 1 the datagrams are received in batches and each datagram may carry
+ * from 1 to CyclesPerPacket consecutive copies of the Signals structure (see UDPSender). The received cycles are queued
+ * (up to BatchSize * CyclesPerPacket, the oldest being dropped when the queue is full) and each Synchronise delivers the oldest one:
+ *  - in RealTimeThread mode the socket is only read when the queue is empty, so that a single system call serves several cycles;
+ *  - in IndependentThread mode the embedded thread fills the queue and Synchronise does not block if the queue is empty. The queue is
+ *    lock-free, so that Synchronise never waits for the embedded thread to copy the received cycles.
+ * Datagrams whose size is not a multiple of the Signals structure size, or which carry more than CyclesPerPacket cycles, are dropped.
+ *
+ * The number of datagrams per batch, the number of drops and the latency (time spent by a cycle in the queue) are available
+ * through the Get* diagnostic methods.
  */
 class UDPReceiver : public MemoryDataSourceI, public EmbeddedServiceMethodBinderI {
 public:
@@ -177,8 +191,94 @@ public:
      */
     const UDPReceiverExecutionMode GetExecutionMode() const;
 
+    /**
+     * @brief Gets the maximum number of datagrams received with one system call.
+     * @return the maximum number of datagrams received with one system call.
+     */
+    uint32 GetBatchSize() const;
+
+    /**
+     * @brief Gets the maximum number of cycles coalesced in one datagram.
+     * @return the maximum number of cycles coalesced in one datagram.
+     */
+    uint32 GetCyclesPerPacket() const;
+
+    /**
+     * @brief Gets the busy poll time.
+     * @return the busy poll time in microseconds (0 if disabled).
+     */
+    uint32 GetBusyPoll() const;
+
+    /**
+     * @brief Gets the number of receive system calls which returned data.
+     * @return the number of batches received.
+     */
+    uint32 GetNumberOfBatches() const;
+
+    /**
+     * @brief Gets the number of datagrams received.
+     * @return the number of datagrams received.
+     */
+    uint32 GetNumberOfPackets() const;
+
+    /**
+     * @brief Gets the number of datagrams of the last batch.
+     * @return the number of datagrams of the last batch.
+     */
+    uint32 GetLastBatchSize() const;
+
+    /**
+     * @brief Gets the largest number of datagrams received in one batch.
+     * @return the largest number of datagrams received in one batch.
+     */
+    uint32 GetMaxBatchSize() const;
+
+    /**
+     * @brief Gets the number of drops, i.e. datagrams with a wrong size plus cycles overwritten
+     * (or not copied, in IndependentThread mode) before being read.
+     * @return the number of drops.
+     */
+    uint32 GetNumberOfDrops() const;
+
+    /**
+     * @brief Gets the time spent in the queue by the last cycle delivered by Synchronise.
+     * @return the latency in microseconds (only computed if BatchSize > 1 or CyclesPerPacket > 1).
+     */
+    uint32 GetLastLatency() const;
+
+    /**
+     * @brief Gets the largest time spent in the queue by a cycle.
+     * @return the largest latency in microseconds (only computed if BatchSize > 1 or CyclesPerPacket > 1).
+     */
+    uint32 GetMaxLatency() const;
+
 private:
 
+    /**
+     * @brief Allocates the batch receive buffers and the cycles queue.
+     * @return true if the memory could be allocated.
+     */
+    bool AllocateBatchMemory();
+
+    /**
+     * @brief Receives up to batchSize datagrams with one system call (waiting at most timeout for the first one)
+     * and queues the received cycles.
+     * @return true if at least one datagram was received.
+     */
+    bool ReceiveBatch();
+
+    /**
+     * @brief Copies the oldest queued cycle to the DataSource memory.
+     * @details In RealTimeThread mode the socket is read if the queue is empty.
+     * @return false if in RealTimeThread mode no datagram could be received.
+     */
+    bool SynchroniseBatch();
+
+    /**
+     * @brief Returns true if BatchSize > 1 or CyclesPerPacket > 1.
+     */
+    bool IsBatched() const;
+
     /**
      * The EmbeddedThread where the Execute method waits for the period to elapse.
      */
@@ -238,6 +338,59 @@ private:
      * Memory for the independent thread reading.
      */
     void *memoryIndependentThread;
+
+    /**
+     * Maximum number of datagrams received with a single system call.
+     */
+    uint32 batchSize;
+
+    /**
+     * Maximum number of cycles in a datagram.
+     */
+    uint32 cyclesPerPacket;
+
+    /**
+     * SO_BUSY_POLL time in microseconds.
+     */
+    uint32 busyPoll;
+
+    /**
+     * Memory where the datagrams of a batch are received (batchSize * cyclesPerPacket * totalMemorySize).
+     */
+    uint8 *batchMemory;
+
+    /**
+     * The recvmmsg message headers (mmsghdr) and their io vectors (iovec).
+     */
+    void *messageHeaders;
+    void *messageVectors;
+
+    /**
+     * Queue of the received cycles and of their reception time.
+     */
+    uint8 *queueMemory;
+    uint64 *queueTimes;
+    uint32 queueSize;
+
+    /**
+     * Free running indices of the oldest (read) and of the next (write) cycle of the queue, whose slot is the index modulo queueSize.
+     * The queue is lock-free: only the receiving thread writes the queueWriteIdx (published with Atomic::Exchange after the cycle is copied)
+     * and the queueReadIdx is advanced with a compare-and-swap both by Synchronise and by the receiving thread when it drops the oldest
+     * cycle of a full queue.
+     */
+    volatile int32 queueReadIdx;
+    volatile int32 queueWriteIdx;
+
+    /**
+     * Diagnostic counters.
+     */
+    uint32 numberOfBatches;
+    uint32 numberOfPackets;
+    uint32 lastBatchSize;
+    uint32 maxBatchSize;
+    uint32 numberOfDrops;
+    uint32 lastLatency;
+    uint32 maxLatency;
 };
 }
 #endif
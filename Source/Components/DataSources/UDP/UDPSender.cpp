@@ -24,6 +24,7 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <sys/socket.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -31,6 +32,7 @@
 
 #include "AdvancedErrorManagement.h"
 #include "BrokerI.h"
+#include "HighResolutionTimer.h"
 #include "MemoryMapAsyncTriggerOutputBroker.h"
 #include "MemoryMapSynchronisedOutputBroker.h"
 #include "Shift.h"
@@ -39,6 +41,12 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * The largest BatchSize accepted by the UDPReceiver (and the sendmmsg limit of UIO_MAXIOV messages).
+ */
+const MARTe::uint32 UDP_SENDER_MAX_BATCH_SIZE = 1024u;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -56,11 +64,32 @@ UDPSender::UDPSender() :
     cpuMask = 0xffffffffu;
     stackSize = 0u;
     executionMode = UDPSenderExecutionModeIndependent;
+    batchSize = 1u;
+    cyclesPerPacket = 1u;
+    batchMemory = NULL_PTR(uint8 *);
+    bufferedCycles = 0u;
+    batchStartTime = 0u;
+    messageHeaders = NULL_PTR(void *);
+    messageVectors = NULL_PTR(void *);
+    numberOfBatches = 0u;
+    numberOfPackets = 0u;
+    lastBatchSize = 0u;
+    numberOfDrops = 0u;
+    lastLatency = 0u;
+    maxLatency = 0u;
+    flushTimeout = 0u;
+    flushTimeoutTicks = 0u;
+    flushPending = 0;
 }
 
 /*lint -e{1551} Justification: the destructor must guarantee that the client sending is closed.*/
 UDPSender::~UDPSender() {
     if (client != NULL_PTR(BasicUDPSocket*)) {
+        if (bufferedCycles > 0u) {
+            if (!SendBatch()) {
+                REPORT_ERROR(ErrorManagement::Warning, "Could not send the last incomplete batch");
+            }
+        }
         if (!client->Close()) {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not close UDP sender.");
         }
@@ -68,6 +97,16 @@ UDPSender::~UDPSender() {
             delete client;
         }
     }
+    if (batchMemory != NULL_PTR(uint8 *)) {
+        void *mem = reinterpret_cast<void *>(batchMemory);
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(mem);
+    }
+    if (messageHeaders != NULL_PTR(void *)) {
+        delete[] reinterpret_cast<struct mmsghdr *>(messageHeaders);
+    }
+    if (messageVectors != NULL_PTR(void *)) {
+        delete[] reinterpret_cast<struct iovec *>(messageVectors);
+    }
 }
 
 bool UDPSender::Initialise(StructuredDataI &data) {
@@ -181,6 +220,31 @@ bool UDPSender::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if (ok) {
+        if (!data.Read("BatchSize", batchSize)) {
+            batchSize = 1u;
+        }
+        ok = ((batchSize > 0u) && (batchSize <= UDP_SENDER_MAX_BATCH_SIZE));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "BatchSize shall be in [1, %d]", UDP_SENDER_MAX_BATCH_SIZE);
+        }
+    }
+    if (ok) {
+        if (!data.Read("CyclesPerPacket", cyclesPerPacket)) {
+            cyclesPerPacket = 1u;
+        }
+        ok = (cyclesPerPacket > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "CyclesPerPacket shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("FlushTimeout", flushTimeout)) {
+            flushTimeout = 0u;
+        }
+        float64 ticks = (static_cast<float64>(flushTimeout) * 1e-3) * static_cast<float64>(HighResolutionTimer::Frequency());
+        flushTimeoutTicks = static_cast<uint64>(ticks);
+    }
     //Do not allow to add signals in run-time
     if (ok) {
         ok = signalsDatabase.MoveRelative("Signals");
@@ -205,8 +269,104 @@ bool UDPSender::Synchronise() {
     const char8 *const dataBuffer = reinterpret_cast<char8*>(memory);
     bool ok = false;
     if (client != NULL_PTR(BasicUDPSocket*)) {
-        uint32 sizeToWrite = totalMemorySize;
-        ok = client->Write(dataBuffer, sizeToWrite);
+        if (IsBatched()) {
+            ok = true;
+            //A state change was requested: do not keep the cycles of the previous state waiting for the batch to be completed
+            if (flushPending != 0) {
+                flushPending = 0;
+                if (bufferedCycles > 0u) {
+                    ok = SendBatch();
+                }
+            }
+            if (bufferedCycles == 0u) {
+                batchStartTime = HighResolutionTimer::Counter();
+            }
+            bool copied = MemoryOperationsHelper::Copy(&batchMemory[bufferedCycles * totalMemorySize], dataBuffer, totalMemorySize);
+            bufferedCycles++;
+            bool flush = (bufferedCycles == (batchSize * cyclesPerPacket));
+            if ((!flush) && (flushTimeoutTicks > 0u)) {
+                flush = ((HighResolutionTimer::Counter() - batchStartTime) >= flushTimeoutTicks);
+            }
+            if (flush) {
+                copied = (SendBatch()) && (copied);
+            }
+            ok = (ok) && (copied);
+        }
+        else {
+            uint32 sizeToWrite = totalMemorySize;
+            ok = client->Write(dataBuffer, sizeToWrite);
+            if (ok) {
+                numberOfBatches++;
+                numberOfPackets++;
+                lastBatchSize = 1u;
+            }
+            else {
+                numberOfDrops++;
+            }
+        }
+    }
+    return ok;
+}
+
+bool UDPSender::SendBatch() {
+    struct mmsghdr *headers = reinterpret_cast<struct mmsghdr *>(messageHeaders);
+    struct iovec *vectors = reinterpret_cast<struct iovec *>(messageVectors);
+    uint32 datagramSize = cyclesPerPacket * totalMemorySize;
+    uint32 nDatagrams = ((bufferedCycles + cyclesPerPacket) - 1u) / cyclesPerPacket;
+    /* The last datagram may hold less than cyclesPerPacket cycles */
+    for (uint32 i = 0u; i < nDatagrams; i++) {
+        vectors[i].iov_len = datagramSize;
+    }
+    vectors[nDatagrams - 1u].iov_len = (bufferedCycles - ((nDatagrams - 1u) * cyclesPerPacket)) * totalMemorySize;
+
+    /*lint -e{613} client cannot be NULL as checked by the caller*/
+    int32 socketHandle = static_cast<int32>(client->GetWriteHandle());
+    uint32 nSent = 0u;
+    bool ok = true;
+    while ((ok) && (nSent < nDatagrams)) {
+        int32 ret = sendmmsg(socketHandle, &headers[nSent], (nDatagrams - nSent), 0);
+        ok = (ret > 0);
+        if (ok) {
+            nSent += static_cast<uint32>(ret);
+        }
+    }
+    numberOfBatches++;
+    numberOfPackets += nSent;
+    numberOfDrops += (nDatagrams - nSent);
+    lastBatchSize = nSent;
+    uint64 elapsed = HighResolutionTimer::Counter() - batchStartTime;
+    lastLatency = static_cast<uint32>(static_cast<float64>(elapsed) * HighResolutionTimer::Period() * 1e6);
+    if (lastLatency > maxLatency) {
+        maxLatency = lastLatency;
+    }
+    bufferedCycles = 0u;
+    return ok;
+}
+
+bool UDPSender::AllocateMemory() {
+    bool ok = MemoryDataSourceI::AllocateMemory();
+    if (ok) {
+        if (IsBatched()) {
+            uint32 datagramSize = cyclesPerPacket * totalMemorySize;
+            batchMemory = reinterpret_cast<uint8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(batchSize * datagramSize));
+            ok = (batchMemory != NULL_PTR(uint8 *));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the batch memory");
+            }
+            if (ok) {
+                struct mmsghdr *headers = new struct mmsghdr[batchSize];
+                struct iovec *vectors = new struct iovec[batchSize];
+                ok = MemoryOperationsHelper::Set(headers, '\0', static_cast<uint32>(sizeof(struct mmsghdr)) * batchSize);
+                for (uint32 i = 0u; i < batchSize; i++) {
+                    vectors[i].iov_base = &batchMemory[i * datagramSize];
+                    vectors[i].iov_len = datagramSize;
+                    headers[i].msg_hdr.msg_iov = &vectors[i];
+                    headers[i].msg_hdr.msg_iovlen = 1u;
+                }
+                messageHeaders = headers;
+                messageVectors = vectors;
+            }
+        }
     }
     return ok;
 }
@@ -297,6 +457,8 @@ bool UDPSender::GetOutputBrokers(ReferenceContainer &outputBrokers,
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the current and next state name are indepentent of the operation.*/
 bool UDPSender::PrepareNextState(const char8 *const currentStateName,
                                  const char8 *const nextStateName) {
+    //The cycles still buffered are sent by the next Synchronise (which may still be running in the current state)
+    flushPending = 1;
     return true;
 }
 
@@ -324,6 +486,46 @@ StreamString UDPSender::GetAddress() const {
     return address;
 }
 
+uint32 UDPSender::GetBatchSize() const {
+    return batchSize;
+}
+
+uint32 UDPSender::GetCyclesPerPacket() const {
+    return cyclesPerPacket;
+}
+
+uint32 UDPSender::GetNumberOfBatches() const {
+    return numberOfBatches;
+}
+
+uint32 UDPSender::GetNumberOfPackets() const {
+    return numberOfPackets;
+}
+
+uint32 UDPSender::GetLastBatchSize() const {
+    return lastBatchSize;
+}
+
+uint32 UDPSender::GetNumberOfDrops() const {
+    return numberOfDrops;
+}
+
+uint32 UDPSender::GetLastLatency() const {
+    return lastLatency;
+}
+
+uint32 UDPSender::GetMaxLatency() const {
+    return maxLatency;
+}
+
+uint32 UDPSender::GetFlushTimeout() const {
+    return flushTimeout;
+}
+
+bool UDPSender::IsBatched() const {
+    return ((batchSize > 1u) || (cyclesPerPacket > 1u));
+}
+
 CLASS_REGISTER(UDPSender, "1.0")
 
 }
@@ -60,6 +60,9 @@ namespace MARTe {
  *         Ignored with a warning when ExecutionMode is RealTimeThread.
  *     StackSize = 10000000 //Optional, (default MARTe2 THREADS_DEFAULT_STACKSIZE) Stack size of the independent thread spawned
  *         Ignored with a warning when ExecutionMode is RealTimeThread.
+ *     CyclesPerPacket = 4 //Optional (default 1). Number of cycles (i.e. of copies of the signals) coalesced in one datagram.
+ *     BatchSize = 8 //Optional (default 1). Number of datagrams sent with a single system call (sendmmsg). Shall be in [1, 1024] (the UDPReceiver limit).
+ *     FlushTimeout = 100 //Optional (default 0, i.e. disabled). Maximum time in milliseconds a cycle waits in an incomplete batch.
  *
  *     Signals = {
  *          Trigger = { //Mandatory iff ExecutionMode ==  IndependentThread. Must be in first position.
@@ -74,6 +77,16 @@ namespace MARTe {
  *          ...
  *     }
  * }
+ *
+ * If CyclesPerPacket > 1 or BatchSize > 1 the signals written in each Synchronise are appended to a batch buffer
+ * and nothing is sent until BatchSize * CyclesPerPacket cycles are buffered; the BatchSize datagrams, each with CyclesPerPacket
+ * consecutive cycles, are then sent with one system call. The UDPReceiver shall declare the same signals and a CyclesPerPacket
+ * greater or equal to the one of the UDPSender. The cycles of an incomplete batch are sent when the batch is completed, when
+ * the first cycle of the batch is older than FlushTimeout (checked at every Synchronise), at the first Synchronise after a state change
+ * (PrepareNextState) and when the UDPSender is destroyed.
+ *
+ * The number of datagrams per batch, the number of drops (datagrams which could not be sent) and the latency
+ * (time between the first cycle of a batch being buffered and the batch being sent) are available through the Get* diagnostic methods.
  */
 
 typedef enum {
@@ -128,7 +141,7 @@ public:CLASS_REGISTER_DECLARATION()
                                   void *const gamMemPtr);
 
     /**
-     * @brief Initialises the packet data and stores the time
+     * @brief Requests the cycles buffered in an incomplete batch to be sent by the next Synchronise.
      * @return true
      */
     virtual bool PrepareNextState(const char8 *const currentStateName,
@@ -141,6 +154,12 @@ public:CLASS_REGISTER_DECLARATION()
      */
     virtual bool SetConfiguredDatabase(StructuredDataI &data);
 
+    /**
+     * @brief Allocates the MemoryDataSourceI memory and, if CyclesPerPacket > 1 or BatchSize > 1, the batch buffer.
+     * @return true if the memory could be allocated.
+     */
+    virtual bool AllocateMemory();
+
     /**
      * @brief Loads and verifies the configuration parameters detailed in the class description.
      * @return true if all the mandatory parameters are correctly specified and if the specified optional parameters have valid values.
@@ -183,8 +202,73 @@ public:CLASS_REGISTER_DECLARATION()
      */
     StreamString GetAddress() const;
 
+    /**
+     * @brief Gets the number of datagrams sent with one system call.
+     * @return the number of datagrams sent with one system call.
+     */
+    uint32 GetBatchSize() const;
+
+    /**
+     * @brief Gets the number of cycles coalesced in one datagram.
+     * @return the number of cycles coalesced in one datagram.
+     */
+    uint32 GetCyclesPerPacket() const;
+
+    /**
+     * @brief Gets the number of send system calls.
+     * @return the number of batches sent.
+     */
+    uint32 GetNumberOfBatches() const;
+
+    /**
+     * @brief Gets the number of datagrams sent.
+     * @return the number of datagrams sent.
+     */
+    uint32 GetNumberOfPackets() const;
+
+    /**
+     * @brief Gets the number of datagrams of the last batch.
+     * @return the number of datagrams of the last batch.
+     */
+    uint32 GetLastBatchSize() const;
+
+    /**
+     * @brief Gets the number of datagrams which could not be sent.
+     * @return the number of drops.
+     */
+    uint32 GetNumberOfDrops() const;
+
+    /**
+     * @brief Gets the time between the first cycle of the last batch being buffered and the batch being sent.
+     * @return the latency in microseconds (only computed if BatchSize > 1 or CyclesPerPacket > 1).
+     */
+    uint32 GetLastLatency() const;
+
+    /**
+     * @brief Gets the largest latency.
+     * @return the largest latency in microseconds (only computed if BatchSize > 1 or CyclesPerPacket > 1).
+     */
+    uint32 GetMaxLatency() const;
+
+    /**
+     * @brief Gets the maximum time that a cycle waits in an incomplete batch.
+     * @return the flush timeout in milliseconds (0 if disabled).
+     */
+    uint32 GetFlushTimeout() const;
+
 private:
 
+    /**
+     * @brief Sends the buffered cycles, CyclesPerPacket per datagram, with sendmmsg.
+     * @return true if all the datagrams were sent.
+     */
+    bool SendBatch();
+
+    /**
+     * @brief Returns true if BatchSize > 1 or CyclesPerPacket > 1.
+     */
+    bool IsBatched() const;
+
     /**
      * The IP address to which the data will be transmitted to
      */
@@ -224,6 +308,58 @@ private:
      * Holds the current execution mode of the datasource.
      */
     UDPSenderExecutionMode executionMode;
+
+    /**
+     * Number of datagrams sent with a single system call.
+     */
+    uint32 batchSize;
+
+    /**
+     * Number of cycles in a datagram.
+     */
+    uint32 cyclesPerPacket;
+
+    /**
+     * Memory where the cycles are buffered (batchSize * cyclesPerPacket * totalMemorySize).
+     */
+    uint8 *batchMemory;
+
+    /**
+     * Number of cycles currently buffered.
+     */
+    uint32 bufferedCycles;
+
+    /**
+     * HighResolutionTimer counter when the first cycle of the batch was buffered.
+     */
+    uint64 batchStartTime;
+
+    /**
+     * The sendmmsg message headers (mmsghdr) and their io vectors (iovec).
+     */
+    void *messageHeaders;
+    void *messageVectors;
+
+    /**
+     * Diagnostic counters.
+     */
+    uint32 numberOfBatches;
+    uint32 numberOfPackets;
+    uint32 lastBatchSize;
+    uint32 numberOfDrops;
+    uint32 lastLatency;
+    uint32 maxLatency;
+
+    /**
+     * Maximum time (in milliseconds and in HighResolutionTimer ticks) that a cycle waits in an incomplete batch.
+     */
+    uint32 flushTimeout;
+    uint64 flushTimeoutTicks;
+
+    /**
+     * Set by PrepareNextState to send the incomplete batch at the next Synchronise.
+     */
+    volatile int32 flushPending;
 };
 }
 #endif
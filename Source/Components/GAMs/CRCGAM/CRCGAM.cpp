@@ -45,19 +45,30 @@ namespace MARTe {
 
 CRCGAM::CRCGAM() :
         GAM() {
-    inputData = NULL_PTR(uint8 *);
-    outputData = NULL_PTR(void *);
+    inputData = NULL_PTR(uint8 **);
+    inputDataSize = NULL_PTR(uint32 *);
+    outputData = NULL_PTR(void **);
+    numberOfCRCs = 0u;
     crcHelper = NULL_PTR(CRCHelper *);
     polynomial = 0x0u;
     initialCRCValue = 0x0u;
     isReflected = 0u;
-    inputSize = 0u;
+    lsbFirst = 0u;
 }
 
 CRCGAM::~CRCGAM() {
-    inputData = NULL_PTR(uint8 *);
-    outputData = NULL_PTR(void *);
-    crcHelper = NULL_PTR(CRCHelper *);
+    if (inputData != NULL_PTR(uint8 **)) {
+        delete[] inputData;
+    }
+    if (inputDataSize != NULL_PTR(uint32 *)) {
+        delete[] inputDataSize;
+    }
+    if (outputData != NULL_PTR(void **)) {
+        delete[] outputData;
+    }
+    if (crcHelper != NULL_PTR(CRCHelper *)) {
+        delete crcHelper;
+    }
 }
 
 bool CRCGAM::Initialise(StructuredDataI &data) {
@@ -84,6 +95,22 @@ bool CRCGAM::Initialise(StructuredDataI &data) {
             ok = false;
         }
     }
+    if (ok) {
+        if (!data.Read("Reflected", lsbFirst)) {
+            lsbFirst = 0u;
+        }
+        if (lsbFirst > 1u) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Reflected option value must be 0 or 1. Now Reflected = %d", lsbFirst);
+            ok = false;
+        }
+        else if ((lsbFirst == 1u) && (isReflected == 1u)) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Reflected = 1 cannot be used with Inverted = 1.");
+            ok = false;
+        }
+        else {
+            //NOOP
+        }
+    }
     if (!ok) {
         REPORT_ERROR(ErrorManagement::InitialisationError, "Error during Initialise.");
     }
@@ -99,16 +126,24 @@ bool CRCGAM::Setup() {
         REPORT_ERROR(ErrorManagement::InitialisationError, "CRCGAM must have at least 1 input signal.");
         ok = false;
     }
-    //The number of Output signals must be equal to 1.
+    //The number of Output signals must be equal to 1 or to the number of Input signals.
     if (ok) {
-        uint32 nOutputSignals;
-        nOutputSignals = GetNumberOfOutputSignals();
-        if (nOutputSignals != 1u) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "nOutputSignals must be one. The current values is %u", nOutputSignals);
+        numberOfCRCs = GetNumberOfOutputSignals();
+        if ((numberOfCRCs != 1u) && (numberOfCRCs != nInputSignals)) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "nOutputSignals must be one or equal to the number of input signals. The current values is %u", numberOfCRCs);
             ok = false;
         }
     }
-    //The inputSize must be taken from InputSignals
+    if (ok) {
+        inputData = new uint8*[numberOfCRCs];
+        inputDataSize = new uint32[numberOfCRCs];
+        outputData = new void*[numberOfCRCs];
+        uint32 c;
+        for (c = 0u; c < numberOfCRCs; c++) {
+            inputDataSize[c] = 0u;
+        }
+    }
+    //The input size of each CRC must be taken from InputSignals
     if (ok) {
         uint32 n;
         for (n = 0u; (n < GetNumberOfInputSignals()) && (ok); n++) {
@@ -123,33 +158,39 @@ bool CRCGAM::Setup() {
             }
             if (ok) {
                 inByteSize *= inSamples;
-                inputSize += inByteSize;
+                if (numberOfCRCs == 1u) {
+                    inputDataSize[0u] += inByteSize;
+                }
+                else {
+                    inputDataSize[n] = inByteSize;
+                    inputData[n] = reinterpret_cast<uint8*>(GetInputSignalMemory(n));
+                }
             }
             else {
                 REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting Signal number of samples from InputSignals.");
             }
         }
     }
-    //The output type must be a supported type.
+    //The output type must be a supported type and the same for all the output signals.
     if (ok) {
         outputSignalType = GetSignalType(OutputSignals, 0u);
+        uint32 n;
+        for (n = 1u; (n < numberOfCRCs) && (ok); n++) {
+            ok = (GetSignalType(OutputSignals, n) == outputSignalType);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "All the output signals must have the same type.");
+            }
+        }
+    }
+    if (ok) {
         if (outputSignalType == UnsignedInteger8Bit) {
             crcHelper = new CRCHelperT<uint8>();
-            crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
-            outputData = reinterpret_cast<uint8*>(GetOutputSignalMemory(0u));
         }
         else if (outputSignalType == UnsignedInteger16Bit) {
             crcHelper = new CRCHelperT<uint16>();
-            crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
-            outputData = reinterpret_cast<uint16*>(GetOutputSignalMemory(0u));
         }
         else if (outputSignalType == UnsignedInteger32Bit) {
             crcHelper = new CRCHelperT<uint32>();
-            crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
-            outputData = reinterpret_cast<uint32*>(GetOutputSignalMemory(0u));
         }
         else {
             const char8 * const outputSignalTypeStr = TypeDescriptor::GetTypeNameFromTypeDescriptor(outputSignalType);
@@ -160,7 +201,15 @@ bool CRCGAM::Setup() {
         }
     }
     if (ok) {
-        inputData = reinterpret_cast<uint8*>(GetInputSignalsMemory());
+        crcHelper->ComputeTable(&polynomial, (lsbFirst == 1u));
+        REPORT_ERROR(ErrorManagement::Information, "Table computed! CRC engine: %s", crcHelper->GetEngineName());
+        uint32 n;
+        for (n = 0u; n < numberOfCRCs; n++) {
+            outputData[n] = GetOutputSignalMemory(n);
+        }
+        if (numberOfCRCs == 1u) {
+            inputData[0u] = reinterpret_cast<uint8*>(GetInputSignalsMemory());
+        }
     }
     if (!ok) {
         REPORT_ERROR(ErrorManagement::InitialisationError, "Error during GAM Setup.");
@@ -176,12 +225,23 @@ bool CRCGAM::Execute() {
     }
 
     if (crcHelper != NULL_PTR(CRCHelper *)) {
-        crcHelper->Compute(inputData, static_cast<int32>(inputSize), &initialCRCValue, inv, outputData);
+        uint32 n;
+        for (n = 0u; n < numberOfCRCs; n++) {
+            crcHelper->Compute(inputData[n], static_cast<int32>(inputDataSize[n]), &initialCRCValue, inv, outputData[n]);
+        }
     }
 
     return true;
 }
 
+CRCHelperEngine CRCGAM::GetEngine() const {
+    CRCHelperEngine engine = CRCHelperEngineByteWise;
+    if (crcHelper != NULL_PTR(CRCHelper *)) {
+        engine = crcHelper->GetEngine();
+    }
+    return engine;
+}
+
 CLASS_REGISTER(CRCGAM, "1.0")
 }
 
@@ -51,8 +51,16 @@ namespace MARTe {
  *   Common values for polynomial are: 0x7 (uint8), 0x1021 (uint16), 0x4C11DB7 (uint32).
  * - The initial CRC value.
  * - The Inverted option: 1 is you want the CRC checksum reflected, 0 otherwise.
+ * - The optional Reflected option: 1 to compute the CRC LSB first (e.g. CRC-32 with Polynomial = 0x4C11DB7 or
+ *   CRC-32C with Polynomial = 0x1EDC6F41), 0 otherwise (default). The Polynomial is always given in the normal representation.
+ *   The InitialValue is loaded in the CRC register as is and no final XOR is applied. Reflected = 1 cannot be used with Inverted = 1.
  *
- * The number of OutputSignals must be equal to 1.
+ * The number of OutputSignals must be equal to 1, in which case the CRC is computed over the memory of all the InputSignals,
+ * or equal to the number of InputSignals, in which case the CRC of each input signal is written in the output signal with
+ * the same index. All the CRCs are computed in a single pass over the input memory. All the OutputSignals must have the same type.
+ *
+ * The CRC is computed with slice-by-8 tables, or with the SSE4.2 crc32 instruction for the reflected CRC-32C when the processor
+ * supports it. The selected engine is reported in Setup.
  *
  * The configuration syntax is (names and signal quantities are only given as an example):
  * <pre>
@@ -86,13 +94,13 @@ public:
 CRCGAM    ();
 
     /**
-     * @brief Default Destructor. NOOP.
+     * @brief Destructor. Frees the CRCHelper.
      */
     virtual ~CRCGAM();
 
     /**
      * @brief see GAM::Initialise.
-     * @details Stores the GAM configuration in order to read Polynomial, InitialValue and Inverted option.
+     * @details Stores the GAM configuration in order to read Polynomial, InitialValue, Inverted and Reflected options.
      */
     virtual bool Initialise(StructuredDataI &data);
 
@@ -101,8 +109,8 @@ CRCGAM    ();
      * @details Retrieves byte size of input signals, computes the table from the polynomial and checks that the rules below are met.
      * @return true if all the preconditions are met.
      * @pre
-     *     GetNumberOfOutputSignals() == 1 &&
-     *     GetSignalType(OutputSignals, 0u) == uint8 or uint16 or uint32
+     *     (GetNumberOfOutputSignals() == 1 || GetNumberOfOutputSignals() == GetNumberOfInputSignals()) &&
+     *     GetSignalType(OutputSignals, *) == uint8 or uint16 or uint32 (the same for all the OutputSignals)
      */
     virtual bool Setup();
 
@@ -111,17 +119,33 @@ CRCGAM    ();
      */
     virtual bool Execute();
 
+    /**
+     * @brief Gets the engine used to compute the CRC.
+     * @return the engine used to compute the CRC (CRCHelperEngineByteWise before Setup).
+     */
+    CRCHelperEngine GetEngine() const;
+
 private:
 
     /**
-     * Memory of the CRCGAM input signals.
+     * Memory of the input of each CRC (either all the InputSignals or each input signal).
      */
-    uint8 * inputData;
+    uint8 ** inputData;
+
+    /**
+     * Byte size of the input of each CRC.
+     */
+    uint32 * inputDataSize;
 
     /**
      * Memory of the CRCGAM output signals.
      */
-    void * outputData;
+    void ** outputData;
+
+    /**
+     * Number of CRCs to compute (i.e. the number of OutputSignals).
+     */
+    uint32 numberOfCRCs;
 
     /**
      * The CRCHelper for type independent CRC computation.
@@ -138,11 +162,6 @@ private:
      */
     uint32 initialCRCValue;
 
-    /**
-     * Byte size of InputSignals.
-     */
-    uint32 inputSize;
-
     /**
      * TypeDescriptor for the out signal type.
      */
@@ -153,6 +172,11 @@ private:
      */
     uint8 isReflected;
 
+    /**
+     * Flag for the LSB first (Reflected) CRC.
+     */
+    uint8 lsbFirst;
+
 };
 
 }
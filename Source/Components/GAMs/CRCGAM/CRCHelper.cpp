@@ -0,0 +1,112 @@
+/**
+ * @file CRCHelper.cpp
+ * @brief Source file for class CRCHelper
+ * @date 18/10/2026
+ * @author Luca Porzio
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class CRCHelper (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#if defined(__GNUC__) && defined(__x86_64__)
+#define CRC_HELPER_CRC32C_HARDWARE
+#include <nmmintrin.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "CRCHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+#ifdef CRC_HELPER_CRC32C_HARDWARE
+/**
+ * The target attribute allows to use the crc32 instruction without compiling the whole library with -msse4.2.
+ * It is only called after checking that the processor supports it.
+ */
+__attribute__((target("sse4.2")))
+MARTe::uint32 CRC32CHardware(const MARTe::uint8 *data, MARTe::uint32 size, const MARTe::uint32 initCRC) {
+    MARTe::uint64 crc = initCRC;
+    while (size >= 8u) {
+        MARTe::uint64 word;
+        //Compiled to a single (unaligned) load
+        __builtin_memcpy(&word, data, 8u);
+        crc = _mm_crc32_u64(crc, word);
+        data = &data[8u];
+        size -= 8u;
+    }
+    while (size > 0u) {
+        crc = _mm_crc32_u8(static_cast<MARTe::uint32>(crc), *data);
+        data = &data[1u];
+        size--;
+    }
+    return static_cast<MARTe::uint32>(crc);
+}
+#endif
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+CRCHelper::CRCHelper() {
+    engine = CRCHelperEngineByteWise;
+}
+
+CRCHelperEngine CRCHelper::GetEngine() const {
+    return engine;
+}
+
+const char8 *CRCHelper::GetEngineName() const {
+    const char8 *name = "ByteWise";
+    if (engine == CRCHelperEngineSliceBy8) {
+        name = "SliceBy8";
+    }
+    else if (engine == CRCHelperEngineHardwareCRC32C) {
+        name = "HardwareCRC32C";
+    }
+    else {
+        //ByteWise
+    }
+    return name;
+}
+
+bool CRCHelper::IsCRC32CHardwareAvailable() {
+#ifdef CRC_HELPER_CRC32C_HARDWARE
+    __builtin_cpu_init();
+    return (__builtin_cpu_supports("sse4.2") != 0);
+#else
+    return false;
+#endif
+}
+
+/*lint -e{715} data, size and initCRC not referenced if the hardware engine is not compiled*/
+uint32 CRCHelper::ComputeCRC32CHardware(const uint8 * const data, const uint32 size, const uint32 initCRC) {
+#ifdef CRC_HELPER_CRC32C_HARDWARE
+    return CRC32CHardware(data, size, initCRC);
+#else
+    return initCRC;
+#endif
+}
+
+}
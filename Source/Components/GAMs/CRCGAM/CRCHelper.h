@@ -31,18 +31,48 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
-
+#include "CompilerTypes.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * @brief Engines that can be selected by CRCHelper::ComputeTable.
+ */
+enum CRCHelperEngine {
+    /**
+     * One table lookup per byte.
+     */
+    CRCHelperEngineByteWise,
+
+    /**
+     * Slice-by-8: eight independent table lookups for every eight bytes.
+     */
+    CRCHelperEngineSliceBy8,
+
+    /**
+     * The SSE4.2 crc32 instruction (reflected CRC-32C only).
+     */
+    CRCHelperEngineHardwareCRC32C
+};
+
+/**
+ * The CRC-32C (Castagnoli) polynomial.
+ */
+static const uint32 CRC_HELPER_CRC32C_POLYNOMIAL = 0x1EDC6F41u;
+
 /**
  * @brief Helper class to compute the CRC.
  */
 class CRCHelper {
 public:
+    /**
+     * @brief Constructor. Sets the engine to CRCHelperEngineByteWise.
+     */
+    CRCHelper();
+
     /**
      * @brief Destructor. NOOP.
      */
@@ -57,6 +87,14 @@ public:
      */
     virtual void ComputeTable(void * const pol) = 0;
 
+    /**
+     * @brief To be specialised by CRCHelperT for all the supported types.
+     * @details Compute the lookup tables for a given polynomial and select the fastest engine available.
+     * @param[in] pol the given divisor polynomial (always in the normal, MSB first, representation).
+     * @param[in] reflected if true the CRC is computed LSB first (e.g. as CRC-32 or CRC-32C), otherwise MSB first.
+     */
+    virtual void ComputeTable(void * const pol, const bool reflected) = 0;
+
     /**
      * @brief To be specialised by CRCHelperT for all the supported types.
      * @details Compute the CRC checksum for given parameters.
@@ -68,10 +106,43 @@ public:
      */
     virtual void Compute(const uint8 * const data, int32 const size, void * const initCRC, bool const inputInverted, void * const retVal) = 0;
 
-};
-}
+    /**
+     * @brief Gets the engine selected by ComputeTable.
+     * @return the engine selected by ComputeTable.
+     */
+    CRCHelperEngine GetEngine() const;
 
+    /**
+     * @brief Gets the name of the engine selected by ComputeTable.
+     * @return "ByteWise", "SliceBy8" or "HardwareCRC32C".
+     */
+    const char8 *GetEngineName() const;
+
+    /**
+     * @brief Checks if the SSE4.2 crc32 instruction is available in this processor.
+     * @return true if ComputeCRC32CHardware can be called.
+     */
+    static bool IsCRC32CHardwareAvailable();
 
+    /**
+     * @brief Computes the reflected CRC-32C with the SSE4.2 crc32 instruction.
+     * @param[in] data the bytes against which the CRC will be computed.
+     * @param[in] size the number of bytes in \a data.
+     * @param[in] initCRC the initial CRC value (no inversion is applied to the input or to the output).
+     * @return the computed CRC checksum.
+     * @pre
+     *   IsCRC32CHardwareAvailable()
+     */
+    static uint32 ComputeCRC32CHardware(const uint8 * const data, const uint32 size, const uint32 initCRC);
+
+protected:
+
+    /**
+     * The engine selected by ComputeTable.
+     */
+    CRCHelperEngine engine;
+};
+}
 
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
@@ -39,12 +39,31 @@
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+
+/**
+ * Number of bytes processed by each iteration of the slice-by-8 engine.
+ */
+static const uint32 CRC_HELPER_SLICES = 8u;
+
 /**
  * @brief Helper class to compute the CRC using different templates.
+ * @details ComputeTable selects the engine used by Compute (see CRCHelper::GetEngine):
+ *  - the SSE4.2 crc32 instruction for the reflected CRC-32C, when available;
+ *  - slice-by-8 otherwise. Each iteration folds 8 bytes with 8 independent table lookups,
+ *    instead of the 8 dependent lookups of the byte-wise algorithm;
+ *  - the byte-wise CRC<T> is still used to compute the CRC with the inputInverted option.
+ *
+ * The reflected CRC is computed LSB first from the polynomial in the normal representation.
+ * Like the non-reflected CRC, the initial value is loaded in the CRC register as is and no final XOR is applied.
  */
 template <typename T>
 class CRCHelperT : public CRCHelper {
 public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    CRCHelperT();
+
     /**
      * @brief Destructor. NOOP.
      */
@@ -54,22 +73,47 @@ public:
 
     /**
      * @see CRCHelper::ComputeTable
-     * @details A cast to the declared output type is performed.
+     * @details A cast to the declared output type is performed. Equivalent to ComputeTable(pol, false).
      */
     virtual void ComputeTable(void * const pol);
 
     /**
-     * @see CRCHelper::Compute
+     * @see CRCHelper::ComputeTable
      * @details A cast to the declared output type is performed.
      */
+    virtual void ComputeTable(void * const pol, const bool reflectedIn);
+
+    /**
+     * @see CRCHelper::Compute
+     * @details A cast to the declared output type is performed. The \a inputInverted option is ignored if the CRC is reflected.
+     */
     virtual void Compute(const uint8 * const data, int32 const size, void * const initCRC, bool const inputInverted, void * const retVal);
 
 private:
 
+    /**
+     * @brief Computes the CRC with the slice-by-8 tables.
+     * @param[in] data the bytes against which the CRC will be computed.
+     * @param[in] size the number of bytes in \a data.
+     * @param[in] initCRC the initial CRC value.
+     * @return the computed CRC checksum.
+     */
+    T ComputeSliceBy8(const uint8 * data, uint32 size, const T initCRC) const;
+
     /**
      * CRC template class.
      */
     CRC<T> crc;
+
+    /**
+     * sliceTable[0] is the byte-wise table. sliceTable[k][i] is the CRC of the byte i followed by k zero bytes.
+     */
+    T sliceTable[CRC_HELPER_SLICES][256u];
+
+    /**
+     * True if the CRC is computed LSB first.
+     */
+    bool reflected;
 };
 }
 
@@ -79,19 +123,161 @@ private:
 namespace MARTe {
 
 /*lint -esym(9107, MARTe::CRCHelperT*) [MISRA C++ Rule 3-1-1] required for template implementation*/
+template<typename T>
+CRCHelperT<T>::CRCHelperT() :
+        CRCHelper() {
+    reflected = false;
+}
+
 template<typename T>
 void CRCHelperT<T>::ComputeTable(void * const pol) {
-    crc.ComputeTable(*static_cast<T*>(pol));
+    ComputeTable(pol, false);
+}
+
+template<typename T>
+void CRCHelperT<T>::ComputeTable(void * const pol, const bool reflectedIn) {
+    const uint32 width = static_cast<uint32>(sizeof(T) * 8u);
+    const T polynomial = *static_cast<T*>(pol);
+    const T topBit = static_cast<T>(static_cast<T>(1u) << (width - 1u));
+    reflected = reflectedIn;
+    crc.ComputeTable(polynomial);
+
+    T reflectedPolynomial = 0u;
+    uint32 b;
+    for (b = 0u; b < width; b++) {
+        if ((polynomial & static_cast<T>(static_cast<T>(1u) << b)) != 0u) {
+            reflectedPolynomial |= static_cast<T>(static_cast<T>(1u) << (width - 1u - b));
+        }
+    }
+    uint32 i;
+    for (i = 0u; i < 256u; i++) {
+        T remainder;
+        if (reflected) {
+            remainder = static_cast<T>(i);
+            for (b = 0u; b < 8u; b++) {
+                if ((remainder & 1u) != 0u) {
+                    remainder = static_cast<T>(remainder >> 1u) ^ reflectedPolynomial;
+                }
+                else {
+                    remainder = static_cast<T>(remainder >> 1u);
+                }
+            }
+        }
+        else {
+            remainder = static_cast<T>(static_cast<T>(i) << (width - 8u));
+            for (b = 0u; b < 8u; b++) {
+                if ((remainder & topBit) != 0u) {
+                    remainder = static_cast<T>(remainder << 1u) ^ polynomial;
+                }
+                else {
+                    remainder = static_cast<T>(remainder << 1u);
+                }
+            }
+        }
+        sliceTable[0u][i] = remainder;
+    }
+    uint32 k;
+    for (k = 1u; k < CRC_HELPER_SLICES; k++) {
+        for (i = 0u; i < 256u; i++) {
+            const T previous = sliceTable[k - 1u][i];
+            if (reflected) {
+                sliceTable[k][i] = static_cast<T>(static_cast<uint64>(previous) >> 8u) ^ sliceTable[0u][previous & 0xFFu];
+            }
+            else {
+                sliceTable[k][i] = static_cast<T>(static_cast<uint64>(previous) << 8u) ^ sliceTable[0u][static_cast<uint64>(previous) >> (width - 8u)];
+            }
+        }
+    }
+
+    engine = CRCHelperEngineSliceBy8;
+    if (reflected) {
+        if ((sizeof(T) == 4u) && (static_cast<uint32>(polynomial) == CRC_HELPER_CRC32C_POLYNOMIAL)) {
+            if (CRCHelper::IsCRC32CHardwareAvailable()) {
+                engine = CRCHelperEngineHardwareCRC32C;
+            }
+        }
+    }
+    else {
+        //Only use the slice-by-8 engine if it gives the same result as the byte-wise CRC<T>
+        uint8 pattern[2u * CRC_HELPER_SLICES + 3u];
+        for (i = 0u; i < static_cast<uint32>(sizeof(pattern)); i++) {
+            pattern[i] = static_cast<uint8>((i * 37u) + 11u);
+        }
+        const T patternInitCRC = static_cast<T>(0x5A5A5A5Au);
+        const T byteWiseCRC = crc.Compute(&pattern[0], static_cast<int32>(sizeof(pattern)), patternInitCRC, false);
+        if (ComputeSliceBy8(&pattern[0], static_cast<uint32>(sizeof(pattern)), patternInitCRC) != byteWiseCRC) {
+            engine = CRCHelperEngineByteWise;
+        }
+    }
 }
 
 template<typename T>
 void CRCHelperT<T>::Compute(const uint8 * const data, int32 const size, void * const initCRC, bool const inputInverted, void * const retVal) {
-    T crcValue = crc.Compute(data, size, *static_cast<T*>(initCRC), inputInverted);
+    T crcValue = *static_cast<T*>(initCRC);
+    if (size > 0) {
+        if (engine == CRCHelperEngineHardwareCRC32C) {
+            crcValue = static_cast<T>(CRCHelper::ComputeCRC32CHardware(data, static_cast<uint32>(size), static_cast<uint32>(crcValue)));
+        }
+        else if (reflected) {
+            crcValue = ComputeSliceBy8(data, static_cast<uint32>(size), crcValue);
+        }
+        else if ((engine == CRCHelperEngineSliceBy8) && (!inputInverted)) {
+            crcValue = ComputeSliceBy8(data, static_cast<uint32>(size), crcValue);
+        }
+        else {
+            crcValue = crc.Compute(data, size, crcValue, inputInverted);
+        }
+    }
     if (retVal != NULL_PTR(void *)) {
         *static_cast<T*>(retVal) = crcValue;
     }
 }
 
+template<typename T>
+T CRCHelperT<T>::ComputeSliceBy8(const uint8 * data, uint32 size, const T initCRC) const {
+    const uint32 width = static_cast<uint32>(sizeof(T) * 8u);
+    uint64 crcValue = initCRC;
+    //The CRC register is folded into the first bytes of each block, in the order in which it is shifted out.
+    //The 8 byte loads are merged in a single load by the compiler where possible.
+    if (reflected) {
+        while (size >= CRC_HELPER_SLICES) {
+            uint64 block = static_cast<uint64>(data[0u]) | (static_cast<uint64>(data[1u]) << 8u) | (static_cast<uint64>(data[2u]) << 16u)
+                    | (static_cast<uint64>(data[3u]) << 24u) | (static_cast<uint64>(data[4u]) << 32u) | (static_cast<uint64>(data[5u]) << 40u)
+                    | (static_cast<uint64>(data[6u]) << 48u) | (static_cast<uint64>(data[7u]) << 56u);
+            block ^= crcValue;
+            crcValue = sliceTable[7u][block & 0xFFu] ^ sliceTable[6u][(block >> 8u) & 0xFFu] ^ sliceTable[5u][(block >> 16u) & 0xFFu]
+                    ^ sliceTable[4u][(block >> 24u) & 0xFFu] ^ sliceTable[3u][(block >> 32u) & 0xFFu] ^ sliceTable[2u][(block >> 40u) & 0xFFu]
+                    ^ sliceTable[1u][(block >> 48u) & 0xFFu] ^ sliceTable[0u][block >> 56u];
+            data = &data[CRC_HELPER_SLICES];
+            size -= CRC_HELPER_SLICES;
+        }
+        while (size > 0u) {
+            crcValue = (crcValue >> 8u) ^ sliceTable[0u][(crcValue ^ *data) & 0xFFu];
+            data = &data[1u];
+            size--;
+        }
+    }
+    else {
+        while (size >= CRC_HELPER_SLICES) {
+            uint64 block = (static_cast<uint64>(data[0u]) << 56u) | (static_cast<uint64>(data[1u]) << 48u) | (static_cast<uint64>(data[2u]) << 40u)
+                    | (static_cast<uint64>(data[3u]) << 32u) | (static_cast<uint64>(data[4u]) << 24u) | (static_cast<uint64>(data[5u]) << 16u)
+                    | (static_cast<uint64>(data[6u]) << 8u) | static_cast<uint64>(data[7u]);
+            block ^= (crcValue << (64u - width));
+            crcValue = sliceTable[7u][block >> 56u] ^ sliceTable[6u][(block >> 48u) & 0xFFu] ^ sliceTable[5u][(block >> 40u) & 0xFFu]
+                    ^ sliceTable[4u][(block >> 32u) & 0xFFu] ^ sliceTable[3u][(block >> 24u) & 0xFFu] ^ sliceTable[2u][(block >> 16u) & 0xFFu]
+                    ^ sliceTable[1u][(block >> 8u) & 0xFFu] ^ sliceTable[0u][block & 0xFFu];
+            data = &data[CRC_HELPER_SLICES];
+            size -= CRC_HELPER_SLICES;
+        }
+        while (size > 0u) {
+            crcValue = static_cast<T>(crcValue << 8u) ^ sliceTable[0u][((crcValue >> (width - 8u)) ^ *data) & 0xFFu];
+            data = &data[1u];
+            size--;
+        }
+    }
+    return static_cast<T>(crcValue);
+}
+
 }
 
 #endif /* SOURCE_COMPONENTS_GAMS_CRCGAM_CRCHELPERT_H_ */
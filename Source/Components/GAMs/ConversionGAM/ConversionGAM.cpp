@@ -501,6 +501,12 @@ bool ConversionGAM::Setup() {
                             REPORT_ERROR(ErrorManagement::ParametersError, "Gain set for conversion %d", idx);
                         }
                         conversionHelpers[idx]->LoadOffset(cdb);
+                        ret = conversionHelpers[idx]->SelectKernel(cdb);
+                        if (!ret) {
+                            REPORT_ERROR(ErrorManagement::InitialisationError, "Invalid Saturate or LookupTable for the signal %s", signalName.Buffer());
+                        }
+                    }
+                    if (ret) {
                         ret = cdb.MoveToAncestor(1u);
                     }
                 }
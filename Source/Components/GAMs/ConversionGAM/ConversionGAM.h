@@ -78,10 +78,21 @@ namespace MARTe {
  *             DataSource = "LCD"
  *             Type = int32
  *             Offset = 4
+ *             Saturate = 1 //Optional. See below.
+ *             LookupTable = 1 //Optional. See below.
  *         }
  *     }
  * }
  * </pre>
+ *
+ * The conversion kernel of each signal is selected in Setup:
+ *  - if the input and output types are the same, with no Gain and no Offset, the memory is copied;
+ *  - by default gain * input + offset is computed in the output type, in a loop which the compiler can vectorise;
+ *  - if Saturate = 1 (only for integer output types) gain * input + offset is computed in float64, truncated towards zero and
+ *    saturated to the output type range (instead of wrapping around);
+ *  - if LookupTable = 1 (only for 8 and 16 bit integer input types) the output for each of the 2^8 or 2^16 possible inputs is
+ *    computed once and Execute only reads the table. This is worthwhile when the conversion is expensive (e.g. with Saturate = 1);
+ *    note that a 16 bit table uses 65536 output values of memory.
  */
 class ConversionGAM: public GAM {
 public:
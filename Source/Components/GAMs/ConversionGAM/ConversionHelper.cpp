@@ -43,6 +43,7 @@ ConversionHelper::ConversionHelper(const void *  const inputMemoryIn, void * con
     outputMemory = outputMemoryIn;
     numberOfElements = 0u;
     numberOfSamples = 0u;
+    kernel = ConversionHelperKernelDirect;
 }
 
 /*lint -e{1540} inputMemoryIn and outputMemoryIn freed by the ConversionGAM */
@@ -73,4 +74,8 @@ void ConversionHelper::SetNumberOfSamples(const uint32 numberOfSamplesIn) {
 void* ConversionHelper::GetOutputMemory() {
     return outputMemory;
 }
+
+ConversionHelperKernel ConversionHelper::GetKernel() const {
+    return kernel;
+}
 }
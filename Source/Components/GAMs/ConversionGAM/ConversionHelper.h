@@ -37,6 +37,28 @@
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * @brief Conversion kernels selected by ConversionHelper::SelectKernel.
+ */
+typedef enum {
+    /**
+     * Same input and output type, unitary gain and null offset: the memory is copied.
+     */
+    ConversionHelperKernelCopy,
+    /**
+     * output = gain * input + offset, computed in the output type.
+     */
+    ConversionHelperKernelDirect,
+    /**
+     * output = gain * input + offset, computed in float64 and saturated to the output type range.
+     */
+    ConversionHelperKernelSaturate,
+    /**
+     * output = table[input], the table being precomputed with the direct or the saturating kernel.
+     */
+    ConversionHelperKernelLookupTable
+} ConversionHelperKernel;
+
 /**
  * @brief Support class for the ConversionGAM. One instance for each input signal is to be allocated.
  * @details This class is responsible for converting all the input signal elements/samples to the corresponding
@@ -77,6 +99,22 @@ public:
      */
     virtual void LoadOffset(StructuredDataI &data) = 0;
 
+    /**
+     * @brief Reads the Saturate and LookupTable parameters and selects the conversion kernel used by Convert.
+     * @details Saturate = 1 is only allowed for integer output types. LookupTable = 1 is only allowed for 8 and 16 bit integer input types.
+     * @param data where to read the parameters.
+     * @return true if the parameters are valid for the input and output types.
+     * @pre
+     *   LoadGain() && LoadOffset()
+     */
+    virtual bool SelectKernel(StructuredDataI &data) = 0;
+
+    /**
+     * @brief Gets the kernel selected by SelectKernel.
+     * @return the kernel selected by SelectKernel (ConversionHelperKernelDirect if SelectKernel was not called).
+     */
+    ConversionHelperKernel GetKernel() const;
+
     /**
      * @brief Gets a pointer to input signal memory.
      * @return a pointer to input signal memory.
@@ -134,6 +172,11 @@ protected:
      */
     void *outputMemory;
 
+    /**
+     * The kernel used by Convert.
+     */
+    ConversionHelperKernel kernel;
+
     /*lint -e{1712} This class does not have a default constructor because
      * the inputMemory and the outputMemory must be defined on construction and both remain constant
      * during the object's lifetime*/
@@ -31,13 +31,20 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
-#include "StructuredDataI.h"
+#include "AdvancedErrorManagement.h"
 #include "ConversionHelper.h"
+#include "MemoryOperationsHelper.h"
+#include "StructuredDataI.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
+/**
+ * Number of values converted in each block by the direct kernel.
+ */
+static const uint32 CONVERSION_HELPER_BLOCK_SIZE = 8u;
+
 /**
  * @brief Support class for the ConversionGAM. One instance for each input signal is to be allocated.
  */
@@ -60,6 +67,7 @@ public:
     /**
      * @see ConversionHelper::Convert.
      * @details Converts for the declared type names. A cast to the declared inputType and outputType is performed and the signals are copied.
+     * All the samples and elements are converted in a single flat loop, with the kernel selected by SelectKernel.
      */
     virtual void Convert();
 
@@ -73,7 +81,49 @@ public:
      */
     virtual void LoadOffset(StructuredDataI &data);
 
+    /**
+     * @see ConversionHelper::SelectKernel.
+     * @details With Saturate = 1 the gain and the offset are read again as float64, so that they are not truncated for integer output types,
+     * and the result is truncated towards zero and saturated to the output type range (NaN is converted to 0).
+     * With LookupTable = 1 a table with 2^8 or 2^16 output values is computed, once, with the direct or with the saturating kernel.
+     */
+    virtual bool SelectKernel(StructuredDataI &data);
+
 private:
+
+    /**
+     * @brief Computes dest[i] = gain * src[i] + offset in the outputType.
+     */
+    void ConvertDirect(const inputType * const src,
+                       outputType * const dest,
+                       const uint32 numberOfValues) const;
+
+    /**
+     * @brief Computes dest[i] = gain * src[i] + offset in float64 and saturates the result to the outputType range.
+     */
+    void ConvertSaturate(const inputType * const src,
+                         outputType * const dest,
+                         const uint32 numberOfValues) const;
+
+    /**
+     * @brief Computes dest[i] = lookupTable[src[i]].
+     */
+    void ConvertLookupTable(const inputType * const src,
+                            outputType * const dest,
+                            const uint32 numberOfValues) const;
+
+    /**
+     * @brief Returns true if T is a floating point type.
+     */
+    template<typename T>
+    static bool IsFloat();
+
+    /**
+     * @brief Returns true if T is a signed type.
+     */
+    template<typename T>
+    static bool IsSigned();
+
     /**
      * True if the Gain parameter was defined.
      */
@@ -87,6 +137,29 @@ private:
      * The offset that is sum to the input signal.
      */
     outputType offset;
+
+    /**
+     * The gain and the offset used by the saturating kernel.
+     */
+    float64 saturationGain;
+    float64 saturationOffset;
+
+    /**
+     * The values (as float64) from which the output saturates to the maximum and to the minimum.
+     */
+    float64 upperLimit;
+    float64 lowerLimit;
+
+    /**
+     * The maximum and minimum values of the outputType.
+     */
+    outputType maxValue;
+    outputType minValue;
+
+    /**
+     * The lookup table (2^(8 * sizeof(inputType)) values), indexed by the input bit pattern.
+     */
+    outputType *lookupTable;
     /*lint -e{1712} This class does not have a default constructor because
      * the inputMemory and the outputMemory must be defined on construction and both remain constant
      * during the object's lifetime*/
@@ -104,11 +177,20 @@ ConversionHelperT<inputType, outputType>::ConversionHelperT(const void *const in
     /*lint -e{9117} [MISRA C++ Rule 5-0-4]. Justification: the type of the gain will depend on the outputType.*/
     gain = static_cast<outputType>(1.0);
     offset = static_cast<outputType>(0.0);
+    saturationGain = 1.0;
+    saturationOffset = 0.0;
+    upperLimit = 0.0;
+    lowerLimit = 0.0;
+    maxValue = static_cast<outputType>(0);
+    minValue = static_cast<outputType>(0);
+    lookupTable = NULL_PTR(outputType *);
 }
 
 template<typename inputType, typename outputType>
 ConversionHelperT<inputType, outputType>::~ConversionHelperT() {
-
+    if (lookupTable != NULL_PTR(outputType *)) {
+        delete[] lookupTable;
+    }
 }
 
 template<typename inputType, typename outputType>
@@ -128,21 +210,211 @@ void ConversionHelperT<inputType, outputType>::LoadOffset(StructuredDataI &data)
     }
 }
 
+template<typename inputType, typename outputType>
+template<typename T>
+bool ConversionHelperT<inputType, outputType>::IsFloat() {
+    /*lint -e{9117} -e{777} [MISRA C++ Rule 5-0-4]. Justification: the truncation is what is being tested.*/
+    return (static_cast<T>(0.5) != static_cast<T>(0));
+}
+
+template<typename inputType, typename outputType>
+template<typename T>
+bool ConversionHelperT<inputType, outputType>::IsSigned() {
+    /*lint -e{9117} -e{568} [MISRA C++ Rule 5-0-4]. Justification: the sign is what is being tested.*/
+    return (static_cast<T>(-1) < static_cast<T>(0));
+}
+
+template<typename inputType, typename outputType>
+bool ConversionHelperT<inputType, outputType>::SelectKernel(StructuredDataI &data) {
+    uint32 saturate = 0u;
+    uint32 useLookupTable = 0u;
+    if (!data.Read("Saturate", saturate)) {
+        saturate = 0u;
+    }
+    if (!data.Read("LookupTable", useLookupTable)) {
+        useLookupTable = 0u;
+    }
+    bool ok = true;
+    if (saturate == 1u) {
+        ok = !IsFloat<outputType>();
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Saturate is only supported for integer output types");
+        }
+        if (ok) {
+            if (!data.Read("Gain", saturationGain)) {
+                saturationGain = 1.0;
+            }
+            if (!data.Read("Offset", saturationOffset)) {
+                saturationOffset = 0.0;
+            }
+            uint32 numberOfBits = static_cast<uint32>(sizeof(outputType)) * 8u;
+            float64 halfRange = 1.0;
+            uint32 b;
+            for (b = 1u; b < numberOfBits; b++) {
+                halfRange *= 2.0;
+            }
+            if (IsSigned<outputType>()) {
+                upperLimit = halfRange;
+                lowerLimit = -halfRange - 1.0;
+                /*lint -e{9117} -e{569} Justification: the bit pattern of the maximum and minimum values is being built.*/
+                maxValue = static_cast<outputType>(~(static_cast<uint64>(1u) << (numberOfBits - 1u)));
+                /*lint -e{9117} -e{569} Justification: the bit pattern of the maximum and minimum values is being built.*/
+                minValue = static_cast<outputType>(static_cast<uint64>(1u) << (numberOfBits - 1u));
+            }
+            else {
+                upperLimit = 2.0 * halfRange;
+                lowerLimit = -1.0;
+                /*lint -e{9117} -e{569} Justification: the bit pattern of the maximum value is being built.*/
+                maxValue = static_cast<outputType>(~static_cast<uint64>(0u));
+                minValue = static_cast<outputType>(0);
+            }
+            kernel = ConversionHelperKernelSaturate;
+        }
+    }
+    else {
+        bool sameType = (sizeof(inputType) == sizeof(outputType));
+        if (sameType) {
+            sameType = ((IsFloat<inputType>() == IsFloat<outputType>()) && (IsSigned<inputType>() == IsSigned<outputType>()));
+        }
+        /*lint -e{777} -e{9137} the gain and the offset are compared with the exact default values.*/
+        if ((sameType) && (gain == static_cast<outputType>(1.0)) && (offset == static_cast<outputType>(0.0))) {
+            kernel = ConversionHelperKernelCopy;
+        }
+        else {
+            kernel = ConversionHelperKernelDirect;
+        }
+    }
+    if ((ok) && (useLookupTable == 1u)) {
+        ok = ((!IsFloat<inputType>()) && (sizeof(inputType) <= 2u));
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "LookupTable is only supported for 8 and 16 bit integer input types");
+        }
+        if (ok) {
+            uint32 tableSize = (sizeof(inputType) == 1u) ? 256u : 65536u;
+            /* Table input with all the possible bit patterns */
+            inputType *tableInput = new inputType[tableSize];
+            uint32 i;
+            for (i = 0u; i < tableSize; i++) {
+                if (sizeof(inputType) == 1u) {
+                    reinterpret_cast<uint8 *>(tableInput)[i] = static_cast<uint8>(i);
+                }
+                else {
+                    reinterpret_cast<uint16 *>(tableInput)[i] = static_cast<uint16>(i);
+                }
+            }
+            lookupTable = new outputType[tableSize];
+            if (kernel == ConversionHelperKernelSaturate) {
+                ConvertSaturate(tableInput, lookupTable, tableSize);
+            }
+            else {
+                ConvertDirect(tableInput, lookupTable, tableSize);
+            }
+            delete[] tableInput;
+            kernel = ConversionHelperKernelLookupTable;
+        }
+    }
+    return ok;
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertDirect(const inputType * const src,
+                                                             outputType * const dest,
+                                                             const uint32 numberOfValues) const {
+    /* Local copies, so that the stores to dest cannot alias the gain and the offset.
+     * The values are converted in blocks of CONVERSION_HELPER_BLOCK_SIZE, which are computed before being stored,
+     * so that the compiler can vectorise each block without having to prove that src and dest do not overlap. */
+    const outputType g = gain;
+    const outputType o = offset;
+    const uint32 blockEnd = numberOfValues - (numberOfValues % CONVERSION_HELPER_BLOCK_SIZE);
+    outputType block[CONVERSION_HELPER_BLOCK_SIZE];
+    uint32 i = 0u;
+    uint32 j;
+    while (i < blockEnd) {
+        for (j = 0u; j < CONVERSION_HELPER_BLOCK_SIZE; j++) {
+            /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+            block[j] = (g * static_cast<outputType>(src[i + j])) + o;
+        }
+        for (j = 0u; j < CONVERSION_HELPER_BLOCK_SIZE; j++) {
+            dest[i + j] = block[j];
+        }
+        i += CONVERSION_HELPER_BLOCK_SIZE;
+    }
+    while (i < numberOfValues) {
+        /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+        dest[i] = (g * static_cast<outputType>(src[i])) + o;
+        i++;
+    }
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertSaturate(const inputType * const src,
+                                                               outputType * const dest,
+                                                               const uint32 numberOfValues) const {
+    const float64 g = saturationGain;
+    const float64 o = saturationOffset;
+    const float64 upper = upperLimit;
+    const float64 lower = lowerLimit;
+    const outputType maxV = maxValue;
+    const outputType minV = minValue;
+    uint32 i;
+    for (i = 0u; i < numberOfValues; i++) {
+        float64 value = (g * static_cast<float64>(src[i])) + o;
+        outputType result;
+        if (value >= upper) {
+            result = maxV;
+        }
+        else if (value <= lower) {
+            result = minV;
+        }
+        /*lint -e{777} NaN is the only value which is not equal to itself.*/
+        else if (value != value) {
+            result = static_cast<outputType>(0);
+        }
+        else {
+            /*lint -e{9117} -e{922} the value is within the outputType range.*/
+            result = static_cast<outputType>(value);
+        }
+        dest[i] = result;
+    }
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::ConvertLookupTable(const inputType * const src,
+                                                                  outputType * const dest,
+                                                                  const uint32 numberOfValues) const {
+    const outputType * const table = lookupTable;
+    uint32 i;
+    if (sizeof(inputType) == 1u) {
+        const uint8 * const index = reinterpret_cast<const uint8 *>(src);
+        for (i = 0u; i < numberOfValues; i++) {
+            dest[i] = table[index[i]];
+        }
+    }
+    else {
+        const uint16 * const index = reinterpret_cast<const uint16 *>(src);
+        for (i = 0u; i < numberOfValues; i++) {
+            dest[i] = table[index[i]];
+        }
+    }
+}
+
 template<typename inputType, typename outputType>
 void ConversionHelperT<inputType, outputType>::Convert() {
-    uint32 s;
-    uint32 n;
-    uint32 idx;
     outputType *dest = reinterpret_cast<outputType*>(outputMemory);
     const inputType *src = reinterpret_cast<const inputType*>(inputMemory);
     if ((dest != NULL) && (src != NULL)) {
-        for (s = 0u; s < numberOfSamples; s++) {
-            for (n = 0u; n < numberOfElements; n++) {
-                idx = s * numberOfElements;
-                idx += n;
-                /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
-                dest[idx] = (gain * static_cast<outputType>(src[idx])) + offset;
-            }
+        const uint32 numberOfValues = numberOfSamples * numberOfElements;
+        if (kernel == ConversionHelperKernelCopy) {
+            (void) MemoryOperationsHelper::Copy(dest, src, numberOfValues * static_cast<uint32>(sizeof(outputType)));
+        }
+        else if (kernel == ConversionHelperKernelLookupTable) {
+            ConvertLookupTable(src, dest, numberOfValues);
+        }
+        else if (kernel == ConversionHelperKernelSaturate) {
+            ConvertSaturate(src, dest, numberOfValues);
+        }
+        else {
+            ConvertDirect(src, dest, numberOfValues);
         }
     }
 }
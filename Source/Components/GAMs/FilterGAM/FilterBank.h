@@ -0,0 +1,79 @@
+/**
+ * @file FilterBank.h
+ * @brief Header file for class FilterBank
+ * @date 18/10/2026
+ * @author Llorenc Capella
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FilterBank
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILTERGAM_FILTERBANK_H_
+#define FILTERGAM_FILTERBANK_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Interface for FilterBankT
+ * @details A filter bank applies the same filter coefficients to several channels in one call. The only functions implemented in this class are
+ * the FilterBank constructor, GetNumberOfNumCoeff(), GetNumberOfDenCoeff() and GetNumberOfChannels(). The rest are pure virtual functions implemented in the FilterBankT.
+ * This class is not meant to be instantiated.
+ */
+//lint -e{1526} Member function not defined. It is defined in FilterBank.cpp ...
+class FilterBank {
+public:
+    //lint -e{1526} Member function not defined. It is defined in FilterBank.cpp ...
+    FilterBank();
+    virtual ~FilterBank();
+    virtual bool Initialise(const void *const numIn,
+                            const uint32 nOfNumCoeffIn,
+                            const void *const denIn,
+                            const uint32 nOfDenCoeffIn,
+                            const uint32 nOfChannelsIn) = 0;
+    virtual void Process(void *const *const input,
+                         void *const *const output,
+                         const uint32 nOfElements) = 0;
+    virtual bool Reset() = 0;
+    //lint -e{1526} Member function not defined. It is defined in FilterBank.cpp ...
+    virtual uint32 GetNumberOfNumCoeff();
+    //lint -e{1526} Member function not defined. It is defined in FilterBank.cpp ...
+    virtual uint32 GetNumberOfDenCoeff();
+    //lint -e{1526} Member function not defined. It is defined in FilterBank.cpp ...
+    virtual uint32 GetNumberOfChannels();
+protected:
+    uint32 nOfNumCoeff;
+    uint32 nOfDenCoeff;
+    uint32 nOfChannels;
+};
+
+}
+#endif /* SOURCE_COMPONENTS_GAMS_FILTERGAM_FILTERBANK_H_ */
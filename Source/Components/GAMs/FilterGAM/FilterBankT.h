@@ -0,0 +1,288 @@
+/**
+ * @file FilterBankT.h
+ * @brief Header file for class FilterBankT
+ * @date 18/10/2026
+ * @author Llorenc Capella
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FilterBankT
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILTERGAM_FILTERBANKT_H_
+#define FILTERGAM_FILTERBANKT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "FilterBank.h"
+#include "AdvancedErrorManagement.h"
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+//lint -esym(9107, MARTe::FilterBankT*) [MISRA C++ Rule 3-1-1] required for template implementation
+/**
+ * @brief Block implementation of a bank of filters sharing the same coefficients.
+ * @details Computes, for each channel c, the same difference equation as the FilterT:
+ *
+ * \f$
+ * y_c[n] = \sum_{k=0}^{M-1}num[k]*x_c[n-k]-\sum_{k=1}^{N-1}den[k]*y_c[n-k]
+ * \f$
+ *
+ * The last input/output values are stored channel-interleaved (one row of nOfChannels values per delay) in circular
+ * buffers, so that no memory is shifted when a new sample arrives; only the head index of the buffer moves. For each
+ * coefficient the inner loop runs over the contiguous channel row, which the compiler vectorises for the floating point types.
+ * The coefficients are applied in the same order as in the FilterT, so that both implementations produce the same output.
+ *
+ * Typical use of this class:
+ *     - Initialise()
+ *     - Process()
+ */
+template<class T>
+class FilterBankT: public FilterBank {
+public:
+    /**
+     * @brief Default constructor
+     * @details null all the pointers and set to false all the internal booleans
+     */
+    FilterBankT();
+
+    /**
+     * @brief default destructor
+     * @details frees all the memory allocated by this class and null the pointers.
+     */
+    virtual ~FilterBankT();
+
+    /**
+     * @brief Initialise the filter bank based on the coefficients of the filter.
+     * @details Allocate memory for the coefficients and last input/output states of all the channels and zero the last values.
+     * @param[in] numIn array of the numerator coefficients.
+     * @param[in] nOfNumCoeffIn number of numerator elements.
+     * @param[in] denIn array of the denominator coefficients (den[0] must be 1).
+     * @param[in] nOfDenCoeffIn number of denominator elements.
+     * @param[in] nOfChannelsIn number of channels filtered with the same coefficients.
+     */
+    virtual bool Initialise(const void *const numIn,
+                            const uint32 nOfNumCoeffIn,
+                            const void *const denIn,
+                            const uint32 nOfDenCoeffIn,
+                            const uint32 nOfChannelsIn);
+
+    /**
+     * @brief Zero the last input/output states of all the channels.
+     */
+    virtual bool Reset();
+
+    /**
+     * @brief Applies the filter to all the channels.
+     * @param[in] input array of nOfChannels pointers to the input arrays.
+     * @param[out] output array of nOfChannels pointers to the output arrays.
+     * @param[in] nOfElements the number of elements of each input (and output) array.
+     * @pre
+     *    Initialise succeed.
+     */
+    virtual void Process(void *const *const input,
+                         void *const *const output,
+                         const uint32 nOfElements);
+
+private:
+
+    /**
+     * Pointer to the numerator coefficients.
+     */
+    T *num;
+
+    /**
+     * Pointer to the denominator coefficients
+     */
+    T *den;
+
+    /**
+     * Circular buffer with nOfNumCoeff rows of nOfChannels last input values.
+     */
+    T *lastInputs;
+
+    /**
+     * Circular buffer with nOfDenCoeff rows of nOfChannels last output values.
+     */
+    T *lastOutputs;
+
+    /**
+     * Row of lastInputs holding x[n]. The row (inputHead + k) % nOfNumCoeff holds x[n-k].
+     */
+    uint32 inputHead;
+
+    /**
+     * Row of lastOutputs holding y[n]. The row (outputHead + k) % nOfDenCoeff holds y[n-k].
+     */
+    uint32 outputHead;
+
+    /**
+     * Indicates if the filter bank is initialised.
+     */
+    bool isInitialised;
+};
+
+template<class T>
+FilterBankT<T>::FilterBankT() :
+        FilterBank() {
+    num = NULL_PTR(T*);
+    den = NULL_PTR(T*);
+    lastInputs = NULL_PTR(T*);
+    lastOutputs = NULL_PTR(T*);
+    inputHead = 0u;
+    outputHead = 0u;
+    isInitialised = false;
+}
+
+template<class T>
+FilterBankT<T>::~FilterBankT() {
+    if (lastInputs != NULL_PTR(T*)) {
+        delete[] lastInputs;
+    }
+    if (lastOutputs != NULL_PTR(T*)) {
+        delete[] lastOutputs;
+    }
+    if (num != NULL_PTR(T*)) {
+        delete[] num;
+    }
+    if (den != NULL_PTR(T*)) {
+        delete[] den;
+    }
+}
+
+template<class T>
+bool FilterBankT<T>::Initialise(const void *const numIn,
+                                const uint32 nOfNumCoeffIn,
+                                const void *const denIn,
+                                const uint32 nOfDenCoeffIn,
+                                const uint32 nOfChannelsIn) {
+    bool ok = (numIn != NULL_PTR(void*)) && (denIn != NULL_PTR(void*));
+    if (ok) {
+        ok = (nOfNumCoeffIn > 0u) && (nOfDenCoeffIn > 0u) && (nOfChannelsIn > 0u);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The number of coefficients and the number of channels must be > 0");
+        }
+    }
+    if (ok) {
+        ok = !isInitialised;
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The filter bank is already initialised");
+        }
+    }
+    if (ok) {
+        nOfNumCoeff = nOfNumCoeffIn;
+        nOfDenCoeff = nOfDenCoeffIn;
+        nOfChannels = nOfChannelsIn;
+        num = new T[nOfNumCoeff];
+        den = new T[nOfDenCoeff];
+        ok = MemoryOperationsHelper::Copy(reinterpret_cast<void*>(num), numIn, static_cast<uint32>(sizeof(T)) * nOfNumCoeff);
+        if (ok) {
+            ok = MemoryOperationsHelper::Copy(reinterpret_cast<void*>(den), denIn, static_cast<uint32>(sizeof(T)) * nOfDenCoeff);
+        }
+    }
+    if (ok) {
+        lastInputs = new T[nOfNumCoeff * nOfChannels];
+        lastOutputs = new T[nOfDenCoeff * nOfChannels];
+        ok = (lastInputs != NULL_PTR(T*)) && (lastOutputs != NULL_PTR(T*));
+    }
+    if (ok) {
+        ok = Reset();
+    }
+    if (ok) {
+        isInitialised = ok;
+    }
+    return ok;
+}
+
+template<class T>
+bool FilterBankT<T>::Reset() {
+    bool ok = (lastInputs != NULL_PTR(T*)) && (lastOutputs != NULL_PTR(T*));
+    if (ok) {
+        ok = MemoryOperationsHelper::Set(lastInputs, static_cast<char8>(0), static_cast<uint32>(sizeof(T)) * nOfNumCoeff * nOfChannels);
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(lastOutputs, static_cast<char8>(0), static_cast<uint32>(sizeof(T)) * nOfDenCoeff * nOfChannels);
+        }
+        inputHead = 0u;
+        outputHead = 0u;
+    }
+    return ok;
+}
+
+template<class T>
+//lint -e{613} Possible use of null pointer --> Process cannot be called if initialised does not succeed.
+void FilterBankT<T>::Process(void *const *const input,
+                             void *const *const output,
+                             const uint32 nOfElements) {
+    for (uint32 elIdx = 0u; elIdx < nOfElements; elIdx++) {
+        //Move the heads backwards so that the previous x[n] becomes x[n-1]. The oldest row is overwritten.
+        if (inputHead == 0u) {
+            inputHead = nOfNumCoeff;
+        }
+        inputHead--;
+        if (outputHead == 0u) {
+            outputHead = nOfDenCoeff;
+        }
+        outputHead--;
+        T *const xRow = &lastInputs[inputHead * nOfChannels];
+        T *const yRow = &lastOutputs[outputHead * nOfChannels];
+        for (uint32 c = 0u; c < nOfChannels; c++) {
+            xRow[c] = reinterpret_cast<T*>(input[c])[elIdx];
+            yRow[c] = static_cast<T>(0);
+        }
+        //Same accumulation order as the FilterT (from the oldest to the newest value).
+        //lint -e{661} Possible access of out-of-bounds pointer. The row index is always wrapped to nOfNumCoeff.
+        for (uint32 i = nOfNumCoeff; i > 0u; i--) {
+            uint32 row = (inputHead + i) - 1u;
+            if (row >= nOfNumCoeff) {
+                row -= nOfNumCoeff;
+            }
+            const T coeff = num[i - 1u];
+            const T *const xOld = &lastInputs[row * nOfChannels];
+            for (uint32 c = 0u; c < nOfChannels; c++) {
+                yRow[c] += xOld[c] * coeff;
+            }
+        }
+        //lint -e{661} Possible access of out-of-bounds pointer. The row index is always wrapped to nOfDenCoeff.
+        for (uint32 i = nOfDenCoeff - 1u; i > 0u; i--) {
+            uint32 row = outputHead + i;
+            if (row >= nOfDenCoeff) {
+                row -= nOfDenCoeff;
+            }
+            const T coeff = den[i];
+            const T *const yOld = &lastOutputs[row * nOfChannels];
+            for (uint32 c = 0u; c < nOfChannels; c++) {
+                yRow[c] -= yOld[c] * coeff;
+            }
+        }
+        for (uint32 c = 0u; c < nOfChannels; c++) {
+            reinterpret_cast<T*>(output[c])[elIdx] = yRow[c];
+        }
+    }
+}
+
+}
+#endif /* FILTERGAM_FILTERBANKT_H_ */
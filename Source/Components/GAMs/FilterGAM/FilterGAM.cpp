@@ -46,6 +46,8 @@ FilterGAM::FilterGAM() :
         GAM() {
     filterRef = NULL_PTR(Filter*);
     filters = NULL_PTR(Filter**);
+    filterBank = NULL_PTR(FilterBank*);
+    blockMode = false;
 //    staticGain = 0.0F;
     nOfSamples = 0u;
     output = NULL_PTR(void**);
@@ -111,6 +113,11 @@ FilterGAM::~FilterGAM() {
         delete[] filters;
         filters = NULL_PTR(Filter**);
     }
+    if (filterBank != NULL_PTR(FilterBank*)) {
+        //lint -e{1551} Function may throw exception. No exceptions are managed
+        delete filterBank;
+        filterBank = NULL_PTR(FilterBank*);
+    }
 }
 
 bool FilterGAM::Initialise(StructuredDataI &data) {
@@ -338,6 +345,22 @@ bool FilterGAM::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if (ok) {
+        StreamString processingMode;
+        if (data.Read("ProcessingMode", processingMode)) {
+            if (processingMode == "Block") {
+                blockMode = true;
+            }
+            else if (processingMode == "Signal") {
+                blockMode = false;
+            }
+            else {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for ProcessingMode = %s (expected values Signal or Block)",
+                             processingMode.Buffer());
+            }
+        }
+    }
     if (ok) {
         isInitialised = true;
     }
@@ -345,6 +368,29 @@ bool FilterGAM::Initialise(StructuredDataI &data) {
     return ok;
 }
 
+template<class T>
+bool FilterGAM::InitialiseFilterBank() {
+    //lint -e{613} Possible use of null pointer. Not possible. Only called from Setup() after a successful Initialise().
+    uint32 auxNOfNumCoeff = filterRef->GetNumberOfNumCoeff();
+    //lint -e{613} Possible use of null pointer. Not possible. Only called from Setup() after a successful Initialise().
+    uint32 auxNOfDenCoeff = filterRef->GetNumberOfDenCoeff();
+    filterBank = new FilterBankT<T>();
+    T *auxNum = new T[auxNOfNumCoeff];
+    T *auxDen = new T[auxNOfDenCoeff];
+    //lint -e{613} Possible use of null pointer. Not possible. Only called from Setup() after a successful Initialise().
+    bool ok = filterRef->GetNumCoeff(auxNum);
+    if (ok) {
+        //lint -e{613} Possible use of null pointer. Not possible. Only called from Setup() after a successful Initialise().
+        ok = filterRef->GetDenCoeff(auxDen);
+    }
+    if (ok) {
+        ok = filterBank->Initialise(auxNum, auxNOfNumCoeff, auxDen, auxNOfDenCoeff, nOfSignals);
+    }
+    delete[] auxNum;
+    delete[] auxDen;
+    return ok;
+}
+
 bool FilterGAM::Setup() {
     nOfSignals = GetNumberOfInputSignals();
     bool ok = nOfSignals > 0u;
@@ -359,8 +405,32 @@ bool FilterGAM::Setup() {
             REPORT_ERROR(ErrorManagement::ParametersError, "numberOfOutputSignals = %u != %u = numberOfInputSignals", nOfOutputSignals, nOfSignals);
         }
     }
-//initialise all filters
-    if (ok) {
+//initialise the filter bank or all filters
+    if (ok && blockMode) {
+        if (filterType == SignedInteger32Bit) {
+            ok = InitialiseFilterBank<int32>();
+        }
+        else if (filterType == SignedInteger64Bit) {
+            ok = InitialiseFilterBank<int64>();
+        }
+        else if (filterType == Float32Bit) {
+            ok = InitialiseFilterBank<float32>();
+        }
+        else if (filterType == Float64Bit) {
+            ok = InitialiseFilterBank<float64>();
+        }
+        else { //Nothing to do. Misra rules..
+
+        }
+        if (ok) {
+            REPORT_ERROR(ErrorManagement::Information, "Block processing of %u signals with the %s filter bank", nOfSignals,
+                         TypeDescriptor::GetTypeNameFromTypeDescriptor(filterType));
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Failed to initialise the filter bank");
+        }
+    }
+    else if (ok) {
         filters = new Filter*[nOfSignals];
         //lint -e{613} Possible use of null pointer. Not possible. The initialisations is guaranteed by the if(ok)
         for (uint32 i = 0u; (i < nOfSignals) && ok; i++) {
@@ -632,10 +702,15 @@ bool FilterGAM::Setup() {
 
 //lint -e{613} Possible use of null pointer. Not possible Execute only called if initalise and setup succeeds.
 bool FilterGAM::Execute() {
-    for (uint32 sIdx = 0u; sIdx < nOfSignals; sIdx++) {
-        //for (uint32 elIdx = 0; elIdx < nOfSamples; elIdx++) {
-        filters[sIdx]->Process(input[sIdx], output[sIdx], nOfSamples);
-        //}
+    if (blockMode) {
+        filterBank->Process(input, output, nOfSamples);
+    }
+    else {
+        for (uint32 sIdx = 0u; sIdx < nOfSignals; sIdx++) {
+            //for (uint32 elIdx = 0; elIdx < nOfSamples; elIdx++) {
+            filters[sIdx]->Process(input[sIdx], output[sIdx], nOfSamples);
+            //}
+        }
     }
 //    uint32 n = 0u;
 //    float32 accumulator;
@@ -647,11 +722,24 @@ bool FilterGAM::Execute() {
 bool FilterGAM::GetResetInEachState() const {
     return resetInEachState;
 }
+
+bool FilterGAM::GetBlockMode() const {
+    return blockMode;
+}
 //lint -e{613} Possible use of null pointer. Not possible PrepareNextState only called if initalise and setup succeeds.
 bool FilterGAM::PrepareNextState(const char8 *const currentStateName,
                                  const char8 *const nextStateName) {
     bool ret = isInitialised && isSetup;
-    if (resetInEachState) {
+    if (blockMode && ret) {
+        //lint -e{9007} side effects on right hand of logical operator, ''||'' [MISRA C++ Rule 5-14-1]. The string comparison has not side effect
+        if (resetInEachState || (lastStateExecuted != currentStateName)) {
+            ret = filterBank->Reset();
+        }
+        if (!resetInEachState) {
+            lastStateExecuted = nextStateName;
+        }
+    }
+    else if (resetInEachState) {
         for (uint32 sIdx = 0u; (sIdx < nOfSignals) && ret; sIdx++) {
             ret = filters[sIdx]->Reset();
 //            if (lastInputs[i] != NULL_PTR(float32*)) {
@@ -35,6 +35,7 @@
 #include "GAM.h"
 #include "StructuredDataI.h"
 #include "FilterT.h"
+#include "FilterBankT.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
@@ -71,6 +72,11 @@ namespace MARTe {
  *
  * The filter can be reset (see PrepareNextState())
  *
+ * By default (ProcessingMode = Signal) each signal is filtered by its own FilterT, one signal after the other. With ProcessingMode = Block all the signals are
+ * filtered together by a FilterBankT of the signal type, selected in the Setup(). The FilterBankT keeps the last input/output values of all the signals in
+ * circular buffers (no shift of the last values for each new sample) and applies each coefficient to all the signals in a single loop, which the compiler
+ * vectorises for float32 and float64. The output is the same in both modes. The Block mode is meant for large banks of signals sharing the same filter.
+ *
  * Moreover the function offers the method StaticGain() in order to make available the real gain of the filter (after converting into appropriate type, only relevant for floating point).
  *
  * @pre The filter must be normalised (den[0] = 1).
@@ -85,6 +91,7 @@ namespace MARTe {
  *     Num = {0.5 0.5} //Compulsory. Filter numerator coefficient.
  *     Den = {1} //Compulsory. Filter denominator coefficient.
  *     ResetInEachState //Optional. If true the filter will be reset on each state change. Otherwise it will be reset only if the filter was not used in the previous state.
+ *     ProcessingMode = Signal //Optional. Signal (default): one FilterT for each signal. Block: one FilterBankT filtering all the signals.
  *     InputSignals = {
  *         InputSignal1 = { //Filter will be applied to each signal. The number of input and output signals must be the same.
  *             DataSource = "DDB1"
@@ -203,6 +210,12 @@ public:
      */
     bool GetResetInEachState() const;
 
+    /**
+     * @brief Queries if the signals are filtered in block (ProcessingMode = Block).
+     * @return true if ProcessingMode = Block.
+     */
+    bool GetBlockMode() const;
+
     /**
      * @brief Resets the lastInputs and lastOutputs if necessary.
      * @details The behaviour of this function can be configured in order to reset the filter every time
@@ -321,6 +334,16 @@ private:
      */
     Filter **filters;
 
+    /**
+     * Filter bank filtering all the input signals when blockMode = true. Otherwise NULL.
+     */
+    FilterBank *filterBank;
+
+    /**
+     * Indicates if the signals are filtered by the filterBank (ProcessingMode = Block) instead of one filter for each signal.
+     */
+    bool blockMode;
+
     /**
      * Holds the type of the filter. All inputs/outputs shall have the same type.
      */
@@ -370,6 +393,13 @@ private:
 
     /*allows to choose between reset the filter every time the state changes or only when in the previous state the filter was not executed. */
     bool resetInEachState;
+
+    /**
+     * @brief Allocates and initialises the filterBank for all the signals with the coefficients of the filterRef.
+     * @return true if the filterBank is initialised.
+     */
+    template<class T>
+    bool InitialiseFilterBank();
 };
 
 }
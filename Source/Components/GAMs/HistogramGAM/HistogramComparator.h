@@ -84,6 +84,34 @@ public:
      */
     virtual uint32 InRange(const void * const mem)=0;
 
+    /**
+     * @brief Replaces the uniform bins with the non-uniform bins delimited by \a edgesIn.
+     * @details The bin 0 counts the occurrences below edgesIn[0], the bin i counts the occurrences in
+     * [edgesIn[i-1], edgesIn[i]) and the last bin counts the occurrences above edgesIn[nEdgesIn-1].
+     * The lower and upper bounds are set to the first and the last edge.
+     * @param[in] edgesIn holds \a nEdgesIn values of the comparator type.
+     * @param[in] nEdgesIn the number of edges (i.e. the number of bins minus one).
+     * @return true if nEdgesIn > 1 and the edges are strictly increasing.
+     */
+    virtual bool SetEdges(const void * const edgesIn,
+                          const uint32 nEdgesIn)=0;
+
+    /**
+     * @brief Gets the number of edges set with SetEdges.
+     * @return the number of edges or 0 if the bins are uniform.
+     */
+    virtual uint32 GetNumberOfEdges()=0;
+
+    /**
+     * @brief Increments the bins of \a histogram for each of the \a nOccurrences values hold in \a mem.
+     * @param[in] mem holds the occurrence values, stored contiguously.
+     * @param[in] nOccurrences the number of occurrences hold in \a mem.
+     * @param[in,out] histogram the histogram to be incremented (GetNumberOfBins() elements).
+     */
+    virtual void AddOccurrences(const void * const mem,
+                                const uint32 nOccurrences,
+                                uint32 * const histogram)=0;
+
 };
 
 }
@@ -80,8 +80,47 @@ public:
      */
     virtual uint32 InRange(const void * const mem);
 
+    /**
+     * @see HistogramComparator::SetEdges()
+     */
+    virtual bool SetEdges(const void * const edgesIn,
+                          const uint32 nEdgesIn);
+
+    /**
+     * @see HistogramComparator::GetNumberOfEdges()
+     */
+    virtual uint32 GetNumberOfEdges();
+
+    /**
+     * @see HistogramComparator::AddOccurrences()
+     * @details The bin of each occurrence is computed by the same (inlined) Bin method used by InRange,
+     * so that a multi-sample signal costs a single virtual call.
+     */
+    virtual void AddOccurrences(const void * const mem,
+                                const uint32 nOccurrences,
+                                uint32 * const histogram);
+
 private:
 
+    /**
+     * @brief Computes the bin of \a value.
+     * @details Uniform bins are computed in O(1) as (value - minLim) / delta, corrected by at most one bin
+     * so that the result matches the bin bounds (minLim + i * delta) exactly. The values in range that fall beyond
+     * the last uniform bin bound (because of the truncation of delta) are counted in the last in-range bin.
+     * Non-uniform bins (see SetEdges) are found with a binary search of the edges.
+     * NaN values are counted in the bin 0.
+     * @param[in] value the occurrence value.
+     * @return the bin of \a value.
+     */
+    inline uint32 Bin(const T value) const;
+
+    /**
+     * @brief Computes the lower bound of the uniform bin \a i + 1, i.e. minLim + i * delta.
+     * @param[in] i the index of the in-range bin.
+     * @return the lower bound of the bin.
+     */
+    inline T BinLowerBound(const uint32 i) const;
+
     /**
      * The upper bound
      */
@@ -101,6 +140,16 @@ private:
      * The number of bins
      */
     uint32 nBins;
+
+    /**
+     * The non-uniform bin edges (NULL if the bins are uniform)
+     */
+    T *edges;
+
+    /**
+     * The number of edges
+     */
+    uint32 nEdges;
 };
 }
 
@@ -117,12 +166,16 @@ HistogramComparatorT<T>::HistogramComparatorT() :
     minLim = static_cast<T>(0);
     nBins = 3u;
     delta = static_cast<T>(0);
-
+    edges = NULL_PTR(T *);
+    nEdges = 0u;
 }
 
 template<typename T>
 HistogramComparatorT<T>::~HistogramComparatorT() {
-
+    if (edges != NULL_PTR(T *)) {
+        delete[] edges;
+        edges = NULL_PTR(T *);
+    }
 }
 
 template<typename T>
@@ -154,31 +207,104 @@ uint32 HistogramComparatorT<T>::GetNumberOfBins() {
 
 template<typename T>
 uint32 HistogramComparatorT<T>::InRange(const void* const mem) {
-
     const T* toCompare = reinterpret_cast<T*>(const_cast<void *>(mem));
+    return Bin(*toCompare);
+}
 
+template<typename T>
+bool HistogramComparatorT<T>::SetEdges(const void * const edgesIn,
+                                       const uint32 nEdgesIn) {
+    const T* edgesToSet = reinterpret_cast<T*>(const_cast<void *>(edgesIn));
+    bool ret = (nEdgesIn > 1u);
+    for (uint32 i = 1u; (i < nEdgesIn) && (ret); i++) {
+        ret = (edgesToSet[i - 1u] < edgesToSet[i]);
+    }
+    if (ret) {
+        if (edges != NULL_PTR(T *)) {
+            delete[] edges;
+        }
+        nEdges = nEdgesIn;
+        edges = new T[nEdges];
+        for (uint32 i = 0u; i < nEdges; i++) {
+            edges[i] = edgesToSet[i];
+        }
+        minLim = edges[0u];
+        maxLim = edges[nEdges - 1u];
+    }
+    return ret;
+}
+
+template<typename T>
+uint32 HistogramComparatorT<T>::GetNumberOfEdges() {
+    return nEdges;
+}
+
+template<typename T>
+void HistogramComparatorT<T>::AddOccurrences(const void * const mem,
+                                             const uint32 nOccurrences,
+                                             uint32 * const histogram) {
+    const T* values = reinterpret_cast<T*>(const_cast<void *>(mem));
+    for (uint32 i = 0u; i < nOccurrences; i++) {
+        histogram[Bin(values[i])]++;
+    }
+}
+
+template<typename T>
+T HistogramComparatorT<T>::BinLowerBound(const uint32 i) const {
+    /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
+    return (minLim + static_cast<T>(i * delta));
+}
+
+template<typename T>
+uint32 HistogramComparatorT<T>::Bin(const T value) const {
     uint32 ret = 0u;
-    if (*toCompare < minLim) {
+    //Written as a negated comparison so that NaN is also counted in the bin 0
+    if (!(value >= minLim)) {
         ret = 0u;
     }
-    else if (*toCompare >= maxLim) {
+    else if (value >= maxLim) {
         ret = (nBins - 1u);
     }
-    else {
-        //do the division with a
-        for (uint32 i = 0u; (i < (nBins - 2u)); i++) {
-            /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
-            T minRange = (minLim + static_cast<T>(i * delta));
-            /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
-            T maxRange = (minLim + static_cast<T>((i + 1u) * delta));
-            /*lint -e{737} -e{9117} -e{9125} Loss of precision is responsibility of the conversion requested by the user.*/
-            if (((*toCompare) >= (minRange)) && ((*toCompare) < maxRange)) {
-                ret = (i + 1u);
-                break;
+    else if (edges != NULL_PTR(T *)) {
+        //edges[0] <= value < edges[nEdges - 1] => the bin is the number of edges <= value
+        uint32 lo = 1u;
+        uint32 hi = (nEdges - 1u);
+        while (lo < hi) {
+            uint32 mid = ((lo + hi) / 2u);
+            if (value >= edges[mid]) {
+                lo = (mid + 1u);
+            }
+            else {
+                hi = mid;
             }
         }
+        ret = lo;
+    }
+    else if ((delta > static_cast<T>(0)) && (nBins > 2u)) {
+        uint32 last = (nBins - 3u);
+        /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
+        T offset = static_cast<T>(value - minLim);
+        T quotient = static_cast<T>(offset / delta);
+        //The comparisons in float64 also clamp the negative, infinite or NaN quotients of degenerate ranges
+        uint32 i = last;
+        float64 quotientF = static_cast<float64>(quotient);
+        if ((quotientF >= 0.0) && (quotientF < static_cast<float64>(last))) {
+            /*lint -e{9122} -e{922} the quotient is positive and lower than last*/
+            i = static_cast<uint32>(quotient);
+        }
+        //Correct the rounding of the quotient so that the bin matches the bin bounds exactly
+        while ((i > 0u) && (value < BinLowerBound(i))) {
+            i--;
+        }
+        while ((i < last) && (value >= BinLowerBound(i + 1u))) {
+            i++;
+        }
+        ret = (i + 1u);
+    }
+    else {
+        //Empty bins (delta truncated to zero)
+        ret = 0u;
     }
-
     return ret;
 }
 
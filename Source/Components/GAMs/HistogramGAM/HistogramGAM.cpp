@@ -31,7 +31,9 @@
 
 #include "AdvancedErrorManagement.h"
 #include "AnyType.h"
+#include "Atomic.h"
 #include "HistogramGAM.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -189,6 +191,12 @@ HistogramGAM::HistogramGAM() :
 
     beginCycle = 0u;
     cycleCounter = 0u;
+    multiSample = 0u;
+    numberOfOccurrences = NULL_PTR(uint32 *);
+    snapshots = NULL_PTR(uint32 **);
+    snapshotRequested = 0;
+    snapshotCounter = 0;
+    (void) snapshotMux.Create();
 }
 
 /*lint -e{1551} destructor does not throw any exception */
@@ -203,6 +211,20 @@ HistogramGAM::~HistogramGAM() {
         delete[] comps;
         comps = NULL_PTR(HistogramComparator **);
     }
+    if (numberOfOccurrences != NULL_PTR(uint32 *)) {
+        delete[] numberOfOccurrences;
+        numberOfOccurrences = NULL_PTR(uint32 *);
+    }
+    if (snapshots != NULL_PTR(uint32 **)) {
+        for (uint32 i = 0u; i < numberOfOutputSignals; i++) {
+            if (snapshots[i] != NULL_PTR(uint32 *)) {
+                delete[] snapshots[i];
+                snapshots[i] = NULL_PTR(uint32 *);
+            }
+        }
+        delete[] snapshots;
+        snapshots = NULL_PTR(uint32 **);
+    }
 }
 
 bool HistogramGAM::Initialise(StructuredDataI &data) {
@@ -212,6 +234,15 @@ bool HistogramGAM::Initialise(StructuredDataI &data) {
             beginCycle = 0u;
         }
     }
+    if (ret) {
+        if (!data.Read("MultiSample", multiSample)) {
+            multiSample = 0u;
+        }
+        ret = (multiSample <= 1u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "MultiSample shall be 0 or 1");
+        }
+    }
     if (ret) {
         stateChangeResetName = "";
         (void) data.Read("StateChangeResetName", stateChangeResetName);
@@ -228,18 +259,21 @@ bool HistogramGAM::Setup() {
 
     if (ret) {
         comps = new HistogramComparator *[numberOfInputSignals];
+        numberOfOccurrences = new uint32[numberOfInputSignals];
 
         for (uint32 i = 0u; (i < numberOfInputSignals); i++) {
             /*lint -e{613} the NULL pointer is checked before*/
             comps[i] = NULL_PTR(HistogramComparator *);
+            /*lint -e{613} the NULL pointer is checked before*/
+            numberOfOccurrences[i] = 1u;
         }
-        //check that the number of dimensions of the input signals is one
+        //check that the number of dimensions of the input signals is one (unless MultiSample is set)
         /*lint -e{850} the variable i does not change in the loop */
         for (uint32 i = 0u; (i < numberOfInputSignals) && (ret); i++) {
             uint32 numberOfElements;
             ret = GetSignalNumberOfElements(InputSignals, i, numberOfElements);
             if (ret) {
-                ret = (numberOfElements == 1u);
+                ret = ((numberOfElements == 1u) || (multiSample == 1u));
                 if (!ret) {
                     REPORT_ERROR(ErrorManagement::FatalError, "The input signal %d must have NumberOfElements=1", i);
                 }
@@ -248,11 +282,15 @@ bool HistogramGAM::Setup() {
                 uint32 numberOfSamples;
                 ret = GetSignalNumberOfSamples(InputSignals, i, numberOfSamples);
                 if (ret) {
-                    ret = (numberOfSamples == 1u);
+                    ret = ((numberOfSamples == 1u) || (multiSample == 1u));
                     if (!ret) {
                         REPORT_ERROR(ErrorManagement::FatalError, "The input signal %d must have NumberOfSamples=1", i);
                     }
                 }
+                if (ret) {
+                    /*lint -e{613} the NULL pointer is checked before*/
+                    numberOfOccurrences[i] = (numberOfElements * numberOfSamples);
+                }
             }
             if (ret) {
                 TypeDescriptor td = GetSignalType(InputSignals, i);
@@ -269,9 +307,32 @@ bool HistogramGAM::Setup() {
                     if (ret) {
                         ret = signalsDatabase.MoveToChild(i);
                     }
+                    uint32 tsize = static_cast<uint32>(td.numberOfBits);
+                    tsize /= 8u;
+                    AnyType edgesType;
                     if (ret) {
-                        uint32 tsize = static_cast<uint32>(td.numberOfBits);
-                        tsize /= 8u;
+                        edgesType = signalsDatabase.GetType("Edges");
+                    }
+                    if ((ret) && (!edgesType.IsVoid())) {
+                        uint32 nEdges = edgesType.GetNumberOfElements(0u);
+                        uint8* ptr = new uint8[tsize * nEdges];
+                        AnyType converted(td, 0u, ptr);
+                        converted.SetNumberOfDimensions(1u);
+                        converted.SetNumberOfElements(0u, nEdges);
+                        ret = signalsDatabase.Read("Edges", converted);
+                        if (ret) {
+                            /*lint -e{613} the NULL pointer is checked before*/
+                            ret = comps[i]->SetEdges(ptr, nEdges);
+                            if (!ret) {
+                                REPORT_ERROR(ErrorManagement::InitialisationError, "The Edges of input signal %d must be at least two and strictly increasing", i);
+                            }
+                        }
+                        else {
+                            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not read the Edges of input signal %d", i);
+                        }
+                        delete[] ptr;
+                    }
+                    else if (ret) {
                         uint8* ptr = new uint8[tsize];
                         AnyType converted(td, 0u, ptr);
 
@@ -316,6 +377,16 @@ bool HistogramGAM::Setup() {
                     comps[i]->SetNumberOfBins(numberOfElements);
                 }
             }
+            if (ret) {
+                /*lint -e{613} the NULL pointer is checked before*/
+                uint32 nEdges = comps[i]->GetNumberOfEdges();
+                if (nEdges > 0u) {
+                    ret = (numberOfElements == (nEdges + 1u));
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "The output signal %d must have NumberOfElements=%d (number of Edges + 1)", i, (nEdges + 1u));
+                    }
+                }
+            }
             if (ret) {
                 TypeDescriptor td = GetSignalType(OutputSignals, i);
                 ret = (td == UnsignedInteger32Bit);
@@ -324,6 +395,17 @@ bool HistogramGAM::Setup() {
                 }
             }
         }
+        if (ret) {
+            snapshots = new uint32 *[numberOfOutputSignals];
+            for (uint32 i = 0u; i < numberOfOutputSignals; i++) {
+                /*lint -e{613} the NULL pointer is checked before*/
+                uint32 nBins = comps[i]->GetNumberOfBins();
+                snapshots[i] = new uint32[nBins];
+                for (uint32 j = 0u; j < nBins; j++) {
+                    snapshots[i][j] = 0u;
+                }
+            }
+        }
 
     }
     else {
@@ -359,14 +441,61 @@ bool HistogramGAM::Execute() {
         for (uint32 i = 0u; i < numberOfInputSignals; i++) {
             uint32 *outputSignal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(i));
             /*lint -e{613} the NULL pointer is checked before*/
-            uint32 index = comps[i]->InRange(GetInputSignalMemory(i));
-            outputSignal[index]++;
+            comps[i]->AddOccurrences(GetInputSignalMemory(i), numberOfOccurrences[i], outputSignal);
         }
     }
     else {
         cycleCounter++;
     }
+    if (snapshotRequested != 0) {
+        //Never wait for a reader: if GetSnapshot is copying, the snapshot is taken in the next cycle
+        if (snapshotMux.FastTryLock()) {
+            for (uint32 i = 0u; i < numberOfOutputSignals; i++) {
+                /*lint -e{613} the NULL pointer is checked before*/
+                uint32 nBins = comps[i]->GetNumberOfBins();
+                /*lint -e{613} the NULL pointer is checked before*/
+                (void) MemoryOperationsHelper::Copy(snapshots[i], GetOutputSignalMemory(i), static_cast<uint32>(nBins * static_cast<uint32>(sizeof(uint32))));
+            }
+            Atomic::Increment(&snapshotCounter);
+            (void) Atomic::Exchange(&snapshotRequested, 0);
+            snapshotMux.FastUnLock();
+        }
+    }
     return true;
 }
+
+void HistogramGAM::RequestSnapshot() {
+    (void) Atomic::Exchange(&snapshotRequested, 1);
+}
+
+bool HistogramGAM::IsSnapshotPending() const {
+    return (snapshotRequested != 0);
+}
+
+uint32 HistogramGAM::GetSnapshotCounter() const {
+    return static_cast<uint32>(snapshotCounter);
+}
+
+bool HistogramGAM::GetSnapshot(const uint32 signalIdx,
+                               uint32 * const histogram,
+                               const uint32 nBins) {
+    bool ret = (snapshots != NULL_PTR(uint32 **));
+    if (ret) {
+        ret = (signalIdx < numberOfOutputSignals);
+    }
+    if (ret) {
+        /*lint -e{613} the NULL pointer is checked before*/
+        ret = (nBins == comps[signalIdx]->GetNumberOfBins());
+    }
+    if (ret) {
+        ret = (snapshotMux.FastLock() == ErrorManagement::NoError);
+        if (ret) {
+            /*lint -e{613} the NULL pointer is checked before*/
+            ret = MemoryOperationsHelper::Copy(histogram, snapshots[signalIdx], static_cast<uint32>(nBins * static_cast<uint32>(sizeof(uint32))));
+            snapshotMux.FastUnLock();
+        }
+    }
+    return ret;
+}
 CLASS_REGISTER(HistogramGAM, "1.0")
 }
@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "FastPollingMutexSem.h"
 #include "GAM.h"
 #include "HistogramComparatorT.h"
 #include "TypeDescriptor.h"
@@ -77,9 +78,23 @@ namespace MARTe {
  *   bin 9: (90 <= x < 100)\n
  *   bin 10: (x >= 100)\n
  *
+ * The bin of an occurrence is computed in constant time, dividing its offset from \a minLim by the bin range.\n
+ *
+ * Instead of MinLim and MaxLim, the input signal can define the (strictly increasing) array \a Edges of non-uniform bins.
+ * In this case the output signal must have NumberOfElements equal to the number of edges plus one: the bin 0 counts
+ * the occurrences below Edges[0], the bin i counts the occurrences in [Edges[i-1], Edges[i]) and the last bin counts
+ * the occurrences above the last edge. The bin of an occurrence is found with a binary search of the edges.\n
+ *
  * The output signals type must be uint32.\n
  * The user can also define the GAM parameter \a BeginCycleNumber that enables the histogram
- * to start counting only after the specified number of MARTe cycles has passed. Default for this parameter is zero.
+ * to start counting only after the specified number of MARTe cycles has passed. Default for this parameter is zero.\n
+ * If the GAM parameter \a MultiSample is set to 1, the input signals can be arrays and/or have more than one sample;
+ * each element of each sample is counted as one occurrence and all of them are processed in a single batch per signal.\n
+ *
+ * A consistent copy of all the histograms can be requested at any time (see RequestSnapshot). The copy is taken
+ * at the end of the next Execute, without stopping (or resetting) the accumulation, and can then be read with GetSnapshot.
+ * The snapshot buffers are protected by a FastPollingMutexSem: the Execute never waits for it and, if a GetSnapshot is
+ * copying, the snapshot is taken in the following cycle.
  *
  * @details
  * The configuration syntax is (names and signal quantities are only given as an example):
@@ -88,6 +103,7 @@ namespace MARTe {
  *     Class = HistogramGAM
  *     BeginCycleNumber = 0 //Optional. Start to compute histogram only after BeginCycleNumber cycles
  *     StateChangeResetName = All //Optional. If set it will reset when the PrepareNextState, nextStaName == StateChangeResetName. If the StateChangeResetName is set to "All", it will always reset.
+ *     MultiSample = 1 //Optional. If set to 1 the input signals can have NumberOfElements > 1 and/or Samples > 1. Default = 0.
  *     InputSignals = {
  *         BeginCycleNumber = 10
  *         Signal1 = {
@@ -104,6 +120,12 @@ namespace MARTe {
  *             MinLim = 10.5
  *             MaxLim = 20.5
  *         }
+ *         Signal3 = {
+ *             DataSource = "Drv1"
+ *             Type = float32
+ *             NumberOfElements = 8
+ *             Edges = {0.0 0.1 1.0 10.0} //Requires MultiSample = 1 because NumberOfElements > 1
+ *         }
  *     }
  *     OutputSignals = {
  *         Histogram1 = {
@@ -116,6 +138,11 @@ namespace MARTe {
  *             Type = uint32
  *             NumberOfElements = 120
  *         }
+ *         Histogram3 = {
+ *             DataSource = "DDB"
+ *             Type = uint32
+ *             NumberOfElements = 5
+ *         }
  *     }
  * }
  * </pre>
@@ -137,7 +164,9 @@ public:
     /**
      * @see GAM::Initialise()
      * @details The following parameter can be defined in the configuration:\n
-     *   BeginCycleNumber: how many cycles to wait before starting to compute the histogram.
+     *   BeginCycleNumber: how many cycles to wait before starting to compute the histogram.\n
+     *   MultiSample: if 1 the input signals can have more than one element and/or sample.
+     * @return true if MultiSample is 0 or 1.
      */
     virtual bool Initialise(StructuredDataI &data);
 
@@ -145,9 +174,11 @@ public:
      * @see GAM::Setup()
      * @details Checks that:\n
      *   (NumberOfInputSignals==NumberOfOutputSignals)\n
-     *   (NumberOfElements == 1) for each input signal\n
-     *   (NumberOfSamples == 1) for each input signal\n
+     *   (NumberOfElements == 1) for each input signal (unless MultiSample = 1)\n
+     *   (NumberOfSamples == 1) for each input signal (unless MultiSample = 1)\n
+     *   Edges (if defined) are strictly increasing, otherwise MinLim and MaxLim are defined\n
      *   (NumberOfElements >= 3) for each output signal\n
+     *   (NumberOfElements == number of Edges + 1) for each output signal whose input signal defines the Edges\n
      *   (Type == uint32) for each output signal\n
      *  @return true if the conditions above are met.
      */
@@ -168,6 +199,37 @@ public:
     virtual bool PrepareNextState(const char8 * const currentStateName,
                                   const char8 * const nextStateName);
 
+    /**
+     * @brief Requests a snapshot of all the histograms.
+     * @details The histograms are copied to the snapshot buffers at the end of the next Execute and
+     * GetSnapshotCounter is then incremented. Can be called from any thread.
+     */
+    void RequestSnapshot();
+
+    /**
+     * @brief Checks if a requested snapshot was not yet taken.
+     * @return true if RequestSnapshot was called and the snapshot was not yet taken.
+     */
+    bool IsSnapshotPending() const;
+
+    /**
+     * @brief Gets the number of snapshots taken so far.
+     * @return the number of snapshots taken so far.
+     */
+    uint32 GetSnapshotCounter() const;
+
+    /**
+     * @brief Copies the last snapshot of the histogram of the output signal \a signalIdx.
+     * @details The copy is taken with the snapshot mutex locked, so that it cannot be mixed with a newer snapshot.
+     * @param[in] signalIdx the index of the output signal.
+     * @param[out] histogram where to copy the snapshot.
+     * @param[in] nBins the number of elements of \a histogram.
+     * @return true if \a signalIdx is valid and \a nBins is the number of bins of the histogram.
+     */
+    bool GetSnapshot(const uint32 signalIdx,
+                     uint32 * const histogram,
+                     const uint32 nBins);
+
 protected:
 
     /**
@@ -192,6 +254,36 @@ protected:
      * The name of the state to reset the histogram counters.
      */
     StreamString stateChangeResetName;
+
+    /**
+     * If 1 the input signals can have more than one element and/or sample.
+     */
+    uint32 multiSample;
+
+    /**
+     * The number of occurrences (elements x samples) of each input signal.
+     */
+    uint32 *numberOfOccurrences;
+
+    /**
+     * The snapshot of each histogram.
+     */
+    uint32 **snapshots;
+
+    /**
+     * Set to 1 by RequestSnapshot and reset by Execute once the snapshot is taken.
+     */
+    volatile int32 snapshotRequested;
+
+    /**
+     * The number of snapshots taken.
+     */
+    volatile int32 snapshotCounter;
+
+    /**
+     * Protects the snapshot buffers.
+     */
+    FastPollingMutexSem snapshotMux;
 };
 
 }
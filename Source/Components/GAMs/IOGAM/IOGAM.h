@@ -44,6 +44,10 @@ namespace MARTe {
  *  Given that the DataSources cannot interchange data directly between them the main scope of the IOGAM is to
  *  serve as a (direct) connector between DataSources.
  *
+ * The input and output signals memory of the GAM are allocated by the framework and bound to the brokers, so that the
+ * copy cannot be replaced by sharing the same memory. When the IOGAM is only used to rename signals, the copy can be avoided
+ * by removing the IOGAM and reading the signals directly from the DataSource, using the signal Alias field in the consumer GAM.
+ *
  * The configuration syntax is (names and signal quantity are only given as an example):
  * <pre>
  * +Buffer = {
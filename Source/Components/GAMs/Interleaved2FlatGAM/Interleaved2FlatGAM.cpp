@@ -29,17 +29,53 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
+#include "HighResolutionTimer.h"
 #include "Interleaved2FlatGAM.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Default minimum number of bytes for the workers to be used.
+ */
+const MARTe::uint32 INTERLEAVED2FLATGAM_WORKER_THRESHOLD = 1048576u;
+
+/**
+ * Time (in ms) that an idle worker waits before checking if it has to be stopped.
+ */
+const MARTe::uint32 INTERLEAVED2FLATGAM_WORKER_TIMEOUT = 100u;
+
+/**
+ * Default maximum time (in us) that the real-time thread waits for the workers to complete a cycle.
+ */
+const MARTe::uint32 INTERLEAVED2FLATGAM_WAIT_TIMEOUT = 1000000u;
+
+/**
+ * Copies transfer.count elements of a fixed size. The inner loop is compiled to a single load and store.
+ */
+template<MARTe::uint32 elementSize>
+void CopyElements(const MARTe::Interleaved2FlatGAMTransfer &transfer,
+                  const MARTe::uint8 *source,
+                  MARTe::uint8 *destination) {
+    for (MARTe::uint32 k = 0u; k < transfer.count; k++) {
+        for (MARTe::uint32 b = 0u; b < elementSize; b++) {
+            destination[b] = source[b];
+        }
+        source = &source[transfer.sourceStride];
+        destination = &destination[transfer.destinationStride];
+    }
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 Interleaved2FlatGAM::Interleaved2FlatGAM() :
-        GAM() {
+        GAM(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
     numberOfInputSamples = NULL_PTR(uint32 *);
     numberOfOutputSamples = NULL_PTR(uint32 *);
     inputByteSize = NULL_PTR(uint32 *);
@@ -51,9 +87,31 @@ Interleaved2FlatGAM::Interleaved2FlatGAM() :
     numberOfOutputPacketChunks = NULL_PTR(uint32 *);
     packetOutputChunkSize = NULL_PTR(uint32 *);
     totalSignalsByteSize = 0u;
+
+    transfers = NULL_PTR(Interleaved2FlatGAMTransfer *);
+    numberOfTransfers = 0u;
+    partitionStart = NULL_PTR(uint32 *);
+    numberOfPartitions = 1u;
+    numberOfWorkers = 0u;
+    workerThreshold = INTERLEAVED2FLATGAM_WORKER_THRESHOLD;
+    cpuMask = 0xffu;
+    workerTimeout = INTERLEAVED2FLATGAM_WAIT_TIMEOUT;
+    workerTimeoutTicks = 0u;
+    workerCycle = 0;
+    workerFinishedCycle = NULL_PTR(volatile int32 *);
+    workerLastCycle = NULL_PTR(int32 *);
+    if (!workerSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
+    }
 }
 
+/*lint -e{1551} must stop the MultiThreadService in the destructor.*/
 Interleaved2FlatGAM::~Interleaved2FlatGAM() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop MultiThreadService.");
+        }
+    }
     if (numberOfInputSamples != NULL_PTR(uint32 *)) {
         delete[] numberOfInputSamples;
     }
@@ -86,6 +144,48 @@ Interleaved2FlatGAM::~Interleaved2FlatGAM() {
         delete[] packetOutputChunkSize;
     }
 
+    if (transfers != NULL_PTR(Interleaved2FlatGAMTransfer *)) {
+        delete[] transfers;
+    }
+
+    if (partitionStart != NULL_PTR(uint32 *)) {
+        delete[] partitionStart;
+    }
+
+    if (workerLastCycle != NULL_PTR(int32 *)) {
+        delete[] workerLastCycle;
+    }
+
+    if (workerFinishedCycle != NULL_PTR(volatile int32 *)) {
+        delete[] workerFinishedCycle;
+    }
+}
+
+bool Interleaved2FlatGAM::Initialise(StructuredDataI &data) {
+    bool ret = GAM::Initialise(data);
+    if (ret) {
+        if (!data.Read("NumberOfWorkers", numberOfWorkers)) {
+            numberOfWorkers = 0u;
+        }
+        if (!data.Read("WorkerThreshold", workerThreshold)) {
+            workerThreshold = INTERLEAVED2FLATGAM_WORKER_THRESHOLD;
+        }
+        if (!data.Read("CPUs", cpuMask)) {
+            cpuMask = 0xffu;
+        }
+        if (!data.Read("WorkerTimeout", workerTimeout)) {
+            workerTimeout = INTERLEAVED2FLATGAM_WAIT_TIMEOUT;
+        }
+        ret = (workerTimeout > 0u);
+        if (ret) {
+            float64 ticks = (static_cast<float64>(workerTimeout) * 1e-6) * static_cast<float64>(HighResolutionTimer::Frequency());
+            workerTimeoutTicks = static_cast<uint64>(ticks);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "WorkerTimeout shall be > 0");
+        }
+    }
+    return ret;
 }
 
 /*lint -e{613} null pointer checked.*/
@@ -329,95 +429,319 @@ bool Interleaved2FlatGAM::Setup() {
 
     }
 
+    if (ret) {
+        ret = BuildTransferPlan();
+    }
+    if (ret) {
+        if ((numberOfWorkers > 0u) && (totalSignalsByteSize >= workerThreshold)) {
+            ret = PartitionTransferPlan(numberOfWorkers + 1u);
+            if (ret) {
+                workerLastCycle = new int32[numberOfWorkers];
+                workerFinishedCycle = new int32[numberOfWorkers];
+                for (uint32 w = 0u; w < numberOfWorkers; w++) {
+                    workerLastCycle[w] = workerCycle;
+                    workerFinishedCycle[w] = workerCycle;
+                }
+                executor.SetNumberOfPoolThreads(numberOfWorkers);
+                executor.SetCPUMask(cpuMask);
+                executor.SetName(GetName());
+                ret = (executor.Start() == ErrorManagement::NoError);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not start the workers");
+                }
+            }
+        }
+    }
+    if (ret) {
+        REPORT_ERROR(ErrorManagement::Information, "Transfer plan with %d copies split in %d partitions", numberOfTransfers, numberOfPartitions);
+    }
+
     return ret;
 }
 
 /*lint -e{613} null pointer checked.*/
-bool Interleaved2FlatGAM::Execute() {
-    bool ret = MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), GetInputSignalsMemory(), totalSignalsByteSize);
-    uint32 cnt = 0u;
-    uint32 offset = 0u;
-    for (uint32 n = 0u; (n < numberOfInputSignals); n++) {
-        //do the split of the signals
-        uint8 *originSource = reinterpret_cast<uint8 *>(GetInputSignalMemory(n));
-
-        uint8 *originDest = &(reinterpret_cast<uint8 *>(GetOutputSignalsMemory()))[offset];
-
-        //this should be the number of samples
-        /*lint -e{613} null pointer checked before.*/
-        for (uint32 k = 0u; k < numberOfInputSamples[n]; k++) {
-            //return to the gam pointet
-            uint8 *dest = originDest;
-            //go to the k-th packet in the data source
-            /*lint -e{613} null pointer checked before.*/
-            uint32 index = (k * inputByteSize[n]);
-            /*lint -e{613} null pointer checked before.*/
-            uint8 *source = &originSource[index];
-            /*lint -e{613} null pointer checked before.*/
-            for (uint32 i = 0u; i < numberOfInputPacketChunks[n]; i++) {
-                //get the chunk size
-                index = (cnt + i);
-                /*lint -e{613} null pointer checked before.*/
-                uint32 chunkSize = packetInputChunkSize[index];
-                //put the k-th element
-                index = (k * chunkSize);
-                dest = &dest[index];
-                (void) MemoryOperationsHelper::Copy(dest, source, chunkSize);
-                //skip the N-k other samples to go to the next chunk mem
-                index = ((numberOfInputSamples[n] - k) * chunkSize);
-                dest = &dest[index];
-                //get the next chunk in source
-                source = &source[chunkSize];
+bool Interleaved2FlatGAM::BuildTransferPlan() {
+    uint32 maxNumberOfTransfers = (numberOfInputSignals + numberOfOutputSignals + 1u);
+    for (uint32 n = 0u; n < numberOfInputSignals; n++) {
+        maxNumberOfTransfers += numberOfInputPacketChunks[n];
+    }
+    for (uint32 n = 0u; n < numberOfOutputSignals; n++) {
+        maxNumberOfTransfers += numberOfOutputPacketChunks[n];
+    }
+    transfers = new Interleaved2FlatGAMTransfer[maxNumberOfTransfers];
+    bool ret = (transfers != NULL_PTR(Interleaved2FlatGAMTransfer *));
+    numberOfTransfers = 0u;
+
+    //Walk the input and output signals by increasing offset. The interleaved regions never overlap (checked in the Setup)
+    //and everything which is between them is copied as is.
+    uint32 position = 0u;
+    uint32 inputOffset = 0u;
+    uint32 outputOffset = 0u;
+    uint32 inputCnt = 0u;
+    uint32 outputCnt = 0u;
+    uint32 i = 0u;
+    uint32 j = 0u;
+    Interleaved2FlatGAMTransfer transfer;
+    while ((ret) && ((i < numberOfInputSignals) || (j < numberOfOutputSignals))) {
+        bool isInput = (i < numberOfInputSignals);
+        if ((isInput) && (j < numberOfOutputSignals)) {
+            isInput = (inputOffset <= outputOffset);
+        }
+        if (isInput) {
+            const uint32 regionSize = (inputByteSize[i] * numberOfInputSamples[i]);
+            if (numberOfInputPacketChunks[i] > 0u) {
+                transfer.sourceOffset = position;
+                transfer.destinationOffset = position;
+                transfer.size = (inputOffset - position);
+                transfer.count = 1u;
+                AddTransfer(transfer);
+                //from interleaved to flat: the chunk c of the sample k goes to the position k of the flat chunk c
+                uint32 packetOffset = 0u;
+                uint32 flatOffset = inputOffset;
+                for (uint32 c = 0u; c < numberOfInputPacketChunks[i]; c++) {
+                    const uint32 chunkSize = packetInputChunkSize[inputCnt + c];
+                    transfer.sourceOffset = (inputOffset + packetOffset);
+                    transfer.destinationOffset = flatOffset;
+                    transfer.size = chunkSize;
+                    transfer.count = numberOfInputSamples[i];
+                    transfer.sourceStride = inputByteSize[i];
+                    transfer.destinationStride = chunkSize;
+                    AddTransfer(transfer);
+                    packetOffset += chunkSize;
+                    flatOffset += (chunkSize * numberOfInputSamples[i]);
+                }
+                position = (inputOffset + regionSize);
+            }
+            inputOffset += regionSize;
+            inputCnt += numberOfInputPacketChunks[i];
+            i++;
+        }
+        else {
+            const uint32 regionSize = (outputByteSize[j] * numberOfOutputSamples[j]);
+            if (numberOfOutputPacketChunks[j] > 0u) {
+                transfer.sourceOffset = position;
+                transfer.destinationOffset = position;
+                transfer.size = (outputOffset - position);
+                transfer.count = 1u;
+                AddTransfer(transfer);
+                //from flat to interleaved: the position k of the flat chunk c goes to the chunk c of the sample k
+                uint32 packetOffset = 0u;
+                uint32 flatOffset = outputOffset;
+                for (uint32 c = 0u; c < numberOfOutputPacketChunks[j]; c++) {
+                    const uint32 chunkSize = packetOutputChunkSize[outputCnt + c];
+                    transfer.sourceOffset = flatOffset;
+                    transfer.destinationOffset = (outputOffset + packetOffset);
+                    transfer.size = chunkSize;
+                    transfer.count = numberOfOutputSamples[j];
+                    transfer.sourceStride = chunkSize;
+                    transfer.destinationStride = outputByteSize[j];
+                    AddTransfer(transfer);
+                    packetOffset += chunkSize;
+                    flatOffset += (chunkSize * numberOfOutputSamples[j]);
+                }
+                position = (outputOffset + regionSize);
             }
+            outputOffset += regionSize;
+            outputCnt += numberOfOutputPacketChunks[j];
+            j++;
         }
-        offset += (inputByteSize[n] * numberOfInputSamples[n]);
-        cnt += numberOfInputPacketChunks[n];
+    }
+    if (ret) {
+        transfer.sourceOffset = position;
+        transfer.destinationOffset = position;
+        transfer.size = (totalSignalsByteSize - position);
+        transfer.count = 1u;
+        AddTransfer(transfer);
+    }
+    return ret;
+}
 
+void Interleaved2FlatGAM::AddTransfer(Interleaved2FlatGAMTransfer transfer) {
+    if ((transfer.size > 0u) && (transfer.count > 0u)) {
+        //elements which are contiguous both in the source and in the destination are a single copy
+        if (transfer.count > 1u) {
+            if ((transfer.sourceStride == transfer.size) && (transfer.destinationStride == transfer.size)) {
+                transfer.size *= transfer.count;
+                transfer.count = 1u;
+            }
+        }
+        if (transfer.count == 1u) {
+            transfer.sourceStride = transfer.size;
+            transfer.destinationStride = transfer.size;
+        }
+        bool merged = false;
+        if (numberOfTransfers > 0u) {
+            Interleaved2FlatGAMTransfer &last = transfers[numberOfTransfers - 1u];
+            bool sameStrides = (last.count == transfer.count);
+            if (sameStrides) {
+                sameStrides = ((last.count == 1u) || ((last.sourceStride == transfer.sourceStride) && (last.destinationStride == transfer.destinationStride)));
+            }
+            //the chunks follow each other both in the source and in the destination
+            if (sameStrides) {
+                merged = (((last.sourceOffset + last.size) == transfer.sourceOffset) && ((last.destinationOffset + last.size) == transfer.destinationOffset));
+            }
+            if (merged) {
+                last.size += transfer.size;
+                if (last.count == 1u) {
+                    last.sourceStride = last.size;
+                    last.destinationStride = last.size;
+                }
+            }
+        }
+        if (!merged) {
+            transfers[numberOfTransfers] = transfer;
+            numberOfTransfers++;
+        }
     }
+}
 
-    cnt = 0u;
-    offset = 0u;
-    for (uint32 n = 0u; (n < numberOfOutputSignals); n++) {
-        //do the split of the signals
-        uint8 *originSource = &(reinterpret_cast<uint8 *>(GetInputSignalsMemory()))[offset];
-
-        uint8 *originDest = reinterpret_cast<uint8 *>(GetOutputSignalMemory(n));
-
-        //this should be the number of samples
-        /*lint -e{613} null pointer checked before.*/
-        for (uint32 k = 0u; k < numberOfOutputSamples[n]; k++) {
-            //return to the gam pointet
-            uint8 *source = originSource;
-            //go to the k-th packet in the data source
-            /*lint -e{613} null pointer checked before.*/
-            uint32 index = (k * outputByteSize[n]);
-            /*lint -e{613} null pointer checked before.*/
-            uint8 *dest = &originDest[index];
-            /*lint -e{613} null pointer checked before.*/
-            for (uint32 i = 0u; i < numberOfOutputPacketChunks[n]; i++) {
-                //get the chunk size
-                index = (cnt + i);
-                /*lint -e{613} null pointer checked before.*/
-                uint32 chunkSize = packetOutputChunkSize[index];
-                //put the k-th element
-                index = (k * chunkSize);
-                source = &source[index];
-                (void) MemoryOperationsHelper::Copy(dest, source, chunkSize);
-                //skip the N-k other samples to go to the next chunk mem
-                index = ((numberOfOutputSamples[n] - k) * chunkSize);
-                source = &source[index];
-                //get the next chunk in source
-                dest = &dest[chunkSize];
+bool Interleaved2FlatGAM::PartitionTransferPlan(const uint32 partitions) {
+    //each cut adds at most one transfer
+    Interleaved2FlatGAMTransfer *split = new Interleaved2FlatGAMTransfer[numberOfTransfers + partitions];
+    partitionStart = new uint32[partitions + 1u];
+    bool ret = (split != NULL_PTR(Interleaved2FlatGAMTransfer *)) && (partitionStart != NULL_PTR(uint32 *));
+    if (ret) {
+        const uint32 share = (((totalSignalsByteSize + partitions) - 1u) / partitions);
+        uint32 budget = share;
+        uint32 p = 0u;
+        uint32 n = 0u;
+        partitionStart[0u] = 0u;
+        for (uint32 t = 0u; t < numberOfTransfers; t++) {
+            Interleaved2FlatGAMTransfer transfer = transfers[t];
+            while (((p + 1u) < partitions) && ((transfer.size * transfer.count) > budget)) {
+                //cut the transfer at the end of the share of this partition
+                Interleaved2FlatGAMTransfer head = transfer;
+                if (transfer.count > 1u) {
+                    head.count = (budget / transfer.size);
+                    transfer.sourceOffset += (head.count * transfer.sourceStride);
+                    transfer.destinationOffset += (head.count * transfer.destinationStride);
+                    transfer.count -= head.count;
+                }
+                else {
+                    head.size = budget;
+                    head.sourceStride = budget;
+                    head.destinationStride = budget;
+                    transfer.sourceOffset += budget;
+                    transfer.destinationOffset += budget;
+                    transfer.size -= budget;
+                    transfer.sourceStride = transfer.size;
+                    transfer.destinationStride = transfer.size;
+                }
+                if (head.count > 0u) {
+                    split[n] = head;
+                    n++;
+                }
+                p++;
+                partitionStart[p] = n;
+                budget = share;
             }
+            split[n] = transfer;
+            n++;
+            budget -= (transfer.size * transfer.count);
+            if ((budget == 0u) && ((p + 1u) < partitions)) {
+                p++;
+                partitionStart[p] = n;
+                budget = share;
+            }
+        }
+        while (p < partitions) {
+            p++;
+            partitionStart[p] = n;
         }
-        offset += (outputByteSize[n] * numberOfOutputSamples[n]);
-        cnt += numberOfOutputPacketChunks[n];
+        delete[] transfers;
+        transfers = split;
+        numberOfTransfers = n;
+        numberOfPartitions = partitions;
+    }
+    return ret;
+}
 
+/*lint -e{613} null pointer checked.*/
+void Interleaved2FlatGAM::ExecuteTransfers(const uint32 first,
+                                           const uint32 last) {
+    const uint8 *inputMemory = reinterpret_cast<uint8 *>(GetInputSignalsMemory());
+    uint8 *outputMemory = reinterpret_cast<uint8 *>(GetOutputSignalsMemory());
+    for (uint32 t = first; t < last; t++) {
+        const Interleaved2FlatGAMTransfer &transfer = transfers[t];
+        const uint8 *source = &inputMemory[transfer.sourceOffset];
+        uint8 *dest = &outputMemory[transfer.destinationOffset];
+        if (transfer.count == 1u) {
+            (void) MemoryOperationsHelper::Copy(dest, source, transfer.size);
+        }
+        else if (transfer.size == 1u) {
+            CopyElements<1u>(transfer, source, dest);
+        }
+        else if (transfer.size == 2u) {
+            CopyElements<2u>(transfer, source, dest);
+        }
+        else if (transfer.size == 4u) {
+            CopyElements<4u>(transfer, source, dest);
+        }
+        else if (transfer.size == 8u) {
+            CopyElements<8u>(transfer, source, dest);
+        }
+        else {
+            for (uint32 k = 0u; k < transfer.count; k++) {
+                (void) MemoryOperationsHelper::Copy(dest, source, transfer.size);
+                source = &source[transfer.sourceStride];
+                dest = &dest[transfer.destinationStride];
+            }
+        }
     }
+}
 
+/*lint -e{613} null pointer checked.*/
+bool Interleaved2FlatGAM::Execute() {
+    bool ret = true;
+    if (numberOfPartitions > 1u) {
+        Atomic::Increment(&workerCycle);
+        const int32 cycle = workerCycle;
+        ret = workerSem.Post();
+        ExecuteTransfers(partitionStart[0u], partitionStart[1u]);
+        const uint64 start = HighResolutionTimer::Counter();
+        bool finished = false;
+        bool expired = false;
+        while ((!finished) && (!expired)) {
+            //busy wait, the workers are expected to complete in the same time of the real-time thread
+            finished = true;
+            for (uint32 w = 0u; (w < numberOfWorkers) && (finished); w++) {
+                finished = (workerFinishedCycle[w] == cycle);
+            }
+            if (!finished) {
+                expired = ((HighResolutionTimer::Counter() - start) > workerTimeoutTicks);
+            }
+        }
+        if (ret) {
+            ret = workerSem.Reset();
+        }
+        if (expired) {
+            REPORT_ERROR(ErrorManagement::Timeout, "The workers did not complete the cycle within %u us", workerTimeout);
+            ret = false;
+        }
+    }
+    else {
+        ExecuteTransfers(0u, numberOfTransfers);
+    }
     return ret;
+}
 
+/*lint -e{613} null pointer checked.*/
+ErrorManagement::ErrorType Interleaved2FlatGAM::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        ErrorManagement::ErrorType err = workerSem.Wait(TimeoutType(INTERLEAVED2FLATGAM_WORKER_TIMEOUT));
+        if (err.ErrorsCleared()) {
+            const uint32 worker = info.GetThreadNumber();
+            const int32 cycle = workerCycle;
+            if (cycle != workerLastCycle[worker]) {
+                workerLastCycle[worker] = cycle;
+                ExecuteTransfers(partitionStart[worker + 1u], partitionStart[worker + 2u]);
+                (void) Atomic::Exchange(&workerFinishedCycle[worker], cycle);
+            }
+        }
+    }
+    return ErrorManagement::NoError;
 }
+
 CLASS_REGISTER(Interleaved2FlatGAM, "1.0")
 }
 
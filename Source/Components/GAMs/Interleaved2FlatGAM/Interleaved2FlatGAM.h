@@ -31,13 +31,54 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
 #include "GAM.h"
+#include "MultiThreadService.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
 
 namespace MARTe {
 
+/**
+ * @brief Describes one entry of the transfer plan computed by the Interleaved2FlatGAM::Setup.
+ * @details Copies count elements of size bytes from the input signals memory (starting at sourceOffset and
+ * moving sourceStride bytes after each element) to the output signals memory (starting at destinationOffset
+ * and moving destinationStride bytes after each element). Contiguous copies have count = 1.
+ */
+struct Interleaved2FlatGAMTransfer {
+    /**
+     * Offset of the first element in the input signals memory.
+     */
+    uint32 sourceOffset;
+
+    /**
+     * Offset of the first element in the output signals memory.
+     */
+    uint32 destinationOffset;
+
+    /**
+     * Size of each element in bytes.
+     */
+    uint32 size;
+
+    /**
+     * Number of elements to copy.
+     */
+    uint32 count;
+
+    /**
+     * Distance in bytes between two consecutive elements in the input signals memory.
+     */
+    uint32 sourceStride;
+
+    /**
+     * Distance in bytes between two consecutive elements in the output signals memory.
+     */
+    uint32 destinationStride;
+};
+
 /**
  * @brief GAM which allows to translate an interleaved memory region into a flat memory area (and vice-versa).
  * @details Some data-sources are expected to produce signals which are interleaved, i.e. which are in the form:
@@ -240,8 +281,32 @@ namespace MARTe {
  *     }
  * }
  * </pre>
+ *
+ * The copies are not computed in real-time. The Setup translates the configuration into a transfer plan
+ * (see Interleaved2FlatGAMTransfer) where the chunks that are adjacent both in the source and in the
+ * destination memory are merged into maximal contiguous runs and where the signals that are not interleaved
+ * are copied with a single copy for each contiguous memory region. Runs of elements with 1, 2, 4 or 8 bytes
+ * are copied with specialised loops, all the others with MemoryOperationsHelper::Copy.
+ *
+ * Large frames can be split across a pool of worker threads, each copying an (almost) equal share of the bytes.
+ * The following optional parameters can be set:
+ *
+ * <pre>
+ * +InterleavedGAM1 = {
+ *     Class = Interleaved2FlatGAM
+ *     NumberOfWorkers = 2 //Optional. Number of threads helping the real-time thread. Default = 0 (no workers).
+ *     WorkerThreshold = 1048576 //Optional. Minimum number of bytes (of all the signals) for the workers to be used. Default = 1048576.
+ *     CPUs = 0xC //Optional. CPU mask of the workers. Default = 0xff.
+ *     WorkerTimeout = 500 //Optional. Maximum time in microseconds that the real-time thread waits for the workers. Default = 1000000.
+ *     ...
+ * }
+ * </pre>
+ *
+ * The workers are only started if NumberOfWorkers > 0 and the total size of the signals is at least WorkerThreshold.
+ * The real-time thread copies its own share and busy waits for the workers to complete. If the workers do not complete within
+ * WorkerTimeout the Execute returns false (a late worker completes its share before starting the next cycle).
  */
-class Interleaved2FlatGAM: public GAM {
+class Interleaved2FlatGAM: public GAM, public EmbeddedServiceMethodBinderI {
 public:
 
     CLASS_REGISTER_DECLARATION()
@@ -252,25 +317,39 @@ public:
 Interleaved2FlatGAM    ();
 
     /**
-     * @brief Destructor. Deallocate memory.
+     * @brief Destructor. Stops the workers and deallocates memory.
      */
     virtual ~Interleaved2FlatGAM();
 
+    /**
+     * @brief Reads the optional worker parameters (see class description).
+     * @return true if GAM::Initialise returns true and WorkerTimeout > 0.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
     /**
      * @brief Verifies correctness of the GAM configuration.
      * @details Checks that:
      *  - The memory size of the input signals is the equal to the memory size of the output signals.
      *  - For each signal, the sum(PacketMemberSizes) is a sub-multiple of the signal size.
-     * @return true if all the conditions above are met.
+     * @details Computes the transfer plan and, if required, splits it across the workers and starts them.
+     * @return true if all the conditions above are met and the workers could be started.
      */
     virtual bool Setup();
 
     /**
-     * @brief Translates from interleaved to flat memory (or vice-versa).
-     * @return true.
+     * @brief Translates from interleaved to flat memory (or vice-versa) by executing the transfer plan.
+     * @return true if the workers (if any) completed the cycle within WorkerTimeout.
      */
     virtual bool Execute();
 
+    /**
+     * @brief Callback function for the workers.
+     * @details Waits for the real-time thread to request a new cycle and copies the share of the worker.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
 protected:
     /**
      * Number of input samples for each signal.
@@ -316,6 +395,98 @@ protected:
      */
     uint32 totalSignalsByteSize;
 
+    /**
+     * The transfer plan.
+     */
+    Interleaved2FlatGAMTransfer *transfers;
+
+    /**
+     * Number of entries in the transfer plan.
+     */
+    uint32 numberOfTransfers;
+
+    /**
+     * Index of the first transfer of each partition (numberOfPartitions + 1 elements). The partition 0 is executed by the real-time thread.
+     */
+    uint32 *partitionStart;
+
+    /**
+     * Number of partitions of the transfer plan (1 if the workers are not used).
+     */
+    uint32 numberOfPartitions;
+
+    /**
+     * Number of workers.
+     */
+    uint32 numberOfWorkers;
+
+    /**
+     * Minimum number of bytes for the workers to be used.
+     */
+    uint32 workerThreshold;
+
+    /**
+     * CPU mask of the workers.
+     */
+    uint32 cpuMask;
+
+    /**
+     * Maximum time (in microseconds and in HighResolutionTimer ticks) that the real-time thread waits for the workers.
+     */
+    uint32 workerTimeout;
+    uint64 workerTimeoutTicks;
+
+private:
+
+    /**
+     * @brief Computes the transfer plan from the signals configuration.
+     * @return true if the memory for the plan could be allocated.
+     */
+    bool BuildTransferPlan();
+
+    /**
+     * @brief Appends a transfer to the plan, merging it with the previous one when possible.
+     * @param[in] transfer the transfer to add.
+     */
+    void AddTransfer(Interleaved2FlatGAMTransfer transfer);
+
+    /**
+     * @brief Splits the transfer plan in partitions which copy the same number of bytes.
+     * @param[in] partitions the number of partitions.
+     * @return true if the memory for the new plan could be allocated.
+     */
+    bool PartitionTransferPlan(const uint32 partitions);
+
+    /**
+     * @brief Executes the transfers in the range [first, last[.
+     */
+    void ExecuteTransfers(const uint32 first,
+                          const uint32 last);
+
+    /**
+     * The workers.
+     */
+    MultiThreadService executor;
+
+    /**
+     * Posted by the real-time thread to wake the workers.
+     */
+    EventSem workerSem;
+
+    /**
+     * Incremented by the real-time thread in each cycle.
+     */
+    volatile int32 workerCycle;
+
+    /**
+     * Last cycle completed by each worker.
+     */
+    volatile int32 *workerFinishedCycle;
+
+    /**
+     * Last cycle executed by each worker.
+     */
+    int32 *workerLastCycle;
 };
 
 }
@@ -0,0 +1,835 @@
+/**
+ * @file MathExpressionFastEvaluator.cpp
+ * @brief Source file for class MathExpressionFastEvaluator
+ * @date 18/10/2026
+ * @author Nicolo Ferron
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MathExpressionFastEvaluator (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "AdvancedErrorManagement.h"
+#include "AnyType.h"
+#include "MathExpressionFastEvaluator.h"
+#include "SafeMath.h"
+#include "TypeConversion.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Internal type identifiers.
+ */
+static const uint32 FAST_TYPE_INT8 = 0u;
+static const uint32 FAST_TYPE_UINT8 = 1u;
+static const uint32 FAST_TYPE_INT16 = 2u;
+static const uint32 FAST_TYPE_UINT16 = 3u;
+static const uint32 FAST_TYPE_INT32 = 4u;
+static const uint32 FAST_TYPE_UINT32 = 5u;
+static const uint32 FAST_TYPE_INT64 = 6u;
+static const uint32 FAST_TYPE_UINT64 = 7u;
+static const uint32 FAST_TYPE_FLOAT32 = 8u;
+static const uint32 FAST_TYPE_FLOAT64 = 9u;
+static const uint32 FAST_TYPE_INVALID = 10u;
+
+typedef bool (*MathExpressionFastKernel)(const MathExpressionFastInstruction &instruction);
+
+/**
+ * @brief Maps a TypeDescriptor to the internal type identifier.
+ */
+static uint32 GetFastType(const TypeDescriptor &type) {
+    uint32 fastType = FAST_TYPE_INVALID;
+    if (type == SignedInteger8Bit) {
+        fastType = FAST_TYPE_INT8;
+    }
+    else if (type == UnsignedInteger8Bit) {
+        fastType = FAST_TYPE_UINT8;
+    }
+    else if (type == SignedInteger16Bit) {
+        fastType = FAST_TYPE_INT16;
+    }
+    else if (type == UnsignedInteger16Bit) {
+        fastType = FAST_TYPE_UINT16;
+    }
+    else if (type == SignedInteger32Bit) {
+        fastType = FAST_TYPE_INT32;
+    }
+    else if (type == UnsignedInteger32Bit) {
+        fastType = FAST_TYPE_UINT32;
+    }
+    else if (type == SignedInteger64Bit) {
+        fastType = FAST_TYPE_INT64;
+    }
+    else if (type == UnsignedInteger64Bit) {
+        fastType = FAST_TYPE_UINT64;
+    }
+    else if (type == Float32Bit) {
+        fastType = FAST_TYPE_FLOAT32;
+    }
+    else if (type == Float64Bit) {
+        fastType = FAST_TYPE_FLOAT64;
+    }
+    else {
+        fastType = FAST_TYPE_INVALID;
+    }
+    return fastType;
+}
+
+/**
+ * @brief Maps an internal type identifier to its TypeDescriptor.
+ */
+static TypeDescriptor GetTypeDescriptor(const uint32 fastType) {
+    static const TypeDescriptor types[FAST_TYPE_INVALID] = { SignedInteger8Bit, UnsignedInteger8Bit, SignedInteger16Bit, UnsignedInteger16Bit,
+            SignedInteger32Bit, UnsignedInteger32Bit, SignedInteger64Bit, UnsignedInteger64Bit, Float32Bit, Float64Bit };
+    return types[fastType];
+}
+
+/**
+ * Operations. Apply() is the only function called by the kernels and returns false if the result saturated.
+ * The integer operations use the same SafeMath functions of the RuntimeEvaluator.
+ */
+template<typename T>
+struct FastAddition {
+    static inline bool Apply(const T x1,
+                             const T x2,
+                             T &result) {
+        ErrorManagement::ErrorType err = SafeMath::Addition(x1, x2, result);
+        return err.ErrorsCleared();
+    }
+};
+
+template<typename T>
+struct FastSubtraction {
+    static inline bool Apply(const T x1,
+                             const T x2,
+                             T &result) {
+        ErrorManagement::ErrorType err = SafeMath::Subtraction(x1, x2, result);
+        return err.ErrorsCleared();
+    }
+};
+
+template<typename T>
+struct FastMultiplication {
+    static inline bool Apply(const T x1,
+                             const T x2,
+                             T &result) {
+        ErrorManagement::ErrorType err = SafeMath::Multiplication(x1, x2, result);
+        return err.ErrorsCleared();
+    }
+};
+
+/**
+ * Floating point specialisations, which keep the loops free of any check.
+ */
+template<>
+struct FastAddition<float32> {
+    static inline bool Apply(const float32 x1,
+                             const float32 x2,
+                             float32 &result) {
+        result = x1 + x2;
+        return true;
+    }
+};
+
+template<>
+struct FastAddition<float64> {
+    static inline bool Apply(const float64 x1,
+                             const float64 x2,
+                             float64 &result) {
+        result = x1 + x2;
+        return true;
+    }
+};
+
+template<>
+struct FastSubtraction<float32> {
+    static inline bool Apply(const float32 x1,
+                             const float32 x2,
+                             float32 &result) {
+        result = x1 - x2;
+        return true;
+    }
+};
+
+template<>
+struct FastSubtraction<float64> {
+    static inline bool Apply(const float64 x1,
+                             const float64 x2,
+                             float64 &result) {
+        result = x1 - x2;
+        return true;
+    }
+};
+
+template<>
+struct FastMultiplication<float32> {
+    static inline bool Apply(const float32 x1,
+                             const float32 x2,
+                             float32 &result) {
+        result = x1 * x2;
+        return true;
+    }
+};
+
+template<>
+struct FastMultiplication<float64> {
+    static inline bool Apply(const float64 x1,
+                             const float64 x2,
+                             float64 &result) {
+        result = x1 * x2;
+        return true;
+    }
+};
+
+template<typename T>
+struct FastDivision {
+    static inline bool Apply(const T x1,
+                             const T x2,
+                             T &result) {
+        result = static_cast<T>(x1 / x2);
+        return true;
+    }
+};
+
+template<typename T>
+struct FastPower {
+    static inline bool Apply(const T x1,
+                             const T x2,
+                             T &result) {
+        result = pow(x1, x2);
+        return true;
+    }
+};
+
+struct FastSin {
+    static inline float64 Apply(const float64 x) {
+        return sin(x);
+    }
+};
+
+struct FastCos {
+    static inline float64 Apply(const float64 x) {
+        return cos(x);
+    }
+};
+
+struct FastTan {
+    static inline float64 Apply(const float64 x) {
+        return tan(x);
+    }
+};
+
+struct FastExp {
+    static inline float64 Apply(const float64 x) {
+        return exp(x);
+    }
+};
+
+struct FastLog {
+    static inline float64 Apply(const float64 x) {
+        return log(x);
+    }
+};
+
+struct FastSqrt {
+    static inline float64 Apply(const float64 x) {
+        return sqrt(x);
+    }
+};
+
+/**
+ * Kernels. The strides are template parameters (0 for a broadcast scalar, 1 for a vector)
+ * so that each loop is specialised, and vectorisable, for the shape of its operands.
+ */
+template<typename T, class Operation, uint32 stride1, uint32 stride2>
+static bool BinaryKernel(const MathExpressionFastInstruction &instruction) {
+    T * const destination = static_cast<T *>(instruction.destination);
+    const T * const operand1 = static_cast<const T *>(instruction.operand1);
+    const T * const operand2 = static_cast<const T *>(instruction.operand2);
+    bool ok = true;
+    for (uint32 i = 0u; i < instruction.nElements; i++) {
+        //All the elements are computed (saturated) even if one of them saturates
+        bool elementOk = Operation::Apply(operand1[i * stride1], operand2[i * stride2], destination[i]);
+        ok = (ok && elementOk);
+    }
+    return ok;
+}
+
+template<class Operation, uint32 stride1>
+static bool UnaryKernel(const MathExpressionFastInstruction &instruction) {
+    float64 * const destination = static_cast<float64 *>(instruction.destination);
+    const float64 * const operand1 = static_cast<const float64 *>(instruction.operand1);
+    for (uint32 i = 0u; i < instruction.nElements; i++) {
+        destination[i] = Operation::Apply(operand1[i * stride1]);
+    }
+    return true;
+}
+
+template<typename TFrom, typename TTo, uint32 stride1>
+static bool CastKernel(const MathExpressionFastInstruction &instruction) {
+    TTo * const destination = static_cast<TTo *>(instruction.destination);
+    const TFrom * const operand1 = static_cast<const TFrom *>(instruction.operand1);
+    for (uint32 i = 0u; i < instruction.nElements; i++) {
+        destination[i] = static_cast<TTo>(operand1[i * stride1]);
+    }
+    return true;
+}
+
+template<typename T, template<typename > class Operation>
+static MathExpressionFastKernel SelectTypedBinaryKernel(const bool isVector1,
+                                                   const bool isVector2) {
+    MathExpressionFastKernel kernel;
+    if (isVector1 && isVector2) {
+        kernel = &BinaryKernel<T, Operation<T>, 1u, 1u>;
+    }
+    else if (isVector1) {
+        kernel = &BinaryKernel<T, Operation<T>, 1u, 0u>;
+    }
+    else if (isVector2) {
+        kernel = &BinaryKernel<T, Operation<T>, 0u, 1u>;
+    }
+    else {
+        kernel = &BinaryKernel<T, Operation<T>, 0u, 0u>;
+    }
+    return kernel;
+}
+
+/**
+ * @brief Selects the kernel of a binary operation defined for all the numeric types.
+ */
+template<template<typename > class Operation>
+static MathExpressionFastKernel SelectBinaryKernel(const uint32 type,
+                                                   const bool isVector1,
+                                                   const bool isVector2) {
+    MathExpressionFastKernel kernel = NULL_PTR(MathExpressionFastKernel);
+    switch (type) {
+    case FAST_TYPE_INT8:
+        kernel = SelectTypedBinaryKernel<int8, Operation>(isVector1, isVector2);
+        break;
+    case FAST_TYPE_UINT8:
+        kernel = SelectTypedBinaryKernel<uint8, Operation>(isVector1, isVector2);
+        break;
+    case FAST_TYPE_INT16:
+        kernel = SelectTypedBinaryKernel<int16, Operation>(isVector1, isVector2);
+        break;
+    case FAST_TYPE_UINT16:
+        kernel = SelectTypedBinaryKernel<uint16, Operation>(isVector1, isVector2);
+        break;
+    case FAST_TYPE_INT32:
+        kernel = SelectTypedBinaryKernel<int32, Operation>(isVector1, isVector2);
+        break;
+    case FAST_TYPE_UINT32:
+        kernel = SelectTypedBinaryKernel<uint32, Operation>(isVector1, isVector2);
+        break;
+    case FAST_TYPE_INT64:
+        kernel = SelectTypedBinaryKernel<int64, Operation>(isVector1, isVector2);
+        break;
+    case FAST_TYPE_UINT64:
+        kernel = SelectTypedBinaryKernel<uint64, Operation>(isVector1, isVector2);
+        break;
+    case FAST_TYPE_FLOAT32:
+        kernel = SelectTypedBinaryKernel<float32, Operation>(isVector1, isVector2);
+        break;
+    case FAST_TYPE_FLOAT64:
+        kernel = SelectTypedBinaryKernel<float64, Operation>(isVector1, isVector2);
+        break;
+    default:
+        kernel = NULL_PTR(MathExpressionFastKernel);
+        break;
+    }
+    return kernel;
+}
+
+template<class Operation>
+static MathExpressionFastKernel SelectUnaryKernel(const bool isVector1) {
+    MathExpressionFastKernel kernel;
+    if (isVector1) {
+        kernel = &UnaryKernel<Operation, 1u>;
+    }
+    else {
+        kernel = &UnaryKernel<Operation, 0u>;
+    }
+    return kernel;
+}
+
+template<typename TFrom, typename TTo>
+static MathExpressionFastKernel SelectCastKernel(const bool isVector1) {
+    MathExpressionFastKernel kernel;
+    if (isVector1) {
+        kernel = &CastKernel<TFrom, TTo, 1u>;
+    }
+    else {
+        kernel = &CastKernel<TFrom, TTo, 0u>;
+    }
+    return kernel;
+}
+
+/**
+ * @brief Selects the kernel which copies a value of the given type (used by the WRITE which cannot be fused).
+ */
+static MathExpressionFastKernel SelectCopyKernel(const uint32 type,
+                                                 const bool isVector1) {
+    MathExpressionFastKernel kernel;
+    uint32 size = GetTypeDescriptor(type).numberOfBits / 8u;
+    if (size == 1u) {
+        kernel = SelectCastKernel<uint8, uint8>(isVector1);
+    }
+    else if (size == 2u) {
+        kernel = SelectCastKernel<uint16, uint16>(isVector1);
+    }
+    else if (size == 4u) {
+        kernel = SelectCastKernel<uint32, uint32>(isVector1);
+    }
+    else {
+        kernel = SelectCastKernel<uint64, uint64>(isVector1);
+    }
+    return kernel;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+MathExpressionFastEvaluator::MathExpressionFastEvaluator() {
+    variableNames = NULL_PTR(StreamString *);
+    variables = NULL_PTR(Operand *);
+    numberOfVariables = 0u;
+    maxNumberOfVariables = 0u;
+    instructions = NULL_PTR(MathExpressionFastInstruction *);
+    numberOfInstructions = 0u;
+    temporaryMemory = NULL_PTR(float64 *);
+    constantMemory = NULL_PTR(float64 *);
+    numberOfConstants = 0u;
+    maxNumberOfElements = 1u;
+    numberOfFoldedOperations = 0u;
+    numberOfFusedWrites = 0u;
+}
+
+MathExpressionFastEvaluator::~MathExpressionFastEvaluator() {
+    FreeCompiledCode();
+    if (variableNames != NULL_PTR(StreamString *)) {
+        delete[] variableNames;
+    }
+    if (variables != NULL_PTR(Operand *)) {
+        delete[] variables;
+    }
+}
+
+void MathExpressionFastEvaluator::FreeCompiledCode() {
+    if (instructions != NULL_PTR(MathExpressionFastInstruction *)) {
+        delete[] instructions;
+        instructions = NULL_PTR(MathExpressionFastInstruction *);
+    }
+    if (temporaryMemory != NULL_PTR(float64 *)) {
+        delete[] temporaryMemory;
+        temporaryMemory = NULL_PTR(float64 *);
+    }
+    if (constantMemory != NULL_PTR(float64 *)) {
+        delete[] constantMemory;
+        constantMemory = NULL_PTR(float64 *);
+    }
+    numberOfInstructions = 0u;
+    numberOfConstants = 0u;
+}
+
+uint32 MathExpressionFastEvaluator::FindVariable(const char8 * const name) const {
+    uint32 index = numberOfVariables;
+    for (uint32 i = 0u; (i < numberOfVariables) && (index == numberOfVariables); i++) {
+        if (variableNames[i] == name) {
+            index = i;
+        }
+    }
+    return index;
+}
+
+void MathExpressionFastEvaluator::AppendVariable(const char8 * const name,
+                                                 const Operand &variable) {
+    if (numberOfVariables == maxNumberOfVariables) {
+        uint32 newMaxNumberOfVariables = maxNumberOfVariables + 8u;
+        StreamString *newNames = new StreamString[newMaxNumberOfVariables];
+        Operand *newVariables = new Operand[newMaxNumberOfVariables];
+        for (uint32 i = 0u; i < numberOfVariables; i++) {
+            newNames[i] = variableNames[i];
+            newVariables[i] = variables[i];
+        }
+        if (variableNames != NULL_PTR(StreamString *)) {
+            delete[] variableNames;
+        }
+        if (variables != NULL_PTR(Operand *)) {
+            delete[] variables;
+        }
+        variableNames = newNames;
+        variables = newVariables;
+        maxNumberOfVariables = newMaxNumberOfVariables;
+    }
+    variableNames[numberOfVariables] = name;
+    variables[numberOfVariables] = variable;
+    numberOfVariables++;
+}
+
+bool MathExpressionFastEvaluator::AddVariable(const char8 * const name,
+                                              const TypeDescriptor &type,
+                                              void * const memory,
+                                              const uint32 nElements,
+                                              const bool isOutput) {
+    uint32 fastType = GetFastType(type);
+    bool ok = (fastType != FAST_TYPE_INVALID) && (nElements > 0u) && (instructions == NULL_PTR(MathExpressionFastInstruction *));
+    if (ok) {
+        ok = (FindVariable(name) == numberOfVariables);
+    }
+    if (ok) {
+        Operand variable;
+        variable.address = memory;
+        variable.type = fastType;
+        variable.nElements = nElements;
+        variable.isConstant = false;
+        variable.isOutput = isOutput;
+        variable.isInput = !isOutput;
+        variable.producer = -1;
+        AppendVariable(name, variable);
+        if (nElements > maxNumberOfElements) {
+            maxNumberOfElements = nElements;
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionFastEvaluator::Emit(bool (*kernel)(const MathExpressionFastInstruction &instruction),
+                                       const Operand &operand1,
+                                       const Operand * const operand2,
+                                       const uint32 resultType,
+                                       const uint32 nElements,
+                                       Operand &result) {
+    bool ok = (kernel != NULL_PTR(MathExpressionFastKernel));
+    if (ok) {
+        bool allConstant = operand1.isConstant;
+        if (operand2 != NULL_PTR(const Operand *)) {
+            allConstant = allConstant && operand2->isConstant;
+        }
+        MathExpressionFastInstruction instruction;
+        instruction.kernel = kernel;
+        instruction.operand1 = operand1.address;
+        instruction.operand2 = (operand2 != NULL_PTR(const Operand *)) ? (operand2->address) : (NULL_PTR(const void *));
+        instruction.nElements = nElements;
+        result.type = resultType;
+        result.nElements = nElements;
+        result.isOutput = false;
+        result.isInput = false;
+        bool folded = false;
+        if (allConstant) {
+            //Constant folding: evaluate now and keep only the result (unless it saturates, so that Execute() reports it).
+            instruction.destination = &constantMemory[numberOfConstants];
+            folded = kernel(instruction);
+        }
+        if (folded) {
+            result.address = &constantMemory[numberOfConstants];
+            result.isConstant = true;
+            result.producer = -1;
+            numberOfConstants++;
+            numberOfFoldedOperations++;
+        }
+        else {
+            result.address = &temporaryMemory[numberOfInstructions * maxNumberOfElements];
+            result.isConstant = false;
+            result.producer = static_cast<int32>(numberOfInstructions);
+            instruction.destination = result.address;
+            instructions[numberOfInstructions] = instruction;
+            numberOfInstructions++;
+        }
+    }
+    return ok;
+}
+
+bool MathExpressionFastEvaluator::Compile(const StreamString &stackMachineCode) {
+    FreeCompiledCode();
+    numberOfFoldedOperations = 0u;
+    numberOfFusedWrites = 0u;
+
+    StreamString code = stackMachineCode;
+    //Each line generates at most one instruction, one constant and one stack entry.
+    uint32 maxNumberOfLines = 1u;
+    const char8 * const codeBuffer = code.Buffer();
+    for (uint32 i = 0u; i < code.Size(); i++) {
+        if (codeBuffer[i] == '\n') {
+            maxNumberOfLines++;
+        }
+    }
+    instructions = new MathExpressionFastInstruction[maxNumberOfLines];
+    temporaryMemory = new float64[maxNumberOfLines * maxNumberOfElements];
+    constantMemory = new float64[maxNumberOfLines];
+    Operand *stack = new Operand[maxNumberOfLines];
+    uint32 stackSize = 0u;
+    //Internal variables (outputs with no signal) are appended to the signal variables.
+    uint32 numberOfSignalVariables = numberOfVariables;
+
+    bool ok = code.Seek(0LLU);
+    StreamString line;
+    char8 terminator;
+    while (ok && code.GetToken(line, "\n", terminator, "\r")) {
+        StreamString opcode;
+        StreamString argument1;
+        StreamString argument2;
+        (void) line.Seek(0LLU);
+        (void) line.GetToken(opcode, " \t", terminator, " \t");
+        (void) line.GetToken(argument1, " \t", terminator, " \t");
+        (void) line.GetToken(argument2, " \t", terminator, " \t");
+        line = "";
+        if (opcode.Size() == 0u) {
+            //Empty line
+        }
+        else if (opcode == "READ") {
+            uint32 index = FindVariable(argument1.Buffer());
+            ok = (index < numberOfVariables);
+            if (ok) {
+                stack[stackSize] = variables[index];
+                stackSize++;
+            }
+        }
+        else if (opcode == "CONST") {
+            uint32 type = GetFastType(TypeDescriptor::GetTypeDescriptorFromTypeName(argument1.Buffer()));
+            ok = (type != FAST_TYPE_INVALID);
+            if (ok) {
+                AnyType source(CharString, 0u, argument2.Buffer());
+                AnyType destination(GetTypeDescriptor(type), 0u, &constantMemory[numberOfConstants]);
+                ok = TypeConvert(destination, source);
+            }
+            if (ok) {
+                stack[stackSize].address = &constantMemory[numberOfConstants];
+                stack[stackSize].type = type;
+                stack[stackSize].nElements = 1u;
+                stack[stackSize].isConstant = true;
+                stack[stackSize].isOutput = false;
+                stack[stackSize].isInput = false;
+                stack[stackSize].producer = -1;
+                stackSize++;
+                numberOfConstants++;
+            }
+        }
+        else if (opcode == "WRITE") {
+            ok = (stackSize > 0u);
+            Operand source;
+            if (ok) {
+                stackSize--;
+                source = stack[stackSize];
+            }
+            uint32 index = FindVariable(argument1.Buffer());
+            if (!ok) {
+                //Stack underflow
+            }
+            else if (index < numberOfSignalVariables) {
+                Operand &target = variables[index];
+                ok = (target.isOutput) && (target.type == source.type);
+                if (ok) {
+                    ok = (source.nElements == target.nElements) || (source.nElements == 1u);
+                }
+                if (ok) {
+                    bool fuse = (source.producer >= 0) && (source.nElements == target.nElements);
+                    if (fuse) {
+                        fuse = (static_cast<uint32>(source.producer) == (numberOfInstructions - 1u));
+                    }
+                    if (fuse) {
+                        instructions[source.producer].destination = target.address;
+                        numberOfFusedWrites++;
+                    }
+                    else {
+                        instructions[numberOfInstructions].kernel = SelectCopyKernel(source.type, (source.nElements > 1u));
+                        instructions[numberOfInstructions].destination = target.address;
+                        instructions[numberOfInstructions].operand1 = source.address;
+                        instructions[numberOfInstructions].operand2 = NULL_PTR(const void *);
+                        instructions[numberOfInstructions].nElements = target.nElements;
+                        numberOfInstructions++;
+                    }
+                }
+            }
+            else {
+                //Internal variable. It refers to the value on the stack unless it is an output signal, which may be overwritten later.
+                Operand internal = source;
+                if (source.isOutput) {
+                    ok = Emit(SelectCopyKernel(source.type, (source.nElements > 1u)), source, NULL_PTR(const Operand *), source.type, source.nElements, internal);
+                }
+                if (ok) {
+                    internal.producer = -1;
+                    internal.isOutput = false;
+                    if (index < numberOfVariables) {
+                        variables[index] = internal;
+                    }
+                    else {
+                        AppendVariable(argument1.Buffer(), internal);
+                    }
+                }
+            }
+        }
+        else if (opcode == "CAST") {
+            uint32 type = GetFastType(TypeDescriptor::GetTypeDescriptorFromTypeName(argument1.Buffer()));
+            ok = (stackSize > 0u) && (type != FAST_TYPE_INVALID);
+            if (ok) {
+                Operand &operand1 = stack[stackSize - 1u];
+                if (operand1.type != type) {
+                    MathExpressionFastKernel kernel = NULL_PTR(MathExpressionFastKernel);
+                    bool isVector1 = (operand1.nElements > 1u);
+                    if ((operand1.type == FAST_TYPE_FLOAT32) && (type == FAST_TYPE_FLOAT64)) {
+                        kernel = SelectCastKernel<float32, float64>(isVector1);
+                    }
+                    else if ((operand1.type == FAST_TYPE_FLOAT64) && (type == FAST_TYPE_FLOAT32)) {
+                        kernel = SelectCastKernel<float64, float32>(isVector1);
+                    }
+                    else {
+                        //Integer conversions are left to the RuntimeEvaluator.
+                    }
+                    Operand result;
+                    ok = Emit(kernel, operand1, NULL_PTR(const Operand *), type, operand1.nElements, result);
+                    if (ok) {
+                        operand1 = result;
+                    }
+                }
+            }
+        }
+        else if ((opcode == "ADD") || (opcode == "SUB") || (opcode == "MUL") || (opcode == "DIV") || (opcode == "POW")) {
+            ok = (stackSize > 1u);
+            if (ok) {
+                //The second operand is on the top of the stack.
+                Operand operand1 = stack[stackSize - 2u];
+                Operand operand2 = stack[stackSize - 1u];
+                ok = (operand1.type == operand2.type);
+                if (ok) {
+                    ok = (operand1.nElements == operand2.nElements) || (operand1.nElements == 1u) || (operand2.nElements == 1u);
+                }
+                MathExpressionFastKernel kernel = NULL_PTR(MathExpressionFastKernel);
+                bool isVector1 = (operand1.nElements > 1u);
+                bool isVector2 = (operand2.nElements > 1u);
+                bool isFloat = (operand1.type == FAST_TYPE_FLOAT32) || (operand1.type == FAST_TYPE_FLOAT64);
+                if (!ok) {
+                    //Not supported.
+                }
+                else if (opcode == "ADD") {
+                    kernel = SelectBinaryKernel<FastAddition>(operand1.type, isVector1, isVector2);
+                }
+                else if (opcode == "SUB") {
+                    kernel = SelectBinaryKernel<FastSubtraction>(operand1.type, isVector1, isVector2);
+                }
+                else if (opcode == "MUL") {
+                    kernel = SelectBinaryKernel<FastMultiplication>(operand1.type, isVector1, isVector2);
+                }
+                else if (opcode == "DIV") {
+                    //The integer division (and its division by zero) is left to the RuntimeEvaluator.
+                    if (isFloat) {
+                        kernel = SelectBinaryKernel<FastDivision>(operand1.type, isVector1, isVector2);
+                    }
+                }
+                else {
+                    if (operand1.type == FAST_TYPE_FLOAT64) {
+                        kernel = SelectTypedBinaryKernel<float64, FastPower>(isVector1, isVector2);
+                    }
+                }
+                Operand result;
+                if (ok) {
+                    uint32 nElements = (operand1.nElements > operand2.nElements) ? (operand1.nElements) : (operand2.nElements);
+                    ok = Emit(kernel, operand1, &operand2, operand1.type, nElements, result);
+                }
+                if (ok) {
+                    stackSize--;
+                    stack[stackSize - 1u] = result;
+                }
+            }
+        }
+        else if ((opcode == "SIN") || (opcode == "COS") || (opcode == "TAN") || (opcode == "EXP") || (opcode == "LOG") || (opcode == "SQRT")) {
+            ok = (stackSize > 0u);
+            if (ok) {
+                Operand &operand1 = stack[stackSize - 1u];
+                ok = (operand1.type == FAST_TYPE_FLOAT64);
+                MathExpressionFastKernel kernel = NULL_PTR(MathExpressionFastKernel);
+                bool isVector1 = (operand1.nElements > 1u);
+                if (!ok) {
+                    //Not supported.
+                }
+                else if (opcode == "SIN") {
+                    kernel = SelectUnaryKernel<FastSin>(isVector1);
+                }
+                else if (opcode == "COS") {
+                    kernel = SelectUnaryKernel<FastCos>(isVector1);
+                }
+                else if (opcode == "TAN") {
+                    kernel = SelectUnaryKernel<FastTan>(isVector1);
+                }
+                else if (opcode == "EXP") {
+                    kernel = SelectUnaryKernel<FastExp>(isVector1);
+                }
+                else if (opcode == "LOG") {
+                    kernel = SelectUnaryKernel<FastLog>(isVector1);
+                }
+                else {
+                    kernel = SelectUnaryKernel<FastSqrt>(isVector1);
+                }
+                Operand result;
+                if (ok) {
+                    ok = Emit(kernel, operand1, NULL_PTR(const Operand *), FAST_TYPE_FLOAT64, operand1.nElements, result);
+                }
+                if (ok) {
+                    operand1 = result;
+                }
+            }
+        }
+        else {
+            ok = false;
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Cannot compile %s %s with the fast evaluator", opcode.Buffer(), argument1.Buffer());
+        }
+    }
+    //Internal variables are recreated on each compilation.
+    numberOfVariables = numberOfSignalVariables;
+    delete[] stack;
+    if (!ok) {
+        FreeCompiledCode();
+    }
+    return ok;
+}
+
+bool MathExpressionFastEvaluator::Execute() const {
+    bool ok = true;
+    for (uint32 i = 0u; i < numberOfInstructions; i++) {
+        bool instructionOk = instructions[i].kernel(instructions[i]);
+        ok = (ok && instructionOk);
+    }
+    return ok;
+}
+
+uint32 MathExpressionFastEvaluator::GetNumberOfInstructions() const {
+    return numberOfInstructions;
+}
+
+uint32 MathExpressionFastEvaluator::GetNumberOfFoldedOperations() const {
+    return numberOfFoldedOperations;
+}
+
+uint32 MathExpressionFastEvaluator::GetNumberOfFusedWrites() const {
+    return numberOfFusedWrites;
+}
+
+}
@@ -0,0 +1,250 @@
+/**
+ * @file MathExpressionFastEvaluator.h
+ * @brief Header file for class MathExpressionFastEvaluator
+ * @date 18/10/2026
+ * @author Nicolo Ferron
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MathExpressionFastEvaluator
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MATHEXPRESSIONFASTEVALUATOR_H_
+#define MATHEXPRESSIONFASTEVALUATOR_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+#include "CompilerTypes.h"
+#include "StreamString.h"
+#include "TypeDescriptor.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief One instruction of the compiled expression.
+ * @details The operands are addresses of signal memory, of folded constants or of
+ * temporary results, so that no stack is used at runtime. A scalar operand is
+ * broadcast to all the nElements of the instruction.
+ */
+struct MathExpressionFastInstruction {
+    /**
+     * @brief Function which executes the instruction. Returns false if the result of an integer operation saturated.
+     */
+    bool (*kernel)(const MathExpressionFastInstruction &instruction);
+    /**
+     * @brief Destination of the result (nElements values).
+     */
+    void *destination;
+    /**
+     * @brief First operand.
+     */
+    const void *operand1;
+    /**
+     * @brief Second operand (NULL for unary instructions).
+     */
+    const void *operand2;
+    /**
+     * @brief Number of elements computed by the instruction.
+     */
+    uint32 nElements;
+};
+
+/**
+ * @brief Compiles the stack machine code generated by the MathExpressionParser
+ * into a flat list of pre-dispatched instructions.
+ *
+ * @details The stack machine code is translated once, at Setup time, as follows:
+ *  - READ and CONST push the address of the variable/constant; no copy is performed at runtime;
+ *  - each operation is resolved, for the types and the shape (scalar or vector) of its operands,
+ *    to a specialised function which is stored in the instruction (direct-threaded code,
+ *    no opcode or type dispatch at runtime);
+ *  - operations whose operands are all constants are evaluated during the compilation (constant folding);
+ *  - a WRITE to an output signal of the result of the preceding operation is fused into the
+ *    operation, which directly writes in the signal memory.
+ *
+ * Vector signals are evaluated element-wise in one pass of each instruction; scalar operands
+ * are broadcast. All the vector operands of one operation must have the same number of elements.
+ *
+ * Supported operations are READ, WRITE, CONST, CAST (float32 <-> float64), ADD, SUB and MUL
+ * (any numeric type), DIV (float32 and float64), and SIN, COS, TAN, EXP, LOG, SQRT and POW (float64).
+ * As in the RuntimeEvaluator, integer ADD, SUB and MUL use the SafeMath functions, i.e. a result which
+ * overflows saturates at the limit of the type and is reported by Execute().
+ * Compile() returns false for any other operation so that the caller can fall back to the RuntimeEvaluator.
+ *
+ * Typical use:
+ *  - AddVariable() for each input and output signal;
+ *  - Compile();
+ *  - Execute().
+ */
+class MathExpressionFastEvaluator {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     */
+    MathExpressionFastEvaluator();
+
+    /**
+     * @brief Destructor. Frees the compiled code and the temporary memory.
+     */
+    ~MathExpressionFastEvaluator();
+
+    /**
+     * @brief Associates a signal to a variable of the expression.
+     * @param[in] name the name of the variable.
+     * @param[in] type the type of the signal.
+     * @param[in] memory the signal memory.
+     * @param[in] nElements the number of elements of the signal.
+     * @param[in] isOutput true if the variable is an output signal.
+     * @return true if the type is supported and the variable was not already added.
+     * @pre
+     *   Compile() was not called.
+     */
+    bool AddVariable(const char8 * const name,
+                     const TypeDescriptor &type,
+                     void * const memory,
+                     const uint32 nElements,
+                     const bool isOutput);
+
+    /**
+     * @brief Compiles the stack machine code.
+     * @param[in] stackMachineCode the code generated by MathExpressionParser::GetStackMachineExpression().
+     * @return true if all the operations are supported by the fast evaluator.
+     */
+    bool Compile(const StreamString &stackMachineCode);
+
+    /**
+     * @brief Executes the compiled code.
+     * @return false if the result of any integer operation saturated (all the instructions are executed anyway).
+     * @pre
+     *   Compile() == true
+     */
+    bool Execute() const;
+
+    /**
+     * @brief Gets the number of compiled instructions.
+     * @return the number of instructions executed on each Execute().
+     */
+    uint32 GetNumberOfInstructions() const;
+
+    /**
+     * @brief Gets the number of operations evaluated at compilation time.
+     * @return the number of folded operations.
+     */
+    uint32 GetNumberOfFoldedOperations() const;
+
+    /**
+     * @brief Gets the number of writes fused with the preceding operation.
+     * @return the number of fused writes.
+     */
+    uint32 GetNumberOfFusedWrites() const;
+
+private:
+
+    /**
+     * @brief Stack and variable entry used during compilation.
+     */
+    struct Operand {
+        void *address;
+        uint32 type;
+        uint32 nElements;
+        bool isConstant;
+        bool isOutput;
+        bool isInput;
+        int32 producer;
+    };
+
+    /**
+     * @brief Appends an instruction or, if all the operands are constant, evaluates it into a new constant.
+     * @details A constant operation which saturates is not folded, so that the error is reported by Execute().
+     */
+    bool Emit(bool (*kernel)(const MathExpressionFastInstruction &instruction),
+              const Operand &operand1,
+              const Operand * const operand2,
+              const uint32 resultType,
+              const uint32 nElements,
+              Operand &result);
+
+    /**
+     * @brief Appends a variable to the list of variables, growing the list if needed.
+     */
+    void AppendVariable(const char8 * const name,
+                        const Operand &variable);
+
+    /**
+     * @brief Looks for a variable by name.
+     * @return the variable index or numberOfVariables if not found.
+     */
+    uint32 FindVariable(const char8 * const name) const;
+
+    /**
+     * @brief Frees the memory allocated by Compile().
+     */
+    void FreeCompiledCode();
+
+    /**
+     * Variable names and their location.
+     */
+    StreamString *variableNames;
+    Operand *variables;
+    uint32 numberOfVariables;
+    uint32 maxNumberOfVariables;
+
+    /**
+     * Compiled instructions.
+     */
+    MathExpressionFastInstruction *instructions;
+    uint32 numberOfInstructions;
+
+    /**
+     * Memory of the temporary results (maxNumberOfElements values of 8 bytes for each instruction).
+     */
+    float64 *temporaryMemory;
+
+    /**
+     * Memory of the constants (one value of 8 bytes for each constant).
+     */
+    float64 *constantMemory;
+    uint32 numberOfConstants;
+
+    /**
+     * Largest number of elements of all the variables.
+     */
+    uint32 maxNumberOfElements;
+
+    /**
+     * Compilation statistics.
+     */
+    uint32 numberOfFoldedOperations;
+    uint32 numberOfFusedWrites;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MATHEXPRESSIONFASTEVALUATOR_H_ */
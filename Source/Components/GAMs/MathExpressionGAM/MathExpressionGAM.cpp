@@ -47,6 +47,8 @@ MathExpressionGAM::MathExpressionGAM() :
     
     mathParser    = NULL_PTR(MathExpressionParser*);
     evaluator     = NULL_PTR(RuntimeEvaluator*);
+    fastEvaluator = NULL_PTR(MathExpressionFastEvaluator*);
+    fastPath      = 0u;
     inputSignals  = NULL_PTR(SignalStruct*);
     outputSignals = NULL_PTR(SignalStruct*);
 }
@@ -60,6 +62,9 @@ MathExpressionGAM::~MathExpressionGAM() {
     if (evaluator != NULL) {
         delete evaluator;
     }
+    if (fastEvaluator != NULL) {
+        delete fastEvaluator;
+    }
     if (inputSignals != NULL) {
         delete[] inputSignals;
     }
@@ -81,6 +86,18 @@ bool MathExpressionGAM::Initialise(StructuredDataI &data) {
         }
     }
     
+    // Optional fast path
+    if (ok) {
+        if (!data.Read("FastPath", fastPath)) {
+            fastPath = 0u;
+        }
+        ok = (fastPath <= 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError,
+                "FastPath must be 0 or 1.");
+        }
+    }
+    
     // Parser initialization
     if (ok) {
         (void) expr.Seek(0LLU);
@@ -128,23 +145,30 @@ bool MathExpressionGAM::Setup() {
         }
     }
     
-    // 1. Checks
+    // 1. Checks (vector signals are only supported by the fast path)
+    bool allScalar = true;
     for (uint32 signalIdx = 0u; (signalIdx < numberOfInputSignals) && ok; signalIdx++) {
-        ok = (inputSignals[signalIdx].numberOfElements == 1u);
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::UnsupportedFeature,
-                "Input signal %s has %u elements (> 1). Only scalar signals are supported.",
-                (inputSignals[signalIdx].name).Buffer(), inputSignals[signalIdx].numberOfElements);
-        } 
+        if (inputSignals[signalIdx].numberOfElements != 1u) {
+            allScalar = false;
+            ok = (fastPath == 1u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::UnsupportedFeature,
+                    "Input signal %s has %u elements (> 1). Only scalar signals are supported (unless FastPath = 1).",
+                    (inputSignals[signalIdx].name).Buffer(), inputSignals[signalIdx].numberOfElements);
+            }
+        }
     }
     
     for (uint32 signalIdx = 0u; (signalIdx < numberOfOutputSignals) && ok; signalIdx++) {
-        ok = (outputSignals[signalIdx].numberOfElements == 1u);
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::UnsupportedFeature,
-                "Output signal %s has %u elements (> 1). Only scalar signals are supported.",
-                (outputSignals[signalIdx].name).Buffer(), outputSignals[signalIdx].numberOfElements);
-        } 
+        if (outputSignals[signalIdx].numberOfElements != 1u) {
+            allScalar = false;
+            ok = (fastPath == 1u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::UnsupportedFeature,
+                    "Output signal %s has %u elements (> 1). Only scalar signals are supported (unless FastPath = 1).",
+                    (outputSignals[signalIdx].name).Buffer(), outputSignals[signalIdx].numberOfElements);
+            }
+        }
     }
     
     // 2. Evaluator initialization
@@ -236,15 +260,63 @@ bool MathExpressionGAM::Setup() {
         } 
     }
     
+    // 6. Fast path compilation
+    if (ok && (fastPath == 1u)) {
+        fastEvaluator = new MathExpressionFastEvaluator();
+        bool compiled = true;
+        for (uint32 signalIdx = 0u; (signalIdx < numberOfInputSignals) && (compiled); signalIdx++) {
+            compiled = fastEvaluator->AddVariable((inputSignals[signalIdx].name).Buffer(), inputSignals[signalIdx].type,
+                                                  GetInputSignalMemory(signalIdx), inputSignals[signalIdx].numberOfElements, false);
+        }
+        for (uint32 signalIdx = 0u; (signalIdx < numberOfOutputSignals) && (compiled); signalIdx++) {
+            compiled = fastEvaluator->AddVariable((outputSignals[signalIdx].name).Buffer(), outputSignals[signalIdx].type,
+                                                  GetOutputSignalMemory(signalIdx), outputSignals[signalIdx].numberOfElements, true);
+        }
+        if (compiled) {
+            /*lint -e{613} ok = True => mathParser != NULL*/
+            compiled = fastEvaluator->Compile(mathParser->GetStackMachineExpression());
+        }
+        if (compiled) {
+            REPORT_ERROR(ErrorManagement::Information,
+                "Fast path compiled to %u instructions (%u operations folded, %u writes fused).",
+                fastEvaluator->GetNumberOfInstructions(), fastEvaluator->GetNumberOfFoldedOperations(),
+                fastEvaluator->GetNumberOfFusedWrites());
+        }
+        else {
+            delete fastEvaluator;
+            fastEvaluator = NULL_PTR(MathExpressionFastEvaluator*);
+            ok = allScalar;
+            if (ok) {
+                REPORT_ERROR(ErrorManagement::Warning,
+                    "The expression cannot be compiled by the fast path. Using the RuntimeEvaluator.");
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError,
+                    "The expression cannot be compiled by the fast path, which is required for vector signals.");
+            }
+        }
+    }
+    
     return ok;
 }
 
 bool MathExpressionGAM::Execute() {
-    /*lint -e{613} ok = True => evaluator != NULL*/
-    return evaluator->Execute();
+    bool ok = true;
+    if (fastEvaluator != NULL) {
+        ok = fastEvaluator->Execute();
+    }
+    else {
+        /*lint -e{613} ok = True => evaluator != NULL*/
+        ok = evaluator->Execute();
+    }
+    return ok;
     
 }
 
+bool MathExpressionGAM::IsFastPathActive() const {
+    return (fastEvaluator != NULL);
+}
+
 CLASS_REGISTER(MathExpressionGAM, "1.0")
 
 } /* namespace MARTe */
@@ -35,6 +35,7 @@
 #include "GAM.h"
 #include "MathExpressionParser.h"
 #include "RuntimeEvaluator.h"
+#include "MathExpressionFastEvaluator.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -109,7 +110,19 @@ namespace MARTe {
  * 
  * The GAM supports:
  *  - signals of any numeric type
- *  - scalar signals only
+ *  - scalar signals only (unless `FastPath = 1`, see below)
+ *
+ * If the optional leaf `FastPath = 1` is set, the expression is also compiled
+ * at Setup() by a MathExpressionFastEvaluator, which replaces the RuntimeEvaluator
+ * stack machine with a list of pre-dispatched instructions (constant subexpressions
+ * are folded and results are written directly in the output signals).
+ * With `FastPath = 1` vector signals are also allowed: all the vector signals must
+ * have the same number of elements, scalars are broadcast and the expression is
+ * evaluated element-wise. If the expression uses an operation or a type combination
+ * not supported by the MathExpressionFastEvaluator, the GAM falls back to the
+ * RuntimeEvaluator (only possible if all the signals are scalar).
+ * Both evaluators saturate integer additions, subtractions and multiplications
+ * which overflow, in which case Execute() returns `false`.
  * 
  * During initialisation, each variable in the expression is automatically
  * associated to the signal with the same name:
@@ -169,6 +182,7 @@ namespace MARTe {
  *                   Out1 = ( In1 + (float32) In2 ) * ((float32) 10);
  *                   Out2 = (float64) Out1 + pi + 10;
  *                  "
+ *     FastPath = 0                   // Optional. Default = 0. If 1 the expression is compiled by the MathExpressionFastEvaluator.
  *     InputSignals = {               // As many as required.
  *         In1 = {
  *             Type = float32
@@ -248,6 +262,13 @@ public:
      */
     virtual bool Execute();
 
+    /**
+     * @brief  Queries if the expression is evaluated by the MathExpressionFastEvaluator.
+     * @return `true` if `FastPath = 1` and the expression was compiled by the MathExpressionFastEvaluator.
+     * @pre    Setup() == `true`
+     */
+    bool IsFastPathActive() const;
+
 protected:
 
     /**
@@ -262,6 +283,12 @@ protected:
      */
     RuntimeEvaluator*     evaluator;
 
+    /**
+     * @brief Pointer to the instance of the MathExpressionFastEvaluator
+     *        (only if `FastPath = 1` and the expression is supported).
+     */
+    MathExpressionFastEvaluator* fastEvaluator;
+
 private:
     
     /**
@@ -287,6 +314,11 @@ private:
      * @brief The expression to be evaluated.
      */
     StreamString expr;
+
+    /**
+     * @brief `FastPath` parameter.
+     */
+    uint8 fastPath;
     
 };
 
@@ -64,6 +64,7 @@ MuxGAM::MuxGAM() :
     maxSelectorValue = 0u;
     numberOfElements = 0u;
     sizeToCopy = 0u;
+    elementByteSize = 0u;
 }
 
 MuxGAM::~MuxGAM() {
@@ -188,7 +189,8 @@ bool MuxGAM::Setup() {
         }
     }
     if (ok) { //compute sizeToCopy
-        sizeToCopy = (typeSignals.numberOfBits * numberOfElements) / 8u;
+        elementByteSize = typeSignals.numberOfBits / 8u;
+        sizeToCopy = elementByteSize * numberOfElements;
     }
     if (ok) { //input elements
         uint32 auxElements = 0u;
@@ -378,47 +380,25 @@ bool MuxGAM::IsValidType(TypeDescriptor const &typeRef) const {
 }
 //lint -e{613} Possible use of null pointer 'MARTe::MuxGAM::selectors' in left argument to operator '[. Copy() only is used in
 //MuxGAM::Execute() and this function only is called if the Setup() succeeds and the pointers are initialized
-inline bool MuxGAM::Copy() const {
-    bool ret;
-    uint32 selectorValue = selectors[selectorIndex][elementIndex];
-    ret = IsValidSelector(selectorValue);
+inline bool MuxGAM::Copy() {
+    const uint32 *selector = selectors[selectorIndex];
+    uint8 *output = static_cast<uint8 *>(outputSignals[selectorIndex]);
+    uint32 selectorValue = selector[elementIndex];
+    bool ret = IsValidSelector(selectorValue);
     if (!ret) {
         REPORT_ERROR(ErrorManagement::FatalError, "Invalid selector value. selector value ( = %u) must be lower than %u", selectorValue, maxSelectorValue);
     }
     if (ret) {
-        if (typeSignals == Float32Bit) {
-            static_cast<float32 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<float32 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == Float64Bit) {
-            static_cast<float64 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<float64 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger8Bit) {
-            static_cast<int8 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int8 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger8Bit) {
-            static_cast<uint8 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint8 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger16Bit) {
-            static_cast<int16 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int16 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger16Bit) {
-            static_cast<uint16 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint16 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger32Bit) {
-            static_cast<int32 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int32 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger32Bit) {
-            static_cast<uint32 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint32 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == SignedInteger64Bit) {
-            static_cast<int64 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<int64 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else if (typeSignals == UnsignedInteger64Bit) {
-            static_cast<uint64 *>(outputSignals[selectorIndex])[elementIndex] = static_cast<uint64 *>(inputSignals[selectorValue])[elementIndex];
-        }
-        else {
-            ret = false;
-        }
+        //consecutive elements routed from the same input are copied as a single block
+        uint32 runEnd = (elementIndex + 1u);
+        while ((runEnd < numberOfElements) && (selector[runEnd] == selectorValue)) {
+            runEnd++;
+        }
+        const uint32 offset = (elementIndex * elementByteSize);
+        const uint8 *input = static_cast<uint8 *>(inputSignals[selectorValue]);
+        ret = MemoryOperationsHelper::Copy(&output[offset], &input[offset], ((runEnd - elementIndex) * elementByteSize));
+        //the caller moves to the next element
+        elementIndex = (runEnd - 1u);
     }
     return ret;
 }
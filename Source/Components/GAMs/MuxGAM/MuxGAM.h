@@ -177,6 +177,7 @@ public:
      * maxSelectorValue = 0u\n
      * numberOfElements = 0u\n
      * sizeToCopy = 0u\n
+     * elementByteSize = 0u\n
      */
     MuxGAM();
 
@@ -202,7 +203,8 @@ public:
 
     /**
      * @brief Copies the selected input signals to the output signals.
-     * @details if selector is an array the input signals are copied element by element.
+     * @details if selector is an array the input signals are copied element by element, where the consecutive
+     * elements with the same selector value are copied as a single block.
      * If the selector has one element the input signals are copied as a block.
      * @return true if the copy is successfully done
      */
@@ -287,6 +289,11 @@ private:
      */
     uint32 sizeToCopy;
 
+    /**
+     * Size in bytes of each element of the input and output signals.
+     */
+    uint32 elementByteSize;
+
     /**
      * @brief Checks that a give type is a supported type.
      * @details valid types:
@@ -307,10 +314,11 @@ private:
 
     /**
      * @brief Copies a preselected input to the output
-     * @details The copy is performed element by element as a function of the selector value
+     * @details The copy is performed as a function of the selector value of the current element (elementIndex). All the following
+     * elements with the same selector value are copied in the same block and elementIndex is moved to the last copied element.
      * @return true if the copy succeed
      */
-    inline bool Copy()const;
+    inline bool Copy();
 
     /**
      * @brief Checks that a given selector is valid.
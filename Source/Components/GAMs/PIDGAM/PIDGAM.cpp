@@ -31,7 +31,9 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "PIDGAM.h"
+#include "RegisteredMethodsMessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -39,6 +41,84 @@
 
 namespace {
 
+/**
+ * @brief Reads a parameter which can be either a scalar or an array.
+ * @param[in] data the configuration.
+ * @param[in] name the name of the parameter.
+ * @param[out] values newly allocated with the \a numberOfValues values of the parameter.
+ * @param[out] numberOfValues the number of values of the parameter.
+ * @return true if the parameter exists and could be read.
+ */
+bool PIDGAMReadParameter(MARTe::StructuredDataI &data,
+                         const MARTe::char8 * const name,
+                         MARTe::float64 *&values,
+                         MARTe::uint32 &numberOfValues) {
+    using namespace MARTe;
+    AnyType at = data.GetType(name);
+    bool ok = !at.IsVoid();
+    if (ok) {
+        numberOfValues = 1u;
+        if (at.GetNumberOfDimensions() > 0u) {
+            numberOfValues = at.GetNumberOfElements(0u);
+        }
+        ok = (numberOfValues > 0u);
+    }
+    if (ok) {
+        values = new float64[numberOfValues];
+        if (at.GetNumberOfDimensions() > 0u) {
+            Vector<float64> valuesVec(values, numberOfValues);
+            ok = data.Read(name, valuesVec);
+        }
+        else {
+            ok = data.Read(name, values[0]);
+        }
+        if (!ok) {
+            delete[] values;
+            values = NULL_PTR(float64 *);
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Replaces \a values by an array of \a numberOfValues elements.
+ * @details If \a values is NULL all the elements are set to \a defaultValue, if it has a single element it is replicated.
+ * @param[in,out] values the parameter values.
+ * @param[in] numberOfValuesIn the number of elements of \a values.
+ * @param[in] numberOfValues the number of elements of the expanded array.
+ * @param[in] defaultValue the value to be used if \a values is NULL.
+ * @return true if numberOfValuesIn is 0 (\a values is NULL), 1 or \a numberOfValues.
+ */
+bool PIDGAMExpandParameter(MARTe::float64 *&values,
+                           const MARTe::uint32 numberOfValuesIn,
+                           const MARTe::uint32 numberOfValues,
+                           const MARTe::float64 defaultValue) {
+    using namespace MARTe;
+    bool ok = ((numberOfValuesIn <= 1u) || (numberOfValuesIn == numberOfValues));
+    if ((ok) && (numberOfValuesIn != numberOfValues)) {
+        float64 value = defaultValue;
+        if (values != NULL_PTR(float64 *)) {
+            value = values[0];
+            delete[] values;
+        }
+        values = new float64[numberOfValues];
+        for (uint32 i = 0u; i < numberOfValues; i++) {
+            values[i] = value;
+        }
+    }
+    return ok;
+}
+
+/**
+ * @brief Deletes and sets to NULL an array allocated with new[].
+ */
+void PIDGAMDeleteArray(MARTe::float64 *&values) {
+    if (values != NULL_PTR(MARTe::float64 *)) {
+        delete[] values;
+        values = NULL_PTR(MARTe::float64 *);
+    }
+}
+
 }
 
 /*---------------------------------------------------------------------------*/
@@ -48,21 +128,26 @@ namespace {
 namespace MARTe {
 
 PIDGAM::PIDGAM() :
-        GAM() {
-    kp = 0.0;
-    proportional = 0.0;
-    ki = 0.0;
-    kid = 0.0;
-    integral = 0.0;
-    kd = 0.0;
-    kdd = 0.0;
-    derivative = 0.0;
+        GAM(),
+        MessageI() {
+    kp = NULL_PTR(float64 *);
+    ki = NULL_PTR(float64 *);
+    kd = NULL_PTR(float64 *);
     sampleTime = 0.0;
-    maxOutput = MAX_FLOAT64;
-    minOutput = -MAX_FLOAT64;
-    enableIntegral = true;
-    lastInput = 0.0;
-    lastIntegral = 0.0;
+    maxOutput = NULL_PTR(float64 *);
+    minOutput = NULL_PTR(float64 *);
+    numberOfParameters = 0u;
+    numberOfLoops = 0u;
+    kpLoops = NULL_PTR(float64 *);
+    kidLoops = NULL_PTR(float64 *);
+    kddLoops = NULL_PTR(float64 *);
+    maxOutputLoops = NULL_PTR(float64 *);
+    minOutputLoops = NULL_PTR(float64 *);
+    lastInput = NULL_PTR(float64 *);
+    lastIntegral = NULL_PTR(float64 *);
+    zeroMeasurement = NULL_PTR(float64 *);
+    resetRequested = NULL_PTR(volatile int32 *);
+    resetPending = 0;
     enableSubstraction = false;
     reference = NULL_PTR(float64 *);
     sizeInputOutput = 0u;
@@ -82,27 +167,80 @@ PIDGAM::PIDGAM() :
 
 }
 
+/*lint -e{1551} the destructor does not throw exceptions*/
 PIDGAM::~PIDGAM() {
     reference = NULL_PTR(float64 *);
     measurement = NULL_PTR(float64 *);
     output = NULL_PTR(float64 *);
+    PIDGAMDeleteArray(kp);
+    PIDGAMDeleteArray(ki);
+    PIDGAMDeleteArray(kd);
+    PIDGAMDeleteArray(maxOutput);
+    PIDGAMDeleteArray(minOutput);
+    PIDGAMDeleteArray(kpLoops);
+    PIDGAMDeleteArray(kidLoops);
+    PIDGAMDeleteArray(kddLoops);
+    PIDGAMDeleteArray(maxOutputLoops);
+    PIDGAMDeleteArray(minOutputLoops);
+    PIDGAMDeleteArray(lastInput);
+    PIDGAMDeleteArray(lastIntegral);
+    PIDGAMDeleteArray(zeroMeasurement);
+    if (resetRequested != NULL_PTR(volatile int32 *)) {
+        delete[] resetRequested;
+        resetRequested = NULL_PTR(volatile int32 *);
+    }
 }
 
 bool PIDGAM::Initialise(StructuredDataI &data) {
     bool ok = GAM::Initialise(data);
+    uint32 nOfKp = 0u;
+    uint32 nOfKi = 0u;
+    uint32 nOfKd = 0u;
+    uint32 nOfMaxOutput = 0u;
+    uint32 nOfMinOutput = 0u;
     if (ok) {
-        ok = data.Read("Kp", kp);
+        ok = PIDGAMReadParameter(data, "Kp", kp, nOfKp);
         bool aux;
-        aux = data.Read("Ki", ki);
+        aux = PIDGAMReadParameter(data, "Ki", ki, nOfKi);
         ok = (ok || aux);
-        aux = data.Read("Kd", kd);
+        aux = PIDGAMReadParameter(data, "Kd", kd, nOfKd);
         ok = (ok || aux);
         if (!ok) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "kp, ki and kd missing. At least one parameter must be initialised");
         }
+    }
+    if (ok) {
+        (void) PIDGAMReadParameter(data, "MaxOutput", maxOutput, nOfMaxOutput);
+        (void) PIDGAMReadParameter(data, "MinOutput", minOutput, nOfMinOutput);
+        //Each parameter is either a scalar (shared by all the loops) or an array with one value per loop
+        numberOfParameters = nOfKp;
+        numberOfParameters = (nOfKi > numberOfParameters) ? (nOfKi) : (numberOfParameters);
+        numberOfParameters = (nOfKd > numberOfParameters) ? (nOfKd) : (numberOfParameters);
+        numberOfParameters = (nOfMaxOutput > numberOfParameters) ? (nOfMaxOutput) : (numberOfParameters);
+        numberOfParameters = (nOfMinOutput > numberOfParameters) ? (nOfMinOutput) : (numberOfParameters);
+        ok = PIDGAMExpandParameter(kp, nOfKp, numberOfParameters, 0.0);
+        if (ok) {
+            ok = PIDGAMExpandParameter(ki, nOfKi, numberOfParameters, 0.0);
+        }
+        if (ok) {
+            ok = PIDGAMExpandParameter(kd, nOfKd, numberOfParameters, 0.0);
+        }
+        if (ok) {
+            ok = PIDGAMExpandParameter(maxOutput, nOfMaxOutput, numberOfParameters, MAX_FLOAT64);
+        }
+        if (ok) {
+            ok = PIDGAMExpandParameter(minOutput, nOfMinOutput, numberOfParameters, -MAX_FLOAT64);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Kp, Ki, Kd, MaxOutput and MinOutput must be scalars or arrays with the same number of elements (%u)",
+                         numberOfParameters);
+        }
+    }
+    /*lint -e{850} the variable i does not change in the loop */
+    for (uint32 i = 0u; (i < numberOfParameters) && (ok); i++) {
         //lint -e{9007} No side effect on the function IsEqual.
-        if (IsEqual(kp, 0.0) && IsEqual(ki, 0.0) && IsEqual(kd, 0.0)) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "kp = ki = kd = 0.");
+        if (IsEqual(kp[i], 0.0) && IsEqual(ki[i], 0.0) && IsEqual(kd[i], 0.0)) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "kp = ki = kd = 0. (loop %u)", i);
             ok = false;
         }
     }
@@ -118,28 +256,19 @@ bool PIDGAM::Initialise(StructuredDataI &data) {
             ok = false;
         }
     }
-    if (ok) {
-        kid = ki * sampleTime;
-        kdd = kd / sampleTime;
-    }
-    if (ok) {
-        ok = data.Read("MaxOutput", maxOutput);
-        if (!ok) {
-            maxOutput = MAX_FLOAT64;
-        }
-        ok = data.Read("MinOutput", minOutput);
-        if (!ok) {
-            minOutput = -MAX_FLOAT64;
-        }
-        ok = true;
-        if (maxOutput < minOutput) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput < minOutput. maxOutput must be larger than minOutput");
+    /*lint -e{850} the variable i does not change in the loop */
+    for (uint32 i = 0u; (i < numberOfParameters) && (ok); i++) {
+        if (maxOutput[i] < minOutput[i]) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput < minOutput. maxOutput must be larger than minOutput (loop %u)", i);
             ok = false;
         }
-        if (IsEqual(maxOutput, minOutput)) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput = minOutput. maxOutput must be larger than minOutput");
+        else if (IsEqual(maxOutput[i], minOutput[i])) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput = minOutput. maxOutput must be larger than minOutput (loop %u)", i);
             ok = false;
         }
+        else {
+            //Valid limits
+        }
     }
     return ok;
 }
@@ -173,8 +302,8 @@ bool PIDGAM::Setup() {
             REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements returned an error for numberOfInputElementsReference");
         }
         if (ok) {
-            if (numberOfInputElementsReference != 1u) {
-                REPORT_ERROR(ErrorManagement::InitialisationError, "The numberOfInputElementsReference value must be one. The crrent value is %u",
+            if (numberOfInputElementsReference == 0u) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The numberOfInputElementsReference value must be positive. The crrent value is %u",
                              numberOfInputElementsReference);
                 ok = false;
             }
@@ -309,65 +438,143 @@ bool PIDGAM::Setup() {
     }
 
     if (ok) {
+        numberOfLoops = numberOfInputElementsReference;
+        ok = ((numberOfParameters == 1u) || (numberOfParameters == numberOfLoops));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The gains and limits must be scalars or arrays with %u elements (one per loop). They have %u elements",
+                         numberOfLoops, numberOfParameters);
+        }
+    }
+    if (ok) {
+        //Fold the sample time in the gains and store the per-loop parameters as structure of arrays
+        kpLoops = new float64[numberOfLoops];
+        kidLoops = new float64[numberOfLoops];
+        kddLoops = new float64[numberOfLoops];
+        maxOutputLoops = new float64[numberOfLoops];
+        minOutputLoops = new float64[numberOfLoops];
+        lastInput = new float64[numberOfLoops];
+        lastIntegral = new float64[numberOfLoops];
+        resetRequested = new volatile int32[numberOfLoops];
+        for (uint32 i = 0u; i < numberOfLoops; i++) {
+            uint32 p = (numberOfParameters == 1u) ? (0u) : (i);
+            /*lint -e{613} kp, ki, kd, maxOutput and minOutput are allocated in Initialise*/
+            kpLoops[i] = kp[p];
+            /*lint -e{613} kp, ki, kd, maxOutput and minOutput are allocated in Initialise*/
+            kidLoops[i] = ki[p] * sampleTime;
+            /*lint -e{613} kp, ki, kd, maxOutput and minOutput are allocated in Initialise*/
+            kddLoops[i] = kd[p] / sampleTime;
+            /*lint -e{613} kp, ki, kd, maxOutput and minOutput are allocated in Initialise*/
+            maxOutputLoops[i] = maxOutput[p];
+            /*lint -e{613} kp, ki, kd, maxOutput and minOutput are allocated in Initialise*/
+            minOutputLoops[i] = minOutput[p];
+            lastInput[i] = 0.0;
+            lastIntegral[i] = 0.0;
+            resetRequested[i] = 0;
+        }
         reference = static_cast<float64 *>(GetInputSignalMemory(0u));
         if (enableSubstraction) {
             measurement = static_cast<float64 *>(GetInputSignalMemory(1u));
         }
+        else {
+            //error = reference - 0.0 is exact, which keeps the loop in Execute free of branches
+            zeroMeasurement = new float64[numberOfLoops];
+            for (uint32 i = 0u; i < numberOfLoops; i++) {
+                zeroMeasurement[i] = 0.0;
+            }
+            measurement = zeroMeasurement;
+        }
         output = static_cast<float64 *>(GetOutputSignalMemory(0u));
     }
+    if (ok) {
+        ReferenceT<RegisteredMethodsMessageFilter> registeredMethodsMessageFilter("RegisteredMethodsMessageFilter");
+        ok = registeredMethodsMessageFilter.IsValid();
+        if (ok) {
+            registeredMethodsMessageFilter->SetDestination(this);
+            ok = InstallMessageFilter(registeredMethodsMessageFilter);
+        }
+    }
 
     return ok;
 }
 bool PIDGAM::Execute() {
+    if (resetPending != 0) {
+        ResetLoops();
+    }
     GetValue();
-    Saturation();
     return true;
 }
 
-//lint -e{613} The Setup() function guarantee that the pointers are not NULL.
-void PIDGAM::GetValue() {
-    if (enableSubstraction) {
-        float64 error;
-        error = *reference - *measurement;
-        proportional = kp * error;
-        if (enableIntegral) {
-            integral = (error * kid) + lastIntegral;
-        }
-        else {
-            integral = error * kid;
-        }
-        derivative = (error - lastInput) * kdd;
-        lastInput = error;
+uint32 PIDGAM::GetNumberOfLoops() const {
+    return numberOfLoops;
+}
+
+bool PIDGAM::RequestLoopReset(const uint32 loopIdx) {
+    bool ok = (loopIdx < numberOfLoops);
+    if (ok) {
+        //The loop flag is set before the pending flag, so that Execute never misses it
+        /*lint -e{613} resetRequested is allocated in Setup for all the loops*/
+        (void) Atomic::Exchange(&resetRequested[loopIdx], 1);
+        (void) Atomic::Exchange(&resetPending, 1);
     }
     else {
-        proportional = kp * *reference;
-        if (enableIntegral) {
-            integral = ((*reference * kid) + lastIntegral);
-        }
-        else {
-            integral = *reference * kid;
-        }
-        derivative = (*reference - lastInput) * kdd;
-        lastInput = *reference;
+        REPORT_ERROR(ErrorManagement::ParametersError, "Loop %u does not exist. The number of loops is %u", loopIdx, numberOfLoops);
     }
-    output[0] = proportional + integral + derivative;
-    lastIntegral = integral;
+    return ok;
 }
 
-//lint -e{613} The Setup() function guarantee that the pointers are not NULL.
-void PIDGAM::Saturation() {
-    if (output[0] > maxOutput) {
-        output[0] = maxOutput;
-        enableIntegral = false;
+ErrorManagement::ErrorType PIDGAM::ResetLoop(ReferenceContainer &message) {
+    ErrorManagement::ErrorType ret = ErrorManagement::NoError;
+
+    // Assume one ReferenceT<StructuredDataI> contained in the message
+    bool ok = (message.Size() == 1u);
+    ReferenceT<StructuredDataI> data = message.Get(0u);
+    if (ok) {
+        ok = data.IsValid();
     }
-    else if (output[0] < minOutput) {
-        output[0] = minOutput;
-        enableIntegral = false;
+    uint32 loopIdx = 0u;
+    if (ok) {
+        ok = data->Read("Loop", loopIdx);
     }
-    else {
-        enableIntegral = true;
+    if (ok) {
+        ok = RequestLoopReset(loopIdx);
     }
+    if (!ok) {
+        ret = ErrorManagement::ParametersError;
+        REPORT_ERROR(ret, "Message does not contain a ReferenceT<StructuredDataI> with a valid Loop");
+    }
+    return ret;
 }
-CLASS_REGISTER(PIDGAM, "1.0")
+
+//lint -e{613} The Setup() function guarantee that the pointers are not NULL.
+void PIDGAM::ResetLoops() {
+    (void) Atomic::Exchange(&resetPending, 0);
+    for (uint32 i = 0u; i < numberOfLoops; i++) {
+        if (Atomic::Exchange(&resetRequested[i], 0) != 0) {
+            lastInput[i] = 0.0;
+            lastIntegral[i] = 0.0;
+        }
+    }
 }
 
+//lint -e{613} The Setup() function guarantee that the pointers are not NULL.
+void PIDGAM::GetValue() {
+    //Branch-free so that the compiler can vectorise the loops batch
+    for (uint32 i = 0u; i < numberOfLoops; i++) {
+        float64 error = reference[i] - measurement[i];
+        float64 integral = (error * kidLoops[i]) + lastIntegral[i];
+        float64 out = ((kpLoops[i] * error) + integral) + ((error - lastInput[i]) * kddLoops[i]);
+        bool saturated = ((out > maxOutputLoops[i]) || (out < minOutputLoops[i]));
+        out = (out > maxOutputLoops[i]) ? (maxOutputLoops[i]) : (out);
+        out = (out < minOutputLoops[i]) ? (minOutputLoops[i]) : (out);
+        output[i] = out;
+        lastInput[i] = error;
+        //Anti-windup: while saturated the integral is not carried to the next cycle
+        lastIntegral[i] = saturated ? (0.0) : (integral);
+    }
+}
+
+CLASS_REGISTER(PIDGAM, "1.0")
+
+/*lint -e{1023} Justification: Macro provided by the Core.*/
+CLASS_METHOD_REGISTER(PIDGAM, ResetLoop)
+}
@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "GAM.h"
+#include "MessageI.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -71,6 +72,13 @@ namespace MARTe {
  * \f$ \n
  * Notice that the lastIntegral is not added to the output.\n
  *
+ * One PIDGAM instance can drive N independent loops: the reference, measurement and output signals are then arrays
+ * with N elements (one per loop). Each of Kp, Ki, Kd, MaxOutput and MinOutput can be a scalar (shared by all the loops)
+ * or an array with N elements. The gains are folded with the sample time in Setup and stored, together with the loop
+ * states, as structure of arrays, so that all the loops are computed by a single branch-free loop.\n
+ * The state of a single loop (last input and integral) can be reset, without touching the other loops, with the
+ * registered method ResetLoop (see below) or with RequestLoopReset. The reset is applied at the beginning of the next Execute.
+ *
  *
  *The configuration syntax is (names and signal quantity are only given as an example):
  *
@@ -111,27 +119,63 @@ namespace MARTe {
  * }
  * </pre>
  *
+ * Multi-loop example (three loops, shared Ki and Kd):
+ * <pre>
+ * +PIDs = {
+ *     Class = PIDGAM
+ *     Kp = {10.0 20.0 5.0}
+ *     Ki = 1.0
+ *     Kd = 0.0
+ *     SampleTime = 0.001
+ *     MaxOutput = {500.0 100.0 10.0} //optional
+ *     MinOutput = {-500.0 -100.0 -10.0} //optional
+ *     InputSignals = {
+ *         Errors = {
+ *             DataSource = "DDB1"
+ *             Type = float64
+ *             NumberOfElements = 3
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Outputs = {
+ *             DataSource = "DDB1"
+ *             Type = float64
+ *             NumberOfElements = 3
+ *         }
+ *     }
+ * }
+ * </pre>
+ *
+ * The message to reset the state of the loop 1 is:
+ * <pre>
+ * +ResetLoop1 = {
+ *     Class = Message
+ *     Destination = "App.Functions.PIDs"
+ *     Function = ResetLoop
+ *     +Parameters = {
+ *         Class = ConfigurationDatabase
+ *         Loop = 1
+ *     }
+ * }
+ * </pre>
  */
-class PIDGAM: public GAM {
+class PIDGAM: public GAM, public MessageI {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
      * @brief Default constructor
      * @post
-     * kp = 0.0\n
-     * proportional = 0.0\n
-     * ki = 0.0\n
-     * kid = 0.0\n
-     * integral = 0.0\n
-     * kd = 0.0\n
-     * kdd = 0.0\n
-     * derivative = 0.0\n
+     * kp = ki = kd = NULL_PTR(float64 *)\n
      * sampleTime = 0.0\n
-     * maxOutput = MAX_FLOAT64\n
-     * minOutput = -MAX_FLOAT64\n
-     * enableIntegral = true\n
-     * lastInput = 0.0\n
-     * lastIntegral = 0.0
+     * maxOutput = minOutput = NULL_PTR(float64 *)\n
+     * numberOfParameters = 0u\n
+     * numberOfLoops = 0u\n
+     * kpLoops = kidLoops = kddLoops = NULL_PTR(float64 *)\n
+     * maxOutputLoops = minOutputLoops = NULL_PTR(float64 *)\n
+     * lastInput = lastIntegral = NULL_PTR(float64 *)\n
+     * zeroMeasurement = NULL_PTR(float64 *)\n
+     * resetRequested = NULL_PTR(volatile int32 *)\n
+     * resetPending = 0\n
      * enableSubstraction = false\n
      * reference = NULL_PTR(float64 *)\n
      * sizeInputOutput = 0u\n
@@ -152,7 +196,7 @@ public:
 PIDGAM    ();
 
     /**
-     * @brief Default constructor.
+     * @brief Destructor. Frees the per-loop parameters and states.
      * @post
      * reference = NULL_PTR(float64 *)\n
      * measurement = NULL_PTR(float64 *)\n
@@ -170,10 +214,11 @@ PIDGAM    ();
      * sampleTime\n
      * maxOutput (optional)\n
      * minOutput (optional)\n
+     * kp, ki, kd, maxOutput and minOutput can be scalars or arrays (one value per loop) with the same number of elements.
      * @post
-     * kp != 0.0 || ki != 0.0 || kd != 0.0\n
+     * kp != 0.0 || ki != 0.0 || kd != 0.0 (for each loop)\n
      * sampleTime > 0.0\n
-     * maxOutpt > minOutput\n
+     * maxOutpt > minOutput (for each loop)\n
      * @return true if all postconditions are met
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -185,9 +230,10 @@ PIDGAM    ();
      * @post
      * nOfInputSignals = 1 || nOfInputSignals = 2\n
      * nOfOutputSignals = 1\n
-     * numberOfInputElementsReference = 1\n
-     * numberOfInputElementsMeasurement = 1\n
-     * numberOfOutputElements = 1\n
+     * numberOfInputElementsReference = numberOfLoops > 0\n
+     * numberOfInputElementsMeasurement = numberOfLoops\n
+     * numberOfOutputElements = numberOfLoops\n
+     * the number of elements of the gains and limits is 1 or numberOfLoops\n
      * numberOfInputSamplesReference = 1\n
      * numberOfInputSamplesMeasurement = 1\n
      * numberOfOuputSamples = 1\n
@@ -203,82 +249,124 @@ PIDGAM    ();
 
     /**
      * @brief Implements the PID.
-     * @details First computes the PID, then saturates the output if needed. If the output
-     * is saturated a flag prevents the integral term to continuing growing.
+     * @details Applies the pending loop resets. Then, for each loop, computes the PID and saturates the output if needed.
+     * If the output is saturated the integral term is not carried to the next cycle (anti-windup).
      * @return true.
      */
     virtual bool Execute();
+
+    /**
+     * @brief Gets the number of loops driven by this instance.
+     * @return the number of elements of the input and output signals.
+     */
+    uint32 GetNumberOfLoops() const;
+
+    /**
+     * @brief Requests the reset of the state of the loop \a loopIdx. The other loops are not affected.
+     * @details The state is reset at the beginning of the next Execute. Can be called from any thread.
+     * @param[in] loopIdx the index of the loop to be reset.
+     * @return true if loopIdx < GetNumberOfLoops().
+     */
+    bool RequestLoopReset(const uint32 loopIdx);
+
+    /**
+     * @brief Registered method which requests the reset of the state of one loop.
+     * @details The message shall contain a ReferenceT<StructuredDataI> with the parameter Loop (the index of the loop to reset).
+     * @return ErrorManagement::NoError if the message contains a valid Loop, ErrorManagement::ParametersError otherwise.
+     */
+    ErrorManagement::ErrorType ResetLoop(ReferenceContainer &message);
+
 private:
 
     /**
-     * proportional coefficient in the time domain in the time domain
+     * proportional coefficients as configured (numberOfParameters elements)
      */
-    float64 kp;
+    float64 *kp;
 
     /**
-     * contribution of the proportional term
+     * integral coefficients in the time domain as configured (numberOfParameters elements)
      */
-    float64 proportional;
+    float64 *ki;
 
     /**
-     * integral coefficient in the time domain
+     * Derivative coefficients in the time domain as configured (numberOfParameters elements)
      */
-    float64 ki;
+    float64 *kd;
 
     /**
-     * Integral coefficient in the discrete domain. kid = kid * sampleTime. It is used to speed up the operations
+     * Indicates the time between samples.
      */
-    float64 kid;
+    float64 sampleTime;
 
     /**
-     * contribution of the integral term
+     * upper limit saturation as configured (numberOfParameters elements)
      */
-    float64 integral;
+    float64 *maxOutput;
 
     /**
-     * Derivative coefficient in the time domain
+     * lower limit saturation as configured (numberOfParameters elements)
      */
-    float64 kd;
+    float64 *minOutput;
 
     /**
-     * Derivative coefficient in the discrete domain. kdd= kd/sampleTime. It is used to speed up the operations
+     * Number of elements of the configured gains and limits (1 if all of them are scalars).
      */
-    float64 kdd;
+    uint32 numberOfParameters;
 
     /**
-     * Contribution of the derivative term.
+     * Number of loops (elements of the input and output signals).
      */
-    float64 derivative;
+    uint32 numberOfLoops;
 
     /**
-     * Indicates the time between samples.
+     * proportional coefficient of each loop
      */
-    float64 sampleTime;
+    float64 *kpLoops;
+
+    /**
+     * Integral coefficient of each loop in the discrete domain. kid = ki * sampleTime.
+     */
+    float64 *kidLoops;
+
+    /**
+     * Derivative coefficient of each loop in the discrete domain. kdd = kd / sampleTime.
+     */
+    float64 *kddLoops;
+
+    /**
+     * upper limit saturation of each loop
+     */
+    float64 *maxOutputLoops;
+
+    /**
+     * lower limit saturation of each loop
+     */
+    float64 *minOutputLoops;
 
     /**
-     * upper limit saturation
+     * Save the last input value of each loop
      */
-    float64 maxOutput;
+    float64 *lastInput;
 
     /**
-     * lower limit saturation
+     * Save the last integrated term of each loop (zero if the output was saturated, see anti-windup)
      */
-    float64 minOutput;
+    float64 *lastIntegral;
 
     /**
-     * Enables/disable the integral term when saturation is acting (anti-windup function)
+     * Measurement used when a single input (the error) is defined. All the elements are zero.
      */
-    bool enableIntegral;
+    float64 *zeroMeasurement;
 
     /**
-     * Save the last input value
+     * Set to 1 by RequestLoopReset for each loop to be reset.
      */
-    float64 lastInput;
+    volatile int32 *resetRequested;
 
     /**
-     * Save the last integrated term
+     * Set to 1 by RequestLoopReset when any loop is to be reset.
      */
-    float64 lastIntegral;
+    volatile int32 resetPending;
 
     /**
      * When enableSubstraction is 1 the GAM expects two inputs: reference value and the feedback value (the actual measurement).
@@ -362,14 +450,14 @@ private:
     uint32 outputDimension;
 
     /**
-     * @brief Implements the PID
+     * @brief Implements the PID of all the loops, including the saturation and the anti-windup.
      */
     inline void GetValue();
 
     /**
-     * Saturates the output of the PID if needed.
+     * @brief Resets the state of the loops whose reset was requested.
      */
-    inline void Saturation();
+    void ResetLoops();
 
 };
 
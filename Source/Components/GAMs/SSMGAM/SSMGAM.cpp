@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "SSMGAM.h"
+#include "StateSpaceKernelT.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -93,10 +94,17 @@ SSMGAM::SSMGAM() :
 
     enableFeedthroughMatrix = false;
     resetInEachState = false;
+    kernel = NULL_PTR(StateSpaceKernel *);
+    useMatrixEngine = false;
+    useFloat32Coefficients = false;
 }
 
 //lint -e{1551} Function may throw exception --> The exceptions are not managed
 SSMGAM::~SSMGAM() {
+    if (kernel != NULL_PTR(StateSpaceKernel *)) {
+        delete kernel;
+        kernel = NULL_PTR(StateSpaceKernel *);
+    }
     if (stateMatrixPointer != NULL_PTR(float64 **)) {
         for (uint32 row = 0u; row < stateMatrixNumberOfRows; row++) {
             if (stateMatrixPointer[row] != NULL_PTR(float64 *)) {
@@ -407,6 +415,42 @@ bool SSMGAM::Initialise(StructuredDataI &data) {
             }
         }
     }
+    if (ok) {
+        StreamString engine;
+        if (data.Read("Engine", engine)) {
+            if (engine == "Matrix") {
+                useMatrixEngine = true;
+            }
+            else if (engine == "Contiguous") {
+                useMatrixEngine = false;
+            }
+            else {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for Engine. Possible values Contiguous or Matrix");
+            }
+        }
+    }
+    if (ok) {
+        StreamString coefficientsType;
+        if (data.Read("CoefficientsType", coefficientsType)) {
+            if (coefficientsType == "float32") {
+                useFloat32Coefficients = true;
+            }
+            else if (coefficientsType == "float64") {
+                useFloat32Coefficients = false;
+            }
+            else {
+                ok = false;
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Wrong value for CoefficientsType. Possible values float64 or float32");
+            }
+        }
+    }
+    if (ok) {
+        ok = !(useMatrixEngine && useFloat32Coefficients);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "CoefficientsType = float32 is only supported by the Contiguous engine");
+        }
+    }
     return ok;
 }
 
@@ -635,34 +679,58 @@ bool SSMGAM::Setup() {
             intermediateOutput2 = Matrix<float64>(intermediateOutput2Pointer, outputMatrixNumberOfRows, 1u);
             derivativeStateVector = Matrix<float64>(derivativeStateVectorPointer, sizeDerivativeStateVector, 1u);
         }
+        if (ok && (!useMatrixEngine)) {
+            if (useFloat32Coefficients) {
+                kernel = new StateSpaceKernelT<float32>();
+            }
+            else {
+                kernel = new StateSpaceKernelT<float64>();
+            }
+            ok = kernel->Initialise(stateMatrixPointer, inputMatrixPointer, outputMatrixPointer, feedthroughMatrixPointer, sizeStateVector,
+                                    inputMatrixNumberOfColumns, outputMatrixNumberOfRows);
+            if (ok) {
+                if (kernel->IsSparse()) {
+                    REPORT_ERROR(ErrorManagement::Information, "Contiguous engine with sparse coefficients");
+                }
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Failed to initialise the contiguous engine");
+            }
+        }
     }
     return ok;
 }
 
 bool SSMGAM::Execute() {
-    bool ok = stateVector.Copy(derivativeStateVector);
-    if (ok) {
-        ok = outputMatrix.Product(stateVector, intermediateOutput1);
-    }
-    if (ok && enableFeedthroughMatrix) {
-        ok = feedthroughMatrix.Product(inputVector, intermediateOutput2);
+    bool ok = true;
+    if (kernel != NULL_PTR(StateSpaceKernel *)) {
+        kernel->Update(inputVectorPointer, outputVectorPointer, stateVectorPointer);
     }
-    if (ok) {
-        if (enableFeedthroughMatrix) {
-            ok = intermediateOutput1.Sum(intermediateOutput2, outputVector);
+    else {
+        ok = stateVector.Copy(derivativeStateVector);
+        if (ok) {
+            ok = outputMatrix.Product(stateVector, intermediateOutput1);
         }
-        else {
-            ok = outputVector.Copy(intermediateOutput1);
+        if (ok && enableFeedthroughMatrix) {
+            ok = feedthroughMatrix.Product(inputVector, intermediateOutput2);
+        }
+        if (ok) {
+            if (enableFeedthroughMatrix) {
+                ok = intermediateOutput1.Sum(intermediateOutput2, outputVector);
+            }
+            else {
+                ok = outputVector.Copy(intermediateOutput1);
+            }
+        }
+        if (ok) {
+            ok = stateMatrix.Product(stateVector, intermediateState1);
+        }
+        if (ok) {
+            ok = inputMatrix.Product(inputVector, intermediateState2);
+        }
+        if (ok) {
+            ok = intermediateState1.Sum(intermediateState2, derivativeStateVector);
         }
-    }
-    if (ok) {
-        ok = stateMatrix.Product(stateVector, intermediateState1);
-    }
-    if (ok) {
-        ok = inputMatrix.Product(inputVector, intermediateState2);
-    }
-    if (ok) {
-        ok = intermediateState1.Sum(intermediateState2, derivativeStateVector);
     }
     return ok;
 }
@@ -679,6 +747,9 @@ bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
                 stateVector(i, 0u) = 0.0;
                 derivativeStateVector(i, 0u) = 0.0;
             }
+            if (kernel != NULL_PTR(StateSpaceKernel *)) {
+                kernel->Reset();
+            }
         }
         else {
             REPORT_ERROR(ErrorManagement::ParametersError, "stateVector or derivativeStateVector = NULL ");
@@ -696,6 +767,9 @@ bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
                     stateVector(i, 0u) = 0.0;
                     derivativeStateVector(i, 0u) = 0.0;
                 }
+                if (kernel != NULL_PTR(StateSpaceKernel *)) {
+                    kernel->Reset();
+                }
             }
             else {
                 REPORT_ERROR(ErrorManagement::ParametersError, "stateVector or derivativeStateVector = NULL ");
@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 #include "GAM.h"
 #include "Matrix.h"
+#include "StateSpaceKernel.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
@@ -87,6 +88,13 @@ namespace MARTe {
  * </li>
  * </ul>
  *
+ * By default (Engine = Contiguous) the four matrices are fused in a single matrix [A B; C D] stored contiguously with aligned
+ * and zero padded rows, and each Execute() is one matrix-vector product over the vector [x[k]; u[k]] (see StateSpaceKernelT).
+ * If most of the coefficients are zero, only the non-zero coefficients are stored and visited.
+ * The coefficients (and the state) can be stored as float32 (CoefficientsType = float32) to halve the memory traffic of large
+ * models, at the cost of the float32 precision; the signals are always float64.
+ * Engine = Matrix selects the original implementation based on the Matrix class operations.
+ *
  * The configuration syntax is (names and signal quantity are only given as an example):
  *
  * <pre>
@@ -98,6 +106,8 @@ namespace MARTe {
  *     FeedthroughMatrix = {{0 1}} //Optional
  *     ResetInEachState = 0//Compulsory. 1--> reset in each state, 0--> reset if the previous state is different from the next state
  *     SampleFrequency = 0.0001 // Currently optional and not used.
+ *     Engine = Contiguous // Optional. Contiguous (default) or Matrix.
+ *     CoefficientsType = float64 // Optional. float64 (default) or float32. float32 is only supported by the Contiguous engine.
  *     InputSignals = {
  *         InputSignal1 = { //input of the SS
  *             DataSource = "DDB1"
@@ -179,6 +189,9 @@ public:
      * sampleFrequency = 0.0\n
      * enableFeedthroughMatrix = false\n
      * resetInEachState = false\n
+     * kernel = NULL_PTR(StateSpaceKernel *)\n
+     * useMatrixEngine = false\n
+     * useFloat32Coefficients = false\n
      */
     SSMGAM();
 
@@ -198,12 +211,13 @@ public:
      * intermediateOutput2Pointer = NULL_PTR(float64 **)\n
      * stateVectorPointer = NULL_PTR(float64 **)\n
      * derivativeStateVectorPointer = NULL_PTR(float64 **)\n
+     * kernel = NULL_PTR(StateSpaceKernel *)\n
      */
     virtual ~SSMGAM();
 
     /**
      * @brief Initialise the parameters from a configuration file.
-     * @details Initialise the SS matrices, the resetInEachState and cross-check consistencies.
+     * @details Initialise the SS matrices, the resetInEachState, the Engine, the CoefficientsType and cross-check consistencies.
      * @param[in] data is the configuration file previously defined.
      * @return true if the initialisation succeeds.
      */
@@ -212,7 +226,7 @@ public:
     /**
      * @brief Initialise the inputs and the output of the GAM.
      * @details Allocate memory for the inputs and outputs, get the input and output pointers
-     * and initialise the class Matrix for use their operations.
+     * and initialise the class Matrix for use their operations. With the Contiguous engine the StateSpaceKernel is built.
      * @return true if the dimension matrices are consistent.
      */
     virtual bool Setup();
@@ -227,6 +241,7 @@ public:
      * \f$
      * y[k] = Cx[k]+Du[k]
      * \f$\n
+     * With the Contiguous engine both equations are computed by StateSpaceKernel::Update().
      *
      * @return true if the operation can be performed.
      */
@@ -485,6 +500,21 @@ private:
      * Remember the last executed state.
      */
     StreamString lastStateExecuted;
+
+    /**
+     * Contiguous engine implementation. NULL with the Matrix engine.
+     */
+    StateSpaceKernel *kernel;
+
+    /**
+     * Engine = Matrix.
+     */
+    bool useMatrixEngine;
+
+    /**
+     * CoefficientsType = float32.
+     */
+    bool useFloat32Coefficients;
 };
 
 }
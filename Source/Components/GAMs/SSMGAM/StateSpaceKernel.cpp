@@ -0,0 +1,67 @@
+/**
+ * @file StateSpaceKernel.cpp
+ * @brief Source file for class StateSpaceKernel
+ * @date 18/10/2026
+ * @author Llorenc Capella
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class StateSpaceKernel (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "StateSpaceKernel.h"
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+StateSpaceKernel::StateSpaceKernel() {
+    nOfStates = 0u;
+    nOfInputs = 0u;
+    nOfOutputs = 0u;
+    sparse = false;
+}
+StateSpaceKernel::~StateSpaceKernel() {
+
+}
+uint32 StateSpaceKernel::GetNumberOfStates() const {
+    return nOfStates;
+}
+uint32 StateSpaceKernel::GetNumberOfInputs() const {
+    return nOfInputs;
+}
+uint32 StateSpaceKernel::GetNumberOfOutputs() const {
+    return nOfOutputs;
+}
+bool StateSpaceKernel::IsSparse() const {
+    return sparse;
+}
+
+}
@@ -0,0 +1,96 @@
+/**
+ * @file StateSpaceKernel.h
+ * @brief Header file for class StateSpaceKernel
+ * @date 18/10/2026
+ * @author Llorenc Capella
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class StateSpaceKernel
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SSMGAM_STATESPACEKERNEL_H_
+#define SSMGAM_STATESPACEKERNEL_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Alignment (in bytes) of the coefficients and of the state buffers.
+ */
+const uint32 STATE_SPACE_KERNEL_ALIGNMENT = 64u;
+
+/**
+ * A fused matrix with at most one non-zero coefficient every STATE_SPACE_KERNEL_SPARSE_RATIO coefficients is stored as a sparse matrix.
+ */
+const uint32 STATE_SPACE_KERNEL_SPARSE_RATIO = 4u;
+
+/**
+ * @brief Interface for StateSpaceKernelT
+ * @details A state space kernel computes x[k+1] = Ax[k]+Bu[k] and y[k] = Cx[k]+Du[k] in a single pass over the fused matrix
+ * [A B; C D]. The only functions implemented in this class are the StateSpaceKernel constructor, GetNumberOfStates(), GetNumberOfInputs(),
+ * GetNumberOfOutputs() and IsSparse(). The rest are pure virtual functions implemented in the StateSpaceKernelT.
+ * This class is not meant to be instantiated.
+ */
+//lint -e{1526} Member function not defined. It is defined in StateSpaceKernel.cpp ...
+class StateSpaceKernel {
+public:
+    //lint -e{1526} Member function not defined. It is defined in StateSpaceKernel.cpp ...
+    StateSpaceKernel();
+    virtual ~StateSpaceKernel();
+    virtual bool Initialise(const float64 * const * const stateMatrix,
+                            const float64 * const * const inputMatrix,
+                            const float64 * const * const outputMatrix,
+                            const float64 * const * const feedthroughMatrix,
+                            const uint32 nOfStatesIn,
+                            const uint32 nOfInputsIn,
+                            const uint32 nOfOutputsIn) = 0;
+    virtual void Update(const float64 * const * const input,
+                        float64 * const * const output,
+                        float64 * const * const state) = 0;
+    virtual void Reset() = 0;
+    //lint -e{1526} Member function not defined. It is defined in StateSpaceKernel.cpp ...
+    virtual uint32 GetNumberOfStates() const;
+    //lint -e{1526} Member function not defined. It is defined in StateSpaceKernel.cpp ...
+    virtual uint32 GetNumberOfInputs() const;
+    //lint -e{1526} Member function not defined. It is defined in StateSpaceKernel.cpp ...
+    virtual uint32 GetNumberOfOutputs() const;
+    //lint -e{1526} Member function not defined. It is defined in StateSpaceKernel.cpp ...
+    virtual bool IsSparse() const;
+protected:
+    uint32 nOfStates;
+    uint32 nOfInputs;
+    uint32 nOfOutputs;
+    bool sparse;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SSMGAM_STATESPACEKERNEL_H_ */
@@ -0,0 +1,426 @@
+/**
+ * @file StateSpaceKernelT.h
+ * @brief Header file for class StateSpaceKernelT
+ * @date 18/10/2026
+ * @author Llorenc Capella
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class StateSpaceKernelT
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SSMGAM_STATESPACEKERNELT_H_
+#define SSMGAM_STATESPACEKERNELT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+#include "StateSpaceKernel.h"
+#include "AdvancedErrorManagement.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Number of partial sums of the dense dot product. Independent partial sums allow the compiler to vectorise the loop.
+ */
+const uint32 STATE_SPACE_KERNEL_LANES = 8u;
+
+//lint -esym(9107, MARTe::StateSpaceKernelT*) [MISRA C++ Rule 3-1-1] required for template implementation
+/**
+ * @brief Contiguous storage implementation of the state space equations.
+ * @details The state and the input vectors are kept together in the vector z = [x; u] and the four matrices are
+ * stored row by row in a single fused matrix:
+ *
+ * \f$
+ * \begin{bmatrix} x[k+1] \\ y[k] \end{bmatrix} = \begin{bmatrix} A & B \\ C & D \end{bmatrix} \begin{bmatrix} x[k] \\ u[k] \end{bmatrix}
+ * \f$
+ *
+ * so that each cycle is a single matrix-vector product over one contiguous block of memory (a missing D is stored as zeros).
+ * The coefficients and z are stored with type T (float32 or float64); the inputs and the outputs are always float64.
+ *
+ * Each row of the fused matrix is padded with zeros up to a multiple of STATE_SPACE_KERNEL_ALIGNMENT bytes and the rows and the
+ * z buffers are STATE_SPACE_KERNEL_ALIGNMENT aligned. The dot product of each row accumulates STATE_SPACE_KERNEL_LANES
+ * independent partial sums without any remainder loop, which the compiler vectorises.
+ *
+ * If at most one coefficient of every STATE_SPACE_KERNEL_SPARSE_RATIO is not zero, the fused matrix is stored in compressed
+ * sparse row format (only the non-zero coefficients and their column) and the dot product only visits the non-zero coefficients.
+ *
+ * Two z buffers are used: x[k+1] is written into the second buffer which becomes the first one in the next cycle, so that no copy
+ * of the state is needed.
+ *
+ * Typical use of this class:
+ *     - Initialise()
+ *     - Update()
+ */
+template<class T>
+class StateSpaceKernelT: public StateSpaceKernel {
+public:
+    /**
+     * @brief Default constructor
+     * @details null all the pointers.
+     */
+    StateSpaceKernelT();
+
+    /**
+     * @brief default destructor
+     * @details frees all the memory allocated by this class.
+     */
+    virtual ~StateSpaceKernelT();
+
+    /**
+     * @brief Builds the fused matrix and zeros the state.
+     * @param[in] stateMatrix the A matrix [nOfStatesIn x nOfStatesIn] (array of rows).
+     * @param[in] inputMatrix the B matrix [nOfStatesIn x nOfInputsIn] (array of rows).
+     * @param[in] outputMatrix the C matrix [nOfOutputsIn x nOfStatesIn] (array of rows).
+     * @param[in] feedthroughMatrix the D matrix [nOfOutputsIn x nOfInputsIn] (array of rows) or NULL if there is no feedthrough.
+     * @param[in] nOfStatesIn number of states (n).
+     * @param[in] nOfInputsIn number of inputs (p).
+     * @param[in] nOfOutputsIn number of outputs (q).
+     * @return true if the dimensions are > 0, the matrices are not NULL and the kernel was not already initialised.
+     */
+    virtual bool Initialise(const float64 * const * const stateMatrix,
+                            const float64 * const * const inputMatrix,
+                            const float64 * const * const outputMatrix,
+                            const float64 * const * const feedthroughMatrix,
+                            const uint32 nOfStatesIn,
+                            const uint32 nOfInputsIn,
+                            const uint32 nOfOutputsIn);
+
+    /**
+     * @brief Computes one iteration of the state space model.
+     * @details Writes x[k] in \a state, computes y[k] = Cx[k]+Du[k] in \a output and keeps x[k+1] = Ax[k]+Bu[k] for the next iteration.
+     * @param[in] input array of nOfInputs pointers to the inputs u[k].
+     * @param[out] output array of nOfOutputs pointers to the outputs y[k].
+     * @param[out] state array of nOfStates pointers to the states x[k].
+     * @pre
+     *    Initialise succeed.
+     */
+    virtual void Update(const float64 * const * const input,
+                        float64 * const * const output,
+                        float64 * const * const state);
+
+    /**
+     * @brief Zeros the state.
+     */
+    virtual void Reset();
+
+private:
+
+    /**
+     * @brief Returns the coefficient (row, column) of the fused matrix.
+     */
+    static float64 GetFusedCoefficient(const float64 * const * const stateMatrix,
+                                       const float64 * const * const inputMatrix,
+                                       const float64 * const * const outputMatrix,
+                                       const float64 * const * const feedthroughMatrix,
+                                       const uint32 nOfStatesIn,
+                                       const uint32 row,
+                                       const uint32 column);
+
+    /**
+     * @brief Dot product of the row \a rowIdx of the dense fused matrix with \a zIn.
+     */
+    inline T DenseDot(const uint32 rowIdx,
+                      const T * const zIn) const;
+
+    /**
+     * @brief Dot product of the row \a rowIdx of the sparse fused matrix with \a zIn.
+     */
+    inline T SparseDot(const uint32 rowIdx,
+                       const T * const zIn) const;
+
+    /**
+     * Memory allocated for the dense coefficients (or the sparse values) and the two z buffers.
+     */
+    T *memory;
+
+    /**
+     * Dense fused matrix (nOfStates + nOfOutputs rows of paddedColumns) or the non-zero coefficients if sparse.
+     */
+    T *coefficients;
+
+    /**
+     * Column of each non-zero coefficient (only if sparse).
+     */
+    uint32 *columns;
+
+    /**
+     * Index of the first non-zero coefficient of each row, plus the total number of non-zero coefficients (only if sparse).
+     */
+    uint32 *rowStart;
+
+    /**
+     * z = [x[k]; u[k]].
+     */
+    T *z;
+
+    /**
+     * Receives x[k+1].
+     */
+    T *zNext;
+
+    /**
+     * nOfStates + nOfInputs rounded up to a multiple of STATE_SPACE_KERNEL_ALIGNMENT bytes.
+     */
+    uint32 paddedColumns;
+};
+
+template<class T>
+StateSpaceKernelT<T>::StateSpaceKernelT() :
+        StateSpaceKernel() {
+    memory = NULL_PTR(T*);
+    coefficients = NULL_PTR(T*);
+    columns = NULL_PTR(uint32*);
+    rowStart = NULL_PTR(uint32*);
+    z = NULL_PTR(T*);
+    zNext = NULL_PTR(T*);
+    paddedColumns = 0u;
+}
+
+template<class T>
+StateSpaceKernelT<T>::~StateSpaceKernelT() {
+    if (memory != NULL_PTR(T*)) {
+        delete[] memory;
+    }
+    if (columns != NULL_PTR(uint32*)) {
+        delete[] columns;
+    }
+    if (rowStart != NULL_PTR(uint32*)) {
+        delete[] rowStart;
+    }
+    coefficients = NULL_PTR(T*);
+    z = NULL_PTR(T*);
+    zNext = NULL_PTR(T*);
+}
+
+template<class T>
+float64 StateSpaceKernelT<T>::GetFusedCoefficient(const float64 * const * const stateMatrix,
+                                                  const float64 * const * const inputMatrix,
+                                                  const float64 * const * const outputMatrix,
+                                                  const float64 * const * const feedthroughMatrix,
+                                                  const uint32 nOfStatesIn,
+                                                  const uint32 row,
+                                                  const uint32 column) {
+    float64 coefficient = 0.0;
+    if (row < nOfStatesIn) {
+        if (column < nOfStatesIn) {
+            coefficient = stateMatrix[row][column];
+        }
+        else {
+            coefficient = inputMatrix[row][column - nOfStatesIn];
+        }
+    }
+    else {
+        if (column < nOfStatesIn) {
+            coefficient = outputMatrix[row - nOfStatesIn][column];
+        }
+        else if (feedthroughMatrix != NULL_PTR(const float64 * const *)) {
+            coefficient = feedthroughMatrix[row - nOfStatesIn][column - nOfStatesIn];
+        }
+        else {
+            //No feedthrough
+        }
+    }
+    return coefficient;
+}
+
+template<class T>
+bool StateSpaceKernelT<T>::Initialise(const float64 * const * const stateMatrix,
+                                      const float64 * const * const inputMatrix,
+                                      const float64 * const * const outputMatrix,
+                                      const float64 * const * const feedthroughMatrix,
+                                      const uint32 nOfStatesIn,
+                                      const uint32 nOfInputsIn,
+                                      const uint32 nOfOutputsIn) {
+    bool ok = (stateMatrix != NULL_PTR(const float64 * const *)) && (inputMatrix != NULL_PTR(const float64 * const *))
+            && (outputMatrix != NULL_PTR(const float64 * const *));
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The state, input and output matrices must be defined");
+    }
+    if (ok) {
+        ok = (nOfStatesIn > 0u) && (nOfInputsIn > 0u) && (nOfOutputsIn > 0u);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The number of states, inputs and outputs must be > 0");
+        }
+    }
+    if (ok) {
+        ok = (memory == NULL_PTR(T*));
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "The state space kernel is already initialised");
+        }
+    }
+    if (ok) {
+        nOfStates = nOfStatesIn;
+        nOfInputs = nOfInputsIn;
+        nOfOutputs = nOfOutputsIn;
+        const uint32 nOfRows = nOfStates + nOfOutputs;
+        const uint32 nOfColumns = nOfStates + nOfInputs;
+        const uint32 elementsPerLine = STATE_SPACE_KERNEL_ALIGNMENT / static_cast<uint32>(sizeof(T));
+        paddedColumns = ((nOfColumns + elementsPerLine - 1u) / elementsPerLine) * elementsPerLine;
+
+        uint32 nOfNonZero = 0u;
+        for (uint32 r = 0u; r < nOfRows; r++) {
+            for (uint32 c = 0u; c < nOfColumns; c++) {
+                if (static_cast<T>(GetFusedCoefficient(stateMatrix, inputMatrix, outputMatrix, feedthroughMatrix, nOfStates, r, c)) != static_cast<T>(0)) {
+                    nOfNonZero++;
+                }
+            }
+        }
+        sparse = ((nOfNonZero * STATE_SPACE_KERNEL_SPARSE_RATIO) <= (nOfRows * nOfColumns));
+
+        uint32 nOfCoefficients = nOfRows * paddedColumns;
+        if (sparse) {
+            //Keep the z buffers aligned
+            nOfCoefficients = ((nOfNonZero + elementsPerLine - 1u) / elementsPerLine) * elementsPerLine;
+        }
+        //elementsPerLine more to align the beginning of the memory
+        const uint32 nOfElements = nOfCoefficients + (2u * paddedColumns) + elementsPerLine;
+        memory = new T[nOfElements];
+        for (uint32 i = 0u; i < nOfElements; i++) {
+            memory[i] = static_cast<T>(0);
+        }
+        uint32 misalignment = static_cast<uint32>(reinterpret_cast<uintp>(memory) % STATE_SPACE_KERNEL_ALIGNMENT);
+        uint32 offset = 0u;
+        if (misalignment != 0u) {
+            offset = (STATE_SPACE_KERNEL_ALIGNMENT - misalignment) / static_cast<uint32>(sizeof(T));
+        }
+        coefficients = &memory[offset];
+        z = &coefficients[nOfCoefficients];
+        zNext = &z[paddedColumns];
+
+        if (sparse) {
+            columns = new uint32[nOfNonZero + 1u];
+            rowStart = new uint32[nOfRows + 1u];
+            uint32 k = 0u;
+            for (uint32 r = 0u; r < nOfRows; r++) {
+                rowStart[r] = k;
+                for (uint32 c = 0u; c < nOfColumns; c++) {
+                    T coefficient = static_cast<T>(GetFusedCoefficient(stateMatrix, inputMatrix, outputMatrix, feedthroughMatrix, nOfStates, r, c));
+                    if (coefficient != static_cast<T>(0)) {
+                        coefficients[k] = coefficient;
+                        columns[k] = c;
+                        k++;
+                    }
+                }
+            }
+            rowStart[nOfRows] = k;
+        }
+        else {
+            for (uint32 r = 0u; r < nOfRows; r++) {
+                T *row = &coefficients[r * paddedColumns];
+                for (uint32 c = 0u; c < nOfColumns; c++) {
+                    row[c] = static_cast<T>(GetFusedCoefficient(stateMatrix, inputMatrix, outputMatrix, feedthroughMatrix, nOfStates, r, c));
+                }
+            }
+        }
+    }
+    return ok;
+}
+
+template<class T>
+inline T StateSpaceKernelT<T>::SparseDot(const uint32 rowIdx,
+                                         const T * const zIn) const {
+    T result = static_cast<T>(0);
+    const uint32 end = rowStart[rowIdx + 1u];
+    for (uint32 k = rowStart[rowIdx]; k < end; k++) {
+        result += coefficients[k] * zIn[columns[k]];
+    }
+    return result;
+}
+
+template<class T>
+inline T StateSpaceKernelT<T>::DenseDot(const uint32 rowIdx,
+                                        const T * const zIn) const {
+    const T * const row = &coefficients[rowIdx * paddedColumns];
+    //Independent partial sums (kept in registers) break the dependency between consecutive additions.
+    T acc0 = static_cast<T>(0);
+    T acc1 = static_cast<T>(0);
+    T acc2 = static_cast<T>(0);
+    T acc3 = static_cast<T>(0);
+    T acc4 = static_cast<T>(0);
+    T acc5 = static_cast<T>(0);
+    T acc6 = static_cast<T>(0);
+    T acc7 = static_cast<T>(0);
+    //paddedColumns is a multiple of STATE_SPACE_KERNEL_LANES and the padding is zero: no remainder
+    for (uint32 c = 0u; c < paddedColumns; c += STATE_SPACE_KERNEL_LANES) {
+        acc0 += row[c] * zIn[c];
+        acc1 += row[c + 1u] * zIn[c + 1u];
+        acc2 += row[c + 2u] * zIn[c + 2u];
+        acc3 += row[c + 3u] * zIn[c + 3u];
+        acc4 += row[c + 4u] * zIn[c + 4u];
+        acc5 += row[c + 5u] * zIn[c + 5u];
+        acc6 += row[c + 6u] * zIn[c + 6u];
+        acc7 += row[c + 7u] * zIn[c + 7u];
+    }
+    return ((acc0 + acc1) + (acc2 + acc3)) + ((acc4 + acc5) + (acc6 + acc7));
+}
+
+template<class T>
+//lint -e{613} Possible use of null pointer --> Update cannot be called if Initialise does not succeed.
+void StateSpaceKernelT<T>::Update(const float64 * const * const input,
+                                  float64 * const * const output,
+                                  float64 * const * const state) {
+    for (uint32 i = 0u; i < nOfInputs; i++) {
+        z[nOfStates + i] = static_cast<T>(*input[i]);
+    }
+    for (uint32 i = 0u; i < nOfStates; i++) {
+        *state[i] = static_cast<float64>(z[i]);
+    }
+    if (sparse) {
+        for (uint32 i = 0u; i < nOfOutputs; i++) {
+            *output[i] = static_cast<float64>(SparseDot(nOfStates + i, z));
+        }
+        for (uint32 i = 0u; i < nOfStates; i++) {
+            zNext[i] = SparseDot(i, z);
+        }
+    }
+    else {
+        for (uint32 i = 0u; i < nOfOutputs; i++) {
+            *output[i] = static_cast<float64>(DenseDot(nOfStates + i, z));
+        }
+        for (uint32 i = 0u; i < nOfStates; i++) {
+            zNext[i] = DenseDot(i, z);
+        }
+    }
+    T *aux = z;
+    z = zNext;
+    zNext = aux;
+}
+
+template<class T>
+void StateSpaceKernelT<T>::Reset() {
+    if ((z != NULL_PTR(T*)) && (zNext != NULL_PTR(T*))) {
+        for (uint32 i = 0u; i < nOfStates; i++) {
+            z[i] = static_cast<T>(0);
+            zNext[i] = static_cast<T>(0);
+        }
+    }
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SSMGAM_STATESPACEKERNELT_H_ */
@@ -76,6 +76,7 @@ SimulinkInterface::SimulinkInterface() {
 
     transpose    = true;
     isStructured = false;
+    decimation   = 1u;
 
 }
 
@@ -315,34 +316,46 @@ bool SimulinkInterface::TransposeAndCopyT(void *const destination, const void *c
     uint32 numberOfColumns = dimensions[1u];
     uint32 numberOfPages   = dimensions.GetNumberOfElements() <= 2u ? 1u : dimensions[2u];
 
+    bool toColumnMajor = ((mode == InputPort) || (mode == Parameter));
+    T *destinationT    = static_cast<T *>(destination);
+    const T *sourceT   = static_cast<const T *>(source);
+
     if (numberOfPages > 1u) {
         // 3D matrix
         for (uint32 rowIdx = 0u; rowIdx < numberOfRows; rowIdx++) {
             for (uint32 colIdx = 0u; colIdx < numberOfColumns; colIdx++) {
                 for (uint32 pagIdx = 0u; pagIdx < numberOfPages; pagIdx++) {
-                    if (mode == InputPort || mode == Parameter) {   // row-major to col-major
-                        *((T *)destination + rowIdx + numberOfRows  * colIdx + numberOfColumns * numberOfRows  * pagIdx)
-                        = *((T *)source    + pagIdx + numberOfPages * colIdx + numberOfColumns * numberOfPages * rowIdx);
+                    uint32 rowMajorIdx = pagIdx + (numberOfPages * colIdx) + (numberOfColumns * numberOfPages * rowIdx);
+                    uint32 colMajorIdx = rowIdx + (numberOfRows  * colIdx) + (numberOfColumns * numberOfRows  * pagIdx);
+                    if (toColumnMajor) {
+                        destinationT[colMajorIdx] = sourceT[rowMajorIdx];
                     }
-                    else {   // col-major to row-major
-                        *((T *)destination + pagIdx + numberOfPages * colIdx + numberOfColumns * numberOfPages * rowIdx)
-                        = *((T *)source    + rowIdx + numberOfRows  * colIdx + numberOfColumns * numberOfRows  * pagIdx);
+                    else {
+                        destinationT[rowMajorIdx] = sourceT[colMajorIdx];
                     }
                 }
             }
         }
     }
     else {
-        // 2D matrix
-        for (uint32 rowIdx = 0u; rowIdx < numberOfRows; rowIdx++) {
-            for (uint32 colIdx = 0u; colIdx < numberOfColumns; colIdx++) {
-                if (mode == InputPort || mode == Parameter) {
-                    *( (T*) destination + rowIdx + numberOfRows    * colIdx )
-                    = *( (T*) source    + colIdx + numberOfColumns * rowIdx);
+        // 2D matrix, transposed one tile at a time
+        for (uint32 rowBlockIdx = 0u; rowBlockIdx < numberOfRows; rowBlockIdx += transposeBlockSize) {
+            uint32 rowBlockEnd = ((numberOfRows - rowBlockIdx) > transposeBlockSize) ? (rowBlockIdx + transposeBlockSize) : numberOfRows;
+            for (uint32 colBlockIdx = 0u; colBlockIdx < numberOfColumns; colBlockIdx += transposeBlockSize) {
+                uint32 colBlockEnd = ((numberOfColumns - colBlockIdx) > transposeBlockSize) ? (colBlockIdx + transposeBlockSize) : numberOfColumns;
+                if (toColumnMajor) {
+                    for (uint32 rowIdx = rowBlockIdx; rowIdx < rowBlockEnd; rowIdx++) {
+                        for (uint32 colIdx = colBlockIdx; colIdx < colBlockEnd; colIdx++) {
+                            destinationT[rowIdx + (numberOfRows * colIdx)] = sourceT[colIdx + (numberOfColumns * rowIdx)];
+                        }
+                    }
                 }
                 else {
-                    *((T *)destination + colIdx + numberOfColumns * rowIdx)
-                    = *((T *)source    + rowIdx + numberOfRows    * colIdx);
+                    for (uint32 rowIdx = rowBlockIdx; rowIdx < rowBlockEnd; rowIdx++) {
+                        for (uint32 colIdx = colBlockIdx; colIdx < colBlockEnd; colIdx++) {
+                            destinationT[colIdx + (numberOfColumns * rowIdx)] = sourceT[rowIdx + (numberOfRows * colIdx)];
+                        }
+                    }
                 }
             }
         }
@@ -351,6 +364,16 @@ bool SimulinkInterface::TransposeAndCopyT(void *const destination, const void *c
     return true;
 }
 
+bool SimulinkInterface::IsTransposeTrivial() const {
+
+    bool trivial = (dimensions.GetNumberOfElements() < 2u);
+    if (!trivial) {
+        bool isPaged = (dimensions.GetNumberOfElements() > 2u) ? (dimensions[2u] > 1u) : false;
+        trivial = (!isPaged) && ((dimensions[0u] == 1u) || (dimensions[1u] == 1u));
+    }
+    return trivial;
+}
+
 
 
 /*---------------------------------------------------------------------------*/
@@ -594,4 +617,145 @@ uint32 SimulinkRootInterface::GetInterfaceBytesize(ConfigurationDatabase structu
 
 
 
+/*---------------------------------------------------------------------------*/
+/*                            SimulinkCopyPlan                               */
+/*---------------------------------------------------------------------------*/
+
+SimulinkCopyPlan::SimulinkCopyPlan() : pendingOperations() {
+    operations         = NULL_PTR(SimulinkCopyOperation*);
+    numberOfOperations = 0u;
+}
+
+//lint -e{1551} Justification: absolutely no exception thrown whatsoever
+SimulinkCopyPlan::~SimulinkCopyPlan() {
+    while (pendingOperations.GetSize() > 0u) {
+        SimulinkCopyOperation* toDelete;
+        if (pendingOperations.Extract(0u, toDelete)) {
+            delete toDelete;
+        }
+    }
+    if (operations != NULL_PTR(SimulinkCopyOperation*)) {
+        delete[] operations;
+    }
+}
+
+bool SimulinkCopyPlan::Add(const SimulinkRootInterface &rootInterface, const SimulinkNonVirtualBusMode copyMode) {
+
+    bool ok = (operations == NULL_PTR(SimulinkCopyOperation*));
+    // Same cases of SimulinkRootInterface::CopyData()
+    if (ok) {
+        bool elementWise = ((copyMode == StructuredBusMode) && (rootInterface.isStructured));
+        if (elementWise) {
+            for (uint32 carriedSignalIdx = 0u; (carriedSignalIdx < rootInterface.GetSize()) && ok; carriedSignalIdx++) {
+                SimulinkInterface* element = rootInterface[carriedSignalIdx];
+                if (element->destPtr != NULL) {
+                    bool plainCopy = (!rootInterface.transpose) || (element->IsTransposeTrivial());
+                    ok = AddOperation(element->destPtr, element->sourcePtr, element->byteSize,
+                                      plainCopy ? NULL_PTR(SimulinkInterface*) : element, rootInterface.interfaceType, element->decimation);
+                }
+            }
+        }
+        else if (rootInterface.destPtr != NULL) {
+            // Byte array buses are always plain copies as the port is always a 1D data buffer
+            bool plainCopy = (!rootInterface.transpose) || (rootInterface.isStructured) || (rootInterface.IsTransposeTrivial());
+            /*lint -e{1763} the transposer is only used to call TransposeAndCopy on the same memory CopyData() would use */
+            ok = AddOperation(rootInterface.destPtr, rootInterface.sourcePtr, rootInterface.byteSize,
+                              plainCopy ? NULL_PTR(SimulinkInterface*) : const_cast<SimulinkRootInterface*>(&rootInterface),
+                              rootInterface.interfaceType, rootInterface.decimation);
+        }
+        else {
+            // Not mapped to any MARTe signal
+        }
+    }
+
+    return ok;
+}
+
+/*lint -e{429} Justification: newOperation is freed in Finalise() or in the destructor */
+bool SimulinkCopyPlan::AddOperation(void* const destination, const void* const source, const uint32 size,
+                                    SimulinkInterface* const transposer, const InterfaceType mode, const uint32 decimation) {
+
+    bool merged = false;
+    uint32 numberOfPendingOperations = pendingOperations.GetSize();
+    bool mergeable = (transposer == NULL_PTR(SimulinkInterface*)) && (decimation == 1u);
+    if ((numberOfPendingOperations > 0u) && (mergeable)) {
+        SimulinkCopyOperation* last = pendingOperations[numberOfPendingOperations - 1u];
+        bool lastMergeable = (last->transposer == NULL_PTR(SimulinkInterface*)) && (last->decimation == 1u);
+        if (lastMergeable) {
+            /*lint -e{9016} pointer arithmetic needed to check the contiguity of the two copies*/
+            bool contiguous = ((static_cast<uint8*>(last->destination) + last->size) == static_cast<uint8*>(destination))
+                           && ((static_cast<const uint8*>(last->source) + last->size) == static_cast<const uint8*>(source));
+            if (contiguous) {
+                last->size += size;
+                merged = true;
+            }
+        }
+    }
+
+    bool ok = true;
+    if (!merged) {
+        SimulinkCopyOperation* newOperation = new SimulinkCopyOperation;
+        newOperation->destination = destination;
+        newOperation->source      = source;
+        newOperation->size        = size;
+        newOperation->transposer  = transposer;
+        newOperation->mode        = mode;
+        newOperation->decimation  = decimation;
+        newOperation->counter     = 0u;
+        ok = pendingOperations.Add(newOperation);
+    }
+
+    return ok;
+}
+
+bool SimulinkCopyPlan::Finalise() {
+
+    bool ok = (operations == NULL_PTR(SimulinkCopyOperation*));
+    if (ok) {
+        numberOfOperations = pendingOperations.GetSize();
+        if (numberOfOperations > 0u) {
+            operations = new SimulinkCopyOperation[numberOfOperations];
+        }
+        for (uint32 opIdx = 0u; (opIdx < numberOfOperations) && ok; opIdx++) {
+            SimulinkCopyOperation* pendingOperation;
+            ok = pendingOperations.Extract(0u, pendingOperation);
+            if (ok) {
+                operations[opIdx] = *pendingOperation;
+                delete pendingOperation;
+            }
+        }
+    }
+
+    return ok;
+}
+
+bool SimulinkCopyPlan::Execute() {
+
+    bool ok = true;
+    for (uint32 opIdx = 0u; (opIdx < numberOfOperations) && ok; opIdx++) {
+        SimulinkCopyOperation &operation = operations[opIdx];
+        bool copy = (operation.decimation == 1u);
+        if ( (!copy) && (operation.decimation > 1u) ) {
+            copy = (operation.counter == 0u);
+            operation.counter = copy ? (operation.decimation - 1u) : (operation.counter - 1u);
+        }
+        if (copy) {
+            if (operation.transposer == NULL_PTR(SimulinkInterface*)) {
+                ok = MemoryOperationsHelper::Copy(operation.destination, operation.source, operation.size);
+            }
+            else {
+                ok = operation.transposer->TransposeAndCopy(operation.destination, operation.source, operation.mode);
+            }
+        }
+    }
+
+    return ok;
+}
+
+uint32 SimulinkCopyPlan::GetNumberOfOperations() const {
+    return numberOfOperations;
+}
+
+
+
 } /* namespace MARTe */
@@ -146,6 +146,7 @@ public:
     void* sourcePtr;                     //<! Pointer to where this interface shall retrive its buffer from
     bool transpose;                      //<! Whether the interface needs to be converted from col-major to row-major layout or viceversa.
     bool isStructured;                   //<! Whether the interface carries a structured data.
+    uint32 decimation;                   //<! The interface is copied once every `decimation` executions (0 means never). Only used by logging signals.
 
 
     /**
@@ -190,11 +191,29 @@ public:
 
     /**
      * @brief Templated version of TransposeAndCopy().
+     * @details 2D matrices are transposed in square tiles of
+     *          #transposeBlockSize elements per side, so that
+     *          both the source and the destination tiles stay in cache
+     *          regardless of the matrix size.
      */
     template<typename T>
     bool TransposeAndCopyT(void *const destination, const void *const source, const InterfaceType mode);
+
+    /**
+     * @brief   Checks if the transposition of this interface is a plain copy.
+     * @details Scalars, vectors and matrices with a single row or a single column
+     *          have the same layout in row-major and in column-major orientation.
+     * @return  `true` if TransposeAndCopy() is equivalent to a memory copy for this interface.
+     */
+    bool IsTransposeTrivial() const;
 };
 
+/**
+ * @brief Side of the square tiles used by SimulinkInterface::TransposeAndCopyT() for 2D matrices.
+ */
+/*lint -esym(551,MARTe::transposeBlockSize) the symbol is accessed in SimulinkInterfaces.cpp */
+static const uint32 transposeBlockSize = 16u;
+
 /**
  * @brief   Represents each root interface (port, parameter, logging signal)
  * @details The root interface is represented both as a StaticList<SimulinkInterface*>
@@ -261,6 +280,109 @@ public:
 
 };
 
+/*---------------------------------------------------------------------------*/
+/*                             SimulinkCopyPlan                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief A single copy between the GAM memory and the model memory.
+ */
+struct SimulinkCopyOperation {
+    void*              destination;     //!< Where the data is copied to.
+    const void*        source;          //!< Where the data is copied from.
+    uint32             size;            //!< Number of bytes to be copied.
+    SimulinkInterface* transposer;      //!< If not NULL the data is copied with transposer->TransposeAndCopy().
+    InterfaceType      mode;            //!< The direction of the transposition.
+    uint32             decimation;      //!< The copy is performed once every `decimation` executions (0 means never).
+    uint32             counter;         //!< Number of executions left before the next copy.
+};
+
+/**
+ * @brief   Flat list of the copies to be performed at every execution of the model.
+ * @details The plan is built once, after the ports have been mapped, by
+ *          walking the SimulinkRootInterface objects in the same way as
+ *          SimulinkRootInterface::CopyData() does. Execute() then only
+ *          has to cycle over an array, without any per-interface branching.
+ *
+ *          While the plan is built:
+ *          - transpositions which are equivalent to a plain copy
+ *            (see SimulinkInterface::IsTransposeTrivial()) are demoted to
+ *            a plain copy;
+ *          - plain copies that are contiguous both in the source and in
+ *            the destination memory (e.g. the elements of a bus which
+ *            are mapped to consecutive GAM signals) are merged into a
+ *            single copy.
+ *
+ *          Copies with a decimation different from 1 are never merged.
+ */
+class SimulinkCopyPlan {
+
+public:
+
+    /**
+     * @brief Default constructor.
+     */
+    SimulinkCopyPlan();
+
+    /**
+     * @brief Destructor. Frees the operations.
+     */
+    ~SimulinkCopyPlan();
+
+    /**
+     * @brief   Adds the copies required by a root interface.
+     * @details Interfaces without a corresponding MARTe signal
+     *          (i.e. destPtr == NULL) are skipped.
+     * @param[in] rootInterface the interface to be added to the plan.
+     * @param[in] copyMode the mode in which nonvirtual buses are mapped.
+     * @return `true` if the operations are successfully added.
+     * @pre Finalise() has not been called.
+     */
+    bool Add(const SimulinkRootInterface &rootInterface, const SimulinkNonVirtualBusMode copyMode);
+
+    /**
+     * @brief  Moves the operations added so far to the array used by Execute().
+     * @return `true` if the array is successfully allocated.
+     */
+    bool Finalise();
+
+    /**
+     * @brief  Performs all the copies of the plan.
+     * @return `true` if all the copies are successful.
+     * @pre Finalise() == `true`
+     */
+    bool Execute();
+
+    /**
+     * @brief  Gets the number of copies in the plan.
+     * @return the number of copies in the plan.
+     */
+    uint32 GetNumberOfOperations() const;
+
+private:
+
+    /**
+     * @brief Appends an operation, merging it with the last one if possible.
+     */
+    bool AddOperation(void* const destination, const void* const source, const uint32 size,
+                      SimulinkInterface* const transposer, const InterfaceType mode, const uint32 decimation);
+
+    /**
+     * The operations added before Finalise().
+     */
+    StaticList<SimulinkCopyOperation*> pendingOperations;
+
+    /**
+     * The operations performed by Execute().
+     */
+    SimulinkCopyOperation* operations;
+
+    /**
+     * Number of elements of the operations array.
+     */
+    uint32 numberOfOperations;
+};
+
 } /* namespace MARTe */
 
 #endif /* SIMULINKINTERFACES_H_ */
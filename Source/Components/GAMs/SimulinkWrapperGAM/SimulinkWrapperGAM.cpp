@@ -1157,6 +1157,29 @@ ErrorManagement::ErrorType SimulinkWrapperGAM::SetupSimulink() {
     }
 
 
+    ///-------------------------------------------------------------------------
+    /// 3b. Build the copy plans used by Execute()
+    ///-------------------------------------------------------------------------
+
+    if (ret.ErrorsCleared()) {
+        ret.internalSetupError = !BuildCopyPlan(inputsCopyPlan, inputs, modelNumOfInputs);
+        if (ret.ErrorsCleared()) {
+            ret.internalSetupError = !BuildCopyPlan(outputsCopyPlan, outputs, modelNumOfOutputs);
+        }
+        if (ret.ErrorsCleared()) {
+            ret.internalSetupError = !BuildCopyPlan(signalsCopyPlan, signals, modelNumOfSignals);
+        }
+        if (ret.ErrorsCleared()) {
+            if (verbosityLevel > 1u) {
+                REPORT_ERROR(ErrorManagement::Information, "[%s] - Copies per step: %u input, %u output, %u logging.", GetName(),
+                    inputsCopyPlan.GetNumberOfOperations(), outputsCopyPlan.GetNumberOfOperations(), signalsCopyPlan.GetNumberOfOperations());
+            }
+        }
+        else {
+            REPORT_ERROR(ret, "[%s] - Failed to build the copy plans.", GetName());
+        }
+    }
+
     ///-------------------------------------------------------------------------
     /// 4. Verify that the external parameter source (if any)
     ///    is compatible with the GAM
@@ -1324,13 +1347,11 @@ ErrorManagement::ErrorType SimulinkWrapperGAM::SetupSimulink() {
 
 bool SimulinkWrapperGAM::Execute() {
 
-    uint32 portIdx;
-
     bool ok = (states != NULL) && (inputs != NULL) && (outputs != NULL) && (signals != NULL);
 
     // Inputs update
-    for (portIdx = 0u; (portIdx < modelNumOfInputs) && (inputs != NULL) && ok; portIdx++) {
-        ok = inputs[portIdx].CopyData(nonVirtualBusMode);
+    if (ok) {
+        ok = inputsCopyPlan.Execute();
     }
 
     // Model step
@@ -1339,12 +1360,25 @@ bool SimulinkWrapperGAM::Execute() {
     }
 
     // Outputs update
-    for (portIdx = 0u; (portIdx < modelNumOfOutputs) && (outputs != NULL) && ok; portIdx++) {
-        ok = outputs[portIdx].CopyData(nonVirtualBusMode);
+    if (ok) {
+        ok = outputsCopyPlan.Execute();
     }
-    
-    for (portIdx = 0u; (portIdx < modelNumOfSignals) && (signals != NULL) && ok; portIdx++) {
-        ok = signals[portIdx].CopyData(nonVirtualBusMode);
+
+    if (ok) {
+        ok = signalsCopyPlan.Execute();
+    }
+
+    return ok;
+}
+
+bool SimulinkWrapperGAM::BuildCopyPlan(SimulinkCopyPlan &plan, const SimulinkRootInterface* const interfaceArray, const uint32 numOfInterfaces) const {
+
+    bool ok = true;
+    for (uint32 portIdx = 0u; (portIdx < numOfInterfaces) && (interfaceArray != NULL) && ok; portIdx++) {
+        ok = plan.Add(interfaceArray[portIdx], nonVirtualBusMode);
+    }
+    if (ok) {
+        ok = plan.Finalise();
     }
 
     return ok;
@@ -1808,6 +1842,34 @@ ErrorManagement::ErrorType SimulinkWrapperGAM::MapPorts(const InterfaceType inte
 
         }
 
+        // Logging signals may be decimated or switched off
+        uint32 decimation = 1u;
+        if ( ret.ErrorsCleared() && found && (interfaceType == Signal) ) {
+            bool noErrors = signalsDatabase.MoveToRoot();
+            if (noErrors) {
+                noErrors = signalsDatabase.MoveRelative("OutputSignals");
+            }
+            if (noErrors) {
+                noErrors = signalsDatabase.MoveToChild(signalIdx);
+            }
+            if (noErrors) {
+                if (!signalsDatabase.Read("LoggingDecimation", decimation)) {
+                    decimation = 1u;
+                }
+                else if (verbosityLevel > 1u) {
+                    REPORT_ERROR(ErrorManagement::Information, "[%s] - %s signal `%s`: LoggingDecimation set to %u.",
+                        GetName(), directionName.Buffer(), GAMSignalName.Buffer(), decimation);
+                }
+                else {
+                    //NOOP
+                }
+            }
+            ret.exception = !noErrors;
+            if (!ret) {
+                REPORT_ERROR(ret, "[%s] - %s signal `%s`: could not read the signal configuration.", GetName(), directionName.Buffer(), GAMSignalName.Buffer());
+            }
+        }
+
         // Ok, here we can map memory inputs
         if ( ret.ErrorsCleared() && found && (signalList != NULL) ) {
 
@@ -1830,6 +1892,7 @@ ErrorManagement::ErrorType SimulinkWrapperGAM::MapPorts(const InterfaceType inte
                     signalList[portIdx][signalInPortIdx]->MARTeAddress = GetOutputSignalMemory(signalIdx);
                     signalList[portIdx][signalInPortIdx]->sourcePtr    = signalList[portIdx][signalInPortIdx]->dataAddr;
                     signalList[portIdx][signalInPortIdx]->destPtr      = signalList[portIdx][signalInPortIdx]->MARTeAddress;
+                    signalList[portIdx][signalInPortIdx]->decimation   = decimation;
 
                     if (signalInPortIdx == 0u) {
                         signalList[portIdx].MARTeAddress = GetOutputSignalMemory(signalIdx);
@@ -1855,6 +1918,7 @@ ErrorManagement::ErrorType SimulinkWrapperGAM::MapPorts(const InterfaceType inte
 
                     signalList[portIdx].sourcePtr = signalList[portIdx].dataAddr;
                     signalList[portIdx].destPtr   = signalList[portIdx].MARTeAddress;
+                    signalList[portIdx].decimation = decimation;
                 }
                 else {
                     REPORT_ERROR(ErrorManagement::ParametersError, "[%s] - Invalid InterfaceType in MapPorts()", GetName());
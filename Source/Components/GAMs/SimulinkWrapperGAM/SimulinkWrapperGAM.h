@@ -922,6 +922,26 @@ namespace MARTe {
  * The name of the GAM output signal must match that of the logging signal
  * for the signal to be mapped.
  *
+ * Copying logging signals out of the model at every step may be expensive
+ * for large signals. Each logging signal accepts the optional
+ * `LoggingDecimation` field: the signal is copied once every
+ * `LoggingDecimation` executions of the GAM (starting from the first one),
+ * and keeps its last value in between. `LoggingDecimation = 0` switches
+ * the copy off, so that the GAM signal is never updated.
+ * Default value: 1 (copied at every execution).
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * OutputSignals = {
+ *     logging_signal = {
+ *         Type               = float32
+ *         NumberOfDimensions = 1
+ *         NumberOfElements   = 6
+ *         DataSource         = DDB1
+ *         LoggingDecimation  = 10
+ *     }
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
  * @warning The connection of logging signals to a GAM output *is not*
  *          enforced by setting the `EnforceModelSignalCoverage` to true.
  *          This means that if the model containg a logging signal named
@@ -1086,6 +1106,7 @@ namespace MARTe {
  * 1.0     | 01/01/2018 | Initial release.
  * 2.0     | 01/07/2020 | QA, rework, support for external parameter source, support for literal parameters.
  * 3.0     | 11/09/2025 | Add structured arrays, logging of block signals and 3D matrices in `Structured` mode. Extensive rework of interface methods.
+ * 3.1     | 18/10/2026 | Precomputed and coalesced copy plans, tiled transposition, `LoggingDecimation` of logging signals.
  *
  *
  * @todo Fix int64/uint64 issue: models with [u]int64 signals when compiled
@@ -1169,6 +1190,16 @@ protected:
     uint32 modelNumOfSignals;           //!< Number of internal logging signals of the model.
     //@}
 
+    /**
+     * @name  Copy plans
+     * @brief Copies performed by Execute() before (inputs) and after (outputs and logging signals) the model step.
+     */
+    //@{
+    SimulinkCopyPlan inputsCopyPlan;    //!< Copies from the GAM input signals to the model inputs.
+    SimulinkCopyPlan outputsCopyPlan;   //!< Copies from the model outputs to the GAM output signals.
+    SimulinkCopyPlan signalsCopyPlan;   //!< Copies from the model logging signals to the GAM output signals.
+    //@}
+
     ErrorManagement::ErrorType status;  //!< The error state of the GAM
     
     /**
@@ -1275,6 +1306,15 @@ private:
      * @brief Prepare model for execution.
      */
     ErrorManagement::ErrorType SetupSimulink();
+
+    /**
+     * @brief     Adds all the interfaces of an array to a copy plan and finalises it.
+     * @param[out] plan            the copy plan to be built.
+     * @param[in]  interfaceArray  array of `SimulinkRootInterface`s already mapped by MapPorts().
+     * @param[in]  numOfInterfaces number of elements of interfaceArray.
+     * @return    `true` if the plan is successfully built.
+     */
+    bool BuildCopyPlan(SimulinkCopyPlan &plan, const SimulinkRootInterface* const interfaceArray, const uint32 numOfInterfaces) const;
     
     /**
      * @brief     Returns `true` if a C API type has the same size of checkSize.
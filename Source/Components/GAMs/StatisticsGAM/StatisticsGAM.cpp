@@ -52,6 +52,7 @@ StatisticsGAM::StatisticsGAM() :
     startCycleNumber = 0u;
     cycleCounter = 0u;
     infiniteMaxMin = false;
+    numberOfSamples = 1u;
 }
 
 /*lint -e{1551} no exception thrown deleting the StatisticsHelperT<> instance*/
@@ -179,11 +180,11 @@ bool StatisticsGAM::Setup() {
     }
 
     if (ret) {
-        ret = (signalNumberOfDimensions == 0u);
+        ret = (signalNumberOfDimensions <= 1u);
     }
 
     if (!ret) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(InputSignals, 0u) != 0u");
+        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(InputSignals, 0u) > 1u");
     }
 
     uint32 signalNumberOfElements = 0u;
@@ -193,11 +194,15 @@ bool StatisticsGAM::Setup() {
     }
 
     if (ret) {
-        ret = (signalNumberOfElements == 1u);
+        ret = (signalNumberOfElements > 0u);
     }
 
     if (!ret) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(InputSignals, 0u) != 1u");
+        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(InputSignals, 0u) == 0u");
+    }
+
+    if (ret) {
+        numberOfSamples = signalNumberOfElements;
     }
 
     uint32 signalIndex;
@@ -342,18 +347,23 @@ template<class Type> bool StatisticsGAM::ExecuteT() {
 
     /*lint -e{665} [MISRA C++ Rule 16-0-6] templated type passed as argument to MACRO*/
     StatisticsHelperT<Type> * ref = NULL_PTR(StatisticsHelperT<Type> *);
-    Type input = (Type) 0;
     Type output = (Type) 0;
 
-    bool ret = MemoryOperationsHelper::Copy(&input, GetInputSignalMemory(0u), sizeof(Type));
-
-    if (ret) {
-        ret = (stats != NULL_PTR(void *));
-    }
+    bool ret = (stats != NULL_PTR(void *));
 
     if (ret) {
         ref = static_cast<StatisticsHelperT<Type> *>(stats);
-        ret = ref->PushSample(input, infiniteMaxMin);
+        if (numberOfSamples == 1u) {
+            Type input = (Type) 0;
+            ret = MemoryOperationsHelper::Copy(&input, GetInputSignalMemory(0u), sizeof(Type));
+            if (ret) {
+                ret = ref->PushSample(input, infiniteMaxMin);
+            }
+        }
+        else {
+            /*lint -e{925} the input signal memory holds numberOfSamples elements of Type*/
+            ret = ref->PushSamples(static_cast<const Type *>(GetInputSignalMemory(0u)), numberOfSamples, infiniteMaxMin);
+        }
     }
 
     if (ret) {
@@ -49,6 +49,12 @@ namespace MARTe {
  * input signal, i.e. (u)int8, (u)int16, (uint32), (u)int64, float32 and float64, and
  * produces the statistics computation in the same native type. As such, the output
  * signals are required to conform to the type of the input signal.
+ * The input signal may also be an array (NumberOfDimensions = 1), in which case all its
+ * elements are inserted in the moving window, in order, on each cycle (e.g. a signal
+ * acquired in blocks of samples). The output signals are always scalar.
+ *
+ * The cost of each sample is amortised O(1), i.e. independent of the window size, also
+ * for the minimum and maximum.
  *
  * The order of the output signals is fixed and will defined if the standard deviation,
  *  max. and min. value are output as signals.
@@ -131,7 +137,8 @@ public:
      * @pre
      *   SetConfiguredDatabase() && GetNumberOfInputSignals() > 0 &&
      *   GetNumberOfOutputSignals() > 0 &&
-     *   All signals are scalar and share the same type.
+     *   All signals share the same type, the output signals are scalar and the input
+     *   signal is scalar or a one-dimensional array.
      * @post 
      *   stats = (void*) new StatisticsHelperT<signalType> (windowSize);
      */
@@ -192,6 +199,11 @@ public:
      */
     bool infiniteMaxMin;
 
+    /**
+     * Number of elements of the input signal inserted in the window on each cycle.
+     */
+    uint32 numberOfSamples;
+
 };
 
 }
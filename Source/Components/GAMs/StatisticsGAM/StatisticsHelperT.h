@@ -46,13 +46,17 @@ namespace MARTe {
 
 /**
  * @brief The class provides templated statistics computation.
- * @details The class allocates circular buffers to store values of samples and
+ * @details The class allocates a circular buffer to store values of samples and
  * computes average, standard deviation, minimum and maximum over a moving time
  * window. As such, the sum of samples and sum of squares is computed upon calling
- * the PushSample() method in a way to minimise operations. The minimum or maximum
- * over the historical buffer are re-computed only when needed, i.e. in case the
- * oldest sample being pushed out of the moving time window is equal to the stored
- * minimum or maximum.
+ * the PushSample() method in a way to minimise operations. For floating point types
+ * the sums are Kahan-compensated, so that the rounding error of adding and removing
+ * samples does not accumulate over the lifetime of the window.
+ * The minimum and maximum are maintained with two monotonic queues holding the
+ * candidates for the minimum and maximum of the window (each sample is inserted and
+ * removed at most once), so that the cost of PushSample() is amortised O(1) and does
+ * not depend on the window size, also when the minimum or maximum leaves the window.
+ * PushSamples() inserts a batch of samples, e.g. all the samples acquired in one cycle.
  * The implementation does not perform division, rather uses bit shift operation
  * for integer types, and pre-computes 1.0 / size for floating point types. As such,
  * the computation of average and standard deviation is only exact after the window
@@ -93,12 +97,11 @@ public:
      * @details The method inserts the sample in the historical buffer and re-computes the
      * sum of samples over the time window with two operations, i.e. to remove the oldest
      * sample leaving the buffer from the cumulative sum before adding the new one.
-     * The minimum and maximum sample attributes are changed if the newly inserted sample
-     * is respectively smaller or higher than the currently stored minimum or maximum. The
-     * historical buffer is fully parsed in case the oldest sample leaving the buffer is
-     * equal to the recorded minimum or maximum.
-     * The new sample is also squared and inserted into a second buffer, with similar sum
-     * management.
+     * The minimum and maximum are read from the head of the monotonic queues, after
+     * having removed the sample leaving the window and the candidates dominated by the
+     * new sample. If infiniteMaxMin is true, the minimum and maximum are instead the
+     * ones of all the samples inserted since the last Reset().
+     * The sum of squares is managed in the same way, squaring the new and the oldest sample.
      * The average, root mean square, and standard deviation are only computed when the
      * corresponding accessors are being called.
      * @return true if buffer was properly allocated.
@@ -106,6 +109,21 @@ public:
     bool PushSample(Type sample,
                     const bool infiniteMaxMin = false);
 
+    /**
+     * @brief Inserts a batch of samples in the moving time window.
+     * @details Equivalent to calling PushSample() for each sample, in order. If the batch
+     * is larger than the window, only the last GetSize() samples are inserted in the
+     * window (the preceding ones only contribute to the minimum and maximum if
+     * infiniteMaxMin is true).
+     * @param[in] samples the samples to insert, oldest first.
+     * @param[in] nOfSamples the number of samples.
+     * @param[in] infiniteMaxMin see PushSample().
+     * @return true if buffer was properly allocated.
+     */
+    bool PushSamples(const Type * const samples,
+                     const uint32 nOfSamples,
+                     const bool infiniteMaxMin = false);
+
     /**
      * @brief Accessor. Retrieves the sample at index in the sample buffer.
      * @return sample at index. 0 if index out of bounds.
@@ -233,33 +251,130 @@ private:
     CircularStaticList<Type> * Xwin;
 
     /**
-     * Sample buffer (squared)
+     * Kahan compensation of the sum of samples (floating point types only)
      */
-    CircularStaticList<Type> * Xsq;
+    Type XavgComp;
 
     /**
-     * @brief Average of squared samples over the moving window.
-     * @return average of sample squares.
+     * Kahan compensation of the sum of squares (floating point types only)
      */
-    Type GetRmsSq(void) const;
+    Type XrmsComp;
 
     /**
-     * @brief Finds the maximum of samples in the sample buffer.
-     * @return maximum.
+     * Number of samples inserted since Reset(), used to age the monotonic queue entries
      */
-    Type FindMax(void) const;
+    uint32 position;
 
     /**
-     * @brief Finds the minimum of samples in the sample buffer.
-     * @return maximum.
+     * Monotonic queue of the maximum candidates (decreasing values).
+     * Circular buffers of size elements starting at maxHead.
+     */
+    Type *maxValues;
+    uint32 *maxPositions;
+    uint32 maxHead;
+    uint32 maxCount;
+
+    /**
+     * Monotonic queue of the minimum candidates (increasing values).
+     * Circular buffers of size elements starting at minHead.
      */
-    Type FindMin(void) const;
+    Type *minValues;
+    uint32 *minPositions;
+    uint32 minHead;
+    uint32 minCount;
+
+    /**
+     * @brief Allocates the sample buffer and the monotonic queues of size elements.
+     */
+    void AllocateBuffers();
+
+    /**
+     * @brief Updates the sum with (added - removed).
+     * @details Exact for integer types; Kahan-compensated for floating point types.
+     */
+    static void UpdateSum(Type &sum,
+                          Type &compensation,
+                          const Type added,
+                          const Type removed);
+
+    /**
+     * @brief Inserts the sample at the current position in a monotonic queue.
+     * @details Removes the head if it left the window and all the tail entries which can
+     * no longer be the extremum of the window.
+     * @return the extremum of the window, i.e. the head of the queue.
+     */
+    Type UpdateQueue(Type * const values,
+                     uint32 * const positions,
+                     uint32 &head,
+                     uint32 &count,
+                     const Type sample,
+                     const bool isMax) const;
+
+    /**
+     * @brief Average of squared samples over the moving window.
+     * @return average of sample squares.
+     */
+    Type GetRmsSq(void) const;
+
 };
 
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+template<typename Type> void StatisticsHelperT<Type>::AllocateBuffers() {
+
+    Xwin = new CircularStaticList<Type>(size);
+    maxValues = new Type[size];
+    maxPositions = new uint32[size];
+    minValues = new Type[size];
+    minPositions = new uint32[size];
+
+}
+
+template<typename Type> void StatisticsHelperT<Type>::UpdateSum(Type &sum,
+                                                                Type &compensation,
+                                                                const Type added,
+                                                                const Type removed) {
+    /*lint -e{715} the compensation is not needed for integer types*/
+    sum -= removed;
+    sum += added;
+}
+
+/**
+ * @brief float32 implementation of StatisticsHelperT<>::UpdateSum()
+ */
+template<> inline void StatisticsHelperT<float32>::UpdateSum(float32 &sum,
+                                                             float32 &compensation,
+                                                             const float32 added,
+                                                             const float32 removed) {
+    float32 y = -removed - compensation;
+    float32 t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+    y = added - compensation;
+    t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+}
+
+/**
+ * @brief float64 implementation of StatisticsHelperT<>::UpdateSum()
+ */
+template<> inline void StatisticsHelperT<float64>::UpdateSum(float64 &sum,
+                                                             float64 &compensation,
+                                                             const float64 added,
+                                                             const float64 removed) {
+    float64 y = -removed - compensation;
+    float64 t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+    y = added - compensation;
+    t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+}
+
 /*lint -e{9117} [MISRA C++ Rule 5-0-4] signedness of 0 ignored in template method to avoid specializing for all integer types*/
 template<typename Type> bool StatisticsHelperT<Type>::Reset() {
 
@@ -273,14 +388,19 @@ template<typename Type> bool StatisticsHelperT<Type>::Reset() {
     Xrms = 0;
     Xstd = 0;
 
-    /* Reset sample buffers */
+    XavgComp = Xspl;
+    XrmsComp = Xspl;
+    position = 0u;
+    maxHead = 0u;
+    maxCount = 0u;
+    minHead = 0u;
+    minCount = 0u;
+
+    /* Reset sample buffer */
     bool ok = true;
     uint32 i;
     for (i = 0u; (i < size) && (ok); i++) {
         ok = Xwin->Set(i, Xspl);
-        if (ok) {
-            ok = Xsq->Set(i, Xspl);
-        }
     }
 
     return ok;
@@ -303,14 +423,19 @@ template<> inline bool StatisticsHelperT<float32>::Reset() { // Must be declared
     Xrms = 0.0F;
     Xstd = 0.0F;
 
-    /* Reset sample buffers */
+    XavgComp = Xspl;
+    XrmsComp = Xspl;
+    position = 0u;
+    maxHead = 0u;
+    maxCount = 0u;
+    minHead = 0u;
+    minCount = 0u;
+
+    /* Reset sample buffer */
     bool ok = true;
     uint32 i;
     for (i = 0u; (i < size) && (ok); i++) {
         ok = Xwin->Set(i, Xspl);
-        if (ok) {
-            ok = Xsq->Set(i, Xspl);
-        }
     }
 
     return ok;
@@ -332,14 +457,19 @@ template<> inline bool StatisticsHelperT<float64>::Reset() { // Must be declared
     Xrms = 0.0;
     Xstd = 0.0;
 
-    /* Reset sample buffers */
+    XavgComp = Xspl;
+    XrmsComp = Xspl;
+    position = 0u;
+    maxHead = 0u;
+    maxCount = 0u;
+    minHead = 0u;
+    minCount = 0u;
+
+    /* Reset sample buffer */
     bool ok = true;
     uint32 i;
     for (i = 0u; (i < size) && (ok); i++) {
         ok = Xwin->Set(i, Xspl);
-        if (ok) {
-            ok = Xsq->Set(i, Xspl);
-        }
     }
 
     return ok;
@@ -364,8 +494,7 @@ template<typename Type> StatisticsHelperT<Type>::StatisticsHelperT(const uint32
     }
 
     /* Instantiate sample buffers */
-    Xwin = new CircularStaticList<Type>(size);
-    Xsq = new CircularStaticList<Type>(size);
+    AllocateBuffers();
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -402,8 +531,7 @@ template<> inline StatisticsHelperT<float32>::StatisticsHelperT(const uint32 win
     Xdiv = 1.0F / static_cast<float32>(size);
 
     /* Instantiate sample buffers */
-    Xwin = new CircularStaticList<float32>(size);
-    Xsq = new CircularStaticList<float32>(size);
+    AllocateBuffers();
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -423,8 +551,7 @@ template<> inline StatisticsHelperT<float64>::StatisticsHelperT(const uint32 win
     Xdiv = 1.0 / static_cast<float64>(size);
 
     /* Instantiate sample buffers */
-    Xwin = new CircularStaticList<float64>(size);
-    Xsq = new CircularStaticList<float64>(size);
+    AllocateBuffers();
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -441,94 +568,68 @@ template<typename Type> StatisticsHelperT<Type>::~StatisticsHelperT() {
         Xwin = NULL_PTR(CircularStaticList<Type> *);
     }
 
-    if (Xsq != NULL_PTR(CircularStaticList<Type> *)) {
-        delete Xsq;
-        Xsq = NULL_PTR(CircularStaticList<Type> *);
+    if (maxValues != NULL_PTR(Type *)) {
+        delete[] maxValues;
+        maxValues = NULL_PTR(Type *);
     }
 
-}
-
-/*lint -e{534} ignore return value of GetData since initialisation error would have been caught earlier*/
-template<typename Type> Type StatisticsHelperT<Type>::FindMax() const {
-
-    Type max = std::numeric_limits<Type>::min();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        Type sample;
+    if (maxPositions != NULL_PTR(uint32 *)) {
+        delete[] maxPositions;
+        maxPositions = NULL_PTR(uint32 *);
+    }
 
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
+    if (minValues != NULL_PTR(Type *)) {
+        delete[] minValues;
+        minValues = NULL_PTR(Type *);
+    }
 
-        if (sample > max) {
-            max = sample;
-        }
+    if (minPositions != NULL_PTR(uint32 *)) {
+        delete[] minPositions;
+        minPositions = NULL_PTR(uint32 *);
     }
 
-    return max;
 }
 
-template<> inline float32 StatisticsHelperT<float32>::FindMax() const { // Must be declared/defined before use
-
-    float32 max = -1.0F * std::numeric_limits<float32>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        float32 sample;
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample > max) {
-            max = sample;
+template<typename Type> Type StatisticsHelperT<Type>::UpdateQueue(Type * const values,
+                                                                  uint32 * const positions,
+                                                                  uint32 &head,
+                                                                  uint32 &count,
+                                                                  const Type sample,
+                                                                  const bool isMax) const {
+
+    /* Remove the head if it is leaving the window (at most one entry per sample) */
+    if (count > 0u) {
+        if ((position - positions[head]) >= size) {
+            head++;
+            if (head == size) {
+                head = 0u;
+            }
+            count--;
         }
     }
 
-    return max;
-}
-
-template<> inline float64 StatisticsHelperT<float64>::FindMax() const { // Must be declared/defined before use
-
-    float64 max = -1.0 * std::numeric_limits<float64>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        float64 sample;
-
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample > max) {
-            max = sample;
+    /* Remove the tail entries which can no longer be the extremum, i.e. which are older and not better than the new sample */
+    bool dominated = true;
+    while ((count > 0u) && (dominated)) {
+        uint32 tail = (head + count) - 1u;
+        if (tail >= size) {
+            tail -= size;
+        }
+        dominated = (isMax) ? (values[tail] <= sample) : (values[tail] >= sample);
+        if (dominated) {
+            count--;
         }
     }
 
-    return max;
-}
-
-template<typename Type> Type StatisticsHelperT<Type>::FindMin() const {
-
-    Type min = std::numeric_limits<Type>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        Type sample;
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample < min) {
-            min = sample;
-        }
+    uint32 tail = head + count;
+    if (tail >= size) {
+        tail -= size;
     }
+    values[tail] = sample;
+    positions[tail] = position;
+    count++;
 
-    return min;
+    return values[head];
 }
 
 template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
@@ -551,39 +652,62 @@ template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
 
     if (ok) {
         /* Compute average */
-        Xavg -= oldest; /* Remove oldest sample from the accumulator */
-        Xavg += Xspl; /* Sum of all sample in time window */
+        UpdateSum(Xavg, XavgComp, Xspl, oldest); /* Sum of all sample in time window */
 
-        /* Update max/min, if necessary */
-        if (Xspl > Xmax) {
-            Xmax = Xspl;
-        }
-
-        if (Xspl < Xmin) {
-            Xmin = Xspl;
-        }
+        /* Update max/min */
+        Type windowMax = UpdateQueue(maxValues, maxPositions, maxHead, maxCount, Xspl, true);
+        Type windowMin = UpdateQueue(minValues, minPositions, minHead, minCount, Xspl, false);
+        position++;
 
-        if(!infiniteMaxMin) {
-            if (oldest == Xmax) { /* The removed sample was the max over the time window */
-                Xmax = FindMax();
+        if (infiniteMaxMin) {
+            if (Xspl > Xmax) {
+                Xmax = Xspl;
             }
-            if (oldest == Xmin) { /* The removed sample was the min over the time window */
-                Xmin = FindMin();
+            if (Xspl < Xmin) {
+                Xmin = Xspl;
             }
         }
+        else {
+            Xmax = windowMax;
+            Xmin = windowMin;
+        }
+
+        /* Compute root mean square */
+        UpdateSum(Xrms, XrmsComp, Xspl * Xspl, oldest * oldest); /* Sum of squares of all samples in time window */
     }
 
-    Type Xspl_sq = Xspl * Xspl; /* Square of the sample */
+    return ok;
+}
 
-    /* Update sample buffer */
-    if (ok) {
-        ok = Xsq->PushData(Xspl_sq, oldest);
+template<typename Type> bool StatisticsHelperT<Type>::PushSamples(const Type * const samples,
+                                                                  const uint32 nOfSamples,
+                                                                  const bool infiniteMaxMin) {
+
+    bool ok = (samples != NULL_PTR(const Type *));
+
+    uint32 first = 0u;
+    if ((ok) && (nOfSamples > size)) {
+        /* These samples would leave the window within this batch */
+        first = nOfSamples - size;
+        if (infiniteMaxMin) {
+            uint32 i;
+            for (i = 0u; i < first; i++) {
+                if (samples[i] > Xmax) {
+                    Xmax = samples[i];
+                }
+                if (samples[i] < Xmin) {
+                    Xmin = samples[i];
+                }
+            }
+        }
+        /* All the current entries of the monotonic queues will have left the window at the end of the batch */
+        maxCount = 0u;
+        minCount = 0u;
     }
 
-    if (ok) {
-        /* Compute root mean square */
-        Xrms -= oldest; /* Remove oldest sample from the accumulator */
-        Xrms += Xspl_sq; /* Sum of squares of all samples in time window */
+    uint32 i;
+    for (i = first; (i < nOfSamples) && (ok); i++) {
+        ok = PushSample(samples[i], infiniteMaxMin);
     }
 
     return ok;
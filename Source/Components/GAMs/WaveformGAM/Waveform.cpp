@@ -24,6 +24,7 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <math.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -34,6 +35,17 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Number of samples generated by the recursive oscillators before being resynchronised with the exact value.
+ */
+const MARTe::uint32 WAVEFORM_OSCILLATOR_RESYNC_SAMPLES = 256u;
+
+/**
+ * Number of interleaved oscillators.
+ */
+const MARTe::uint32 WAVEFORM_OSCILLATOR_LANES = 4u;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -68,6 +80,7 @@ Waveform::Waveform() :
     indexOutputSignal = 0u;
     triggersEnable = false;
     lastTime = 0.0;
+    fastGeneration = 0u;
 }
 
 Waveform::~Waveform() {
@@ -139,6 +152,15 @@ bool Waveform::Initialise(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::Warning, "numberOfStartTriggers is 0. Trigger mechanism ignored.");
         }
     }
+    if (ok) {
+        if (!data.Read("FastGeneration", fastGeneration)) {
+            fastGeneration = 0u;
+        }
+        ok = (fastGeneration <= 1u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "FastGeneration must be 0 or 1");
+        }
+    }
     return ok;
 }
 bool Waveform::Setup() {
@@ -435,6 +457,66 @@ bool Waveform::Execute() {
     return ok;
 }
 
+void Waveform::PrecomputeOscillatorValues(const float64 quadratic,
+                                          const float64 linear,
+                                          const float64 constant,
+                                          const float64 amplitude,
+                                          const float64 offset) {
+    const float64 laneIncrement = timeIncrement * static_cast<float64>(WAVEFORM_OSCILLATOR_LANES);
+    //The step between two consecutive samples of a lane changes by a constant angle
+    const float64 stepIncrement = 2.0 * quadratic * laneIncrement * laneIncrement;
+    const float64 sinStepIncrement = sin(stepIncrement);
+    const float64 cosStepIncrement = cos(stepIncrement);
+    uint32 blockStart = 0u;
+    while (blockStart < numberOfOutputElements) {
+        uint32 blockEnd = blockStart + WAVEFORM_OSCILLATOR_RESYNC_SAMPLES;
+        if (blockEnd > numberOfOutputElements) {
+            blockEnd = numberOfOutputElements;
+        }
+        float64 sinPhase[WAVEFORM_OSCILLATOR_LANES];
+        float64 cosPhase[WAVEFORM_OSCILLATOR_LANES];
+        float64 sinStep[WAVEFORM_OSCILLATOR_LANES];
+        float64 cosStep[WAVEFORM_OSCILLATOR_LANES];
+        for (uint32 j = 0u; j < WAVEFORM_OSCILLATOR_LANES; j++) {
+            const float64 laneTime = currentTime + (static_cast<float64>(j) * timeIncrement);
+            const float64 lanePhase = ((quadratic * laneTime * laneTime) + (linear * laneTime)) + constant;
+            const float64 laneStep = (quadratic * laneIncrement * ((2.0 * laneTime) + laneIncrement)) + (linear * laneIncrement);
+            sinPhase[j] = sin(lanePhase);
+            cosPhase[j] = cos(lanePhase);
+            sinStep[j] = sin(laneStep);
+            cosStep[j] = cos(laneStep);
+        }
+        uint32 i = blockStart;
+        while ((i + WAVEFORM_OSCILLATOR_LANES) <= blockEnd) {
+            for (uint32 j = 0u; j < WAVEFORM_OSCILLATOR_LANES; j++) {
+                outputFloat64[i + j] = sinPhase[j];
+                const float64 sinPhaseNext = (sinPhase[j] * cosStep[j]) + (cosPhase[j] * sinStep[j]);
+                cosPhase[j] = (cosPhase[j] * cosStep[j]) - (sinPhase[j] * sinStep[j]);
+                sinPhase[j] = sinPhaseNext;
+                const float64 sinStepNext = (sinStep[j] * cosStepIncrement) + (cosStep[j] * sinStepIncrement);
+                cosStep[j] = (cosStep[j] * cosStepIncrement) - (sinStep[j] * sinStepIncrement);
+                sinStep[j] = sinStepNext;
+            }
+            i += WAVEFORM_OSCILLATOR_LANES;
+        }
+        for (uint32 j = 0u; i < blockEnd; j++) {
+            outputFloat64[i] = sinPhase[j];
+            i++;
+        }
+        for (i = blockStart; i < blockEnd; i++) {
+            TriggerMechanism();
+            if (signalOn && triggersOn) {
+                outputFloat64[i] = (amplitude * outputFloat64[i]) + offset;
+            }
+            else {
+                outputFloat64[i] = 0.0;
+            }
+            currentTime += timeIncrement;
+        }
+        blockStart = blockEnd;
+    }
+}
+
 void Waveform::TriggerMechanism() {
     if (triggersEnable) {
         bool stop = false;
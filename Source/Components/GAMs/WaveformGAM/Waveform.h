@@ -50,6 +50,11 @@ namespace MARTe {
  * This class implements the common functionalities that are common to all the derived classes, which are basically the setup of the
  * trigger mechanism and the selection of the output type.
  *
+ * Waveforms whose phase is a polynomial of second order in time (i.e. WaveformSin and WaveformChirp) can set FastGeneration = 1.
+ * In this mode sin() is not called for every sample: the samples are generated with recursive oscillators (see PrecomputeOscillatorValues()),
+ * which are resynchronised with the exact libm value every 256 samples, so that the error with respect to the
+ * default generation does not grow with the number of samples (it is dominated by the float64 rounding of the sample time, i.e. well below the float32 resolution).
+ *
  * The trigger time must be specified in seconds and the type shall be float64.
  */
 
@@ -80,6 +85,7 @@ public:
      * time1 = 0u;
      * timeIncrement = 0.0;
      * timeState = 0u;
+     * fastGeneration = 0u;
      */
     Waveform();
 
@@ -101,6 +107,8 @@ public:
      * and stopTriggerTime and checks that startTriggerTime[i] < stopTriggerTime[i]. An invalid trigger time sequence
      * does not give an error only a warning is launched, however the trigger mechanism is disabled and the output always
      * will be on with the expected defined waveform.
+     * The optional parameter FastGeneration (default 0) selects the recursive oscillator generation (see PrecomputeOscillatorValues()).
+     * It is ignored by the waveforms which are not defined by a phase law (e.g. WaveformPointsDef).
      * @param[in] data is the GAM configuration file
      * @return true if MARTe#GAM#Initialise(StructuredDataI &data) exits without errors.
      */
@@ -199,6 +207,30 @@ protected:
      */
     virtual bool TimeIncrementValidation()=0;
 
+    /**
+     * @brief Computes outputFloat64[i] = amplitude * sin(quadratic * t^2 + linear * t + constant) + offset without calling sin() for every sample.
+     * @details The samples are split in four interleaved lanes. Each lane holds the (sin, cos) of its phase and the
+     * (sin, cos) of the phase step to its next sample, which are both advanced with a rotation, since the second difference of a quadratic phase
+     * is constant. The lanes are independent so that the compiler can vectorise the generation across samples.
+     * Every 256 samples the lanes are re-initialised with the exact libm value, which bounds the accumulated rounding error.
+     * The trigger mechanism and the currentTime update are applied exactly as in the sample by sample generation.
+     * @param[in] quadratic the coefficient of t^2 in the phase (0 for a sinusoid).
+     * @param[in] linear the coefficient of t in the phase (i.e. the angular frequency at t = 0).
+     * @param[in] constant the phase at t = 0.
+     * @param[in] amplitude the amplitude of the waveform.
+     * @param[in] offset the offset of the waveform.
+     */
+    void PrecomputeOscillatorValues(const float64 quadratic,
+                                    const float64 linear,
+                                    const float64 constant,
+                                    const float64 amplitude,
+                                    const float64 offset);
+
+    /**
+     * If 1 the derived classes generate the waveform with PrecomputeOscillatorValues().
+     */
+    uint8 fastGeneration;
+
     /**
      * Output pointer. It support several output signals
      */
@@ -132,17 +132,22 @@ bool WaveformChirp::Initialise(StructuredDataI &data) {
 }
 
 bool WaveformChirp::PrecomputeValues() {
-    for (uint32 i = 0u; i < numberOfOutputElements; i++) {
-        TriggerMechanism();
-        if (signalOn && triggersOn) {
-            float64 aux = ((w1 * currentTime) + ((w12 * currentTime * currentTime) / cD2)) + phase;
-            float64 aux2 = sin(aux);
-            outputFloat64[i] = (amplitude * aux2) + offset;
-        }
-        else {
-            outputFloat64[i] = 0.0;
+    if (fastGeneration == 1u) {
+        PrecomputeOscillatorValues(w12 / cD2, w1, phase, amplitude, offset);
+    }
+    else {
+        for (uint32 i = 0u; i < numberOfOutputElements; i++) {
+            TriggerMechanism();
+            if (signalOn && triggersOn) {
+                float64 aux = ((w1 * currentTime) + ((w12 * currentTime * currentTime) / cD2)) + phase;
+                float64 aux2 = sin(aux);
+                outputFloat64[i] = (amplitude * aux2) + offset;
+            }
+            else {
+                outputFloat64[i] = 0.0;
+            }
+            currentTime += timeIncrement;
         }
-        currentTime += timeIncrement;
     }
     return true;
 }
@@ -105,17 +105,22 @@ bool WaveformSin::Initialise(StructuredDataI& data) {
 }
 
 bool WaveformSin::PrecomputeValues() {
-    for (uint32 i = 0u; i < numberOfOutputElements; i++) {
-        TriggerMechanism();
-        if (signalOn && triggersOn) {
-            float64 aux = (w * currentTime) + phase;
-            float64 aux2 = sin(aux);
-            outputFloat64[i] = ((amplitude * aux2) + offset);
-        }
-        else {
-            outputFloat64[i] = 0.0;
+    if (fastGeneration == 1u) {
+        PrecomputeOscillatorValues(0.0, w, phase, amplitude, offset);
+    }
+    else {
+        for (uint32 i = 0u; i < numberOfOutputElements; i++) {
+            TriggerMechanism();
+            if (signalOn && triggersOn) {
+                float64 aux = (w * currentTime) + phase;
+                float64 aux2 = sin(aux);
+                outputFloat64[i] = ((amplitude * aux2) + offset);
+            }
+            else {
+                outputFloat64[i] = 0.0;
+            }
+            currentTime += timeIncrement;
         }
-        currentTime += timeIncrement;
     }
     return true;
 }
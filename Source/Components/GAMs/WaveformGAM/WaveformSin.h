@@ -79,6 +79,7 @@ namespace MARTe {
  *     Frequency = 1.0
  *     Phase = 0.0
  *     Offset = 1.1
+ *     FastGeneration = 0 //Optional. If 1 the samples are generated with recursive oscillators instead of calling sin() for each sample (see Waveform::PrecomputeOscillatorValues).
  *     StartTriggerTime = {0.1 0.3 0.5 1.8}
  *     StopTriggerTime = {0.2 0.4 0.6} //the StopTriggerTime has one time value less. It means that after the sequence of output on and off, the GAM will remain on forever
  *     InputSignals = {
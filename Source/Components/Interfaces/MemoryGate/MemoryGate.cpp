@@ -33,6 +33,54 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+/*lint -estring(526,__sync_*) -estring(628,__sync_*) -estring(746,__sync_*) -estring(1055,__sync_*) The __sync_* functions are GCC built-in functions, so they do not have declaration.*/
+
+namespace {
+/**
+ * Maximum number of attempts of MemoryGate::MemoryReadSnapshot.
+ */
+const MARTe::uint32 MEMORY_GATE_SNAPSHOT_MAX_RETRIES = 64u;
+
+/**
+ * @brief Gives VersionedBuffer access to the buffers of a MemoryGate (buffer i is at mem + i * memSize).
+ */
+class LocalBufferLocator {
+public:
+    LocalBufferLocator(MARTe::VersionedBufferHeader * const headersIn,
+                       MARTe::uint8 * const memIn,
+                       const MARTe::uint32 memSizeIn,
+                       const MARTe::uint32 numberOfBuffersIn) :
+            headers(headersIn),
+            mem(memIn),
+            memSize(memSizeIn),
+            numberOfBuffers(numberOfBuffersIn) {
+    }
+
+    MARTe::uint32 GetNumberOfBuffers() const {
+        return numberOfBuffers;
+    }
+
+    MARTe::uint32 GetBufferSize() const {
+        return memSize;
+    }
+
+    MARTe::VersionedBufferHeader *GetBufferHeader(const MARTe::uint32 bufferIdx) const {
+        return &headers[bufferIdx];
+    }
+
+    MARTe::uint8 *GetBufferMemory(const MARTe::uint32 bufferIdx) const {
+        return &mem[memSize * bufferIdx];
+    }
+
+private:
+    MARTe::VersionedBufferHeader * const headers;
+    MARTe::uint8 * const mem;
+    const MARTe::uint32 memSize;
+    const MARTe::uint32 numberOfBuffers;
+};
+
+typedef MARTe::VersionedBuffer<LocalBufferLocator> LocalVersionedBuffer;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -51,6 +99,14 @@ MemoryGate::MemoryGate() :
     spinlocksWrite = NULL_PTR(FastPollingMutexSem *);
     whatIsNewestCounter = NULL_PTR(uint32 *);
     whatIsNewestGlobCounter = 0u;
+    readRetries = 0;
+    writeRetries = 0;
+    versioned = 0u;
+    bufferHeaders = NULL_PTR(VersionedBufferHeader *);
+    lastVersion = 0;
+    newestVersion = 0;
+    lastReadVersion = 0;
+    skippedVersions = 0;
 }
 
 MemoryGate::~MemoryGate() {
@@ -71,6 +127,10 @@ MemoryGate::~MemoryGate() {
         delete[] whatIsNewestCounter;
         whatIsNewestCounter = NULL_PTR(uint32 *);
     }
+    if (bufferHeaders != NULL_PTR(VersionedBufferHeader *)) {
+        delete[] bufferHeaders;
+        bufferHeaders = NULL_PTR(VersionedBufferHeader *);
+    }
 }
 
 bool MemoryGate::Initialise(StructuredDataI &data) {
@@ -119,6 +179,21 @@ bool MemoryGate::Initialise(StructuredDataI &data) {
             }
         }
 
+        if (ret) {
+            if (!data.Read("Versioned", versioned)) {
+                versioned = 0u;
+            }
+            if (versioned != 0u) {
+                if (bufferHeaders == NULL) {
+                    bufferHeaders = new VersionedBufferHeader[numberOfBuffers];
+                }
+                for (uint32 i = 0u; i < numberOfBuffers; i++) {
+                    bufferHeaders[i].sequence = 0;
+                    bufferHeaders[i].version = 0;
+                }
+            }
+        }
+
         if (ret) {
             uint32 resetTimeoutT;
             if (!data.Read("ResetMSecTimeout", resetTimeoutT)) {
@@ -164,6 +239,28 @@ bool MemoryGate::SetMemorySize(uint32 size) {
 }
 
 bool MemoryGate::MemoryRead(uint8 * const bufferToFill) {
+    bool ok;
+    if (versioned != 0u) {
+        ok = VersionedMemoryRead(bufferToFill);
+    }
+    else {
+        ok = LockedMemoryRead(bufferToFill);
+    }
+    return ok;
+}
+
+bool MemoryGate::MemoryWrite(const uint8 * const bufferToFlush) {
+    bool ok;
+    if (versioned != 0u) {
+        ok = VersionedMemoryWrite(bufferToFlush);
+    }
+    else {
+        ok = LockedMemoryWrite(bufferToFlush);
+    }
+    return ok;
+}
+
+bool MemoryGate::LockedMemoryRead(uint8 * const bufferToFill) {
     //get input offset
     bool ok = false;
     uint64 checkedMask = 0ull;
@@ -198,6 +295,9 @@ bool MemoryGate::MemoryRead(uint8 * const bufferToFill) {
             spinlocksWrite[bufferIdx].FastUnLock();
             ok = true;
         }
+        else {
+            Atomic::Increment(&readRetries);
+        }
     }
     //copy the memory to the data source buffer
     if (ok) {
@@ -216,7 +316,7 @@ bool MemoryGate::MemoryRead(uint8 * const bufferToFill) {
     return ok;
 }
 
-bool MemoryGate::MemoryWrite(const uint8 * const bufferToFlush) {
+bool MemoryGate::LockedMemoryWrite(const uint8 * const bufferToFlush) {
 
     bool ok = false;
     uint32 bufferIdx = 0u;
@@ -249,6 +349,9 @@ bool MemoryGate::MemoryWrite(const uint8 * const bufferToFlush) {
                 spinlocksWrite[bufferIdx].FastUnLock();
             }
         }
+        if (!ok) {
+            Atomic::Increment(&writeRetries);
+        }
     }
 
     //copy the memory to the data source buffer
@@ -301,6 +404,109 @@ bool MemoryGate::MemoryWrite(const uint8 * const bufferToFlush) {
     }
     return ok;
 }
+void MemoryGate::UpdateSkippedVersions(const int32 version) {
+    bool updated = false;
+    while (!updated) {
+        int32 lastRead = lastReadVersion;
+        if (LocalVersionedBuffer::IsNewer(version, lastRead)) {
+            updated = __sync_bool_compare_and_swap(&lastReadVersion, lastRead, version);
+            if (updated) {
+                int32 skipped = static_cast<int32>((static_cast<uint32>(version) - static_cast<uint32>(lastRead)) - 1u);
+                if (skipped > 0) {
+                    (void) __sync_fetch_and_add(&skippedVersions, skipped);
+                }
+            }
+        }
+        else {
+            //Another reader already read this version or a newer one
+            updated = true;
+        }
+    }
+}
+
+bool MemoryGate::VersionedMemoryRead(uint8 * const bufferToFill) {
+    bool ok = (mem != NULL_PTR(uint8 *));
+    int32 version = 0;
+    if (ok) {
+        LocalBufferLocator locator(bufferHeaders, mem, memSize, numberOfBuffers);
+        ok = LocalVersionedBuffer::ReadNewest(locator, newestVersion, bufferToFill, readRetries, version);
+    }
+    if (ok) {
+        UpdateSkippedVersions(version);
+    }
+    return ok;
+}
+
+bool MemoryGate::VersionedMemoryWrite(const uint8 * const bufferToFlush) {
+    bool ok = (mem != NULL_PTR(uint8 *));
+    if (ok) {
+        LocalBufferLocator locator(bufferHeaders, mem, memSize, numberOfBuffers);
+        ok = LocalVersionedBuffer::Write(locator, lastVersion, newestVersion, bufferToFlush, writeRetries);
+    }
+    return ok;
+}
+
+bool MemoryGate::MemoryReadSnapshot(MemoryGate * const * const gates,
+                                    uint8 * const * const buffersToFill,
+                                    const uint32 numberOfGates) {
+    bool ok = (numberOfGates <= 64u);
+    for (uint32 i = 0u; (i < numberOfGates) && (ok); i++) {
+        ok = (gates[i] != NULL_PTR(MemoryGate *));
+        if (ok) {
+            ok = (gates[i]->versioned != 0u);
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "MemoryReadSnapshot requires at most 64 MemoryGate with Versioned = 1");
+    }
+    int32 versions[64u];
+    bool consistent = false;
+    for (uint32 k = 0u; (k < MEMORY_GATE_SNAPSHOT_MAX_RETRIES) && (ok) && (!consistent); k++) {
+        uint32 i;
+        for (i = 0u; i < numberOfGates; i++) {
+            versions[i] = gates[i]->newestVersion;
+        }
+        consistent = true;
+        for (i = 0u; (i < numberOfGates) && (consistent); i++) {
+            consistent = (gates[i]->mem != NULL_PTR(uint8 *));
+            if (consistent) {
+                LocalBufferLocator locator(gates[i]->bufferHeaders, gates[i]->mem, gates[i]->memSize, gates[i]->numberOfBuffers);
+                consistent = LocalVersionedBuffer::Read(locator, versions[i], buffersToFill[i]);
+            }
+        }
+        //If no gate published a newer version after the first collect, all the versions were the newest at the same instant
+        for (i = 0u; (i < numberOfGates) && (consistent); i++) {
+            consistent = (gates[i]->newestVersion == versions[i]);
+        }
+        if (!consistent) {
+            Atomic::Increment(&gates[0u]->readRetries);
+        }
+    }
+    ok = (ok) && (consistent);
+    if (ok) {
+        for (uint32 i = 0u; i < numberOfGates; i++) {
+            gates[i]->UpdateSkippedVersions(versions[i]);
+        }
+    }
+    return ok;
+}
+
+bool MemoryGate::IsVersioned() const {
+    return (versioned != 0u);
+}
+
+uint32 MemoryGate::GetReadRetries() const {
+    return static_cast<uint32>(readRetries);
+}
+
+uint32 MemoryGate::GetWriteRetries() const {
+    return static_cast<uint32>(writeRetries);
+}
+
+uint32 MemoryGate::GetSkippedVersions() const {
+    return static_cast<uint32>(skippedVersions);
+}
+
 CLASS_REGISTER(MemoryGate, "1.0")
 
 }
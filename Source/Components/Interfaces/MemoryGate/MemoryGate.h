@@ -31,6 +31,8 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "MemoryOperationsHelper.h"
 #include "ReferenceContainer.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -38,6 +40,75 @@
 
 namespace MARTe{
 
+/**
+ * @brief Header of each buffer of a ring of versioned buffers.
+ */
+struct VersionedBufferHeader {
+    /**
+     * Even when stable, odd when being written.
+     */
+    volatile int32 sequence;
+
+    /**
+     * The version currently stored in the buffer.
+     */
+    volatile int32 version;
+};
+
+/**
+ * @brief Lock-free ring of versioned buffers, each protected by a sequence lock.
+ * @details Each write takes a new version with an atomic increment of \a lastVersion and writes the buffer (version % numberOfBuffers)
+ * after marking it as being written (odd sequence). The version is then published in \a newestVersion. Readers copy a buffer without
+ * locking it and check that its sequence did not change during the copy. Used by MemoryGate (Versioned = 1) and by SharedMemoryGate.
+ * @tparam BufferLocator class which gives access to the buffers with the following methods:
+ *  - uint32 GetNumberOfBuffers() const;
+ *  - uint32 GetBufferSize() const;
+ *  - VersionedBufferHeader *GetBufferHeader(const uint32 bufferIdx) const;
+ *  - uint8 *GetBufferMemory(const uint32 bufferIdx) const.
+ */
+template<class BufferLocator>
+class VersionedBuffer {
+public:
+
+    /**
+     * @brief Checks if \a version1 was taken after \a version2 (wrap-around safe).
+     * @return true if \a version1 is newer than \a version2.
+     */
+    static bool IsNewer(const int32 version1,
+                        const int32 version2);
+
+    /**
+     * @brief Copies the buffer holding \a version without locking it.
+     * @return true if the buffer still holds \a version and was not written during the copy.
+     */
+    static bool Read(const BufferLocator &locator,
+                     const int32 version,
+                     uint8 * const bufferToFill);
+
+    /**
+     * @brief Copies the buffer holding the newest version, retrying (at most GetNumberOfBuffers() times) if it was written during the copy.
+     * @param[out] version the version which was read.
+     * @return true if a consistent copy was read. \a readRetries is incremented for each failed attempt.
+     */
+    static bool ReadNewest(const BufferLocator &locator,
+                           const volatile int32 &newestVersion,
+                           uint8 * const bufferToFill,
+                           volatile int32 &readRetries,
+                           int32 &version);
+
+    /**
+     * @brief Writes \a bufferToFlush with a new version and publishes it as the newest one (unless a newer version was already published).
+     * @details If the buffer of the new version is being written by another writer (or was already written with a newer version) a
+     * new version is taken, at most GetNumberOfBuffers() times. \a writeRetries is incremented for each failed attempt.
+     * @return true if the buffer was written.
+     */
+    static bool Write(const BufferLocator &locator,
+                      volatile int32 &lastVersion,
+                      volatile int32 &newestVersion,
+                      const uint8 * const bufferToFlush,
+                      volatile int32 &writeRetries);
+};
+
 /**
  * @brief Allows asynchronous communication between any MARTe components.
  *
@@ -51,6 +122,18 @@ namespace MARTe{
  * @details The writers call the function MemoryWrite() that will flush the input buffer to the oldest written available buffer. If all
  * the buffers are busy by readers or other writers, the MemoryWrite() returns false.
  *
+ * @details If Versioned = 1 the buffers are used as a ring of versions (see VersionedBuffer) and no lock is taken by MemoryRead() and MemoryWrite(), so that
+ * a slow reader can never stall a writer:
+ *  - each write takes a new version number with an atomic increment and writes the buffer (version % NumberOfBuffers). The buffer
+ *    sequence counter is odd while the buffer is being written. With a single writer the buffer is always free, so the write never fails.
+ *  - readers copy the buffer of the newest published version without locking it and check that its sequence counter did not change during
+ *    the copy, otherwise they retry with the newest version (at most NumberOfBuffers times, then MemoryRead() returns false). A reader
+ *    only fails if the writers go through the whole ring while it is copying, so the depth of the ring (NumberOfBuffers) should be chosen
+ *    considering the size of the buffer and the slowest reader.
+ *  - MemoryReadSnapshot() reads several versioned gates so that all the copies belong to the newest versions published at the same instant.
+ *  - GetSkippedVersions() returns the number of versions which were overwritten before being read by any reader, GetReadRetries() and
+ *    GetWriteRetries() measure the contention between readers and writers (they are also updated when Versioned = 0).
+ *
  * The configuration syntax is (names are only given as an example):
  *
  * <pre>
@@ -59,6 +142,7 @@ namespace MARTe{
  *        NumberOfBuffers = 10 //The number of buffers that should be in [1-64]. Default = 2
  *        ResetMSecTimeout = 10 //The timeout in milliseconds used by the mutex to lock all the buffers to change the write operations counters in case of write overflow). Default is 0xFFFFFFFF.\n
  *        MemorySize = 100 //The size of each buffer memory. If this parameter is not set or if it is equal to zero and the buffer size will be set by the first component that calls SetMemorySize().
+ *        Versioned = 1 //Optional. If 1 the buffers are a lock-free ring of versions (see above). Default = 0
  *    }
  * </pre>
  */
@@ -83,7 +167,8 @@ public:
      *   - ResetMSecTimeout = N (the timeout in milliseconds used by the mutex to lock all the buffers to change the
      *     write operations counters in case of overflow). Default is 0xFFFFFFFF.\n
      *   - MemorySize = N (the size of each buffer memory. If this parameter is not set or if it is equal to zero,
-     *     the buffer size will be set by the first component that calls SetMemorySize()).
+     *     the buffer size will be set by the first component that calls SetMemorySize()).\n
+     *   - Versioned = [0-1] (use the buffers as a lock-free ring of versions. Default = 0).
      */
     virtual bool Initialise(StructuredDataI &data);
 
@@ -117,6 +202,42 @@ public:
      */
     virtual bool MemoryWrite(const uint8 * const bufferToFlush);
 
+    /**
+     * @brief Reads the newest versions of several versioned gates at the same instant.
+     * @details Collects the newest version of each gate, copies all of them and checks that no gate published a newer version
+     * in the meanwhile, otherwise everything is read again (at most MEMORY_GATE_SNAPSHOT_MAX_RETRIES times).
+     * @param[in] gates the gates to be read. All of them must have Versioned = 1.
+     * @param[in] buffersToFill the buffers to be filled, one for each gate.
+     * @param[in] numberOfGates the number of elements of \a gates and \a buffersToFill.
+     * @return true if a consistent snapshot was copied.
+     */
+    static bool MemoryReadSnapshot(MemoryGate * const * const gates,
+                                   uint8 * const * const buffersToFill,
+                                   const uint32 numberOfGates);
+
+    /**
+     * @brief Checks if the gate was configured with Versioned = 1.
+     * @return true if the buffers are used as a lock-free ring of versions.
+     */
+    bool IsVersioned() const;
+
+    /**
+     * @brief Gets the number of reads which had to try another buffer because of a concurrent write.
+     * @return the number of read retries.
+     */
+    uint32 GetReadRetries() const;
+
+    /**
+     * @brief Gets the number of writes which had to try another buffer because it was busy.
+     * @return the number of write retries.
+     */
+    uint32 GetWriteRetries() const;
+
+    /**
+     * @brief Gets the number of versions which were overwritten before being read (only if Versioned = 1).
+     * @return the number of skipped versions.
+     */
+    uint32 GetSkippedVersions() const;
 
 protected:
 
@@ -165,6 +286,73 @@ protected:
      * in case of overflow of \a whatIsNewestCounter (to avoid a priority inversion)
      */
     TimeoutType resetTimeout;
+
+    /**
+     * Number of reads which had to try another buffer.
+     */
+    volatile int32 readRetries;
+
+    /**
+     * Number of writes which had to try another buffer.
+     */
+    volatile int32 writeRetries;
+
+private:
+
+    /**
+     * @brief Implementation of MemoryRead() with Versioned = 0.
+     */
+    bool LockedMemoryRead(uint8 * const bufferToFill);
+
+    /**
+     * @brief Implementation of MemoryWrite() with Versioned = 0.
+     */
+    bool LockedMemoryWrite(const uint8 * const bufferToFlush);
+
+    /**
+     * @brief Implementation of MemoryRead() with Versioned = 1.
+     */
+    bool VersionedMemoryRead(uint8 * const bufferToFill);
+
+    /**
+     * @brief Implementation of MemoryWrite() with Versioned = 1.
+     */
+    bool VersionedMemoryWrite(const uint8 * const bufferToFlush);
+
+    /**
+     * @brief Accounts for the versions between the last read one and \a version.
+     */
+    void UpdateSkippedVersions(const int32 version);
+
+    /**
+     * If 1 the buffers are a lock-free ring of versions.
+     */
+    uint8 versioned;
+
+    /**
+     * The sequence lock and the version of each buffer.
+     */
+    VersionedBufferHeader *bufferHeaders;
+
+    /**
+     * The last version taken by a writer.
+     */
+    volatile int32 lastVersion;
+
+    /**
+     * The newest published version (0 = nothing written).
+     */
+    volatile int32 newestVersion;
+
+    /**
+     * The newest version returned by a read.
+     */
+    volatile int32 lastReadVersion;
+
+    /**
+     * Number of versions overwritten before being read.
+     */
+    volatile int32 skippedVersions;
 };
 
 }
@@ -172,6 +360,105 @@ protected:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+/*lint -estring(526,__sync_*) -estring(628,__sync_*) -estring(746,__sync_*) -estring(1055,__sync_*) The __sync_* functions are GCC built-in functions, so they do not have declaration.*/
+
+namespace MARTe {
+
+template<class BufferLocator>
+bool VersionedBuffer<BufferLocator>::IsNewer(const int32 version1,
+                                             const int32 version2) {
+    return (static_cast<int32>(static_cast<uint32>(version1) - static_cast<uint32>(version2)) > 0);
+}
+
+template<class BufferLocator>
+bool VersionedBuffer<BufferLocator>::Read(const BufferLocator &locator,
+                                          const int32 version,
+                                          uint8 * const bufferToFill) {
+    uint32 bufferIdx = static_cast<uint32>(version) % locator.GetNumberOfBuffers();
+    VersionedBufferHeader *header = locator.GetBufferHeader(bufferIdx);
+    int32 sequenceBefore = header->sequence;
+    __sync_synchronize();
+    bool ok = ((static_cast<uint32>(sequenceBefore) & 1u) == 0u) && (header->version == version);
+    if (ok) {
+        (void) MemoryOperationsHelper::Copy(bufferToFill, locator.GetBufferMemory(bufferIdx), locator.GetBufferSize());
+        __sync_synchronize();
+        ok = (header->sequence == sequenceBefore);
+    }
+    return ok;
+}
+
+template<class BufferLocator>
+bool VersionedBuffer<BufferLocator>::ReadNewest(const BufferLocator &locator,
+                                                const volatile int32 &newestVersion,
+                                                uint8 * const bufferToFill,
+                                                volatile int32 &readRetries,
+                                                int32 &version) {
+    bool ok = false;
+    uint32 numberOfBuffers = locator.GetNumberOfBuffers();
+    for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
+        version = newestVersion;
+        ok = Read(locator, version, bufferToFill);
+        if (!ok) {
+            Atomic::Increment(&readRetries);
+        }
+    }
+    return ok;
+}
+
+template<class BufferLocator>
+bool VersionedBuffer<BufferLocator>::Write(const BufferLocator &locator,
+                                           volatile int32 &lastVersion,
+                                           volatile int32 &newestVersion,
+                                           const uint8 * const bufferToFlush,
+                                           volatile int32 &writeRetries) {
+    int32 version = 0;
+    int32 sequence = 0;
+    VersionedBufferHeader *header = NULL_PTR(VersionedBufferHeader *);
+    uint32 bufferIdx = 0u;
+    bool claimed = false;
+    uint32 numberOfBuffers = locator.GetNumberOfBuffers();
+    for (uint32 k = 0u; (k < numberOfBuffers) && (!claimed); k++) {
+        version = __sync_add_and_fetch(&lastVersion, 1);
+        bufferIdx = static_cast<uint32>(version) % numberOfBuffers;
+        header = locator.GetBufferHeader(bufferIdx);
+        sequence = header->sequence;
+        if ((static_cast<uint32>(sequence) & 1u) == 0u) {
+            claimed = __sync_bool_compare_and_swap(&header->sequence, sequence, static_cast<int32>(static_cast<uint32>(sequence) + 1u));
+        }
+        if (claimed) {
+            //A writer with a newer version already went through this buffer: do not overwrite it with older data
+            if (IsNewer(header->version, version)) {
+                header->sequence = sequence;
+                claimed = false;
+            }
+        }
+        if (!claimed) {
+            Atomic::Increment(&writeRetries);
+        }
+    }
+    if (claimed) {
+        (void) MemoryOperationsHelper::Copy(locator.GetBufferMemory(bufferIdx), bufferToFlush, locator.GetBufferSize());
+        /*lint -e{613} header is not NULL if claimed*/
+        header->version = version;
+        __sync_synchronize();
+        header->sequence = static_cast<int32>(static_cast<uint32>(sequence) + 2u);
+
+        //Publish the version unless a newer one was already published
+        bool published = false;
+        while (!published) {
+            int32 newest = newestVersion;
+            if (IsNewer(version, newest)) {
+                published = __sync_bool_compare_and_swap(&newestVersion, newest, version);
+            }
+            else {
+                published = true;
+            }
+        }
+    }
+    return claimed;
+}
+
+}
 
 #endif /* MEMORYGATE_H_ */
 
@@ -0,0 +1,304 @@
+/**
+ * @file SharedMemoryGate.cpp
+ * @brief Source file for class SharedMemoryGate
+ * @date 18/10/2026
+ * @author Giuseppe Ferro
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryGate (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "SharedMemoryGate.h"
+#include "Sleep.h"
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/*lint -estring(526,__sync_*) -estring(628,__sync_*) -estring(746,__sync_*) -estring(1055,__sync_*) The __sync_* functions are GCC built-in functions, so they do not have declaration.*/
+
+namespace {
+/**
+ * Values of SharedHeader::state.
+ */
+const MARTe::int32 SHARED_MEMORY_INITIALISING = 1;
+const MARTe::int32 SHARED_MEMORY_READY = 2;
+
+/**
+ * Maximum time waiting for another process to initialise the shared memory.
+ */
+const MARTe::uint32 SHARED_MEMORY_INIT_TIMEOUT_MSEC = 1000u;
+
+/**
+ * Alignment of the header and of each buffer.
+ */
+const MARTe::uint32 SHARED_MEMORY_ALIGNMENT = 64u;
+
+MARTe::uint32 AlignSize(const MARTe::uint32 size) {
+    return ((size + SHARED_MEMORY_ALIGNMENT) - 1u) & ~(SHARED_MEMORY_ALIGNMENT - 1u);
+}
+
+/**
+ * @brief Gives VersionedBuffer access to the buffers of a SharedMemoryGate (each buffer follows its VersionedBufferHeader,
+ * buffer i is at firstBuffer + i * bufferStride).
+ */
+class SharedBufferLocator {
+public:
+    SharedBufferLocator(MARTe::uint8 * const firstBufferIn,
+                        const MARTe::uint32 bufferStrideIn,
+                        const MARTe::uint32 memSizeIn,
+                        const MARTe::uint32 numberOfBuffersIn) :
+            firstBuffer(firstBufferIn),
+            bufferStride(bufferStrideIn),
+            memSize(memSizeIn),
+            numberOfBuffers(numberOfBuffersIn) {
+    }
+
+    MARTe::uint32 GetNumberOfBuffers() const {
+        return numberOfBuffers;
+    }
+
+    MARTe::uint32 GetBufferSize() const {
+        return memSize;
+    }
+
+    MARTe::VersionedBufferHeader *GetBufferHeader(const MARTe::uint32 bufferIdx) const {
+        /*lint -e{927} -e{826} the buffer header is at the beginning of each buffer*/
+        return reinterpret_cast<MARTe::VersionedBufferHeader *>(&firstBuffer[bufferIdx * bufferStride]);
+    }
+
+    MARTe::uint8 *GetBufferMemory(const MARTe::uint32 bufferIdx) const {
+        return &firstBuffer[(bufferIdx * bufferStride) + static_cast<MARTe::uint32>(sizeof(MARTe::VersionedBufferHeader))];
+    }
+
+private:
+    MARTe::uint8 * const firstBuffer;
+    const MARTe::uint32 bufferStride;
+    const MARTe::uint32 memSize;
+    const MARTe::uint32 numberOfBuffers;
+};
+
+typedef MARTe::VersionedBuffer<SharedBufferLocator> SharedVersionedBuffer;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+SharedMemoryGate::SharedMemoryGate() :
+        MemoryGate() {
+    header = NULL_PTR(SharedHeader *);
+    sharedMemorySize = 0u;
+    bufferStride = 0u;
+    fileDescriptor = -1;
+    unlinkOnExit = 0u;
+}
+
+/*lint -e{1551} the destructor does not throw.*/
+SharedMemoryGate::~SharedMemoryGate() {
+    if (header != NULL_PTR(SharedHeader *)) {
+        (void) munmap(reinterpret_cast<void *>(header), static_cast<size_t>(sharedMemorySize));
+        header = NULL_PTR(SharedHeader *);
+    }
+    if (fileDescriptor >= 0) {
+        (void) close(fileDescriptor);
+        fileDescriptor = -1;
+    }
+    if (unlinkOnExit > 0u) {
+        (void) shm_unlink(sharedMemoryName.Buffer());
+    }
+}
+
+bool SharedMemoryGate::Initialise(StructuredDataI &data) {
+    bool ret = ReferenceContainer::Initialise(data);
+    if (ret) {
+        ret = data.Read("SharedMemoryName", sharedMemoryName);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Please specify the SharedMemoryName");
+        }
+    }
+    if (ret) {
+        ret = (sharedMemoryName.Size() > 1u);
+        if (ret) {
+            ret = (sharedMemoryName[0u] == '/');
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The SharedMemoryName %s must start with '/'", sharedMemoryName.Buffer());
+        }
+    }
+    if (ret) {
+        if (!data.Read("NumberOfBuffers", numberOfBuffers)) {
+            numberOfBuffers = 2u;
+        }
+        ret = (numberOfBuffers <= 64u) && (numberOfBuffers > 0u);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The maximum allowed numberOfBuffers is 64");
+        }
+    }
+    if (ret) {
+        if (!data.Read("UnlinkOnExit", unlinkOnExit)) {
+            unlinkOnExit = 0u;
+        }
+        uint32 size = 0u;
+        if (data.Read("MemorySize", size)) {
+            if (size > 0u) {
+                ret = SetMemorySize(size);
+            }
+        }
+    }
+    return ret;
+}
+
+bool SharedMemoryGate::SetMemorySize(uint32 size) {
+    bool ret = true;
+    if (header == NULL_PTR(SharedHeader *)) {
+        memSize = size;
+        bufferStride = AlignSize(static_cast<uint32>(sizeof(VersionedBufferHeader)) + memSize);
+        sharedMemorySize = AlignSize(static_cast<uint32>(sizeof(SharedHeader))) + (numberOfBuffers * bufferStride);
+
+        //Only one process can create the object: it sizes and initialises it, the others wait for it
+        /*lint -e{9130} -e{9117} O_RDWR, O_CREAT and O_EXCL are POSIX flags*/
+        fileDescriptor = shm_open(sharedMemoryName.Buffer(), O_RDWR | O_CREAT | O_EXCL, static_cast<mode_t>(0666));
+        bool creator = (fileDescriptor >= 0);
+        if (!creator) {
+            ret = (errno == EEXIST);
+            if (ret) {
+                /*lint -e{9130} O_RDWR is a POSIX flag*/
+                fileDescriptor = shm_open(sharedMemoryName.Buffer(), O_RDWR, static_cast<mode_t>(0666));
+                ret = (fileDescriptor >= 0);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::OSError, "Failed to open the shared memory %s", sharedMemoryName.Buffer());
+            }
+        }
+        if ((ret) && (creator)) {
+            ret = (ftruncate(fileDescriptor, static_cast<off_t>(sharedMemorySize)) == 0);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::OSError, "The shared memory %s could not be sized to %u bytes", sharedMemoryName.Buffer(), sharedMemorySize);
+            }
+        }
+        if ((ret) && (!creator)) {
+            //The object exists but the creator may not have sized it yet
+            struct stat fileStatus;
+            fileStatus.st_size = 0;
+            ret = (fstat(fileDescriptor, &fileStatus) == 0);
+            for (uint32 t = 0u; (t < SHARED_MEMORY_INIT_TIMEOUT_MSEC) && (ret) && (fileStatus.st_size == 0); t++) {
+                Sleep::MSec(1u);
+                ret = (fstat(fileDescriptor, &fileStatus) == 0);
+            }
+            if (ret) {
+                ret = (fileStatus.st_size == static_cast<off_t>(sharedMemorySize));
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::OSError, "The shared memory %s has not the expected size of %u bytes (buffers of a different size?)",
+                             sharedMemoryName.Buffer(), sharedMemorySize);
+            }
+        }
+        if (ret) {
+            void *address = mmap(NULL_PTR(void *), static_cast<size_t>(sharedMemorySize), PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+            /*lint -e{923} MAP_FAILED is defined by POSIX as a cast of -1*/
+            ret = (address != MAP_FAILED);
+            if (ret) {
+                header = reinterpret_cast<SharedHeader *>(address);
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::OSError, "Failed to map the shared memory %s", sharedMemoryName.Buffer());
+            }
+        }
+        if (ret) {
+            if (creator) {
+                header->state = SHARED_MEMORY_INITIALISING;
+                header->memorySize = memSize;
+                header->nOfBuffers = numberOfBuffers;
+                header->nextTicket = 0;
+                header->newestTicket = 0;
+                __sync_synchronize();
+                header->state = SHARED_MEMORY_READY;
+            }
+            else {
+                for (uint32 t = 0u; (t < SHARED_MEMORY_INIT_TIMEOUT_MSEC) && (header->state != SHARED_MEMORY_READY); t++) {
+                    Sleep::MSec(1u);
+                }
+                ret = (header->state == SHARED_MEMORY_READY);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::Timeout, "The shared memory %s was not initialised by the creator", sharedMemoryName.Buffer());
+                }
+            }
+        }
+        if (ret) {
+            ret = (header->memorySize == memSize) && (header->nOfBuffers == numberOfBuffers);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::FatalError, "The shared memory %s has %u buffers of %u bytes (!= %u buffers of %u bytes)",
+                             sharedMemoryName.Buffer(), header->nOfBuffers, header->memorySize, numberOfBuffers, memSize);
+            }
+        }
+    }
+    else {
+        ret = (memSize == size);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Memory size mismatch (%d != %d). All the components must specify the same size", size, memSize);
+        }
+    }
+
+    return ret;
+}
+
+bool SharedMemoryGate::MemoryRead(uint8 * const bufferToFill) {
+    bool ok = false;
+    if (header != NULL_PTR(SharedHeader *)) {
+        /*lint -e{927} the buffers are laid out after the header in the mapped memory*/
+        uint8 *base = reinterpret_cast<uint8 *>(header);
+        SharedBufferLocator locator(&base[AlignSize(static_cast<uint32>(sizeof(SharedHeader)))], bufferStride, memSize, numberOfBuffers);
+        int32 ticket = 0;
+        ok = SharedVersionedBuffer::ReadNewest(locator, header->newestTicket, bufferToFill, readRetries, ticket);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "No consistent buffer of %s could be read in %u attempts (is a writer stuck or dead while writing?)",
+                         sharedMemoryName.Buffer(), numberOfBuffers);
+        }
+    }
+    return ok;
+}
+
+bool SharedMemoryGate::MemoryWrite(const uint8 * const bufferToFlush) {
+    bool ok = false;
+    if (header != NULL_PTR(SharedHeader *)) {
+        /*lint -e{927} the buffers are laid out after the header in the mapped memory*/
+        uint8 *base = reinterpret_cast<uint8 *>(header);
+        SharedBufferLocator locator(&base[AlignSize(static_cast<uint32>(sizeof(SharedHeader)))], bufferStride, memSize, numberOfBuffers);
+        ok = SharedVersionedBuffer::Write(locator, header->nextTicket, header->newestTicket, bufferToFlush, writeRetries);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::Warning, "No buffer of %s could be claimed in %u attempts (is a writer stuck or dead while writing?)",
+                         sharedMemoryName.Buffer(), numberOfBuffers);
+        }
+    }
+    return ok;
+}
+
+CLASS_REGISTER(SharedMemoryGate, "1.0")
+
+}
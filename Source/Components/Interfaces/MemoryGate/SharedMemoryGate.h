@@ -0,0 +1,189 @@
+/**
+ * @file SharedMemoryGate.h
+ * @brief Header file for class SharedMemoryGate
+ * @date 18/10/2026
+ * @author Giuseppe Ferro
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryGate
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SHAREDMEMORYGATE_H_
+#define SHAREDMEMORYGATE_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "MemoryGate.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe{
+
+/**
+ * @brief A MemoryGate whose buffers live in a POSIX shared memory object, so that
+ * components of different processes can be linked.
+ *
+ * @details The shared memory object is opened (and created by the first process) when the memory size is known,
+ * i.e. in Initialise() if MemorySize is declared, otherwise in the first SetMemorySize(). All the processes must
+ * declare the same NumberOfBuffers and memory size.
+ *
+ * @details Each buffer is protected by a sequence lock (see VersionedBuffer) stored in the shared memory and no system call is performed
+ * by MemoryRead() and MemoryWrite():
+ *  - writers (one or more, also in different processes) take a ticket with an atomic increment; the ticket selects
+ *    the buffer (ticket % NumberOfBuffers). The writer marks the buffer as being written (odd sequence), copies the data,
+ *    marks it as stable (even sequence) and publishes the ticket as the newest one. If the buffer is being written by
+ *    another writer, a new ticket is taken; MemoryWrite() returns false after NumberOfBuffers attempts.
+ *  - readers copy the newest buffer and check that its sequence did not change during the copy, otherwise they retry
+ *    (at most NumberOfBuffers times, then MemoryRead() returns false). Readers never delay the writers.
+ *
+ * @details The shared memory object is not removed when the component is destroyed, so that any process can be restarted
+ * and link again to the live data. Set UnlinkOnExit = 1 in the process which owns the data to remove it.
+ *
+ * The configuration syntax is (names are only given as an example):
+ *
+ * <pre>
+ *    +SharedMem = {
+ *        Class = SharedMemoryGate
+ *        SharedMemoryName = "/marte_control" //The name of the POSIX shared memory object (must start with '/').
+ *        NumberOfBuffers = 4 //The number of buffers that should be in [1-64]. Default = 2
+ *        MemorySize = 100 //Optional. The size of each buffer memory. If this parameter is not set or if it is equal to zero the buffer size will be set by the first component that calls SetMemorySize().
+ *        UnlinkOnExit = 0 //Optional. If 1 the shared memory object is removed in the destructor. Default = 0
+ *    }
+ * </pre>
+ *
+ * A LinkDataSource links to a SharedMemoryGate exactly as to a MemoryGate, e.g. Link = SharedMem.
+ */
+class SharedMemoryGate: public MemoryGate {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Constructor
+     */
+    SharedMemoryGate();
+
+    /**
+     * @brief Destructor. Unmaps the shared memory (and removes it if UnlinkOnExit = 1).
+     */
+    virtual ~SharedMemoryGate();
+
+    /**
+     * @see ReferenceContainer::Initialise()
+     * @details The user can specify the following configuration parameters:\n
+     *   - SharedMemoryName = "/name" (compulsory)\n
+     *   - NumberOfBuffers = N (the number of buffers that should be in [1-64]. Default = 2)\n
+     *   - MemorySize = N (the size of each buffer memory. If this parameter is not set or if it is equal to zero,
+     *     the buffer size will be set by the first component that calls SetMemorySize())\n
+     *   - UnlinkOnExit = [0-1] (Default = 0)
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Opens and maps the shared memory the first time, then checks if \a size is equal to the previous declared buffer size.
+     * @details Only the process that creates the shared memory object (O_EXCL) sizes and initialises it. The other processes
+     * wait (up to one second) for the object to be sized and initialised and check that the number of buffers and the buffer size are the same.
+     * @param[in] size is the size of the buffer memory.
+     * @return true if the shared memory could be mapped and the sizes are consistent.
+     */
+    virtual bool SetMemorySize(uint32 size);
+
+    /**
+     * @brief Copies the newest written buffer to \a bufferToFill.
+     * @param[in] bufferToFill is the buffer to be filled with read data.
+     * @return true if a consistent copy was obtained within NumberOfBuffers attempts. A buffer left half written by a writer
+     * that died keeps failing the reads of that buffer (reporting a warning) instead of blocking the reader.
+     */
+    virtual bool MemoryRead(uint8 * const bufferToFill);
+
+    /**
+     * @brief Copies \a bufferToFlush to a buffer and publishes it as the newest one.
+     * @param[in] bufferToFlush is the buffer contains the data to be written.
+     * @return true if a buffer could be claimed within NumberOfBuffers attempts.
+     */
+    virtual bool MemoryWrite(const uint8 * const bufferToFlush);
+
+private:
+
+    /**
+     * @brief Header stored at the beginning of the shared memory.
+     */
+    struct SharedHeader {
+        /**
+         * 0 = not initialised (zeroed by ftruncate), 1 = being initialised, 2 = ready.
+         */
+        volatile int32 state;
+        /**
+         * The size of each buffer.
+         */
+        uint32 memorySize;
+        /**
+         * The number of buffers.
+         */
+        uint32 nOfBuffers;
+        /**
+         * The next ticket to be taken by a writer.
+         */
+        volatile int32 nextTicket;
+        /**
+         * The newest published ticket (0 = nothing written).
+         */
+        volatile int32 newestTicket;
+    };
+
+    /**
+     * The name of the shared memory object.
+     */
+    StreamString sharedMemoryName;
+
+    /**
+     * The mapped shared memory.
+     */
+    SharedHeader *header;
+
+    /**
+     * The size of the mapping.
+     */
+    uint32 sharedMemorySize;
+
+    /**
+     * The distance in bytes between two buffer headers.
+     */
+    uint32 bufferStride;
+
+    /**
+     * The shared memory file descriptor.
+     */
+    int32 fileDescriptor;
+
+    /**
+     * Remove the shared memory object in the destructor.
+     */
+    uint8 unlinkOnExit;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SHAREDMEMORYGATE_H_ */
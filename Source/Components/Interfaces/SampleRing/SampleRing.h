@@ -0,0 +1,245 @@
+/**
+ * @file SampleRing.h
+ * @brief Header file for class SampleRing
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SampleRing
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SAMPLERING_H_
+#define SAMPLERING_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Lock-free single-producer/single-consumer ring of fixed size samples.
+ * @details The producer (typically a real-time thread) gets the next free slot with GetWriteSlot, fills it and makes it visible
+ * to the consumer with Commit. The consumer reads the committed samples with GetReadSlot and gives the slots back to the producer with Release.
+ * Each index is only modified by one side and is published with Atomic::Exchange, so that neither side ever blocks.
+ * One slot is always kept empty to distinguish between a full and an empty ring.
+ */
+class SampleRing {
+public:
+
+    /**
+     * @brief Constructor. NOOP.
+     * @post
+     *   !IsInitialised()
+     */
+    SampleRing();
+
+    /**
+     * @brief Destructor. Frees the slots.
+     */
+    ~SampleRing();
+
+    /**
+     * @brief Allocates the ring.
+     * @param[in] numberOfSamplesIn the number of samples that the ring can hold.
+     * @param[in] sampleSizeIn the size in bytes of each sample.
+     * @return true if the ring was not already initialised and both parameters are > 0.
+     */
+    bool Initialise(const uint32 numberOfSamplesIn,
+                    const uint32 sampleSizeIn);
+
+    /**
+     * @brief Returns true if Initialise was successfully called.
+     * @return true if Initialise was successfully called.
+     */
+    bool IsInitialised() const;
+
+    /**
+     * @brief Gets the size in bytes of each sample.
+     * @return the size in bytes of each sample.
+     */
+    uint32 GetSampleSize() const;
+
+    /**
+     * @brief Gets the next free slot. Shall only be called by the producer.
+     * @return the slot where to write the next sample or NULL if the ring is full (or not initialised).
+     */
+    char8 *GetWriteSlot();
+
+    /**
+     * @brief Makes the slot returned by GetWriteSlot visible to the consumer. Shall only be called by the producer.
+     */
+    void Commit();
+
+    /**
+     * @brief Gets the number of committed samples not yet released. Shall only be called by the consumer.
+     * @return the number of samples available for reading.
+     */
+    uint32 GetNumberOfSamples() const;
+
+    /**
+     * @brief Gets a committed sample. Shall only be called by the consumer.
+     * @param[in] sampleIdx the index of the sample, where 0 is the oldest and GetNumberOfSamples() - 1 the newest.
+     * @return the slot holding the sample or NULL if \a sampleIdx >= GetNumberOfSamples().
+     */
+    const char8 *GetReadSlot(const uint32 sampleIdx) const;
+
+    /**
+     * @brief Gives the oldest samples back to the producer. Shall only be called by the consumer.
+     * @param[in] numberOfSamplesIn the number of samples to release (truncated to GetNumberOfSamples()).
+     */
+    void Release(const uint32 numberOfSamplesIn);
+
+private:
+
+    /**
+     * The slots (ringSize slots of sampleSize bytes).
+     */
+    char8 *slots;
+
+    /**
+     * Number of slots in the ring.
+     */
+    uint32 ringSize;
+
+    /**
+     * Number of bytes of each slot.
+     */
+    uint32 sampleSize;
+
+    /**
+     * Next slot to be written. Only modified by the producer.
+     */
+    volatile int32 writeIdx;
+
+    /**
+     * Next slot to be read. Only modified by the consumer.
+     */
+    volatile int32 readIdx;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+inline SampleRing::SampleRing() {
+    slots = NULL_PTR(char8 *);
+    ringSize = 0u;
+    sampleSize = 0u;
+    writeIdx = 0;
+    readIdx = 0;
+}
+
+/*lint -e{1551} the destructor must guarantee that the slots are freed.*/
+inline SampleRing::~SampleRing() {
+    if (slots != NULL_PTR(char8 *)) {
+        delete[] slots;
+    }
+}
+
+inline bool SampleRing::Initialise(const uint32 numberOfSamplesIn,
+                                   const uint32 sampleSizeIn) {
+    bool ok = ((numberOfSamplesIn > 0u) && (sampleSizeIn > 0u) && (slots == NULL_PTR(char8 *)));
+    if (ok) {
+        ringSize = numberOfSamplesIn + 1u;
+        sampleSize = sampleSizeIn;
+        slots = new char8[ringSize * sampleSize];
+        writeIdx = 0;
+        readIdx = 0;
+    }
+    return ok;
+}
+
+inline bool SampleRing::IsInitialised() const {
+    return (slots != NULL_PTR(char8 *));
+}
+
+inline uint32 SampleRing::GetSampleSize() const {
+    return sampleSize;
+}
+
+inline char8 *SampleRing::GetWriteSlot() {
+    char8 *slot = NULL_PTR(char8 *);
+    if (slots != NULL_PTR(char8 *)) {
+        uint32 idx = static_cast<uint32>(writeIdx);
+        uint32 nextIdx = idx + 1u;
+        if (nextIdx == ringSize) {
+            nextIdx = 0u;
+        }
+        if (nextIdx != static_cast<uint32>(readIdx)) {
+            slot = &slots[idx * sampleSize];
+        }
+    }
+    return slot;
+}
+
+inline void SampleRing::Commit() {
+    uint32 nextIdx = static_cast<uint32>(writeIdx) + 1u;
+    if (nextIdx == ringSize) {
+        nextIdx = 0u;
+    }
+    //Publish the slot
+    (void) Atomic::Exchange(&writeIdx, static_cast<int32>(nextIdx));
+}
+
+inline uint32 SampleRing::GetNumberOfSamples() const {
+    uint32 rIdx = static_cast<uint32>(readIdx);
+    uint32 wIdx = static_cast<uint32>(writeIdx);
+    return (wIdx >= rIdx) ? (wIdx - rIdx) : ((wIdx + ringSize) - rIdx);
+}
+
+inline const char8 *SampleRing::GetReadSlot(const uint32 sampleIdx) const {
+    const char8 *slot = NULL_PTR(const char8 *);
+    if (sampleIdx < GetNumberOfSamples()) {
+        uint32 idx = static_cast<uint32>(readIdx) + sampleIdx;
+        if (idx >= ringSize) {
+            idx -= ringSize;
+        }
+        slot = &slots[idx * sampleSize];
+    }
+    return slot;
+}
+
+inline void SampleRing::Release(const uint32 numberOfSamplesIn) {
+    uint32 available = GetNumberOfSamples();
+    uint32 toRelease = (numberOfSamplesIn < available) ? (numberOfSamplesIn) : (available);
+    if (toRelease > 0u) {
+        uint32 idx = static_cast<uint32>(readIdx) + toRelease;
+        if (idx >= ringSize) {
+            idx -= ringSize;
+        }
+        //Only now can the producer reuse the slots
+        (void) Atomic::Exchange(&readIdx, static_cast<int32>(idx));
+    }
+}
+
+}
+
+#endif /* SAMPLERING_H_ */
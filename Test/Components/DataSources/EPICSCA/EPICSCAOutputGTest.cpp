@@ -173,4 +173,34 @@ TEST(EPICSCAOutputGTest,TestIsIgnoringBufferOverrun) {
 TEST(EPICSCAOutputGTest,TestAsyncCaPut) {
     EPICSCAOutputTest test;
     ASSERT_TRUE(test.TestAsyncCaPut());
-}
\ No newline at end of file
+}
+
+TEST(EPICSCAOutputGTest,TestInitialise_Ring) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_Ring());
+}
+
+TEST(EPICSCAOutputGTest,TestInitialise_False_Ring) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Ring());
+}
+
+TEST(EPICSCAOutputGTest,TestInitialise_False_Ring_NumberOfBuffers) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Ring_NumberOfBuffers());
+}
+
+TEST(EPICSCAOutputGTest,TestGetBrokerName_Ring) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestGetBrokerName_Ring());
+}
+
+TEST(EPICSCAOutputGTest,TestSynchronise_Ring) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestSynchronise_Ring());
+}
+
+TEST(EPICSCAOutputGTest,TestExecute_Ring) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestExecute_Ring());
+}
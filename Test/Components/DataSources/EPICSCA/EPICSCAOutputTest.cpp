@@ -188,7 +188,7 @@ private:
 
 CLASS_REGISTER(EPICSCAOutputSchedulerTestHelper, "1.0")
 
-static bool TestIntegratedInApplication(const MARTe::char8 * const config, bool destroy) {
+static bool TestIntegratedInApplication(const MARTe::char8 * const config, bool destroy, bool ring = false) {
     using namespace MARTe;
 
     ConfigurationDatabase cdb;
@@ -201,6 +201,15 @@ static bool TestIntegratedInApplication(const MARTe::char8 * const config, bool
     if (!ok) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "%s", err.Buffer());
     }
+    if ((ok) && (ring)) {
+        ok = cdb.MoveAbsolute("$Test.+Data.+EPICSCAOutputTest");
+        if (ok) {
+            ok = cdb.Write("Ring", 1);
+        }
+        if (ok) {
+            ok = cdb.MoveToRoot();
+        }
+    }
 
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
 
@@ -1369,9 +1378,9 @@ bool EPICSCAOutputTest::TestAsyncCaPut() {
     return ok;
 }
 
-bool EPICSCAOutputTest::TestExecute() {
+static bool TestExecuteIntegratedInApplication(bool ring) {
     using namespace MARTe;
-    bool ok = TestIntegratedInApplication(config1, false);
+    bool ok = TestIntegratedInApplication(config1, false, ring);
     ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
 
     ReferenceT<EPICSCAOutputGAMTestHelper> gam1;
@@ -1514,6 +1523,10 @@ bool EPICSCAOutputTest::TestExecute() {
     return ok;
 }
 
+bool EPICSCAOutputTest::TestExecute() {
+    return TestExecuteIntegratedInApplication(false);
+}
+
 bool EPICSCAOutputTest::TestExecute_Arrays() {
     using namespace MARTe;
     bool ok = TestIntegratedInApplication(config3, false);
@@ -1680,3 +1693,133 @@ bool EPICSCAOutputTest::TestExecute_Arrays() {
     return ok;
 }
 
+bool EPICSCAOutputTest::TestInitialise_Ring() {
+    using namespace MARTe;
+    EPICSCAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("Ring", 1);
+    cdb.Write("PublicationPeriod", 5);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    bool ok = !test.IsRing();
+    if (ok) {
+        ok = test.Initialise(cdb);
+    }
+    if (ok) {
+        ok = (test.IsRing());
+        ok &= (test.GetPublicationPeriod() == 5);
+        ok &= (test.GetNumberOfOverruns() == 0);
+        ok &= (test.GetNumberOfCoalescedUpdates() == 0);
+        ok &= (test.ConsumeRing() == 0);
+    }
+    return ok;
+}
+
+bool EPICSCAOutputTest::TestInitialise_False_Ring() {
+    using namespace MARTe;
+    EPICSCAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("Ring", 2);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool EPICSCAOutputTest::TestInitialise_False_Ring_NumberOfBuffers() {
+    using namespace MARTe;
+    EPICSCAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 0);
+    cdb.Write("Ring", 1);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool EPICSCAOutputTest::TestGetBrokerName_Ring() {
+    using namespace MARTe;
+    EPICSCAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("Ring", 1);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (StringHelper::Compare(test.GetBrokerName(cdb, OutputSignals), "MemoryMapSynchronisedOutputBroker") == 0);
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "") == 0);
+    }
+    return ok;
+}
+
+bool EPICSCAOutputTest::TestSynchronise_Ring() {
+    using namespace MARTe;
+    //The publication thread is not started as PrepareNextState is not called
+    bool ok = TestIntegratedInApplication(config1, false, true);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+    ReferenceT<EPICSCAOutput> dataSource;
+    if (ok) {
+        dataSource = godb->Find("Test.Data.EPICSCAOutputTest");
+        ok = dataSource.IsValid();
+    }
+    uint32 numberOfBuffers = 0u;
+    if (ok) {
+        numberOfBuffers = dataSource->GetNumberOfBuffers();
+        ok = (dataSource->IsRing());
+    }
+    uint32 *signal = NULL_PTR(uint32 *);
+    if (ok) {
+        uint32 signalIdx;
+        ok = dataSource->GetSignalIndex(signalIdx, "SignalUInt32");
+        if (ok) {
+            void *signalAddress = NULL_PTR(void *);
+            ok = dataSource->GetSignalMemoryBuffer(signalIdx, 0u, signalAddress);
+            signal = reinterpret_cast<uint32 *>(signalAddress);
+        }
+    }
+    uint32 n;
+    for (n = 0u; (n < numberOfBuffers) && (ok); n++) {
+        *signal = n;
+        ok = dataSource->Synchronise();
+    }
+    if (ok) {
+        ok = (dataSource->GetNumberOfOverruns() == 0u);
+    }
+    if (ok) {
+        //The ring is full (IgnoreBufferOverrun = 1 by default)
+        ok = dataSource->Synchronise();
+    }
+    if (ok) {
+        ok = (dataSource->GetNumberOfOverruns() == 1u);
+    }
+    if (ok) {
+        ok = (dataSource->ConsumeRing() == numberOfBuffers);
+    }
+    if (ok) {
+        ok = (dataSource->GetNumberOfCoalescedUpdates() == (numberOfBuffers - 1u));
+    }
+    if (ok) {
+        ok = (dataSource->ConsumeRing() == 0u);
+    }
+    if (ok) {
+        ok = dataSource->Synchronise();
+    }
+    if (ok) {
+        ok = (dataSource->ConsumeRing() == 1u);
+    }
+    if (ok) {
+        ok = (dataSource->GetNumberOfCoalescedUpdates() == (numberOfBuffers - 1u));
+    }
+    ca_detach_context();
+    ca_context_destroy();
+    godb->Purge();
+    return ok;
+}
+
+bool EPICSCAOutputTest::TestExecute_Ring() {
+    return TestExecuteIntegratedInApplication(true);
+}
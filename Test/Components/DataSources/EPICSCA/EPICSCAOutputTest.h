@@ -171,6 +171,36 @@ public:
      */
     bool TestAsyncCaPut();
 
+    /**
+     * @brief Tests the Initialise method with Ring = 1.
+     */
+    bool TestInitialise_Ring();
+
+    /**
+     * @brief Tests the Initialise method with an invalid Ring value.
+     */
+    bool TestInitialise_False_Ring();
+
+    /**
+     * @brief Tests the Initialise method with Ring = 1 and NumberOfBuffers = 0.
+     */
+    bool TestInitialise_False_Ring_NumberOfBuffers();
+
+    /**
+     * @brief Tests the GetBrokerName method with Ring = 1.
+     */
+    bool TestGetBrokerName_Ring();
+
+    /**
+     * @brief Tests that Synchronise counts the overruns and that ConsumeRing coalesces to the latest sample.
+     */
+    bool TestSynchronise_Ring();
+
+    /**
+     * @brief Tests that the PV values are correctly written by the DataSourceI with Ring = 1.
+     */
+    bool TestExecute_Ring();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -159,3 +159,23 @@ TEST(EPICSPVAOutputGTest,TestSynchronise_False_BadSignal) {
     ASSERT_TRUE(test.TestSynchronise_False_BadSignal());
 }
 
+TEST(EPICSPVAOutputGTest,TestInitialise_Ring) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_Ring());
+}
+
+TEST(EPICSPVAOutputGTest,TestInitialise_False_Ring) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Ring());
+}
+
+TEST(EPICSPVAOutputGTest,TestGetBrokerName_Ring) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestGetBrokerName_Ring());
+}
+
+TEST(EPICSPVAOutputGTest,TestSynchronise_Ring_Overrun) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestSynchronise_Ring_Overrun());
+}
+
@@ -2695,3 +2695,139 @@ bool EPICSPVAOutputTest::TestSynchronise_False_BadSignal() {
 
     return ok;
 }
+
+bool EPICSPVAOutputTest::TestInitialise_Ring() {
+    using namespace MARTe;
+    EPICSPVAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("Ring", 1);
+    cdb.Write("PublicationPeriod", 5);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    bool ok = !test.IsRing();
+    if (ok) {
+        ok = test.Initialise(cdb);
+    }
+    if (ok) {
+        ok = (test.IsRing());
+        ok &= (test.GetPublicationPeriod() == 5);
+        ok &= (test.GetNumberOfMemoryBuffers() == 1);
+        ok &= (test.GetNumberOfOverruns() == 0);
+        ok &= (test.GetNumberOfCoalescedUpdates() == 0);
+        ok &= (test.ConsumeRing() == 0);
+    }
+    return ok;
+}
+
+bool EPICSPVAOutputTest::TestInitialise_False_Ring() {
+    using namespace MARTe;
+    EPICSPVAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("Ring", 2);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool EPICSPVAOutputTest::TestGetBrokerName_Ring() {
+    using namespace MARTe;
+    EPICSPVAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("Ring", 1);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (StringHelper::Compare(test.GetBrokerName(cdb, OutputSignals), "MemoryMapSynchronisedOutputBroker") == 0);
+    }
+    return ok;
+}
+
+bool EPICSPVAOutputTest::TestSynchronise_Ring_Overrun() {
+    using namespace MARTe;
+    const char8 * const config = ""
+            "$Test = {\n"
+            "    Class = RealTimeApplication\n"
+            "    +Functions = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +GAM1 = {\n"
+            "            Class = EPICSPVAOutputGAMTestHelper\n"
+            "            OutputSignals = {\n"
+            "                SignalFloat64 = {\n"
+            "                    Type = float64\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    Alias = RecordOut4\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Data = {\n"
+            "        Class = ReferenceContainer\n"
+            "        DefaultDataSource = DDB1\n"
+            "        +Timings = {\n"
+            "            Class = TimingDataSource\n"
+            "        }\n"
+            "        +EPICSPVAOutputTest = {\n"
+            "            Class = EPICSPVAOutput\n"
+            "            NumberOfBuffers = 2\n"
+            "            IgnoreBufferOverrun = 0\n"
+            "            Ring = 1\n"
+            "            Signals = {\n"
+            "                RecordOut4 = {\n"
+            "                    Field = Element1\n"
+            "                    Type = float64\n"
+            "                    NumberOfElements = 1\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +States = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +State1 = {\n"
+            "            Class = RealTimeState\n"
+            "            +Threads = {\n"
+            "                Class = ReferenceContainer\n"
+            "                +Thread1 = {\n"
+            "                    Class = RealTimeThread\n"
+            "                    Functions = {GAM1}\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Scheduler = {\n"
+            "        Class = EPICSPVAOutputSchedulerTestHelper\n"
+            "        TimingDataSource = Timings\n"
+            "    }\n"
+            "}\n";
+
+    //The publication thread is not started as PrepareNextState is not called
+    bool ok = TestIntegratedInApplication(config, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+    ReferenceT<EPICSPVAOutput> dataSource;
+    if (ok) {
+        dataSource = godb->Find("Test.Data.EPICSPVAOutputTest");
+        ok = dataSource.IsValid();
+    }
+    if (ok) {
+        ok = dataSource->Synchronise();
+    }
+    if (ok) {
+        ok = dataSource->Synchronise();
+    }
+    if (ok) {
+        ok = (dataSource->GetNumberOfOverruns() == 0u);
+    }
+    if (ok) {
+        //The ring is full and IgnoreBufferOverrun = 0
+        ok = !dataSource->Synchronise();
+    }
+    if (ok) {
+        ok = (dataSource->GetNumberOfOverruns() == 1u);
+    }
+    godb->Purge();
+
+    return ok;
+}
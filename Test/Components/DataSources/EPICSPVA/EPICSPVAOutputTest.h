@@ -167,6 +167,26 @@ public:
      */
     bool TestSynchronise_False_BadSignal();
 
+    /**
+     * @brief Tests the Initialise method with Ring = 1.
+     */
+    bool TestInitialise_Ring();
+
+    /**
+     * @brief Tests the Initialise method with an invalid Ring value.
+     */
+    bool TestInitialise_False_Ring();
+
+    /**
+     * @brief Tests the GetBrokerName method with Ring = 1.
+     */
+    bool TestGetBrokerName_Ring();
+
+    /**
+     * @brief Tests that Synchronise counts the overruns when Ring = 1.
+     */
+    bool TestSynchronise_Ring_Overrun();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -430,3 +430,97 @@ TEST(FileReaderGTest,TestEOF_Error_Binary_Preload) {
     ASSERT_TRUE(test.TestEOF_Error_Binary_Preload());
 }
 
+TEST(FileReaderGTest,TestSynchronise_Binary_MemoryMap) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Binary_MemoryMap());
+}
+
+TEST(FileReaderGTest,TestSynchronise_StartSample) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_StartSample());
+}
+
+TEST(FileReaderGTest,TestSynchronise_StartTime) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_StartTime());
+}
+
+TEST(FileReaderGTest,TestSynchronise_CSV_BinaryCache) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_CSV_BinaryCache());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_MemoryMap_Preload) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MemoryMap_Preload());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_BinaryCache) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BinaryCache());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_StartSample_StartTime) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_StartSample_StartTime());
+}
+
+TEST(FileReaderGTest,TestGetBrokerName_InterpolationMode) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestGetBrokerName_InterpolationMode());
+}
+
+TEST(FileReaderGTest,TestSynchronise_InterpolationMode_Linear) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_InterpolationMode_Linear());
+}
+
+TEST(FileReaderGTest,TestSynchronise_InterpolationMode_Hold) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_InterpolationMode_Hold());
+}
+
+TEST(FileReaderGTest,TestSynchronise_InterpolationMode_Cubic) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_InterpolationMode_Cubic());
+}
+
+TEST(FileReaderGTest,TestSynchronise_InterpolationMode_Linear_EOF_Rewind) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_InterpolationMode_Linear_EOF_Rewind());
+}
+
+TEST(FileReaderGTest,TestSynchronise_InterpolationMode_Linear_EOF_Last) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_InterpolationMode_Linear_EOF_Last());
+}
+
+TEST(FileReaderGTest,TestSynchronise_InterpolationMode_Hold_EOF_Rewind) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_InterpolationMode_Hold_EOF_Rewind());
+}
+
+TEST(FileReaderGTest,TestSynchronise_InterpolationMode_Hold_EOF_Last) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_InterpolationMode_Hold_EOF_Last());
+}
+
+TEST(FileReaderGTest,TestSynchronise_InterpolationMode_Cubic_EOF_Rewind) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_InterpolationMode_Cubic_EOF_Rewind());
+}
+
+TEST(FileReaderGTest,TestSynchronise_InterpolationMode_Cubic_EOF_Last) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_InterpolationMode_Cubic_EOF_Last());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_InterpolationMode) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_InterpolationMode());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_InterpolationMode_NoInterpolate) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_InterpolationMode_NoInterpolate());
+}
@@ -549,7 +549,8 @@ static bool TestIntegratedExecution(const MARTe::char8 *const config,
                                     const MARTe::char8 *const csvSeparator = ";",
                                     bool forceEOFRewind = false,
                                     bool forceEOFLast = false,
-                                    bool forceEOFError = false) {
+                                    bool forceEOFError = false,
+                                    const MARTe::char8 *const interpolationMode = "") {
     using namespace MARTe;
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -567,6 +568,9 @@ static bool TestIntegratedExecution(const MARTe::char8 *const config,
         cdb.Write("InterpolationPeriod", interpolationPeriod);
         cdb.Delete("XAxisSignal");
         cdb.Write("XAxisSignal", xAxisSignalName);
+        if (StringHelper::Length(interpolationMode) > 0u) {
+            cdb.Write("InterpolationMode", interpolationMode);
+        }
     }
     else {
         cdb.Write("Interpolate", "no");
@@ -837,7 +841,8 @@ static bool TestIntegratedExecution(const MARTe::char8 *const config,
 static bool TestIntegratedExecutionInterpolation(const MARTe::char8 *const config,
                                                  bool csv,
                                                  MARTe::uint32 *numberOfElements,
-                                                 const MARTe::char8 *const xAxisSignal = "SignalUInt32") {
+                                                 const MARTe::char8 *const xAxisSignal = "SignalUInt32",
+                                                 const MARTe::char8 *const interpolationMode = "") {
     using namespace MARTe;
     const char8 *filename = "";
     bool ok = true;
@@ -852,8 +857,11 @@ static bool TestIntegratedExecutionInterpolation(const MARTe::char8 *const confi
     for (i = 0; i < signalToGenerateNumberOfSamples; i++) {
         signalsFile[i] = new FRTSignalToVerify(numberOfElements, 2 * interpolationPeriod * i + initialValue);
     }
+    //With Hold the file samples are repeated. Otherwise (given that the data is a line) all the interpolation modes return the XAxisSignal.
+    bool hold = (StringHelper::Compare(interpolationMode, "Hold") == 0);
     for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
-        signalsToVerify[i] = new FRTSignalToVerify(numberOfElements, i * interpolationPeriod + initialValue);
+        uint32 value = hold ? (2 * interpolationPeriod * (i / 2) + initialValue) : (i * interpolationPeriod + initialValue);
+        signalsToVerify[i] = new FRTSignalToVerify(numberOfElements, value);
     }
 
     if (csv) {
@@ -861,7 +869,7 @@ static bool TestIntegratedExecutionInterpolation(const MARTe::char8 *const confi
         GenerateCSVFile(filename, ";", signalsFile, numberOfElements, signalToGenerateNumberOfSamples);
         if (ok) {
             ok = TestIntegratedExecution(config, filename, signalsToVerify, numberOfElements, signalToVerifyNumberOfSamples, true, interpolationPeriod,
-                                         xAxisSignal);
+                                         xAxisSignal, true, false, ";", false, false, false, interpolationMode);
         }
     }
     else {
@@ -869,7 +877,7 @@ static bool TestIntegratedExecutionInterpolation(const MARTe::char8 *const confi
         GenerateBinaryFile(filename, signalsFile, numberOfElements, signalToGenerateNumberOfSamples);
         if (ok) {
             ok = TestIntegratedExecution(config, filename, signalsToVerify, numberOfElements, signalToVerifyNumberOfSamples, false, interpolationPeriod,
-                                         xAxisSignal);
+                                         xAxisSignal, true, false, "", false, false, false, interpolationMode);
         }
     }
     for (i = 0; i < signalToGenerateNumberOfSamples; i++) {
@@ -885,6 +893,41 @@ static bool TestIntegratedExecutionInterpolation(const MARTe::char8 *const confi
     return ok;
 }
 
+static bool TestIntegratedExecutionStart(const MARTe::char8 *const config,
+                                         bool csv,
+                                         MARTe::uint32 startIdx) {
+    using namespace MARTe;
+    const char8 *filename = "";
+    bool ok = true;
+    uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    const uint32 signalToGenerateNumberOfSamples = 3u;
+    FRTSignalToVerify **signals = new FRTSignalToVerify*[signalToGenerateNumberOfSamples];
+    uint32 i;
+    for (i = 0; i < signalToGenerateNumberOfSamples; i++) {
+        signals[i] = new FRTSignalToVerify(numberOfElements, i + 1);
+    }
+    if (csv) {
+        filename = "TestIntegratedExecutionStart.csv";
+        GenerateCSVFile(filename, ";", signals, numberOfElements, signalToGenerateNumberOfSamples);
+    }
+    else {
+        filename = "TestIntegratedExecutionStart.bin";
+        GenerateBinaryFile(filename, signals, numberOfElements, signalToGenerateNumberOfSamples);
+    }
+    //Only the samples after the start are to be read
+    if (ok) {
+        ok = TestIntegratedExecution(config, filename, &signals[startIdx], numberOfElements, signalToGenerateNumberOfSamples - startIdx, csv, 0, "", true,
+                                     false, ";");
+    }
+    for (i = 0; i < signalToGenerateNumberOfSamples; i++) {
+        delete signals[i];
+    }
+    delete [] signals;
+    DeleteTestFile(filename);
+
+    return ok;
+}
+
 //Standard configuration to be patched
 static const MARTe::char8 *const config1 = ""
         "$Test = {"
@@ -2919,33 +2962,647 @@ static const MARTe::char8 *const config11P = ""
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
-bool FileReaderTest::TestConstructor() {
-    using namespace MARTe;
-    FileReader test;
-    return true;
-}
-
-bool FileReaderTest::TestAllocateMemory() {
-    using namespace MARTe;
-    FileReader test;
-    return test.AllocateMemory();
-}
+//Configuration with the file memory mapped
+static const MARTe::char8 *const config12 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = FileReaderGAMTriggerTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt8 = {"
+        "                    Type = uint8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt8 = {"
+        "                    Type = int8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt16 = {"
+        "                    Type = int16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt64 = {"
+        "                    Type = int64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat32 = {"
+        "                    Type = float32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat64WhichIsAlsoAVeryLon = {"
+        "                    Type = float64"
+        "                    DataSource = Drv1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = FileReader"
+        "            Filename = \"filereader_test.bin\""
+        "            FileFormat = binary"
+        "            CSVSeparator = \";\""
+        "            Interpolate = no"
+        "            MemoryMap = yes"
+        "            PrefetchByteSize = 4096"
+        "            XAxisSignal = SignalUInt32"
+        "            +Messages = {"
+        "                Class = ReferenceContainer"
+        "                +FileRuntimeError = {"
+        "                    Class = Message"
+        "                    Destination = FileReaderTestHelper"
+        "                    Function = HandleRuntimeError"
+        "                    Mode = ExpectsReply"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = FileReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}"
+        "+FileReaderTestHelper = {"
+        "    Class = FileReaderTestHelper"
+        "}"
+        "+TestMessages = {"
+        "    Class = ReferenceContainer"
+        "    +MessageFlush = {"
+        "        Class = Message"
+        "        Destination = \"Test.Data.Drv1\""
+        "        Function = FlushFile"
+        "    }"
+        "}";
 
-bool FileReaderTest::TestGetNumberOfMemoryBuffers() {
-    using namespace MARTe;
-    FileReader test;
-    return (test.GetNumberOfMemoryBuffers() == 1u);
-}
+//Configuration starting at a given sample
+static const MARTe::char8 *const config13 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = FileReaderGAMTriggerTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt8 = {"
+        "                    Type = uint8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt8 = {"
+        "                    Type = int8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt16 = {"
+        "                    Type = int16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt64 = {"
+        "                    Type = int64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat32 = {"
+        "                    Type = float32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat64WhichIsAlsoAVeryLon = {"
+        "                    Type = float64"
+        "                    DataSource = Drv1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = FileReader"
+        "            Filename = \"filereader_test.bin\""
+        "            FileFormat = binary"
+        "            CSVSeparator = \";\""
+        "            Interpolate = no"
+        "            StartSample = 1"
+        "            XAxisSignal = SignalUInt32"
+        "            +Messages = {"
+        "                Class = ReferenceContainer"
+        "                +FileRuntimeError = {"
+        "                    Class = Message"
+        "                    Destination = FileReaderTestHelper"
+        "                    Function = HandleRuntimeError"
+        "                    Mode = ExpectsReply"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = FileReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}"
+        "+FileReaderTestHelper = {"
+        "    Class = FileReaderTestHelper"
+        "}"
+        "+TestMessages = {"
+        "    Class = ReferenceContainer"
+        "    +MessageFlush = {"
+        "        Class = Message"
+        "        Destination = \"Test.Data.Drv1\""
+        "        Function = FlushFile"
+        "    }"
+        "}";
 
-bool FileReaderTest::TestGetSignalMemoryBuffer() {
-    using namespace MARTe;
-    void *ptr;
-    FileReader test;
-    bool ok = !test.GetSignalMemoryBuffer(0, 0, ptr);
-    if (ok) {
-        uint32 numberOfElements[] = { 1, 1, 1, 3, 1, 1, 1, 1, 10, 1 };
-        ok = TestIntegratedExecution(config1, false, &numberOfElements[0], ";");
-    }
+//Configuration starting at a given XAxisSignal value
+static const MARTe::char8 *const config14 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = FileReaderGAMTriggerTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt8 = {"
+        "                    Type = uint8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt8 = {"
+        "                    Type = int8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt16 = {"
+        "                    Type = int16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt64 = {"
+        "                    Type = int64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat32 = {"
+        "                    Type = float32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat64WhichIsAlsoAVeryLon = {"
+        "                    Type = float64"
+        "                    DataSource = Drv1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = FileReader"
+        "            Filename = \"filereader_test.bin\""
+        "            FileFormat = binary"
+        "            CSVSeparator = \";\""
+        "            Interpolate = no"
+        "            StartTime = 3"
+        "            XAxisSignal = SignalUInt32"
+        "            +Messages = {"
+        "                Class = ReferenceContainer"
+        "                +FileRuntimeError = {"
+        "                    Class = Message"
+        "                    Destination = FileReaderTestHelper"
+        "                    Function = HandleRuntimeError"
+        "                    Mode = ExpectsReply"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = FileReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}"
+        "+FileReaderTestHelper = {"
+        "    Class = FileReaderTestHelper"
+        "}"
+        "+TestMessages = {"
+        "    Class = ReferenceContainer"
+        "    +MessageFlush = {"
+        "        Class = Message"
+        "        Destination = \"Test.Data.Drv1\""
+        "        Function = FlushFile"
+        "    }"
+        "}";
+
+//Configuration with the csv file converted into a memory mapped binary sidecar
+static const MARTe::char8 *const config15 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = FileReaderGAMTriggerTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt8 = {"
+        "                    Type = uint8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt8 = {"
+        "                    Type = int8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt16 = {"
+        "                    Type = int16"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt64 = {"
+        "                    Type = int64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat32 = {"
+        "                    Type = float32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat64WhichIsAlsoAVeryLon = {"
+        "                    Type = float64"
+        "                    DataSource = Drv1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = FileReader"
+        "            Filename = \"filereader_test.bin\""
+        "            FileFormat = binary"
+        "            CSVSeparator = \";\""
+        "            Interpolate = no"
+        "            BinaryCache = yes"
+        "            MemoryMap = yes"
+        "            XAxisSignal = SignalUInt32"
+        "            +Messages = {"
+        "                Class = ReferenceContainer"
+        "                +FileRuntimeError = {"
+        "                    Class = Message"
+        "                    Destination = FileReaderTestHelper"
+        "                    Function = HandleRuntimeError"
+        "                    Mode = ExpectsReply"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = FileReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}"
+        "+FileReaderTestHelper = {"
+        "    Class = FileReaderTestHelper"
+        "}"
+        "+TestMessages = {"
+        "    Class = ReferenceContainer"
+        "    +MessageFlush = {"
+        "        Class = Message"
+        "        Destination = \"Test.Data.Drv1\""
+        "        Function = FlushFile"
+        "    }"
+        "}";
+
+//Configuration with one signal of the types which are interpolated differently (integer saturation, 64 bits and floating point)
+static const MARTe::char8 *const config16 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = FileReaderGAMTriggerTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt8 = {"
+        "                    Type = uint8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt8 = {"
+        "                    Type = int8"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt64 = {"
+        "                    Type = int64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                    DataSource = Drv1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = FileReader"
+        "            Filename = \"filereader_test.csv\""
+        "            FileFormat = csv"
+        "            CSVSeparator = \";\""
+        "            Interpolate = yes"
+        "            XAxisSignal = SignalUInt32"
+        "            InterpolationPeriod = 1"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = FileReaderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * File for the config16. The XAxisSignal (SignalUInt32) has a period of 2, so that with an InterpolationPeriod of 1 every other output
+ * is interpolated at the middle of an interval (i.e. with exact float64 arithmetic).
+ * The SignalUInt8 and the SignalInt8 overshoot the range of the type with Cubic, the SignalUInt64 and the SignalInt64 are above 2^53
+ * (where consecutive integers are not representable as float64) and the SignalFloat64 is a parabola, i.e. not a line.
+ */
+static const MARTe::char8 *const fileInterpolationMode = ""
+        "#SignalUInt32 (uint32)[1];SignalUInt8 (uint8)[1];SignalInt8 (int8)[1];SignalUInt64 (uint64)[1];SignalInt64 (int64)[1];SignalFloat64 (float64)[1]\n"
+        "2;200;-100;1152921504606846977;-1152921504606846977;0.000000\n"
+        "4;255;-128;1152921504606846979;-1152921504606846979;2.000000\n"
+        "6;255;-128;1152921504606846985;-1152921504606846985;8.000000\n"
+        "8;0;101;1152921504606846995;-1152921504606846995;18.000000\n";
+
+/**
+ * Expected output of the config16 for a given cycle.
+ */
+struct FRTInterpolatedSample {
+    MARTe::uint32 xAxis;
+    MARTe::uint8 uint8Value;
+    MARTe::int8 int8Value;
+    MARTe::uint64 uint64Value;
+    MARTe::int64 int64Value;
+    MARTe::float64 float64Value;
+};
+
+static bool TestIntegratedExecutionInterpolationMode(const MARTe::char8 *const interpolationMode,
+                                                     const MARTe::char8 *const eof,
+                                                     bool preload,
+                                                     const FRTInterpolatedSample *const expected,
+                                                     MARTe::uint32 numberOfCycles) {
+    using namespace MARTe;
+    const char8 *const filename = "TestIntegratedExecutionInterpolationMode.csv";
+    GenerateFile(filename, fileInterpolationMode);
+    ConfigurationDatabase cdb;
+    StreamString configStream = config16;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    cdb.MoveAbsolute("$Test.+Data.+Drv1");
+    cdb.Delete("Filename");
+    cdb.Write("Filename", filename);
+    cdb.Write("InterpolationMode", interpolationMode);
+    cdb.Write("EOF", eof);
+    if (preload) {
+        cdb.Write("Preload", "yes");
+    }
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        cdb.MoveToRoot();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    ReferenceT<FileReaderSchedulerTestHelper> scheduler;
+    ReferenceT<FileReaderGAMTriggerTestHelper> gam;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        gam = application->Find("Functions.GAM1");
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    uint32 s;
+    for (s = 0u; (s < numberOfCycles) && (ok); s++) {
+        ok = scheduler->ExecuteThreadCycle(0);
+        if (ok) {
+            ok = (*gam->uint32Signal == expected[s].xAxis);
+        }
+        if (ok) {
+            ok = (*gam->uint8Signal == expected[s].uint8Value);
+        }
+        if (ok) {
+            ok = (*gam->int8Signal == expected[s].int8Value);
+        }
+        if (ok) {
+            ok = (*gam->uint64Signal == expected[s].uint64Value);
+        }
+        if (ok) {
+            ok = (*gam->int64Signal == expected[s].int64Value);
+        }
+        if (ok) {
+            ok = (*gam->float64Signal == expected[s].float64Value);
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unexpected interpolated sample at cycle %d", s);
+        }
+    }
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    god->Purge();
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestConstructor() {
+    using namespace MARTe;
+    FileReader test;
+    return true;
+}
+
+bool FileReaderTest::TestAllocateMemory() {
+    using namespace MARTe;
+    FileReader test;
+    return test.AllocateMemory();
+}
+
+bool FileReaderTest::TestGetNumberOfMemoryBuffers() {
+    using namespace MARTe;
+    FileReader test;
+    return (test.GetNumberOfMemoryBuffers() == 1u);
+}
+
+bool FileReaderTest::TestGetSignalMemoryBuffer() {
+    using namespace MARTe;
+    void *ptr;
+    FileReader test;
+    bool ok = !test.GetSignalMemoryBuffer(0, 0, ptr);
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 3, 1, 1, 1, 1, 10, 1 };
+        ok = TestIntegratedExecution(config1, false, &numberOfElements[0], ";");
+    }
     return ok;
 }
 
@@ -4016,3 +4673,358 @@ bool FileReaderTest::TestEOF_Error_Binary_Preload() {
     uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
     return TestIntegratedExecution(config11P, false, &numberOfElements[0], ";", false, false, true);
 }
+
+bool FileReaderTest::TestSynchronise_Binary_MemoryMap() {
+    using namespace MARTe;
+    bool ok = true;
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecution(config12, false, &numberOfElements[0], ";", true, false, false);
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecution(config12, false, &numberOfElements[0], ";", true, false, false);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_StartSample() {
+    using namespace MARTe;
+    bool ok = TestIntegratedExecutionStart(config13, false, 1u);
+    if (ok) {
+        ok = TestIntegratedExecutionStart(config13, true, 1u);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_StartTime() {
+    using namespace MARTe;
+    //The SignalUInt32 of the sample with index 2 is 3
+    bool ok = TestIntegratedExecutionStart(config14, false, 2u);
+    if (ok) {
+        ok = TestIntegratedExecutionStart(config14, true, 2u);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_CSV_BinaryCache() {
+    using namespace MARTe;
+    const char8 *const filename = "FileReaderTest_BinaryCache.csv";
+    const char8 *const cacheFilename = "FileReaderTest_BinaryCache.csv.bin";
+    uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
+    const uint32 signalToVerifyNumberOfSamples = 3u;
+    FRTSignalToVerify **signals = new FRTSignalToVerify*[signalToVerifyNumberOfSamples];
+    uint32 i;
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        signals[i] = new FRTSignalToVerify(numberOfElements, i + 1);
+    }
+    GenerateCSVFile(filename, ";", signals, numberOfElements, signalToVerifyNumberOfSamples);
+    DeleteTestFile(cacheFilename);
+    //The first execution converts the csv file into the sidecar
+    bool ok = TestIntegratedExecution(config15, filename, signals, numberOfElements, signalToVerifyNumberOfSamples, true, 0, "", true, false, ";", true);
+    if (ok) {
+        File cacheFile;
+        ok = cacheFile.Open(cacheFilename, BasicFile::ACCESS_MODE_R);
+        (void) cacheFile.Close();
+    }
+    //The second execution reads the sidecar, which is newer than the csv file
+    if (ok) {
+        ok = TestIntegratedExecution(config15, filename, signals, numberOfElements, signalToVerifyNumberOfSamples, true, 0, "", true, false, ";", true);
+    }
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        delete signals[i];
+    }
+    delete [] signals;
+    DeleteTestFile(filename);
+    DeleteTestFile(cacheFilename);
+    return ok;
+}
+
+bool FileReaderTest::TestInitialise_False_MemoryMap_Preload() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Filename", "FileReaderTest_TestInitialise.bin");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Interpolate", "no");
+    cdb.Write("Preload", "yes");
+    cdb.Write("MemoryMap", "yes");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileReaderTest::TestInitialise_False_BinaryCache() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Filename", "FileReaderTest_TestInitialise.csv");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVSeparator", ";");
+    cdb.Write("Interpolate", "no");
+    cdb.Write("BinaryCache", "true");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileReaderTest::TestInitialise_False_StartSample_StartTime() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Filename", "FileReaderTest_TestInitialise.bin");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Interpolate", "no");
+    cdb.Write("StartSample", 1);
+    cdb.Write("StartTime", 3);
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileReaderTest::TestGetBrokerName_InterpolationMode() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_Test.csv";
+    GenerateFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVSeparator", ";");
+    cdb.Write("Interpolate", "yes");
+    cdb.Write("XAxisSignal", "SignalUint32");
+    cdb.Write("InterpolationPeriod", 2);
+    cdb.Write("InterpolationMode", "Linear");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (test.GetInterpolationMode() == "Linear");
+    }
+    if (ok) {
+        ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapSynchronisedInputBroker") == 0);
+    }
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_InterpolationMode_Linear() {
+    using namespace MARTe;
+    bool ok = true;
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecutionInterpolation(config1, true, &numberOfElements[0], "SignalUInt32", "Linear");
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 1, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecutionInterpolation(config1, false, &numberOfElements[0], "SignalUInt32", "Linear");
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 1, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecutionInterpolation(config1P, false, &numberOfElements[0], "SignalUInt32", "Linear");
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_InterpolationMode_Hold() {
+    using namespace MARTe;
+    bool ok = true;
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecutionInterpolation(config1, true, &numberOfElements[0], "SignalUInt32", "Hold");
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 1, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecutionInterpolation(config1, false, &numberOfElements[0], "SignalUInt32", "Hold");
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_InterpolationMode_Cubic() {
+    using namespace MARTe;
+    bool ok = true;
+    //The cubic interpolation of a line is the line itself, including the first and the last interval of the file.
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecutionInterpolation(config1, true, &numberOfElements[0], "SignalUInt32", "Cubic");
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 1, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecutionInterpolation(config1, false, &numberOfElements[0], "SignalUInt32", "Cubic");
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_InterpolationMode_Linear_EOF_Rewind() {
+    using namespace MARTe;
+    //2^60
+    const uint64 b = 1152921504606846976LLU;
+    const int64 nb = -1152921504606846976LL;
+    //Integers are rounded to the nearest integer (e.g. 227.5 -> 228 and -13.5 -> -14) and the 64 bit signals are exact.
+    //After the last sample the file is rewound and the window primed again.
+    const FRTInterpolatedSample expected[] = {
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 },
+            { 3u, 228u, -114, b + 2u, nb - 2, 1.0 },
+            { 4u, 255u, -128, b + 3u, nb - 3, 2.0 },
+            { 5u, 255u, -128, b + 6u, nb - 6, 5.0 },
+            { 6u, 255u, -128, b + 9u, nb - 9, 8.0 },
+            { 7u, 128u, -14, b + 14u, nb - 14, 13.0 },
+            { 8u, 0u, 101, b + 19u, nb - 19, 18.0 },
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 },
+            { 3u, 228u, -114, b + 2u, nb - 2, 1.0 } };
+    bool ok = TestIntegratedExecutionInterpolationMode("Linear", "Rewind", false, &expected[0], 9u);
+    if (ok) {
+        ok = TestIntegratedExecutionInterpolationMode("Linear", "Rewind", true, &expected[0], 9u);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_InterpolationMode_Linear_EOF_Last() {
+    using namespace MARTe;
+    //2^60
+    const uint64 b = 1152921504606846976LLU;
+    const int64 nb = -1152921504606846976LL;
+    //After the last sample the window is at the end and the last sample is held, while the XAxisSignal keeps on being interpolated.
+    const FRTInterpolatedSample expected[] = {
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 },
+            { 3u, 228u, -114, b + 2u, nb - 2, 1.0 },
+            { 4u, 255u, -128, b + 3u, nb - 3, 2.0 },
+            { 5u, 255u, -128, b + 6u, nb - 6, 5.0 },
+            { 6u, 255u, -128, b + 9u, nb - 9, 8.0 },
+            { 7u, 128u, -14, b + 14u, nb - 14, 13.0 },
+            { 8u, 0u, 101, b + 19u, nb - 19, 18.0 },
+            { 9u, 0u, 101, b + 19u, nb - 19, 18.0 },
+            { 10u, 0u, 101, b + 19u, nb - 19, 18.0 } };
+    bool ok = TestIntegratedExecutionInterpolationMode("Linear", "Last", false, &expected[0], 9u);
+    if (ok) {
+        ok = TestIntegratedExecutionInterpolationMode("Linear", "Last", true, &expected[0], 9u);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_InterpolationMode_Hold_EOF_Rewind() {
+    using namespace MARTe;
+    //2^60
+    const uint64 b = 1152921504606846976LLU;
+    const int64 nb = -1152921504606846976LL;
+    //The sample whose XAxisSignal is less or equal than the interpolated XAxisSignal is copied as is (including the XAxisSignal).
+    const FRTInterpolatedSample expected[] = {
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 },
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 },
+            { 4u, 255u, -128, b + 3u, nb - 3, 2.0 },
+            { 4u, 255u, -128, b + 3u, nb - 3, 2.0 },
+            { 6u, 255u, -128, b + 9u, nb - 9, 8.0 },
+            { 6u, 255u, -128, b + 9u, nb - 9, 8.0 },
+            { 8u, 0u, 101, b + 19u, nb - 19, 18.0 },
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 },
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 } };
+    bool ok = TestIntegratedExecutionInterpolationMode("Hold", "Rewind", false, &expected[0], 9u);
+    if (ok) {
+        ok = TestIntegratedExecutionInterpolationMode("Hold", "Rewind", true, &expected[0], 9u);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_InterpolationMode_Hold_EOF_Last() {
+    using namespace MARTe;
+    //2^60
+    const uint64 b = 1152921504606846976LLU;
+    const int64 nb = -1152921504606846976LL;
+    //After the last sample the last sample is held, including its XAxisSignal.
+    const FRTInterpolatedSample expected[] = {
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 },
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 },
+            { 4u, 255u, -128, b + 3u, nb - 3, 2.0 },
+            { 4u, 255u, -128, b + 3u, nb - 3, 2.0 },
+            { 6u, 255u, -128, b + 9u, nb - 9, 8.0 },
+            { 6u, 255u, -128, b + 9u, nb - 9, 8.0 },
+            { 8u, 0u, 101, b + 19u, nb - 19, 18.0 },
+            { 8u, 0u, 101, b + 19u, nb - 19, 18.0 },
+            { 8u, 0u, 101, b + 19u, nb - 19, 18.0 } };
+    bool ok = TestIntegratedExecutionInterpolationMode("Hold", "Last", false, &expected[0], 9u);
+    if (ok) {
+        ok = TestIntegratedExecutionInterpolationMode("Hold", "Last", true, &expected[0], 9u);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_InterpolationMode_Cubic_EOF_Rewind() {
+    using namespace MARTe;
+    //2^60
+    const uint64 b = 1152921504606846976LLU;
+    const int64 nb = -1152921504606846976LL;
+    //Catmull-Rom at the middle of an interval: (-y0 + 9 * y1 + 9 * y2 - y3) / 16, with y0 = 2 * y1 - y2 in the first interval and
+    //y3 = 2 * y2 - y1 in the last one. e.g. SignalFloat64 at 3: (2 + 0 + 18 - 8) / 16 = 0.75 and at 5: (0 + 18 + 72 - 18) / 16 = 4.5.
+    //SignalUInt8 at 5 is 274.375 and SignalInt8 is -144.0625, which are saturated. The lookahead sample of the last interval is
+    //the first sample of the file (read after the rewind), which is kept until the last interval has been interpolated.
+    const FRTInterpolatedSample expected[] = {
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 },
+            { 3u, 231u, -116, b + 2u, nb - 2, 0.75 },
+            { 4u, 255u, -128, b + 3u, nb - 3, 2.0 },
+            { 5u, 255u, -128, b + 6u, nb - 6, 4.5 },
+            { 6u, 255u, -128, b + 9u, nb - 9, 8.0 },
+            { 7u, 143u, -28, b + 14u, nb - 14, 12.75 },
+            { 8u, 0u, 101, b + 19u, nb - 19, 18.0 },
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 },
+            { 3u, 231u, -116, b + 2u, nb - 2, 0.75 } };
+    bool ok = TestIntegratedExecutionInterpolationMode("Cubic", "Rewind", false, &expected[0], 9u);
+    if (ok) {
+        ok = TestIntegratedExecutionInterpolationMode("Cubic", "Rewind", true, &expected[0], 9u);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_InterpolationMode_Cubic_EOF_Last() {
+    using namespace MARTe;
+    //2^60
+    const uint64 b = 1152921504606846976LLU;
+    const int64 nb = -1152921504606846976LL;
+    //The last interval is interpolated with the next sample extrapolated, after which the last sample is held.
+    const FRTInterpolatedSample expected[] = {
+            { 2u, 200u, -100, b + 1u, nb - 1, 0.0 },
+            { 3u, 231u, -116, b + 2u, nb - 2, 0.75 },
+            { 4u, 255u, -128, b + 3u, nb - 3, 2.0 },
+            { 5u, 255u, -128, b + 6u, nb - 6, 4.5 },
+            { 6u, 255u, -128, b + 9u, nb - 9, 8.0 },
+            { 7u, 143u, -28, b + 14u, nb - 14, 12.75 },
+            { 8u, 0u, 101, b + 19u, nb - 19, 18.0 },
+            { 9u, 0u, 101, b + 19u, nb - 19, 18.0 },
+            { 10u, 0u, 101, b + 19u, nb - 19, 18.0 } };
+    bool ok = TestIntegratedExecutionInterpolationMode("Cubic", "Last", false, &expected[0], 9u);
+    if (ok) {
+        ok = TestIntegratedExecutionInterpolationMode("Cubic", "Last", true, &expected[0], 9u);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestInitialise_False_InterpolationMode() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.csv";
+    GenerateFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVSeparator", ";");
+    cdb.Write("Interpolate", "yes");
+    cdb.Write("XAxisSignal", "SignalUint8");
+    cdb.Write("InterpolationPeriod", 100);
+    cdb.Write("InterpolationMode", "Quadratic");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    DeleteTestFile(filename);
+    return !ok;
+}
+
+bool FileReaderTest::TestInitialise_False_InterpolationMode_NoInterpolate() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.csv";
+    GenerateFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVSeparator", ";");
+    cdb.Write("Interpolate", "no");
+    cdb.Write("InterpolationMode", "Linear");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    DeleteTestFile(filename);
+    return !ok;
+}
@@ -430,6 +430,101 @@ public:
      * @brief Tests the EOF for binary files with the Error behaviour using preload..
      */
     bool TestEOF_Error_Binary_Preload();
+
+    /**
+     * @brief Tests the Synchronise method reading from a memory mapped binary file.
+     */
+    bool TestSynchronise_Binary_MemoryMap();
+
+    /**
+     * @brief Tests the Synchronise method starting from a given StartSample.
+     */
+    bool TestSynchronise_StartSample();
+
+    /**
+     * @brief Tests the Synchronise method starting from a given StartTime.
+     */
+    bool TestSynchronise_StartTime();
+
+    /**
+     * @brief Tests the Synchronise method reading a csv file through its binary cache.
+     */
+    bool TestSynchronise_CSV_BinaryCache();
+
+    /**
+     * @brief Tests that the Initialise method fails if MemoryMap and Preload are both set.
+     */
+    bool TestInitialise_False_MemoryMap_Preload();
+
+    /**
+     * @brief Tests that the Initialise method fails if BinaryCache is neither yes nor no.
+     */
+    bool TestInitialise_False_BinaryCache();
+
+    /**
+     * @brief Tests that the Initialise method fails if StartSample and StartTime are both set.
+     */
+    bool TestInitialise_False_StartSample_StartTime();
+
+    /**
+     * @brief Tests that the GetBrokerName method returns a MemoryMapSynchronisedInputBroker if the InterpolationMode is set.
+     */
+    bool TestGetBrokerName_InterpolationMode();
+
+    /**
+     * @brief Tests the Synchronise method with InterpolationMode = Linear.
+     */
+    bool TestSynchronise_InterpolationMode_Linear();
+
+    /**
+     * @brief Tests the Synchronise method with InterpolationMode = Hold.
+     */
+    bool TestSynchronise_InterpolationMode_Hold();
+
+    /**
+     * @brief Tests the Synchronise method with InterpolationMode = Cubic.
+     */
+    bool TestSynchronise_InterpolationMode_Cubic();
+
+    /**
+     * @brief Tests the Synchronise method with InterpolationMode = Linear with integer rounding and saturation, 64 bit signals above 2^53 and EOF = Rewind.
+     */
+    bool TestSynchronise_InterpolationMode_Linear_EOF_Rewind();
+
+    /**
+     * @brief Tests the Synchronise method with InterpolationMode = Linear and EOF = Last.
+     */
+    bool TestSynchronise_InterpolationMode_Linear_EOF_Last();
+
+    /**
+     * @brief Tests the Synchronise method with InterpolationMode = Hold and EOF = Rewind.
+     */
+    bool TestSynchronise_InterpolationMode_Hold_EOF_Rewind();
+
+    /**
+     * @brief Tests the Synchronise method with InterpolationMode = Hold and EOF = Last.
+     */
+    bool TestSynchronise_InterpolationMode_Hold_EOF_Last();
+
+    /**
+     * @brief Tests the Synchronise method with InterpolationMode = Cubic with non linear data, integer saturation, 64 bit signals above 2^53 and EOF = Rewind (where the lookahead sample is read after the rewind).
+     */
+    bool TestSynchronise_InterpolationMode_Cubic_EOF_Rewind();
+
+    /**
+     * @brief Tests the Synchronise method with InterpolationMode = Cubic and EOF = Last.
+     */
+    bool TestSynchronise_InterpolationMode_Cubic_EOF_Last();
+
+    /**
+     * @brief Tests that the Initialise method fails with an invalid InterpolationMode.
+     */
+    bool TestInitialise_False_InterpolationMode();
+
+    /**
+     * @brief Tests that the Initialise method fails if the InterpolationMode is set and Interpolate = no.
+     */
+    bool TestInitialise_False_InterpolationMode_NoInterpolate();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -342,3 +342,34 @@ TEST(FileWriterGTest,TestNoOverwrite_CSV) {
     FileWriterTest test;
     ASSERT_TRUE(test.TestNoOverwrite_CSV());
 }
+
+TEST(FileWriterGTest,TestInitialise_CyclesPerWrite) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_CyclesPerWrite());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_CyclesPerWrite_GT_0) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_CyclesPerWrite_GT_0());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_CyclesPerWrite_CSV) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_CyclesPerWrite_CSV());
+}
+
+TEST(FileWriterGTest,TestSynchronise_CyclesPerWrite) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestSynchronise_CyclesPerWrite());
+}
+
+TEST(FileWriterGTest,TestSynchronise_CSVNumberFormat) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestSynchronise_CSVNumberFormat());
+}
+
+TEST(FileWriterGTest,TestCloseFile_CSVPartialBlock) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestCloseFile_CSVPartialBlock());
+}
+
@@ -24,6 +24,7 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <limits>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -341,7 +342,7 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
                                     MARTe::uint32 numberOfPreTriggers, MARTe::uint32 numberOfPostTriggers, MARTe::float32 period,
                                     const MARTe::char8 * const filename, const MARTe::char8 * const expectedFileContent, bool csv, bool deleteFile,
                                     const MARTe::uint32 sleepMSec = 100, 
-                                    const MARTe::uint8 refreshContent = 0u, MARTe::uint32 * detectedSize = NULL) {
+                                    const MARTe::uint8 refreshContent = 0u, MARTe::uint32 * detectedSize = NULL, const MARTe::uint32 cyclesPerWrite = 1u) {
     using namespace MARTe;
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -385,6 +386,8 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
     cdb.Write("StoreOnTrigger", storeOnTrigger);
     cdb.Delete("RefreshContent");
     cdb.Write("RefreshContent", refreshContent);
+    cdb.Delete("CyclesPerWrite");
+    cdb.Write("CyclesPerWrite", cyclesPerWrite);
 
     cdb.Delete("FileFormat");
     if (csv) {
@@ -3068,6 +3071,234 @@ static const MARTe::char8 * const config17 = ""
         "    }"
         "}";
 
+// Configuration for TestSynchronise_CSVNumberFormat and TestCloseFile_CSVPartialBlock
+static const MARTe::char8 * const config18 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = FileWriterGAMTriggerTestHelper"
+        "            Signal =  {0}"
+        "            OutputSignals = {"
+        "                Trigger = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint8"
+        "                }"
+        "                Time = {"
+        "                    DataSource = DDB1"
+        "                    Type = uint32"
+        "                }"
+        "                SignalFloat32 = {"
+        "                    Type = float32"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 14"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 14"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalInt64 = {"
+        "                    Type = int64"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = Drv1"
+        "                }"
+        "                SignalFloat64Scalar = {"
+        "                    Type = float64"
+        "                    DataSource = Drv1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Drv1 = {"
+        "            Class = FileWriter"
+        "            NumberOfBuffers = 10"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            Filename = \"FileWriterTest_CSVNumberFormat.csv\""
+        "            FileFormat = csv"
+        "            CSVSeparator = \";\""
+        "            Overwrite = yes"
+        "            StoreOnTrigger = 0"
+        "            RefreshContent = 0"
+        "            Signals = {"
+        "                SignalFloat32 = {"
+        "                    Type = float32"
+        "                }"
+        "                SignalFloat64 = {"
+        "                    Type = float64"
+        "                }"
+        "                SignalInt64 = {"
+        "                    Type = int64"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                }"
+        "                SignalFloat64Scalar = {"
+        "                    Type = float64"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = FileWriterSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * Writes a single csv line with values which are not trivially formatted (integral, zero, fractional, tiny, huge, negative, not finite and integer limits)
+ * and compares the file content, byte for byte, against the output of the generic Printf path (i.e. the one used before the
+ * precompiled csv formatters were introduced). The line is smaller than the csv block, so it only reaches the file if
+ * FlushFile (closeFile = false) or CloseFile (closeFile = true) write the partially filled block.
+ */
+static bool TestIntegratedCSVNumberFormat(bool closeFile) {
+    using namespace MARTe;
+    const char8 * const filename = "FileWriterTest_CSVNumberFormat.csv";
+    bool ok = TestIntegratedInApplication(config18, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<FileWriter> fileWriter;
+    if (ok) {
+        fileWriter = godb->Find("Test.Data.Drv1");
+        ok = fileWriter.IsValid();
+    }
+    void *signalAddress[5] = { NULL, NULL, NULL, NULL, NULL };
+    uint32 s;
+    for (s = 0u; (s < 5u) && (ok); s++) {
+        ok = fileWriter->GetSignalMemoryBuffer(s, 0u, signalAddress[s]);
+    }
+    StreamString expectedFileContent = "#SignalFloat32 (float32)[14];SignalFloat64 (float64)[14];SignalInt64 (int64)[3];SignalUInt64 (uint64)[1];"
+                                       "SignalFloat64Scalar (float64)[1]\n";
+    if (ok) {
+        float32 *signalFloat32 = reinterpret_cast<float32 *>(signalAddress[0]);
+        signalFloat32[0] = 0.1F;
+        signalFloat32[1] = 1.5e-7F;
+        signalFloat32[2] = 3.0e16F;
+        signalFloat32[3] = -2.5F;
+        signalFloat32[4] = std::numeric_limits<float32>::quiet_NaN();
+        signalFloat32[5] = std::numeric_limits<float32>::infinity();
+        signalFloat32[6] = -std::numeric_limits<float32>::infinity();
+        signalFloat32[7] = -123456.0F;
+        //Zero (also negative), fractional and negative values, including negative values which are printed as zero
+        signalFloat32[8] = 0.0F;
+        signalFloat32[9] = -0.0F;
+        signalFloat32[10] = -0.75F;
+        signalFloat32[11] = 1234.5677F;
+        signalFloat32[12] = -0.001F;
+        signalFloat32[13] = -3.0e-7F;
+        float64 *signalFloat64 = reinterpret_cast<float64 *>(signalAddress[1]);
+        signalFloat64[0] = 0.3;
+        signalFloat64[1] = 2.5e-9;
+        signalFloat64[2] = 1.0e17;
+        signalFloat64[3] = 654321.0;
+        signalFloat64[4] = std::numeric_limits<float64>::quiet_NaN();
+        signalFloat64[5] = std::numeric_limits<float64>::infinity();
+        signalFloat64[6] = -std::numeric_limits<float64>::infinity();
+        signalFloat64[7] = 999999999.9999996;
+        signalFloat64[8] = 0.0;
+        signalFloat64[9] = -0.0;
+        signalFloat64[10] = -3.141592653589793;
+        signalFloat64[11] = 123456.7890123;
+        signalFloat64[12] = -0.000001;
+        signalFloat64[13] = -98765432.1234567;
+        int64 *signalInt64 = reinterpret_cast<int64 *>(signalAddress[2]);
+        signalInt64[0] = std::numeric_limits<int64>::min();
+        signalInt64[1] = -1;
+        signalInt64[2] = std::numeric_limits<int64>::max();
+        *reinterpret_cast<uint64 *>(signalAddress[3]) = std::numeric_limits<uint64>::max();
+        *reinterpret_cast<float64 *>(signalAddress[4]) = -0.0000005;
+
+        AnyType signalsAnyType[5];
+        signalsAnyType[0] = AnyType(Float32Bit, 0u, signalAddress[0]);
+        signalsAnyType[0].SetNumberOfDimensions(1u);
+        signalsAnyType[0].SetNumberOfElements(0u, 14u);
+        signalsAnyType[1] = AnyType(Float64Bit, 0u, signalAddress[1]);
+        signalsAnyType[1].SetNumberOfDimensions(1u);
+        signalsAnyType[1].SetNumberOfElements(0u, 14u);
+        signalsAnyType[2] = AnyType(SignedInteger64Bit, 0u, signalAddress[2]);
+        signalsAnyType[2].SetNumberOfDimensions(1u);
+        signalsAnyType[2].SetNumberOfElements(0u, 3u);
+        signalsAnyType[3] = AnyType(UnsignedInteger64Bit, 0u, signalAddress[3]);
+        signalsAnyType[4] = AnyType(Float64Bit, 0u, signalAddress[4]);
+        //The line is expected to be exactly equal to the one printed with the default format of each signal
+        ok = expectedFileContent.PrintFormatted("%f;%f;%d;%u;%f\n", &signalsAnyType[0]);
+    }
+    if (ok) {
+        ok = fileWriter->Synchronise();
+    }
+    if (ok) {
+        ErrorManagement::ErrorType err;
+        if (closeFile) {
+            err = fileWriter->CloseFile();
+        }
+        else {
+            err = fileWriter->FlushFile();
+        }
+        ok = err.ErrorsCleared();
+    }
+    //Read the file before purging (which would also flush the file)
+    File generatedFile;
+    if (ok) {
+        ok = generatedFile.Open(filename, BasicFile::ACCESS_MODE_R);
+    }
+    StreamString fileContent;
+    if (ok) {
+        const uint32 BUFFER_SIZE = 64u;
+        char8 buffer[BUFFER_SIZE];
+        uint32 readSize = BUFFER_SIZE;
+        (void) generatedFile.Seek(0u);
+        while ((ok) && (generatedFile.Read(&buffer[0], readSize))) {
+            if (readSize == 0u) {
+                break;
+            }
+            ok = fileContent.Write(&buffer[0], readSize);
+            readSize = BUFFER_SIZE;
+        }
+        (void) generatedFile.Close();
+    }
+    if (ok) {
+        ok = (fileContent == expectedFileContent);
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Expected %s but read %s", expectedFileContent.Buffer(), fileContent.Buffer());
+        }
+    }
+    godb->Purge();
+    Directory toDelete(filename);
+    (void) toDelete.Delete();
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -3300,6 +3531,66 @@ bool FileWriterTest::TestInitialise_Binary() {
     return ok;
 }
 
+bool FileWriterTest::TestInitialise_CyclesPerWrite() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise_CyclesPerWrite");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("CyclesPerWrite", 8);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetCyclesPerWrite() == 8);
+    ok &= (test.GetWriteThroughput() == 0.0);
+    return ok;
+}
+
+bool FileWriterTest::TestInitialise_False_CyclesPerWrite_GT_0() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise_CyclesPerWrite");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("CyclesPerWrite", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileWriterTest::TestInitialise_False_CyclesPerWrite_CSV() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise_CyclesPerWrite");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVSeparator", ",");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("CyclesPerWrite", 4);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileWriterTest::TestSynchronise_CyclesPerWrite() {
+    //5 cycles are generated: two complete blocks are written by Synchronise and the last cycle by FlushFile
+    return TestIntegratedInApplication_NoTrigger("FileWriterTest_TestSynchronise_CyclesPerWrite_BIN", false, 0u, NULL, 2u);
+}
+
 bool FileWriterTest::TestInitialise_False_Binary_No_Overwrite() {
     using namespace MARTe;
     FileWriter test;
@@ -3586,7 +3877,7 @@ bool FileWriterTest::TestIntegratedInApplication_RefreshContent(const MARTe::cha
     return TestIntegratedInApplication_NoTrigger( filename, csv, 1u, detectedFileSize);
 }
 
-bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *filename, bool csv, MARTe::uint8 refreshContent, MARTe::uint32* detectedFileSize) {
+bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *filename, bool csv, MARTe::uint8 refreshContent, MARTe::uint32* detectedFileSize, MARTe::uint32 cyclesPerWrite) {
     using namespace MARTe;
     uint32 signalToGenerate[] = { 1, 2, 3, 4, 5 };
     uint32 numberOfElements = sizeof(signalToGenerate) / sizeof(uint32);
@@ -3704,7 +3995,7 @@ bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *
         }
     }
 
-    bool ok = TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, 1u, numberOfBuffers, 0, 0, period, filename, expectedFileContent, csv, true, 100, refreshContent, detectedFileSize);
+    bool ok = TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, 1u, numberOfBuffers, 0, 0, period, filename, expectedFileContent, csv, true, 100, refreshContent, detectedFileSize, cyclesPerWrite);
     if (!csv) {
         if (expectedFileContent != NULL) {
             char8 *mem = const_cast<char8 *>(&expectedFileContent[0]);
@@ -4321,3 +4612,11 @@ bool FileWriterTest::TestNoOverwrite_CSV()
 {
     return TestIntegratedInApplication_NoOverwrite( "FileWriterTest_TestNoOverwrite", true, 0u, NULL);
 }
+
+bool FileWriterTest::TestSynchronise_CSVNumberFormat() {
+    return TestIntegratedCSVNumberFormat(false);
+}
+
+bool FileWriterTest::TestCloseFile_CSVPartialBlock() {
+    return TestIntegratedCSVNumberFormat(true);
+}
@@ -239,7 +239,7 @@ public:
     /**
      * @brief Tests the FileWriter integrated in an application which continuously stores data.
      */
-    bool TestIntegratedInApplication_NoTrigger(const MARTe::char8 *filename, bool csv = true, MARTe::uint8 refreshContent = 0u, MARTe::uint32* detectedFileSize = 0);
+    bool TestIntegratedInApplication_NoTrigger(const MARTe::char8 *filename, bool csv = true, MARTe::uint8 refreshContent = 0u, MARTe::uint32* detectedFileSize = 0, MARTe::uint32 cyclesPerWrite = 1u);
 
     /**
      * @brief Tests the FileWriter integrated in an application which continuously stores data.
@@ -366,6 +366,37 @@ public:
      */
     bool TestNoOverwrite_CSV();
 
+    /**
+     * @brief Tests the Initialise method with CyclesPerWrite > 1.
+     */
+    bool TestInitialise_CyclesPerWrite();
+
+    /**
+     * @brief Tests the Initialise method with CyclesPerWrite = 0.
+     */
+    bool TestInitialise_False_CyclesPerWrite_GT_0();
+
+    /**
+     * @brief Tests the Initialise method with CyclesPerWrite > 1 and FileFormat = csv.
+     */
+    bool TestInitialise_False_CyclesPerWrite_CSV();
+
+    /**
+     * @brief Tests the Synchronise method accumulating more than one cycle per write.
+     */
+    bool TestSynchronise_CyclesPerWrite();
+
+    /**
+     * @brief Tests that the csv lines are printed, byte for byte, as with the default Printf formats for fractional, tiny, huge, negative
+     * and not finite floats, for the 64 bit integer limits and for arrays; the partially filled csv block is written by FlushFile.
+     */
+    bool TestSynchronise_CSVNumberFormat();
+
+    /**
+     * @brief Tests that CloseFile writes the partially filled csv block.
+     */
+    bool TestCloseFile_CSVPartialBlock();
+
 };
 
 /*---------------------------------------------------------------------------*/
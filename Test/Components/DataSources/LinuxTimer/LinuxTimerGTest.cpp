@@ -290,6 +290,31 @@ TEST(LinuxTimerGTest, TestSetConfiguredDatabase_WithBackwardCompatOnHRT) {
     ASSERT_TRUE(test.TestSetConfiguredDatabase_WithBackwardCompatOnHRT());
 }
 
+TEST(LinuxTimerGTest, TestGetSignalMemoryBuffer_Statistics) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestGetSignalMemoryBuffer_Statistics());
+}
+
+TEST(LinuxTimerGTest, TestInitialise_LatenessHistogram) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_LatenessHistogram());
+}
+
+TEST(LinuxTimerGTest, TestInitialise_False_LatenessHistogramNumberOfBins) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_LatenessHistogramNumberOfBins());
+}
+
+TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_InvalidStatisticsSignal) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_InvalidStatisticsSignal());
+}
+
+TEST(LinuxTimerGTest, TestExecute_Statistics) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestExecute_Statistics());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1556,6 +1556,158 @@ const MARTe::char8 *const config34 = ""
         "    }"
         "}";
 
+//Configuration with the statistics signals
+const MARTe::char8 *const config35 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "                AbsoluteTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                DeltaTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                TrigRephase = {"
+        "                    DataSource = Timer"
+        "                    Type = uint8"
+        "                }"
+        "                Lateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                MaxOverrun = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                MissedPeriods = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            SleepNature = Default"
+        "            LatenessHistogramBinWidth = 100000"
+        "            LatenessHistogramNumberOfBins = 8"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with a statistics signal with the wrong type
+const MARTe::char8 *const config36 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LinuxTimerTestGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                    Frequency = 1000"
+        "                }"
+        "                AbsoluteTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                DeltaTime = {"
+        "                    DataSource = Timer"
+        "                    Type = uint64"
+        "                }"
+        "                TrigRephase = {"
+        "                    DataSource = Timer"
+        "                    Type = uint8"
+        "                }"
+        "                Lateness = {"
+        "                    DataSource = Timer"
+        "                    Type = uint16"
+        "                }"
+        "                MaxOverrun = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "                MissedPeriods = {"
+        "                    DataSource = Timer"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            SleepNature = Default"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1599,7 +1751,7 @@ bool LinuxTimerTest::TestGetSignalMemoryBuffer_False() {
     using namespace MARTe;
     LinuxTimer test;
     uint32 *ptr;
-    return !test.GetSignalMemoryBuffer(5, 0, (void*&) ptr);
+    return !test.GetSignalMemoryBuffer(8, 0, (void*&) ptr);
 }
 
 bool LinuxTimerTest::TestGetBrokerName() {
@@ -2446,3 +2598,168 @@ bool LinuxTimerTest::TestGetSleepPercentage() {
     return TestInitialise_Busy_SleepPercentage();
 }
 
+bool LinuxTimerTest::TestGetSignalMemoryBuffer_Statistics() {
+    using namespace MARTe;
+    LinuxTimer test;
+    bool ok = true;
+    uint32 i;
+    for (i = 5u; (i < 8u) && (ok); i++) {
+        uint32 *ptr = NULL_PTR(uint32 *);
+        ok = test.GetSignalMemoryBuffer(i, 0, (void*&) ptr);
+        if (ok) {
+            ok = (*ptr == 0u);
+        }
+    }
+    return ok;
+}
+
+bool LinuxTimerTest::TestInitialise_LatenessHistogram() {
+    using namespace MARTe;
+    LinuxTimer test;
+    ConfigurationDatabase cdb;
+    bool ok = (test.GetLatenessHistogramBinWidth() == 1000u);
+    ok &= (test.GetLatenessHistogramNumberOfBins() == 16u);
+    cdb.Write("LatenessHistogramBinWidth", 500);
+    cdb.Write("LatenessHistogramNumberOfBins", 4);
+    if (ok) {
+        ok = test.Initialise(cdb);
+    }
+    if (ok) {
+        ok = (test.GetLatenessHistogramBinWidth() == 500u);
+        ok &= (test.GetLatenessHistogramNumberOfBins() == 4u);
+    }
+    LinuxTimerStatistics stats;
+    uint32 histogram[4];
+    if (ok) {
+        ok = test.GetStatistics(stats, &histogram[0], 4u);
+    }
+    if (ok) {
+        ok = (stats.numberOfCycles == 0u);
+        ok &= (stats.maxLateness == 0u);
+        ok &= (histogram[0] == 0u);
+        ok &= (histogram[3] == 0u);
+    }
+    if (ok) {
+        //Wrong number of bins
+        ok = !test.GetStatistics(stats, &histogram[0], 3u);
+    }
+    return ok;
+}
+
+bool LinuxTimerTest::TestInitialise_False_LatenessHistogramNumberOfBins() {
+    using namespace MARTe;
+    LinuxTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("LatenessHistogramNumberOfBins", 0);
+    return !test.Initialise(cdb);
+}
+
+bool LinuxTimerTest::TestSetConfiguredDatabase_False_InvalidStatisticsSignal() {
+    return !TestIntegratedInApplication(config36);
+}
+
+bool LinuxTimerTest::TestExecute_Statistics() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(config35);
+    ConfigurationDatabase cdb;
+    StreamString configStream = config35;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    if (ok) {
+        ok = parser.Parse();
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution().ErrorsCleared();
+    }
+    ReferenceT<LinuxTimer> linuxTimer;
+    if (ok) {
+        linuxTimer = application->Find("Data.Timer");
+        ok = linuxTimer.IsValid();
+    }
+    LinuxTimerStatistics stats;
+    uint32 histogram[8];
+    if (ok) {
+        uint32 c = 0u;
+        stats.numberOfCycles = 0u;
+        while ((ok) && (c < 500u) && (stats.numberOfCycles <= 10u)) {
+            Sleep::MSec(10);
+            ok = linuxTimer->GetStatistics(stats, &histogram[0], 8u);
+            c++;
+        }
+    }
+    if (ok) {
+        ok = (stats.numberOfCycles > 10u);
+        ok &= (stats.maxLateness >= stats.lastLateness);
+        ok &= (stats.sumLateness <= (stats.maxLateness * stats.numberOfCycles));
+    }
+    if (ok) {
+        //The histogram may have been updated after the statistics were copied
+        uint64 total = 0u;
+        uint32 i;
+        for (i = 0u; i < 8u; i++) {
+            total += histogram[i];
+        }
+        ok = (total == stats.numberOfCycles);
+    }
+    if (ok) {
+        ReferenceContainer message;
+        ReferenceT<ConfigurationDatabase> data(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        ok = message.Insert(data);
+        if (ok) {
+            ok = linuxTimer->ReportStatistics(message).ErrorsCleared();
+        }
+        uint64 numberOfCycles = 0u;
+        uint64 maxLateness = 0u;
+        uint32 messageHistogram[8];
+        Vector<uint32> messageHistogramV(&messageHistogram[0], 8u);
+        if (ok) {
+            ok = data->Read("NumberOfCycles", numberOfCycles);
+        }
+        if (ok) {
+            ok = data->Read("MaxLateness", maxLateness);
+        }
+        if (ok) {
+            ok = data->Read("LatenessHistogram", messageHistogramV);
+        }
+        if (ok) {
+            ok = (numberOfCycles >= stats.numberOfCycles);
+            ok &= (maxLateness >= stats.maxLateness);
+        }
+    }
+    if (ok) {
+        ok = linuxTimer->ResetStatistics().ErrorsCleared();
+    }
+    if (ok) {
+        uint64 previousNumberOfCycles = stats.numberOfCycles;
+        uint32 c = 0u;
+        while ((ok) && (c < 500u) && (stats.numberOfCycles >= previousNumberOfCycles)) {
+            Sleep::MSec(1);
+            ok = linuxTimer->GetStatistics(stats, NULL_PTR(uint32 *), 0u);
+            c++;
+        }
+        if (ok) {
+            ok = (stats.numberOfCycles < previousNumberOfCycles);
+        }
+    }
+    if (application.IsValid()) {
+        (void) application->StopCurrentStateExecution();
+    }
+    god->Purge();
+    return ok;
+}
@@ -296,6 +296,31 @@ public:
      */
     bool TestSetConfiguredDatabase_WithBackwardCompatOnHRT();
 
+    /**
+     * @brief Tests the GetSignalMemoryBuffer method with the Lateness, MaxOverrun and MissedPeriods signals.
+     */
+    bool TestGetSignalMemoryBuffer_Statistics();
+
+    /**
+     * @brief Tests the Initialise method with the LatenessHistogramBinWidth and LatenessHistogramNumberOfBins parameters.
+     */
+    bool TestInitialise_LatenessHistogram();
+
+    /**
+     * @brief Tests the Initialise method with LatenessHistogramNumberOfBins = 0.
+     */
+    bool TestInitialise_False_LatenessHistogramNumberOfBins();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method with a statistics signal that is not a uint32.
+     */
+    bool TestSetConfiguredDatabase_False_InvalidStatisticsSignal();
+
+    /**
+     * @brief Tests that the statistics are updated, reported by the ReportStatistics method and reset by the ResetStatistics method.
+     */
+    bool TestExecute_Statistics();
+
 };
 
 /*---------------------------------------------------------------------------*/
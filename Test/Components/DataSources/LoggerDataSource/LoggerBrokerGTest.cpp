@@ -56,6 +56,26 @@ TEST(LoggerBrokerGTest,TestExecute) {
     ASSERT_TRUE(test.TestExecute());
 }
 
+TEST(LoggerBrokerGTest,TestExecute_Deferred) {
+    LoggerBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Deferred());
+}
+
+TEST(LoggerBrokerGTest,TestExecute_Deferred_Filters) {
+    LoggerBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Deferred_Filters());
+}
+
+TEST(LoggerBrokerGTest,TestExecute_Deferred_MaxRate) {
+    LoggerBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Deferred_MaxRate());
+}
+
+TEST(LoggerBrokerGTest,TestExecute_Deferred_Dropped) {
+    LoggerBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Deferred_Dropped());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
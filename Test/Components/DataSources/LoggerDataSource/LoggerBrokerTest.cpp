@@ -35,6 +35,7 @@
 #include "GAM.h"
 #include "LoggerBroker.h"
 #include "LoggerBrokerTest.h"
+#include "LoggerDataSource.h"
 #include "MemoryOperationsHelper.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
@@ -166,6 +167,127 @@ void LoggerBrokerTestErrorProcessFunction(const MARTe::ErrorManagement::ErrorInf
     lastError += errorDescription;
 }
 
+/**
+ * Executes numberOfCycles with a deferred LoggerDataSource (whose consumer thread is not started) and
+ * checks that nothing is printed until ConsumeSamples is called.
+ */
+static bool LoggerBrokerTestDeferred(const MARTe::char8 * const loggerConfig,
+                                     const MARTe::uint32 numberOfCycles,
+                                     const MARTe::char8 * const expected) {
+    using namespace MARTe;
+    StreamString config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = LoggerBrokerTestGAM"
+            "            OutputSignals = {"
+            "                Signal1 = {"
+            "                    DataSource = LoggerDS"
+            "                    Type = uint32"
+            "                }"
+            "                Signal5 = {"
+            "                    DataSource = LoggerDS"
+            "                    Type = uint32"
+            "                    NumberOfElements = 2"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +LoggerDS = {"
+            "            Class = LoggerDataSource"
+            "            Deferred = 1";
+    config += loggerConfig;
+    config += ""
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = LoggerBrokerTestScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    ConfigurationDatabase cdb;
+    config.Seek(0);
+    StandardParser parser(config, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<LoggerBrokerTestScheduler> scheduler;
+    ReferenceT<LoggerDataSource> loggerDS;
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        loggerDS = application->Find("Data.LoggerDS");
+        ok = (scheduler.IsValid() && loggerDS.IsValid());
+    }
+    if (ok) {
+        ok = loggerDS->IsDeferred();
+    }
+    if (ok) {
+        scheduler->PrepareNextState("", "State1");
+
+        application->StartNextStateExecution();
+
+        lastError = "";
+        ErrorManagement::ErrorProcessFunctionType currentErrorMessageProcessFunction = MARTe::ErrorManagement::errorMessageProcessFunction;
+
+        SetErrorProcessFunction(&LoggerBrokerTestErrorProcessFunction);
+
+        uint32 i;
+        for (i = 0u; i < numberOfCycles; i++) {
+            scheduler->ExecuteThreadCycle(0);
+        }
+        //The real-time thread shall not print anything
+        ok = (lastError.Size() == 0u);
+        if (ok) {
+            ok = (loggerDS->ConsumeSamples() > 0u);
+        }
+
+        SetErrorProcessFunction(currentErrorMessageProcessFunction);
+    }
+
+    REPORT_ERROR_STATIC(ErrorManagement::Information, lastError.Buffer());
+    god->Purge();
+    if (ok) {
+        ok = (lastError == expected);
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -293,3 +415,33 @@ bool LoggerBrokerTest::TestInit() {
 bool LoggerBrokerTest::TestExecute() {
     return TestInit();
 }
+
+bool LoggerBrokerTest::TestExecute_Deferred() {
+    return LoggerBrokerTestDeferred("", 3u, "Signal1 [0:0]:1 Signal5 [0:1]:{ 1 2 }  Signal1 [0:0]:1 Signal5 [0:1]:{ 1 2 }  Signal1 [0:0]:1 Signal5 [0:1]:{ 1 2 } ");
+}
+
+bool LoggerBrokerTest::TestExecute_Deferred_Filters() {
+    const MARTe::char8 * const loggerConfig = ""
+            "            Signals = {"
+            "                Signal1 = {"
+            "                    Type = uint32"
+            "                    OnChange = 1"
+            "                }"
+            "                Signal5 = {"
+            "                    Type = uint32"
+            "                    NumberOfElements = 2"
+            "                    Decimation = 2"
+            "                }"
+            "            }";
+    //Signal1 never changes and Signal5 is printed for the first and third samples.
+    return LoggerBrokerTestDeferred(loggerConfig, 3u, "Signal1 [0:0]:1 Signal5 [0:1]:{ 1 2 }  Signal5 [0:1]:{ 1 2 } ");
+}
+
+bool LoggerBrokerTest::TestExecute_Deferred_MaxRate() {
+    return LoggerBrokerTestDeferred("            MaxRate = 1", 3u, "Signal1 [0:0]:1 Signal5 [0:1]:{ 1 2 } ");
+}
+
+bool LoggerBrokerTest::TestExecute_Deferred_Dropped() {
+    return LoggerBrokerTestDeferred("            NumberOfBuffers = 2", 3u,
+                                    "Signal1 [0:0]:1 Signal5 [0:1]:{ 1 2 }  Signal1 [0:0]:1 Signal5 [0:1]:{ 1 2 }  Dropped 1 samples (ring full)");
+}
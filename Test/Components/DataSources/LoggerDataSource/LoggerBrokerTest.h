@@ -55,6 +55,26 @@ public:
      * @brief Tests the Execute method.
      */
     bool TestExecute();
+
+    /**
+     * @brief Tests the Execute method in deferred mode.
+     */
+    bool TestExecute_Deferred();
+
+    /**
+     * @brief Tests the Execute method in deferred mode with the OnChange and Decimation signal filters.
+     */
+    bool TestExecute_Deferred_Filters();
+
+    /**
+     * @brief Tests the Execute method in deferred mode with MaxRate.
+     */
+    bool TestExecute_Deferred_MaxRate();
+
+    /**
+     * @brief Tests the Execute method in deferred mode when the ring is full.
+     */
+    bool TestExecute_Deferred_Dropped();
 };
 
 
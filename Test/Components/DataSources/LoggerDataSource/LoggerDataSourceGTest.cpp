@@ -91,6 +91,36 @@ TEST(LoggerDataSourceGTest,TestInitialise) {
     ASSERT_TRUE(test.TestInitialise());
 }
 
+TEST(LoggerDataSourceGTest,TestInitialise_Deferred) {
+    LoggerDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_Deferred());
+}
+
+TEST(LoggerDataSourceGTest,TestInitialise_False_BadDeferred) {
+    LoggerDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadDeferred());
+}
+
+TEST(LoggerDataSourceGTest,TestInitialise_False_BadNumberOfBuffers) {
+    LoggerDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadNumberOfBuffers());
+}
+
+TEST(LoggerDataSourceGTest,TestInitialise_False_BadDecimation) {
+    LoggerDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadDecimation());
+}
+
+TEST(LoggerDataSourceGTest,TestInitialise_False_BadMaxRate) {
+    LoggerDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadMaxRate());
+}
+
+TEST(LoggerDataSourceGTest,TestPrepareNextState_Deferred) {
+    LoggerDataSourceTest test;
+    ASSERT_TRUE(test.TestPrepareNextState_Deferred());
+}
+
 
 
 /*---------------------------------------------------------------------------*/
@@ -208,3 +208,76 @@ bool LoggerDataSourceTest::TestInitialise() {
     ConfigurationDatabase cdb;
     return lds.Initialise(cdb);
 }
+
+bool LoggerDataSourceTest::TestInitialise_Deferred() {
+    using namespace MARTe;
+    LoggerDataSource lds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Deferred", 1);
+    cdb.Write("NumberOfBuffers", 16);
+    cdb.Write("ConsumerPeriod", 5);
+    cdb.Write("CPUMask", 0x1);
+    cdb.Write("StackSize", 1048576);
+    cdb.Write("Decimation", 10);
+    cdb.Write("OnChange", 1);
+    cdb.Write("MaxRate", 2.5);
+    bool ok = lds.Initialise(cdb);
+    if (ok) {
+        ok = lds.IsDeferred();
+    }
+    return ok;
+}
+
+bool LoggerDataSourceTest::TestInitialise_False_BadDeferred() {
+    using namespace MARTe;
+    LoggerDataSource lds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Deferred", 2);
+    return !lds.Initialise(cdb);
+}
+
+bool LoggerDataSourceTest::TestInitialise_False_BadNumberOfBuffers() {
+    using namespace MARTe;
+    LoggerDataSource lds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Deferred", 1);
+    cdb.Write("NumberOfBuffers", 0);
+    return !lds.Initialise(cdb);
+}
+
+bool LoggerDataSourceTest::TestInitialise_False_BadDecimation() {
+    using namespace MARTe;
+    LoggerDataSource lds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Deferred", 1);
+    cdb.Write("Decimation", 0);
+    return !lds.Initialise(cdb);
+}
+
+bool LoggerDataSourceTest::TestInitialise_False_BadMaxRate() {
+    using namespace MARTe;
+    LoggerDataSource lds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Deferred", 1);
+    cdb.Write("MaxRate", -1.0);
+    return !lds.Initialise(cdb);
+}
+
+bool LoggerDataSourceTest::TestPrepareNextState_Deferred() {
+    using namespace MARTe;
+    LoggerDataSource lds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Deferred", 1);
+    bool ok = lds.Initialise(cdb);
+    if (ok) {
+        ok = lds.PrepareNextState("", "");
+    }
+    //Already running
+    if (ok) {
+        ok = lds.PrepareNextState("", "");
+    }
+    if (ok) {
+        ok = (lds.ConsumeSamples() == 0u);
+    }
+    return ok;
+}
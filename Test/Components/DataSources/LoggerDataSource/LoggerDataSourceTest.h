@@ -90,6 +90,36 @@ public:
      * @brief Tests the Initialise method.
      */
     bool TestInitialise();
+
+    /**
+     * @brief Tests the Initialise method with Deferred = 1 and all the related parameters.
+     */
+    bool TestInitialise_Deferred();
+
+    /**
+     * @brief Tests the Initialise method with an invalid Deferred.
+     */
+    bool TestInitialise_False_BadDeferred();
+
+    /**
+     * @brief Tests the Initialise method with NumberOfBuffers = 0.
+     */
+    bool TestInitialise_False_BadNumberOfBuffers();
+
+    /**
+     * @brief Tests the Initialise method with Decimation = 0.
+     */
+    bool TestInitialise_False_BadDecimation();
+
+    /**
+     * @brief Tests the Initialise method with a negative MaxRate.
+     */
+    bool TestInitialise_False_BadMaxRate();
+
+    /**
+     * @brief Tests the PrepareNextState method with Deferred = 1.
+     */
+    bool TestPrepareNextState_Deferred();
 };
 
 /*---------------------------------------------------------------------------*/
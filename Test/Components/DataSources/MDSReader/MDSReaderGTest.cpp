@@ -631,6 +631,21 @@ TEST(MDSReaderGTest, TestSynchronise68) {
     ASSERT_TRUE(test.TestSynchronise68(nOfSegments));
 }
 
+TEST(MDSReaderGTest, TestSynchronisePrefetch) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestSynchronisePrefetch());
+}
+
+TEST(MDSReaderGTest, TestSynchronisePrefetchInterpolation) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestSynchronisePrefetchInterpolation());
+}
+
+TEST(MDSReaderGTest, TestGetCacheMisses) {
+    MDSReaderTest test;
+    ASSERT_TRUE(test.TestGetCacheMisses());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
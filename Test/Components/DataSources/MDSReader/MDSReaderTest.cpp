@@ -38,6 +38,7 @@
 #include "MDSReaderTestHelper.h"
 #include "CreateTree.h"
 #include "AdvancedErrorManagement.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -7278,3 +7279,140 @@ bool MDSReaderTest::TestSynchronise68(uint32 nOfSegments) {
     delete[] ptr;
     return ok;
 }
+
+bool MDSReaderTest::TestSynchronisePrefetch() {
+    MDSReaderTestHelper dS(treeName);
+    bool ok;
+    ok = dS.CreateConfigurationFile(0.1, 0, 0);
+    if (ok) {
+        ok = dS.config.Write("PrefetchSegments", 4u);
+    }
+    if (ok) {
+        ok = dS.Initialise(dS.config);
+    }
+    if (ok) {
+        ok = dS.SetConfiguredDatabase(dS.config);
+    }
+    if (ok) {
+        ok = dS.PrepareNextState("state1", "state2");
+    }
+    void **ptr = new void *[numberOfValidNodes];
+    for (uint32 i = 0u; (i < numberOfValidNodes) && ok; i++) {
+        ok = dS.GetSignalMemoryBuffer(i, 0, ptr[i]);
+    }
+    if (ok) {
+        for (uint32 i = 0u; (i < 20) && ok; i++) {
+            //Give time to the prefetch thread
+            Sleep::MSec(20u);
+            ok = dS.Synchronise();
+            if (ok) {
+                ok &= dS.CompareS_uint8(((uint8 *) ptr[0]), i, 1, dS.elementsRead);
+                ok &= dS.CompareS_int8(((int8 *) ptr[1]), i, 1, dS.elementsRead);
+                ok &= dS.CompareS_uint16(((uint16 *) ptr[2]), i, 2, dS.elementsRead);
+                ok &= dS.CompareS_int16(((int16 *) ptr[3]), i, 2, dS.elementsRead);
+                ok &= dS.CompareS_uint32(((uint32 *) ptr[4]), i, 4, dS.elementsRead);
+                ok &= dS.CompareS_int32(((int32 *) ptr[5]), i, 4, dS.elementsRead);
+                ok &= dS.CompareS_uint64(((uint64 *) ptr[6]), i, 8, dS.elementsRead);
+                ok &= dS.CompareS_int64(((int64 *) ptr[7]), i, 8, dS.elementsRead);
+                ok &= dS.CompareS_float32(((float32 *) ptr[8]), i, 0.1, dS.elementsRead);
+                ok &= dS.CompareS_float64(((float64 *) ptr[9]), i, 0.1, dS.elementsRead);
+            }
+        }
+    }
+    if (ok) {
+        ok = (dS.GetCacheHits() > 0u);
+    }
+    delete[] ptr;
+    return ok;
+}
+
+bool MDSReaderTest::TestSynchronisePrefetchInterpolation() {
+    MDSReaderTestHelper dS(treeName);
+    bool ok;
+    ok = dS.CreateConfigurationFile(0.1, 1, 0);
+    if (ok) {
+        ok = dS.config.Write("PrefetchSegments", 4u);
+    }
+    if (ok) {
+        ok = dS.Initialise(dS.config);
+    }
+    if (ok) {
+        ok = dS.SetConfiguredDatabase(dS.config);
+    }
+    if (ok) {
+        ok = dS.PrepareNextState("state1", "state2");
+    }
+    void **ptr = new void *[numberOfValidNodes];
+    for (uint32 i = 0u; (i < numberOfValidNodes) && ok; i++) {
+        ok = dS.GetSignalMemoryBuffer(i, 0, ptr[i]);
+    }
+    if (ok) {
+        for (uint32 i = 0u; (i < 5) && ok; i++) {
+            //Give time to the prefetch thread
+            Sleep::MSec(20u);
+            ok = dS.Synchronise();
+            if (ok) {
+                ok &= dS.CompareS_uint8(((uint8 *) ptr[0]), i, 1, dS.elementsRead);
+                ok &= dS.CompareS_int8(((int8 *) ptr[1]), i, 1, dS.elementsRead);
+                ok &= dS.CompareS_uint16(((uint16 *) ptr[2]), i, 2, dS.elementsRead);
+                ok &= dS.CompareS_int16(((int16 *) ptr[3]), i, 2, dS.elementsRead);
+                ok &= dS.CompareS_uint32(((uint32 *) ptr[4]), i, 4, dS.elementsRead);
+                ok &= dS.CompareS_int32(((int32 *) ptr[5]), i, 4, dS.elementsRead);
+                ok &= dS.CompareS_uint64(((uint64 *) ptr[6]), i, 8, dS.elementsRead);
+                ok &= dS.CompareS_int64(((int64 *) ptr[7]), i, 8, dS.elementsRead);
+                ok &= dS.CompareS_float32(((float32 *) ptr[8]), i, 0.1, dS.elementsRead);
+                ok &= dS.CompareS_float64(((float64 *) ptr[9]), i, 0.1, dS.elementsRead);
+            }
+        }
+    }
+    if (ok) {
+        ok = (dS.GetCacheHits() > 0u);
+    }
+    delete[] ptr;
+    return ok;
+}
+
+bool MDSReaderTest::TestGetCacheMisses() {
+    MDSReaderTestHelper dS(treeName);
+    bool ok;
+    ok = dS.CreateConfigurationFile();
+    if (ok) {
+        ok = dS.config.Write("PrefetchSegments", 4u);
+    }
+    if (ok) {
+        ok = dS.Initialise(dS.config);
+    }
+    if (ok) {
+        ok = dS.SetConfiguredDatabase(dS.config);
+    }
+    void **ptr = new void *[numberOfValidNodes];
+    for (uint32 i = 0u; (i < numberOfValidNodes) && ok; i++) {
+        ok = dS.GetSignalMemoryBuffer(i, 0, ptr[i]);
+    }
+    //The prefetch thread is not started (no PrepareNextState) so that all the segments are read by Synchronise
+    if (ok) {
+        for (uint32 i = 0u; (i < 20) && ok; i++) {
+            ok = dS.Synchronise();
+            if (ok) {
+                ok &= dS.CompareS_uint8(((uint8 *) ptr[0]), i, 1, dS.elementsRead);
+                ok &= dS.CompareS_int8(((int8 *) ptr[1]), i, 1, dS.elementsRead);
+                ok &= dS.CompareS_uint16(((uint16 *) ptr[2]), i, 2, dS.elementsRead);
+                ok &= dS.CompareS_int16(((int16 *) ptr[3]), i, 2, dS.elementsRead);
+                ok &= dS.CompareS_uint32(((uint32 *) ptr[4]), i, 4, dS.elementsRead);
+                ok &= dS.CompareS_int32(((int32 *) ptr[5]), i, 4, dS.elementsRead);
+                ok &= dS.CompareS_uint64(((uint64 *) ptr[6]), i, 8, dS.elementsRead);
+                ok &= dS.CompareS_int64(((int64 *) ptr[7]), i, 8, dS.elementsRead);
+                ok &= dS.CompareS_float32(((float32 *) ptr[8]), i, 0.1, dS.elementsRead);
+                ok &= dS.CompareS_float64(((float64 *) ptr[9]), i, 0.1, dS.elementsRead);
+            }
+        }
+    }
+    if (ok) {
+        ok = (dS.GetCacheHits() == 0u);
+    }
+    if (ok) {
+        ok = (dS.GetCacheMisses() > 0u);
+    }
+    delete[] ptr;
+    return ok;
+}
@@ -950,6 +950,29 @@ public:
      */
     bool TestSynchronise68(uint32 nOfSegments);
 
+    /**
+     * @brief Test Synchronise with PrefetchSegments = 4 and compare the output against the expected values
+     * @details node sampling time 0.1. Read sampling time = 0.1, elementsRead = 10
+     * dataManagement[i] = 0
+     * holeManagement[i] = 0
+     * The segments shall be read from the cache (GetCacheHits() > 0).
+     */
+    bool TestSynchronisePrefetch();
+
+    /**
+     * @brief Test Synchronise with PrefetchSegments = 4 and compare the output against the expected values
+     * @details node sampling time 0.1. Read sampling time = 0.1, elementsRead = 10
+     * dataManagement[i] = 1
+     * holeManagement[i] = 0
+     * The segments shall be read from the cache (GetCacheHits() > 0).
+     */
+    bool TestSynchronisePrefetchInterpolation();
+
+    /**
+     * @brief Test MDSReader::GetCacheMisses() when the prefetch thread is not started.
+     */
+    bool TestGetCacheMisses();
+
 private:
     StreamString treeName;
     StreamString fullPath;
@@ -109,11 +109,31 @@ TEST(MDSWriterGTest,TestIntegratedInApplication_NoTrigger_Flush) {
     ASSERT_TRUE(test.TestIntegratedInApplication_NoTrigger_Flush());
 }
 
+TEST(MDSWriterGTest,TestIntegratedInApplication_NoTrigger_WriterThreads) {
+    MDSWriterTest test;
+    ASSERT_TRUE(test.TestIntegratedInApplication_NoTrigger_WriterThreads());
+}
+
+TEST(MDSWriterGTest,TestIntegratedInApplication_NoTrigger_Flush_WriterThreads) {
+    MDSWriterTest test;
+    ASSERT_TRUE(test.TestIntegratedInApplication_NoTrigger_Flush_WriterThreads());
+}
+
+TEST(MDSWriterGTest,TestIntegratedInApplication_NoTrigger_CompressSegments) {
+    MDSWriterTest test;
+    ASSERT_TRUE(test.TestIntegratedInApplication_NoTrigger_CompressSegments());
+}
+
 TEST(MDSWriterGTest,TestIntegratedInApplication_Trigger) {
     MDSWriterTest test;
     ASSERT_TRUE(test.TestIntegratedInApplication_Trigger());
 }
 
+TEST(MDSWriterGTest,TestIntegratedInApplication_Trigger_WriterThreads) {
+    MDSWriterTest test;
+    ASSERT_TRUE(test.TestIntegratedInApplication_Trigger_WriterThreads());
+}
+
 TEST(MDSWriterGTest,TestIntegratedInApplication_Trigger_NotMultiple) {
     MDSWriterTest test;
     ASSERT_TRUE(test.TestIntegratedInApplication_Trigger_NotMultiple());
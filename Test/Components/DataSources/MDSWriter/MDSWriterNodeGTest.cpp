@@ -124,6 +124,16 @@ TEST(MDSWriterNodeGTest,TestInitialise_False_BadAutomaticSegmentation) {
     ASSERT_TRUE(test.TestInitialise_False_BadAutomaticSegmentation());
 }
 
+TEST(MDSWriterNodeGTest,TestInitialise_CompressSegments) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_CompressSegments());
+}
+
+TEST(MDSWriterNodeGTest,TestInitialise_False_BadCompressSegments) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BadCompressSegments());
+}
+
 TEST(MDSWriterNodeGTest,TestInitialise_False_NoSamples) {
     MDSWriterNodeTest test;
     ASSERT_TRUE(test.TestInitialise_False_NoSamples());
@@ -204,6 +214,16 @@ TEST(MDSWriterNodeGTest,TestExecute_False_NoSignalSet) {
     ASSERT_TRUE(test.TestExecute_False_NoSignalSet());
 }
 
+TEST(MDSWriterNodeGTest,TestExecute_SegmentPipeline) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestExecute_SegmentPipeline());
+}
+
+TEST(MDSWriterNodeGTest,TestExecute_SegmentPipeline_Timeout) {
+    MDSWriterNodeTest test;
+    ASSERT_TRUE(test.TestExecute_SegmentPipeline_Timeout());
+}
+
 TEST(MDSWriterNodeGTest,TestAllocateTreeNode) {
     MDSWriterNodeTest test;
     ASSERT_TRUE(test.TestAllocateTreeNode());
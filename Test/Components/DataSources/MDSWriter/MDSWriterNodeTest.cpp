@@ -362,6 +362,51 @@ bool MDSWriterNodeTest::TestInitialise_False_BadAutomaticSegmentation() {
     return !test.Initialise(cdb);
 }
 
+bool MDSWriterNodeTest::TestInitialise_CompressSegments() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "AAA");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 100);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 1);
+    cdb.Write("AutomaticSegmentation", 0);
+
+    MDSWriterNode test;
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = !test.IsCompressSegments();
+    }
+    cdb.Write("CompressSegments", 1);
+    MDSWriterNode testCompress;
+    if (ok) {
+        ok = testCompress.Initialise(cdb);
+    }
+    if (ok) {
+        ok = testCompress.IsCompressSegments();
+    }
+    return ok;
+}
+
+bool MDSWriterNodeTest::TestInitialise_False_BadCompressSegments() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "AAA");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 100);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 4);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 1);
+    cdb.Write("AutomaticSegmentation", 0);
+    cdb.Write("CompressSegments", 2);
+
+    MDSWriterNode test;
+    return !test.Initialise(cdb);
+}
+
 bool MDSWriterNodeTest::TestInitialise_False_NoSamples() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
@@ -935,6 +980,214 @@ bool MDSWriterNodeTest::TestExecute_False_NoSignalSet() {
     return ok;
 }
 
+bool MDSWriterNodeTest::TestExecute_SegmentPipeline() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "SIGUINT16F");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 2);
+    cdb.Write("AutomaticSegmentation", 0);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    MDSWriterNode test;
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = !test.IsSegmentPipelineEnabled();
+    }
+    if (ok) {
+        ok = test.EnableSegmentPipeline(1000u);
+    }
+    if (ok) {
+        ok = test.IsSegmentPipelineEnabled();
+    }
+    StreamString treeName = "mds_m2test";
+
+    MDSplus::Tree *tree = NULL;
+    int32 lastPulseNumber = -1;
+    try {
+        tree = new MDSplus::Tree(treeName.Buffer(), lastPulseNumber);
+        lastPulseNumber = tree->getCurrent(treeName.Buffer());
+    }
+    catch (MDSplus::MdsException &exc) {
+        ok = false;
+    }
+    delete tree;
+    tree = NULL_PTR(MDSplus::Tree *);
+    int32 currentPulseNumber = lastPulseNumber + 1;
+    try {
+        tree = new MDSplus::Tree(treeName.Buffer(), -1);
+        tree->setCurrent(treeName.Buffer(), currentPulseNumber);
+        tree->createPulse(currentPulseNumber);
+    }
+    catch (MDSplus::MdsException &exc) {
+        delete tree;
+        tree = NULL_PTR(MDSplus::Tree *);
+        ok = false;
+    }
+
+    MDSplus::TreeNode *sigUInt16F;
+    if (ok) {
+        try {
+            sigUInt16F = tree->getNode("SIGUINT16F");
+            sigUInt16F->deleteData();
+
+        }
+        catch (MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed opening node");
+            ok = false;
+        }
+    }
+
+    uint16 signal = 0u;
+    if (ok) {
+        ok = test.AllocateTreeNode(tree);
+    }
+    if (ok) {
+        test.SetSignalMemory(&signal);
+    }
+    uint32 s;
+    //Two segments: the second segment is buffered while the first is pending
+    for (s = 0u; (s < 4u) && (ok); s++) {
+        signal = static_cast<uint16>(s);
+        ok = test.Execute();
+        if (ok) {
+            ok = (test.IsSegmentPending() == (s > 0u));
+        }
+        if ((ok) && (s == 2u)) {
+            ok = test.WritePendingSegment();
+        }
+    }
+    if (ok) {
+        ok = (test.GetNumberOfPipelineStalls() == 0u);
+    }
+    if (ok) {
+        ok = test.WritePendingSegment();
+    }
+    if (ok) {
+        ok = test.WaitForSegmentWritten();
+    }
+    if (ok) {
+        ok = (sigUInt16F->getNumSegments() == 2);
+    }
+    if (ok) {
+        MDSplus::Array *segment = sigUInt16F->getSegment(1);
+        int32 numberOfElements = 0;
+        uint16 *values = segment->getShortUnsignedArray(&numberOfElements);
+        ok = (numberOfElements == 2);
+        if (ok) {
+            ok = (values[0] == 2u) && (values[1] == 3u);
+        }
+        delete[] values;
+        MDSplus::deleteData(segment);
+    }
+
+    if (tree != NULL) {
+        delete tree;
+    }
+    return ok;
+}
+
+bool MDSWriterNodeTest::TestExecute_SegmentPipeline_Timeout() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    cdb.Write("NodeName", "SIGUINT16F");
+    cdb.Write("Type", "uint16");
+    cdb.Write("NumberOfElements", 1);
+    cdb.Write("Period", 5e-7);
+    cdb.Write("MakeSegmentAfterNWrites", 2);
+    cdb.Write("AutomaticSegmentation", 0);
+    cdb.Write("Samples", 1);
+    cdb.Write("NumberOfDimensions", 0);
+    MDSWriterNode test;
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = !test.IsSegmentPipelineEnabled();
+    }
+    if (ok) {
+        ok = test.EnableSegmentPipeline(10u);
+    }
+    if (ok) {
+        ok = test.IsSegmentPipelineEnabled();
+    }
+    StreamString treeName = "mds_m2test";
+
+    MDSplus::Tree *tree = NULL;
+    int32 lastPulseNumber = -1;
+    try {
+        tree = new MDSplus::Tree(treeName.Buffer(), lastPulseNumber);
+        lastPulseNumber = tree->getCurrent(treeName.Buffer());
+    }
+    catch (MDSplus::MdsException &exc) {
+        ok = false;
+    }
+    delete tree;
+    tree = NULL_PTR(MDSplus::Tree *);
+    int32 currentPulseNumber = lastPulseNumber + 1;
+    try {
+        tree = new MDSplus::Tree(treeName.Buffer(), -1);
+        tree->setCurrent(treeName.Buffer(), currentPulseNumber);
+        tree->createPulse(currentPulseNumber);
+    }
+    catch (MDSplus::MdsException &exc) {
+        delete tree;
+        tree = NULL_PTR(MDSplus::Tree *);
+        ok = false;
+    }
+
+    MDSplus::TreeNode *sigUInt16F;
+    if (ok) {
+        try {
+            sigUInt16F = tree->getNode("SIGUINT16F");
+            sigUInt16F->deleteData();
+
+        }
+        catch (MDSplus::MdsException &exc) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Failed opening node");
+            ok = false;
+        }
+    }
+
+    uint16 signal = 0u;
+    if (ok) {
+        ok = test.AllocateTreeNode(tree);
+    }
+    if (ok) {
+        test.SetSignalMemory(&signal);
+    }
+    uint32 s;
+    //The writer never commits the first segment: the second one is dropped after 10 ms
+    for (s = 0u; (s < 3u) && (ok); s++) {
+        signal = static_cast<uint16>(s);
+        ok = test.Execute();
+    }
+    if (ok) {
+        signal = 3u;
+        ok = !test.Execute();
+    }
+    if (ok) {
+        ok = (test.GetNumberOfPipelineStalls() == 1u);
+    }
+    if (ok) {
+        ok = !test.WaitForSegmentWritten();
+    }
+    if (ok) {
+        ok = test.WritePendingSegment();
+    }
+    if (ok) {
+        ok = test.WaitForSegmentWritten();
+    }
+    if (ok) {
+        ok = (sigUInt16F->getNumSegments() == 1);
+    }
+
+    if (tree != NULL) {
+        delete tree;
+    }
+    return ok;
+}
+
 bool MDSWriterNodeTest::TestAllocateTreeNode() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
@@ -136,6 +136,16 @@ public:
      */
     bool TestInitialise_False_BadAutomaticSegmentation();
 
+    /**
+     * @brief Test the Initialise specifying CompressSegments
+     */
+    bool TestInitialise_CompressSegments();
+
+    /**
+     * @brief Test the Initialise specifying an invalid CompressSegments
+     */
+    bool TestInitialise_False_BadCompressSegments();
+
     /**
      * @brief Test the Initialise without specifying the number of samples
      */
@@ -226,6 +236,16 @@ public:
      */
     bool TestExecute_False_NoSignalSet();
 
+    /**
+     * @brief Tests the Execute method with the segment pipeline enabled.
+     */
+    bool TestExecute_SegmentPipeline();
+
+    /**
+     * @brief Tests that the Execute method fails if the writer does not commit the pending segment within the timeout.
+     */
+    bool TestExecute_SegmentPipeline_Timeout();
+
     /**
      * @brief Tests the AllocateTreeNode method.
      */
@@ -414,7 +414,8 @@ template<typename typeToCheck> static bool CheckSegmentData(MARTe::int32 numberO
 static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::uint32 *signalToGenerate, MARTe::uint32 toGenerateNumberOfElements, MARTe::uint8 *triggerToGenerate,
                                     MARTe::uint32 *signalToVerify, MARTe::uint32 *timeToVerify, MARTe::uint32 toVerifyNumberOfElements, MARTe::uint32 numberOfBuffers,
                                     MARTe::uint32 numberOfPreTriggers, MARTe::uint32 numberOfPostTriggers, MARTe::float32 period, const MARTe::char8 * const treeName, MARTe::uint32 pulseNumber,
-                                    MARTe::int32 numberOfSegments, bool needsFlush, MARTe::uint32 sleepMSec = 100, bool automaticSegmentation = false, MARTe::float64 periodMultiplier = 1e6) {
+                                    MARTe::int32 numberOfSegments, bool needsFlush, MARTe::uint32 sleepMSec = 100, bool automaticSegmentation = false, MARTe::float64 periodMultiplier = 1e6,
+                                    MARTe::uint32 numberOfWriterThreads = 0u, bool compressSegments = false) {
     using namespace MARTe;
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -449,6 +450,9 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
     cdb.Delete("StoreOnTrigger");
     uint32 storeOnTrigger = (triggerToGenerate != NULL) ? 1 : 0;
     cdb.Write("StoreOnTrigger", storeOnTrigger);
+    if (numberOfWriterThreads > 0u) {
+        cdb.Write("NumberOfWriterThreads", numberOfWriterThreads);
+    }
     cdb.MoveRelative("Signals");
     uint32 nSignals = cdb.GetNumberOfChildren();
     uint32 n;
@@ -456,6 +460,10 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
         cdb.MoveRelative(cdb.GetChildName(n));
         cdb.Delete("Period");
         cdb.Write("Period", period);
+        StreamString nodeName;
+        if ((compressSegments) && (cdb.Read("NodeName", nodeName))) {
+            cdb.Write("CompressSegments", 1);
+        }
         cdb.MoveToAncestor(1u);
     }
 
@@ -492,6 +500,12 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
         mdsWriter = godb->Find("Test.Data.Drv1");
         ok = mdsWriter.IsValid();
     }
+    if (ok) {
+        ok = (mdsWriter->GetNumberOfWriterThreads() == numberOfWriterThreads);
+    }
+    if (ok) {
+        ok = (mdsWriter->GetSegmentWriteTimeout() == 10000u);
+    }
 
     //Open the tree and check if the data was correctly stored.
     //Create a pulse. It assumes that the tree template is already created!!
@@ -7409,6 +7423,52 @@ bool MDSWriterTest::TestIntegratedInApplication_NoTrigger() {
                                    numberOfSegments, false);
 }
 
+bool MDSWriterTest::TestIntegratedInApplication_NoTrigger_WriterThreads() {
+    using namespace MARTe;
+    uint32 signalToGenerate[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    uint32 timeToVerify[] = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22 };
+    uint32 numberOfElements = sizeof(signalToGenerate) / sizeof(uint32);
+    const char8 * const treeName = "mds_m2test";
+    const uint32 numberOfBuffers = 16;
+    const uint32 pulseNumber = 1;
+    const uint32 writeAfterNSegments = 4;
+    const uint32 numberOfSegments = numberOfElements / writeAfterNSegments;
+    const float32 period = 2;
+    const uint32 numberOfWriterThreads = 2;
+    return TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, signalToGenerate, timeToVerify, numberOfElements, numberOfBuffers, 0, 0, period, treeName, pulseNumber,
+                                   numberOfSegments, false, 100, false, 1e6, numberOfWriterThreads);
+}
+
+bool MDSWriterTest::TestIntegratedInApplication_NoTrigger_Flush_WriterThreads() {
+    using namespace MARTe;
+    uint32 signalToGenerate[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 };
+    uint32 timeToVerify[] = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24 };
+    uint32 numberOfElements = sizeof(signalToGenerate) / sizeof(uint32);
+    const char8 * const treeName = "mds_m2test";
+    const uint32 numberOfBuffers = 16;
+    const uint32 pulseNumber = 2;
+    const uint32 numberOfSegments = 4;
+    const float32 period = 2;
+    const uint32 numberOfWriterThreads = 3;
+    return TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, signalToGenerate, timeToVerify, numberOfElements, numberOfBuffers, 0, 0, period, treeName, pulseNumber,
+                                   numberOfSegments, true, 100, false, 1e6, numberOfWriterThreads);
+}
+
+bool MDSWriterTest::TestIntegratedInApplication_NoTrigger_CompressSegments() {
+    using namespace MARTe;
+    uint32 signalToGenerate[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    uint32 timeToVerify[] = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22 };
+    uint32 numberOfElements = sizeof(signalToGenerate) / sizeof(uint32);
+    const char8 * const treeName = "mds_m2test";
+    const uint32 numberOfBuffers = 16;
+    const uint32 pulseNumber = 1;
+    const uint32 writeAfterNSegments = 4;
+    const uint32 numberOfSegments = numberOfElements / writeAfterNSegments;
+    const float32 period = 2;
+    return TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, signalToGenerate, timeToVerify, numberOfElements, numberOfBuffers, 0, 0, period, treeName, pulseNumber,
+                                   numberOfSegments, false, 100, false, 1e6, 0u, true);
+}
+
 bool MDSWriterTest::TestIntegratedInApplication_NoTrigger_Flush() {
     using namespace MARTe;
     uint32 signalToGenerate[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 };
@@ -7443,6 +7503,26 @@ bool MDSWriterTest::TestIntegratedInApplication_Trigger() {
                                    numberOfPostTriggers, period, treeName, pulseNumber, numberOfSegments, false);
 }
 
+bool MDSWriterTest::TestIntegratedInApplication_Trigger_WriterThreads() {
+    using namespace MARTe;
+    uint32 signalToGenerate[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    uint32 signalToVerify[] = { 1, 2, 3, 4, 6, 7, 8, 9 };
+    uint32 timeToVerify[] = { 0, 2, 4, 6, 10, 12, 14, 16 };
+    uint8 triggerToGenerate[] = { 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0 };
+    uint32 numberOfElements = sizeof(signalToGenerate) / sizeof(uint32);
+    uint32 numberOfElementsToVerify = sizeof(signalToVerify) / sizeof(uint32);
+    const char8 * const treeName = "mds_m2test";
+    const uint32 numberOfBuffers = 16;
+    const uint32 numberOfPreTriggers = 2;
+    const uint32 numberOfPostTriggers = 1;
+    const uint32 pulseNumber = 3;
+    const uint32 numberOfSegments = 2;
+    const float32 period = 2;
+    const uint32 numberOfWriterThreads = 2;
+    return TestIntegratedExecution(config2, signalToGenerate, numberOfElements, triggerToGenerate, signalToVerify, timeToVerify, numberOfElementsToVerify, numberOfBuffers, numberOfPreTriggers,
+                                   numberOfPostTriggers, period, treeName, pulseNumber, numberOfSegments, false, 100, false, 1e6, numberOfWriterThreads);
+}
+
 bool MDSWriterTest::TestIntegratedInApplication_Trigger_NotMultiple() {
     using namespace MARTe;
     uint32 signalToGenerate[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
@@ -213,11 +213,32 @@ public:
      */
     bool TestIntegratedInApplication_NoTrigger_Flush();
 
+    /**
+     * @brief Tests the MDSWriter integrated in an application which continuously stores data using a pool of writer threads.
+     */
+    bool TestIntegratedInApplication_NoTrigger_WriterThreads();
+
+    /**
+     * @brief Tests the MDSWriter integrated in an application which continuously stores data using a pool of writer threads
+     * and that requires a flush at the end in order to demonstrate that all the data is stored in the MDSplus database.
+     */
+    bool TestIntegratedInApplication_NoTrigger_Flush_WriterThreads();
+
+    /**
+     * @brief Tests the MDSWriter integrated in an application which continuously stores compressed segments.
+     */
+    bool TestIntegratedInApplication_NoTrigger_CompressSegments();
+
     /**
      * @brief Tests the MDSWriter integrated in an application which asynchronously stores data based on a trigger event.
      */
     bool TestIntegratedInApplication_Trigger();
 
+    /**
+     * @brief Tests the MDSWriter integrated in an application which asynchronously stores data based on a trigger event using a pool of writer threads.
+     */
+    bool TestIntegratedInApplication_Trigger_WriterThreads();
+
     /**
      * @brief Tests the MDSWriter integrated in an application which asynchronously stores data based on a trigger event and with a MakeSegmentAfterNWrites which is not multiple of the length of the array to write .
      */
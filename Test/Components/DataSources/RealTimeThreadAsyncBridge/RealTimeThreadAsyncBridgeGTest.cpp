@@ -164,3 +164,33 @@ TEST(RealTimeThreadAsyncBridgeGTest,TestResetSignalValue) {
     RealTimeThreadAsyncBridgeTest test;
     ASSERT_TRUE(test.TestResetSignalValue());
 }
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestInitialise_WaitFree) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestInitialise_WaitFree());
+}
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestInitialise_False_WaitFreeBlockingMode) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_WaitFreeBlockingMode());
+}
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestInitialise_False_WaitFreeNumberOfBuffers) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_WaitFreeNumberOfBuffers());
+}
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestGetOffset_WaitFree) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestGetOffset_WaitFree());
+}
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestGetInputOffset_WaitFree_Retries) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestGetInputOffset_WaitFree_Retries());
+}
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestSetConfiguredDatabase_WaitFreeNumberOfReaders) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_WaitFreeNumberOfReaders());
+}
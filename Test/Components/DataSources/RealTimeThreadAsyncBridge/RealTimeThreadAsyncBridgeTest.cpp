@@ -2819,3 +2819,399 @@ bool RealTimeThreadAsyncBridgeTest::TestResetSignalValue() {
 
 }
 
+bool RealTimeThreadAsyncBridgeTest::TestInitialise_WaitFree() {
+    RealTimeThreadAsyncBridgeTestDS dataSource;
+    const char8 *conf1 = "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridgeTestDS"
+            "            NumberOfBuffers = 3"
+            "            WaitFree = 1"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = conf1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        cdb.MoveAbsolute("+Drv1");
+        ret = dataSource.Initialise(cdb);
+    }
+
+    return ret;
+}
+
+bool RealTimeThreadAsyncBridgeTest::TestInitialise_False_WaitFreeBlockingMode() {
+    RealTimeThreadAsyncBridgeTestDS dataSource;
+    const char8 *conf1 = "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridgeTestDS"
+            "            NumberOfBuffers = 3"
+            "            BlockingMode = 1"
+            "            WaitFree = 1"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = conf1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        cdb.MoveAbsolute("+Drv1");
+        ret = !dataSource.Initialise(cdb);
+    }
+
+    return ret;
+}
+
+bool RealTimeThreadAsyncBridgeTest::TestInitialise_False_WaitFreeNumberOfBuffers() {
+    RealTimeThreadAsyncBridgeTestDS dataSource;
+    const char8 *conf1 = "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridgeTestDS"
+            "            NumberOfBuffers = 2"
+            "            WaitFree = 1"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = conf1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        cdb.MoveAbsolute("+Drv1");
+        ret = !dataSource.Initialise(cdb);
+    }
+
+    return ret;
+}
+
+bool RealTimeThreadAsyncBridgeTest::TestGetOffset_WaitFree() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = RealTimeThreadAsyncBridgeTestGAM1"
+            "            OutputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "        +GAMB = {"
+            "            Class = RealTimeThreadAsyncBridgeTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridgeTestDS"
+            "            NumberOfBuffers = 3"
+            "            WaitFree = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "                +Thread2 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMB}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<RealTimeThreadAsyncBridgeTestDS> dataSource;
+
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+
+    uint8 *mem = NULL_PTR(uint8 *);
+    if (ret) {
+        ret = dataSource->GetSignalMemoryBuffer(0u, 0u, (void*&) mem);
+    }
+    uint32 writeOffset = 0u;
+    uint32 readOffset = 0u;
+    //the writer never writes on the newest buffer (0 at the beginning)
+    if (ret) {
+        ret = dataSource->GetOutputOffset(0u, 1u, writeOffset);
+    }
+    if (ret) {
+        ret = (writeOffset == sizeof(uint32));
+    }
+    if (ret) {
+        *reinterpret_cast<uint32 *>(&mem[writeOffset]) = 1u;
+        ret = dataSource->TerminateOutputCopy(0u, writeOffset, 1u);
+    }
+    //the reader gets the newest buffer
+    if (ret) {
+        ret = dataSource->GetInputOffset(0u, 1u, readOffset);
+    }
+    if (ret) {
+        ret = (readOffset == writeOffset);
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(&mem[readOffset]) == 1u);
+    }
+    //the writer skips the buffer being read
+    if (ret) {
+        ret = dataSource->GetOutputOffset(0u, 1u, writeOffset);
+    }
+    if (ret) {
+        ret = (writeOffset == (2u * sizeof(uint32)));
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(&mem[writeOffset]) == 1u);
+    }
+    if (ret) {
+        *reinterpret_cast<uint32 *>(&mem[writeOffset]) = 2u;
+        ret = dataSource->TerminateOutputCopy(0u, writeOffset, 1u);
+    }
+    //the reader has read a buffer superseded by a newer one
+    if (ret) {
+        ret = dataSource->TerminateInputCopy(0u, readOffset, 1u);
+    }
+    if (ret) {
+        ret = (dataSource->GetStaleReads() == 1u);
+    }
+    if (ret) {
+        ret = dataSource->GetInputOffset(0u, 1u, readOffset);
+    }
+    if (ret) {
+        ret = (readOffset == writeOffset);
+    }
+    if (ret) {
+        ret = (*reinterpret_cast<uint32 *>(&mem[readOffset]) == 2u);
+    }
+    if (ret) {
+        ret = dataSource->TerminateInputCopy(0u, readOffset, 1u);
+    }
+    if (ret) {
+        ret = (dataSource->GetStaleReads() == 1u);
+    }
+    if (ret) {
+        ret = (dataSource->GetReaderRetries() == 0u);
+    }
+    MARTe::ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool RealTimeThreadAsyncBridgeTest::TestGetInputOffset_WaitFree_Retries() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = RealTimeThreadAsyncBridgeTestGAM1"
+            "            OutputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "        +GAMB = {"
+            "            Class = RealTimeThreadAsyncBridgeTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridgeTestDS"
+            "            NumberOfBuffers = 3"
+            "            WaitFree = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "                +Thread2 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMB}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<RealTimeThreadAsyncBridgeTestDS> dataSource;
+
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+
+    uint32 writeOffset = 0u;
+    uint32 readOffset = 0u;
+    if (ret) {
+        ret = dataSource->GetOutputOffset(0u, 1u, writeOffset);
+    }
+    if (ret) {
+        ret = dataSource->TerminateOutputCopy(0u, writeOffset, 1u);
+    }
+    //simulate the writer claiming the newest buffer
+    FastPollingMutexSem *spinWrite = NULL_PTR(FastPollingMutexSem *);
+    if (ret) {
+        spinWrite = dataSource->GetSpinlocksWrite();
+        ret = spinWrite[1].FastTryLock();
+    }
+    if (ret) {
+        ret = !dataSource->GetInputOffset(0u, 1u, readOffset);
+    }
+    if (ret) {
+        ret = (dataSource->GetReaderRetries() == dataSource->GetNumberOfMemoryBuffers());
+    }
+    if (ret) {
+        ret = (dataSource->GetSpinlocksRead()[1] == 0);
+    }
+    if (ret) {
+        spinWrite[1].FastUnLock();
+        ret = dataSource->GetInputOffset(0u, 1u, readOffset);
+    }
+    if (ret) {
+        ret = (readOffset == writeOffset);
+    }
+    if (ret) {
+        ret = dataSource->TerminateInputCopy(0u, readOffset, 1u);
+    }
+    MARTe::ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+static bool InitialiseWaitFreeTwoReaders(const char8 * const numberOfBuffers) {
+    StreamString config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = RealTimeThreadAsyncBridgeTestGAM1"
+            "            OutputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "        +GAMB = {"
+            "            Class = RealTimeThreadAsyncBridgeTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "        +GAMC = {"
+            "            Class = RealTimeThreadAsyncBridgeTestGAM1"
+            "            InputSignals = {"
+            "               Signal1 = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridgeTestDS"
+            "            WaitFree = 1"
+            "            NumberOfBuffers = ";
+    config += numberOfBuffers;
+    config += ""
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "                +Thread2 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMB}"
+            "                }"
+            "                +Thread3 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMC}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config.Buffer());
+    MARTe::ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool RealTimeThreadAsyncBridgeTest::TestSetConfiguredDatabase_WaitFreeNumberOfReaders() {
+    //two readers need at least 2 + 2 buffers
+    bool ret = !InitialiseWaitFreeTwoReaders("3");
+    if (ret) {
+        ret = InitialiseWaitFreeTwoReaders("4");
+    }
+    return ret;
+}
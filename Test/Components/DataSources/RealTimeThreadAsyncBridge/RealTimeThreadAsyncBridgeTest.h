@@ -176,6 +176,36 @@ public:
      */
     bool TestResetSignalValue();
 
+    /**
+     * @brief Tests the Initialise method with WaitFree = 1
+     */
+    bool TestInitialise_WaitFree();
+
+    /**
+     * @brief Tests the Initialise method that fails if WaitFree = 1 and BlockingMode > 0
+     */
+    bool TestInitialise_False_WaitFreeBlockingMode();
+
+    /**
+     * @brief Tests the Initialise method that fails if WaitFree = 1 and NumberOfBuffers < 3
+     */
+    bool TestInitialise_False_WaitFreeNumberOfBuffers();
+
+    /**
+     * @brief Tests the GetInputOffset and GetOutputOffset methods with WaitFree = 1
+     */
+    bool TestGetOffset_WaitFree();
+
+    /**
+     * @brief Tests that the GetInputOffset method counts the retries when the newest buffer is claimed by the writer with WaitFree = 1
+     */
+    bool TestGetInputOffset_WaitFree_Retries();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if WaitFree = 1 and NumberOfBuffers < number of readers + 2 and succeeds on the boundary.
+     */
+    bool TestSetConfiguredDatabase_WaitFreeNumberOfReaders();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -95,6 +95,21 @@ TEST(UDPReceiverGTest,TestInitialise_Wrong_ExecutionMode) {
     ASSERT_TRUE(test.TestInitialise_Wrong_ExecutionMode());
 }
 
+TEST(UDPReceiverGTest,TestInitialise_Batch) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Batch());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_Wrong_BatchSize) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_BatchSize());
+}
+
+TEST(UDPReceiverGTest,TestInitialise_Wrong_CyclesPerPacket) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_CyclesPerPacket());
+}
+
 TEST(UDPReceiverGTest,TestSetConfiguredDatabase_ValidAddress) {
     UDPReceiverTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase_ValidAddress());
@@ -125,6 +140,16 @@ TEST(UDPReceiverGTest,TestSynchronise) {
     ASSERT_TRUE(test.TestSynchronise());
 }
 
+TEST(UDPReceiverGTest,TestSynchronise_Batch) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestSynchronise_Batch());
+}
+
+TEST(UDPReceiverGTest,TestSynchronise_Batch_IndependentThread) {
+    UDPReceiverTest test;
+    ASSERT_TRUE(test.TestSynchronise_Batch_IndependentThread());
+}
+
 TEST(UDPReceiverGTest,TestExecute_Timeout) {
     UDPReceiverTest test;
     ASSERT_TRUE(test.TestExecute_Timeout());
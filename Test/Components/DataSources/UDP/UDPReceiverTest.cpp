@@ -261,7 +261,8 @@ static bool TestIntegratedExecution(const MARTe::char8 *const config,
 }
 
 static bool TestSendReceiveExecution(const MARTe::char8 *const config,
-                                     MARTe::uint32 sleepMSec = 10) {
+                                     MARTe::uint32 sleepMSec = 10,
+                                     const bool checkBatchCounters = false) {
     using namespace MARTe;
 
     bool ok = true;
@@ -325,6 +326,24 @@ static bool TestSendReceiveExecution(const MARTe::char8 *const config,
         uint32 valueSent = *dataBuffer;
         ok = (valueSent == 99u);
     }
+    if (ok) {
+        if (checkBatchCounters) {
+            ReferenceT<UDPReceiver> udp = application->Find("Data.UDP");
+            ok = udp.IsValid();
+            if (ok) {
+                ok = (udp->GetNumberOfPackets() > 0u);
+            }
+            if (ok) {
+                ok = (udp->GetNumberOfBatches() > 0u);
+            }
+            if (ok) {
+                ok = (udp->GetMaxBatchSize() >= udp->GetLastBatchSize());
+            }
+            if (ok) {
+                ok = (udp->GetMaxLatency() >= udp->GetLastLatency());
+            }
+        }
+    }
     if (ok) {
         ok = sndThread.StopThread();
     }
@@ -652,6 +671,135 @@ static const MARTe::char8 *const config5 = ""
 
 
 
+//Correct configuration with localhost and batch reception
+static const MARTe::char8 *const config6 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperGAM"
+        "            InputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = RealTimeThread"
+        "            Port = 45678"
+        "            Timeout = 4"
+        "            BatchSize = 4"
+        "            CyclesPerPacket = 2"
+        "            Signals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Correct configuration with localhost, batch reception and decoupled thread
+static const MARTe::char8 *const config7 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMReceiver = {"
+        "            Class = TestHelperGAM"
+        "            InputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPReceiver"
+        "            ExecutionMode = IndependentThread"
+        "            Port = 45678"
+        "            Timeout = 4"
+        "            BatchSize = 4"
+        "            CyclesPerPacket = 2"
+        "            BusyPoll = 50"
+        "            Signals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMReceiver}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPReceiverSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -798,6 +946,50 @@ bool UDPReceiverTest::TestInitialise_Wrong_ExecutionMode() {
     return !ok;
 }
 
+bool UDPReceiverTest::TestInitialise_Batch() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("BatchSize", 8);
+    cdb.Write("CyclesPerPacket", 4);
+    cdb.Write("BusyPoll", 50);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetBatchSize() == 8u);
+    ok &= (test.GetCyclesPerPacket() == 4u);
+    ok &= (test.GetBusyPoll() == 50u);
+    ok &= (test.GetNumberOfPackets() == 0u);
+    ok &= (test.GetNumberOfDrops() == 0u);
+    return ok;
+}
+
+bool UDPReceiverTest::TestInitialise_Wrong_BatchSize() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("BatchSize", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool UDPReceiverTest::TestInitialise_Wrong_CyclesPerPacket() {
+    using namespace MARTe;
+    UDPReceiver test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("CyclesPerPacket", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
 bool UDPReceiverTest::TestSetConfiguredDatabase_ValidAddress() {
     return TestIntegratedExecution(config1);
 }
@@ -839,6 +1031,14 @@ bool UDPReceiverTest::TestSynchronise() {
     return TestSendReceiveExecution(config3);
 }
 
+bool UDPReceiverTest::TestSynchronise_Batch() {
+    return TestSendReceiveExecution(config6, 10u, true);
+}
+
+bool UDPReceiverTest::TestSynchronise_Batch_IndependentThread() {
+    return TestSendReceiveExecution(config7, 200u, true);
+}
+
 bool UDPReceiverTest::TestExecute_Timeout() {
     using namespace MARTe;
 
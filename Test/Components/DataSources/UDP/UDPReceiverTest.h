@@ -94,6 +94,21 @@ public:
      */
     bool TestInitialise_Wrong_ExecutionMode();
 
+    /**
+     * @brief Tests the Initialise method with BatchSize, CyclesPerPacket and BusyPoll.
+     */
+    bool TestInitialise_Batch();
+
+    /**
+     * @brief Tests the Initialise method with BatchSize = 0.
+     */
+    bool TestInitialise_Wrong_BatchSize();
+
+    /**
+     * @brief Tests the Initialise method with CyclesPerPacket = 0.
+     */
+    bool TestInitialise_Wrong_CyclesPerPacket();
+
     /**
      * @brief Tests the SetConfiguredDatabase method with Address for multicast.
      */
@@ -124,6 +139,16 @@ public:
      */
     bool TestSynchronise();
 
+    /**
+     * @brief Tests the Synchronise method with batch reception in RealTimeThread mode.
+     */
+    bool TestSynchronise_Batch();
+
+    /**
+     * @brief Tests the Synchronise method with batch reception in IndependentThread mode.
+     */
+    bool TestSynchronise_Batch_IndependentThread();
+
     /**
      * @brief Tests the Execute method
      */
@@ -141,3 +141,32 @@ TEST(UDPSenderGTest,TestSynchronise_RealTimeThread) {
     ASSERT_TRUE(test.TestSynchronise_RealTimeThread());
 }
 
+TEST(UDPSenderGTest,TestSynchronise_Batch) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Batch());
+}
+
+TEST(UDPSenderGTest,TestSynchronise_BatchFlushTimeout) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestSynchronise_BatchFlushTimeout());
+}
+
+TEST(UDPSenderGTest,TestInitialise_Batch) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_Batch());
+}
+
+TEST(UDPSenderGTest,TestInitialise_Wrong_BatchSize) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_BatchSize());
+}
+
+TEST(UDPSenderGTest,TestInitialise_Wrong_BatchSize_TooLarge) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_BatchSize_TooLarge());
+}
+
+TEST(UDPSenderGTest,TestInitialise_Wrong_CyclesPerPacket) {
+    UDPSenderTest test;
+    ASSERT_TRUE(test.TestInitialise_Wrong_CyclesPerPacket());
+}
@@ -222,7 +222,9 @@ static bool TestIntegratedExecution(const MARTe::char8 *const config,
 }
 
 bool TestSendReceiveApplication(const MARTe::char8 *const config,
-                                MARTe::uint32 sleepMSec = 10) {
+                                MARTe::uint32 sleepMSec = 10,
+                                const MARTe::uint32 expectedPackets = 0u,
+                                const MARTe::uint32 expectedBatches = 1u) {
     using namespace MARTe;
 
     ReceiverClientHelper rcvThread;
@@ -280,6 +282,28 @@ bool TestSendReceiveApplication(const MARTe::char8 *const config,
     uint32 valueReceived = *reinterpret_cast<uint32*>(&mem[9]);
     ok = (valueReceived == 99u);
 
+    if (ok) {
+        if (expectedPackets > 0u) {
+            ReferenceT<UDPSender> udp = application->Find("Data.UDP");
+            ok = udp.IsValid();
+            if (ok) {
+                ok = (udp->GetNumberOfPackets() == expectedPackets);
+            }
+            if (ok) {
+                ok = (udp->GetNumberOfBatches() == expectedBatches);
+            }
+            if (ok) {
+                ok = (udp->GetLastBatchSize() == (expectedPackets / expectedBatches));
+            }
+            if (ok) {
+                ok = (udp->GetNumberOfDrops() == 0u);
+            }
+            if (ok) {
+                ok = (udp->GetMaxLatency() >= udp->GetLastLatency());
+            }
+        }
+    }
+
     if (ok) {
         ok = rcvThread.StopThread();
     }
@@ -598,6 +622,314 @@ static const MARTe::char8 *const config2 = ""
         "}";
 
 
+//Correct configuration with RealTimeThread and batch sending
+static const MARTe::char8 *const config3 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMTimer = {"
+        "            Class = IOGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = Timer"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = Timer"
+        "                    Frequency = 1"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "        +TriggerGAM = {"
+        "            Class = ConstantGAM"
+        "            OutputSignals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                    DataSource = DDB1"
+        "                    Default = 1"
+        "                }"
+        "            }"
+        "        }"
+        "        +PayloadGAM = {"
+        "            Class = ConstantGAM"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                    Default = 99"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMSender = {"
+        "            Class = IOGAM"
+        "            InputSignals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                    DataSource = UDP"
+        "                }"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPSender"
+        "            Address = \"127.0.0.1\""
+        "            Port = 45678"
+        "            ExecutionMode = RealTimeThread"
+        "            BatchSize = 2"
+        "            CyclesPerPacket = 2"
+        "            Signals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                }"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            SleepNature = \"Default\""
+        "            Signals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMTimer TriggerGAM PayloadGAM GAMSender}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPSenderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Correct configuration with RealTimeThread, batch sending and flush timeout
+static const MARTe::char8 *const config4 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMTimer = {"
+        "            Class = IOGAM"
+        "            InputSignals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = Timer"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = Timer"
+        "                    Frequency = 1"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "        }"
+        "        +TriggerGAM = {"
+        "            Class = ConstantGAM"
+        "            OutputSignals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                    DataSource = DDB1"
+        "                    Default = 1"
+        "                }"
+        "            }"
+        "        }"
+        "        +PayloadGAM = {"
+        "            Class = ConstantGAM"
+        "            OutputSignals = {"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                    Default = 99"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAMSender = {"
+        "            Class = IOGAM"
+        "            InputSignals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = DDB1"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                    DataSource = UDP"
+        "                }"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                    DataSource = UDP"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +DDB1 = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +UDP = {"
+        "            Class = UDP::UDPSender"
+        "            Address = \"127.0.0.1\""
+        "            Port = 45678"
+        "            ExecutionMode = RealTimeThread"
+        "            BatchSize = 2"
+        "            CyclesPerPacket = 2"
+        "            FlushTimeout = 5"
+        "            Signals = {"
+        "                Trigger = {"
+        "                    Type = uint8"
+        "                }"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                }"
+        "                Payload = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "        +Timer = {"
+        "            Class = LinuxTimer"
+        "            SleepNature = \"Default\""
+        "            Signals = {"
+        "                Counter = {"
+        "                    Type = uint32"
+        "                }"
+        "                Time = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMTimer TriggerGAM PayloadGAM GAMSender}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = UDPSenderSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -814,6 +1146,66 @@ bool UDPSenderTest::TestInitialise_RealTimeThread_IgnoreParameters() {
     return test.Initialise(cdb);
 }
 
+bool UDPSenderTest::TestInitialise_Batch() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("BatchSize", 8);
+    cdb.Write("CyclesPerPacket", 4);
+    cdb.Write("FlushTimeout", 100);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetBatchSize() == 8u);
+    ok &= (test.GetFlushTimeout() == 100u);
+    ok &= (test.GetCyclesPerPacket() == 4u);
+    ok &= (test.GetNumberOfPackets() == 0u);
+    ok &= (test.GetNumberOfDrops() == 0u);
+    return ok;
+}
+
+bool UDPSenderTest::TestInitialise_Wrong_BatchSize() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("BatchSize", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool UDPSenderTest::TestInitialise_Wrong_BatchSize_TooLarge() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("BatchSize", 1025);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool UDPSenderTest::TestInitialise_Wrong_CyclesPerPacket() {
+    using namespace MARTe;
+    UDPSender test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Address", "127.0.0.1");
+    cdb.Write("Port", 45678);
+    cdb.Write("ExecutionMode", "RealTimeThread");
+    cdb.Write("CyclesPerPacket", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
 bool UDPSenderTest::TestGetInputBrokers() {
     using namespace MARTe;
     UDPSender test;
@@ -863,6 +1255,16 @@ bool UDPSenderTest::TestSynchronise_RealTimeThread() {
     return TestSendReceiveApplication(config2);
 }
 
+bool UDPSenderTest::TestSynchronise_Batch() {
+    //5 cycles: the first 4 are sent with one sendmmsg in 2 datagrams, the last one is buffered
+    return TestSendReceiveApplication(config3, 10u, 2u);
+}
+
+bool UDPSenderTest::TestSynchronise_BatchFlushTimeout() {
+    //5 cycles 10 ms apart with a 5 ms flush timeout: the 2nd and the 4th cycles send the two incomplete batches, each with one datagram
+    return TestSendReceiveApplication(config4, 10u, 2u, 2u);
+}
+
 bool UDPSenderTest::TestSetConfiguredDatabase_Correct() {
     return TestIntegratedExecution(config1);
 }
@@ -138,6 +138,36 @@ public:
      */
     bool TestSynchronise_RealTimeThread();
 
+    /**
+     * @brief Tests the Synchronise method with coalescing and batch sending.
+     */
+    bool TestSynchronise_Batch();
+
+    /**
+     * @brief Tests that an incomplete batch is sent when the FlushTimeout expires.
+     */
+    bool TestSynchronise_BatchFlushTimeout();
+
+    /**
+     * @brief Tests the Initialise method with BatchSize and CyclesPerPacket.
+     */
+    bool TestInitialise_Batch();
+
+    /**
+     * @brief Tests the Initialise method with BatchSize = 0.
+     */
+    bool TestInitialise_Wrong_BatchSize();
+
+    /**
+     * @brief Tests the Initialise method with a BatchSize larger than the UDPReceiver limit.
+     */
+    bool TestInitialise_Wrong_BatchSize_TooLarge();
+
+    /**
+     * @brief Tests the Initialise method with CyclesPerPacket = 0.
+     */
+    bool TestInitialise_Wrong_CyclesPerPacket();
+
     /**
      * @brief Tests the SetConfiguredDatabase method.
      */
@@ -122,6 +122,31 @@ TEST(CRCGAMGTest,TestExecuteUint32) {
     ASSERT_TRUE(test.TestExecuteUint32());
 }
 
+TEST(CRCGAMGTest,TestInitialiseWrongReflected) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongReflected());
+}
+
+TEST(CRCGAMGTest,TestInitialiseReflectedInverted) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseReflectedInverted());
+}
+
+TEST(CRCGAMGTest,TestSetupWrongOutputTypes) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongOutputTypes());
+}
+
+TEST(CRCGAMGTest,TestExecuteCRC32C) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestExecuteCRC32C());
+}
+
+TEST(CRCGAMGTest,TestExecuteMultipleCRCs) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMultipleCRCs());
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -540,4 +540,229 @@ bool CRCGAMTest::TestExecuteUint16() {
 bool CRCGAMTest::TestExecuteUint32() {
     return TestExecute<MARTe::uint32>(1024);
 }
-	
+
+bool CRCGAMTest::TestInitialiseWrongReflected() {
+    using namespace MARTe;
+    CRCGAM gam;
+    bool ok;
+    ConfigurationDatabase config;
+    uint32 pol = 0;
+    uint32 initCRC = 0;
+    uint8 inverted = 0;
+    uint8 reflected = 2;
+    config.Write("Polynomial", pol);
+    config.Write("InitialValue", initCRC);
+    config.Write("Inverted", inverted);
+    config.Write("Reflected", reflected);
+    ok = !gam.Initialise(config);
+    return ok;
+}
+
+bool CRCGAMTest::TestInitialiseReflectedInverted() {
+    using namespace MARTe;
+    CRCGAM gam;
+    bool ok;
+    ConfigurationDatabase config;
+    uint32 pol = 0;
+    uint32 initCRC = 0;
+    uint8 inverted = 1;
+    uint8 reflected = 1;
+    config.Write("Polynomial", pol);
+    config.Write("InitialValue", initCRC);
+    config.Write("Inverted", inverted);
+    config.Write("Reflected", reflected);
+    ok = !gam.Initialise(config);
+    return ok;
+}
+
+/**
+ * Adds a second input signal and a second output signal to the configuration.
+ */
+static bool AddSecondCRC(MARTe::ConfigurationDatabase &cdb, const MARTe::char8 * const outputType) {
+    using namespace MARTe;
+    bool ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.InputSignals");
+    if (ok) {
+        ok = cdb.CreateRelative("Signal3");
+    }
+    if (ok) {
+        ok = cdb.Write("DataSource", "DSH");
+    }
+    if (ok) {
+        ok = cdb.Write("Type", "uint8");
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals");
+    }
+    if (ok) {
+        ok = cdb.CreateRelative("Signal4");
+    }
+    if (ok) {
+        ok = cdb.Write("DataSource", "DDB1");
+    }
+    if (ok) {
+        ok = cdb.Write("Type", outputType);
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1");
+    }
+    if (ok) {
+        ok = cdb.Delete("Polynomial");
+    }
+    if (ok) {
+        ok = cdb.Write("Polynomial", 0x7);
+    }
+    return ok;
+}
+
+bool CRCGAMTest::TestSetupWrongOutputTypes() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = configFromBasicTypeTemplate;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = AddSecondCRC(cdb, "uint16");
+    }
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        cdb.MoveToRoot();
+        ord->Purge();
+        ok = ord->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = ord->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = !application->ConfigureApplication();
+    }
+    ord->Purge();
+    return ok;
+}
+
+bool CRCGAMTest::TestExecuteCRC32C() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = configFromBasicTypeTemplate;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals.Signal2");
+    }
+    if (ok) {
+        ok = cdb.Delete("Type");
+    }
+    if (ok) {
+        ok = cdb.Write("Type", "uint32");
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1");
+    }
+    if (ok) {
+        ok = cdb.Delete("Polynomial");
+    }
+    if (ok) {
+        ok = cdb.Write("Polynomial", CRC_HELPER_CRC32C_POLYNOMIAL);
+    }
+    if (ok) {
+        ok = cdb.Delete("InitialValue");
+    }
+    if (ok) {
+        ok = cdb.Write("InitialValue", 0xFFFFFFFFu);
+    }
+    if (ok) {
+        ok = cdb.Delete("Inverted");
+    }
+    if (ok) {
+        ok = cdb.Write("Inverted", 0);
+    }
+    if (ok) {
+        ok = cdb.Write("Reflected", 1);
+    }
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        cdb.MoveToRoot();
+        ord->Purge();
+        ok = ord->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = ord->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<CRCTestHelper> gam = ord->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        if (CRCHelper::IsCRC32CHardwareAvailable()) {
+            ok = (gam->GetEngine() == CRCHelperEngineHardwareCRC32C);
+        }
+        else {
+            ok = (gam->GetEngine() == CRCHelperEngineSliceBy8);
+        }
+    }
+    if (ok) {
+        uint8 *input = reinterpret_cast<uint8*>(gam->GetInputSignalMemory(0u));
+        *input = 10u;
+        ok = gam->Execute();
+    }
+    if (ok) {
+        uint32 *output = reinterpret_cast<uint32*>(gam->GetOutputSignalMemory(0u));
+        ok = (*output == 0xC6608496u);
+    }
+    ord->Purge();
+    return ok;
+}
+
+bool CRCGAMTest::TestExecuteMultipleCRCs() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = configFromBasicTypeTemplate;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = AddSecondCRC(cdb, "uint8");
+    }
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        cdb.MoveToRoot();
+        ord->Purge();
+        ok = ord->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = ord->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    ReferenceT<CRCTestHelper> gam = ord->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = (gam->GetNumberOfOutputSignals() == 2u);
+    }
+    if (ok) {
+        *reinterpret_cast<uint8*>(gam->GetInputSignalMemory(0u)) = 10u;
+        *reinterpret_cast<uint8*>(gam->GetInputSignalMemory(1u)) = 20u;
+        ok = gam->Execute();
+    }
+    if (ok) {
+        //CRC-8 of each input signal
+        ok = (*reinterpret_cast<uint8*>(gam->GetOutputSignalMemory(0u)) == 0x36u);
+        ok &= (*reinterpret_cast<uint8*>(gam->GetOutputSignalMemory(1u)) == 0x6Cu);
+    }
+    ord->Purge();
+    return ok;
+}
@@ -135,6 +135,34 @@ public:
      * @brief Test the execute function for output type = uint32
      */
     bool TestExecuteUint32();
+
+    /**
+     * @brief Test the initialise function when the Reflected
+     * parameter is greater then 1
+     */
+    bool TestInitialiseWrongReflected();
+
+    /**
+     * @brief Test the initialise function when both Reflected
+     * and Inverted are set
+     */
+    bool TestInitialiseReflectedInverted();
+
+    /**
+     * @brief Test the setup function when the output signals
+     * have different types
+     */
+    bool TestSetupWrongOutputTypes();
+
+    /**
+     * @brief Test the execute function with the reflected CRC-32C
+     */
+    bool TestExecuteCRC32C();
+
+    /**
+     * @brief Test the execute function with one CRC for each input signal
+     */
+    bool TestExecuteMultipleCRCs();
 };
 
 
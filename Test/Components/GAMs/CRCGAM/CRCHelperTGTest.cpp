@@ -68,3 +68,33 @@ TEST(CRCHelperTGTest,TestCompute) {
     CRCHelperTTest test;
     ASSERT_TRUE(test.TestCompute());
 }
+
+TEST(CRCHelperTGTest,TestComputeSliceBy8) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeSliceBy8());
+}
+
+TEST(CRCHelperTGTest,TestComputeReflected) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeReflected());
+}
+
+TEST(CRCHelperTGTest,TestComputeCRC32C) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeCRC32C());
+}
+
+TEST(CRCHelperTGTest,TestComputeAllSizes) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeAllSizes());
+}
+
+TEST(CRCHelperTGTest,TestComputeInverted) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeInverted());
+}
+
+TEST(CRCHelperTGTest,TestGetEngineName) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestGetEngineName());
+}
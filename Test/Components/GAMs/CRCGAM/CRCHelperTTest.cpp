@@ -33,10 +33,72 @@
 
 #include "CRCHelperT.h"
 #include "CRCHelperTTest.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * The standard CRC check input.
+ */
+const MARTe::char8 * const checkInput = "123456789";
+
+/**
+ * Bit-by-bit CRC used as reference.
+ */
+template<typename T>
+T BitwiseCRC(const MARTe::uint8 * const data, const MARTe::uint32 size, const T pol, const T initCRC, const bool reflected) {
+    using namespace MARTe;
+    const uint32 width = static_cast<uint32>(sizeof(T) * 8u);
+    T reflectedPol = 0u;
+    uint32 b;
+    for (b = 0u; b < width; b++) {
+        if (((pol >> b) & 1u) != 0u) {
+            reflectedPol |= static_cast<T>(static_cast<T>(1u) << (width - 1u - b));
+        }
+    }
+    T crc = initCRC;
+    uint32 i;
+    for (i = 0u; i < size; i++) {
+        if (reflected) {
+            crc ^= data[i];
+        }
+        else {
+            crc ^= static_cast<T>(static_cast<T>(data[i]) << (width - 8u));
+        }
+        for (b = 0u; b < 8u; b++) {
+            if (reflected) {
+                crc = ((crc & 1u) != 0u) ? static_cast<T>(static_cast<T>(crc >> 1u) ^ reflectedPol) : static_cast<T>(crc >> 1u);
+            }
+            else {
+                crc = (((crc >> (width - 1u)) & 1u) != 0u) ? static_cast<T>(static_cast<T>(crc << 1u) ^ pol) : static_cast<T>(crc << 1u);
+            }
+        }
+    }
+    return crc;
+}
+
+template<typename T>
+bool CheckAllSizes(T pol, const bool reflected) {
+    using namespace MARTe;
+    uint8 data[64];
+    uint32 i;
+    for (i = 0u; i < 64u; i++) {
+        data[i] = static_cast<uint8>((i * 7u) + 3u);
+    }
+    CRCHelperT<T> test;
+    test.ComputeTable(&pol, reflected);
+    bool ok = true;
+    for (i = 0u; (i <= 64u) && (ok); i++) {
+        T initCRC = static_cast<T>(0x12345678u);
+        T crc = 0u;
+        test.Compute(&data[0], static_cast<int32>(i), &initCRC, false, &crc);
+        ok = (crc == BitwiseCRC<T>(&data[0], i, pol, static_cast<T>(0x12345678u), reflected));
+    }
+    return ok;
+}
+}
 
 
 /*---------------------------------------------------------------------------*/
@@ -126,4 +188,143 @@ bool CRCHelperTTest::TestCompute() {
 
     return ok;
 }
-	
+
+bool CRCHelperTTest::TestComputeSliceBy8() {
+    const uint8 * const data = reinterpret_cast<const uint8 *>(checkInput);
+    uint8 p8 = 0x7u;
+    uint8 i8 = 0u;
+    uint8 r8 = 0u;
+    CRCHelperT<uint8> t8;
+    t8.ComputeTable(&p8);
+    t8.Compute(data, 9, &i8, false, &r8);
+
+    uint16 p16 = 0x1021u;
+    uint16 i16 = 0u;
+    uint16 r16 = 0u;
+    CRCHelperT<uint16> t16;
+    t16.ComputeTable(&p16);
+    t16.Compute(data, 9, &i16, false, &r16);
+
+    uint32 p32 = 0x4C11DB7u;
+    uint32 i32 = 0xFFFFFFFFu;
+    uint32 r32 = 0u;
+    CRCHelperT<uint32> t32;
+    t32.ComputeTable(&p32);
+    t32.Compute(data, 9, &i32, false, &r32);
+
+    //CRC-8, CRC-16/XMODEM and CRC-32/MPEG-2
+    bool ok = (r8 == 0xF4u) && (r16 == 0x31C3u) && (r32 == 0x0376E6E7u);
+    if (ok) {
+        ok = (t8.GetEngine() == CRCHelperEngineSliceBy8) && (t16.GetEngine() == CRCHelperEngineSliceBy8) && (t32.GetEngine() == CRCHelperEngineSliceBy8);
+    }
+    return ok;
+}
+
+bool CRCHelperTTest::TestComputeReflected() {
+    const uint8 * const data = reinterpret_cast<const uint8 *>(checkInput);
+    uint8 p8 = 0x7u;
+    uint8 i8 = 0xFFu;
+    uint8 r8 = 0u;
+    CRCHelperT<uint8> t8;
+    t8.ComputeTable(&p8, true);
+    t8.Compute(data, 9, &i8, false, &r8);
+
+    uint16 p16 = 0x1021u;
+    uint16 i16 = 0u;
+    uint16 r16 = 0u;
+    CRCHelperT<uint16> t16;
+    t16.ComputeTable(&p16, true);
+    t16.Compute(data, 9, &i16, false, &r16);
+
+    uint32 p32 = 0x4C11DB7u;
+    uint32 i32 = 0xFFFFFFFFu;
+    uint32 r32 = 0u;
+    CRCHelperT<uint32> t32;
+    t32.ComputeTable(&p32, true);
+    t32.Compute(data, 9, &i32, false, &r32);
+
+    //CRC-8/ROHC, CRC-16/KERMIT and CRC-32 (without the final XOR)
+    bool ok = (r8 == 0xD0u) && (r16 == 0x2189u) && (r32 == static_cast<uint32>(~0xCBF43926u));
+    if (ok) {
+        ok = (t32.GetEngine() == CRCHelperEngineSliceBy8);
+    }
+    return ok;
+}
+
+bool CRCHelperTTest::TestComputeCRC32C() {
+    const uint8 * const data = reinterpret_cast<const uint8 *>(checkInput);
+    uint32 p32 = CRC_HELPER_CRC32C_POLYNOMIAL;
+    uint32 i32 = 0xFFFFFFFFu;
+    uint32 r32 = 0u;
+    CRCHelperT<uint32> t32;
+    t32.ComputeTable(&p32, true);
+    t32.Compute(data, 9, &i32, false, &r32);
+    //CRC-32C (without the final XOR)
+    bool ok = (r32 == static_cast<uint32>(~0xE3069283u));
+    if (ok) {
+        if (CRCHelper::IsCRC32CHardwareAvailable()) {
+            ok = (t32.GetEngine() == CRCHelperEngineHardwareCRC32C);
+        }
+        else {
+            ok = (t32.GetEngine() == CRCHelperEngineSliceBy8);
+        }
+    }
+    if (ok) {
+        ok = CheckAllSizes<uint32>(CRC_HELPER_CRC32C_POLYNOMIAL, true);
+    }
+    return ok;
+}
+
+bool CRCHelperTTest::TestComputeAllSizes() {
+    bool ok = CheckAllSizes<uint8>(0x7u, false);
+    if (ok) {
+        ok = CheckAllSizes<uint8>(0x7u, true);
+    }
+    if (ok) {
+        ok = CheckAllSizes<uint16>(0x1021u, false);
+    }
+    if (ok) {
+        ok = CheckAllSizes<uint16>(0x8005u, true);
+    }
+    if (ok) {
+        ok = CheckAllSizes<uint32>(0x4C11DB7u, false);
+    }
+    if (ok) {
+        ok = CheckAllSizes<uint32>(0x4C11DB7u, true);
+    }
+    return ok;
+}
+
+bool CRCHelperTTest::TestComputeInverted() {
+    uint8 data[4] = { 1u, 2u, 3u, 4u };
+    uint16 p16 = 0x1021u;
+    uint16 i16 = 0u;
+    uint16 r16 = 0u;
+    CRCHelperT<uint16> t16;
+    t16.ComputeTable(&p16);
+    t16.Compute(&data[3], 4, &i16, true, &r16);
+
+    CRC<uint16> byteWise;
+    byteWise.ComputeTable(p16);
+    return (r16 == byteWise.Compute(&data[3], 4, i16, true));
+}
+
+bool CRCHelperTTest::TestGetEngineName() {
+    uint16 p16 = 0x1021u;
+    CRCHelperT<uint16> t16;
+    bool ok = (t16.GetEngine() == CRCHelperEngineByteWise);
+    if (ok) {
+        ok = (StringHelper::Compare(t16.GetEngineName(), "ByteWise") == 0);
+    }
+    t16.ComputeTable(&p16);
+    if (ok) {
+        ok = (StringHelper::Compare(t16.GetEngineName(), "SliceBy8") == 0);
+    }
+    uint32 p32 = CRC_HELPER_CRC32C_POLYNOMIAL;
+    CRCHelperT<uint32> t32;
+    t32.ComputeTable(&p32, true);
+    if ((ok) && (CRCHelper::IsCRC32CHardwareAvailable())) {
+        ok = (StringHelper::Compare(t32.GetEngineName(), "HardwareCRC32C") == 0);
+    }
+    return ok;
+}
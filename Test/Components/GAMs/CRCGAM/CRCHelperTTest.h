@@ -74,6 +74,36 @@ public:
      */
     bool TestCompute();
 
+    /**
+     * @brief Test the function Compute with the slice-by-8 engine against the standard check values.
+     */
+    bool TestComputeSliceBy8();
+
+    /**
+     * @brief Test the function Compute with a reflected CRC against the standard check values.
+     */
+    bool TestComputeReflected();
+
+    /**
+     * @brief Test the function Compute with the CRC-32C polynomial.
+     */
+    bool TestComputeCRC32C();
+
+    /**
+     * @brief Test the function Compute against a bit-by-bit CRC for all the sizes up to 64 bytes.
+     */
+    bool TestComputeAllSizes();
+
+    /**
+     * @brief Test that the function Compute with inputInverted gives the same result as the byte-wise CRC.
+     */
+    bool TestComputeInverted();
+
+    /**
+     * @brief Test the function GetEngineName.
+     */
+    bool TestGetEngineName();
+
 };
 
 
@@ -279,6 +279,41 @@ TEST(ConversionGAMGTest,TestSetup_False_InvalidOutputSamplesMismatch) {
     ASSERT_TRUE(test.TestSetup_False_InvalidOutputSamplesMismatch());
 }
 
+TEST(ConversionGAMGTest,TestSetup_Saturate) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_Saturate());
+}
+
+TEST(ConversionGAMGTest,TestSetup_False_Saturate) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_Saturate());
+}
+
+TEST(ConversionGAMGTest,TestSetup_False_LookupTable) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_LookupTable());
+}
+
+TEST(ConversionGAMGTest,TestExecute_LookupTable_FromUInt8) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestExecute<MARTe::uint8>(0xff, true, 2.0, true, 1, true));
+}
+
+TEST(ConversionGAMGTest,TestExecute_LookupTable_FromInt8) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestExecute<MARTe::int8>(-1, true, 2.0, true, 1, true));
+}
+
+TEST(ConversionGAMGTest,TestExecute_LookupTable_FromUInt16) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestExecute<MARTe::uint16>(0xffff, true, 2.0, true, 1, true));
+}
+
+TEST(ConversionGAMGTest,TestExecute_LookupTable_FromInt16) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestExecute<MARTe::int16>(-1, true, 2.0, true, 1, true));
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -402,4 +402,135 @@ bool ConversionGAMTest::TestSetup_False_InvalidOutputSamplesMismatch() {
     return ok;
 }
 
+bool ConversionGAMTest::TestSetup_Saturate() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = configFromBasicTypeTemplate;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    //Parse the template configuration file
+    bool ok = parser.Parse();
+
+    //Saturate all the integer output signals (the output types repeat every 10 signals and the last two are float)
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals");
+    }
+    if (ok) {
+        uint32 i;
+        StreamString signalName;
+        const uint32 numberOfSignals = 30u;
+        for (i = 0; (i < numberOfSignals) && (ok); i++) {
+            if ((i %% 10u) < 8u) {
+                signalName = "";
+                signalName.Printf("Signal%%d", (i + 1));
+                ok = cdb.MoveRelative(signalName.Buffer());
+                if (ok) {
+                    ok = cdb.Write("Saturate", 1);
+                }
+                if (ok) {
+                    cdb.MoveToAncestor(1u);
+                }
+            }
+        }
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    //Initialise the application
+    if (ok) {
+        cdb.MoveToRoot();
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
 
+    god->Purge();
+    return ok;
+}
+
+bool ConversionGAMTest::TestSetup_False_Saturate() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = configFromBasicTypeTemplate;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    //Parse the template configuration file
+    bool ok = parser.Parse();
+
+    //Saturate a float32 output signal
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals.Signal9");
+    }
+    if (ok) {
+        ok = cdb.Write("Saturate", 1);
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    //Initialise the application
+    if (ok) {
+        cdb.MoveToRoot();
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = !application->ConfigureApplication();
+    }
+
+    god->Purge();
+    return ok;
+}
+
+bool ConversionGAMTest::TestSetup_False_LookupTable() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = configFromBasicTypeTemplate;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    //Parse the template configuration file
+    bool ok = parser.Parse();
+
+    //Patch a 32 bit input signal with a LookupTable
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.InputSignals.Signal1");
+    }
+    if (ok) {
+        cdb.Delete("Type");
+        ok = cdb.Write("Type", "uint32");
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals.Signal1");
+    }
+    if (ok) {
+        ok = cdb.Write("LookupTable", 1);
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    //Initialise the application
+    if (ok) {
+        cdb.MoveToRoot();
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = !application->ConfigureApplication();
+    }
+
+    god->Purge();
+    return ok;
+}
@@ -95,15 +95,32 @@ public:
      */
     bool TestSetup_False_InvalidOutputSamplesMismatch();
 
+    /**
+     * @brief Tests the Setup method with Saturate = 1 in all the integer output signals.
+     */
+    bool TestSetup_Saturate();
+
+    /**
+     * @brief Tests that the Setup method fails with Saturate = 1 in a float output signal.
+     */
+    bool TestSetup_False_Saturate();
+
+    /**
+     * @brief Tests that the Setup method fails with LookupTable = 1 and a 32 bit input signal.
+     */
+    bool TestSetup_False_LookupTable();
+
     /**
      * @brief Tests the Execute method for all the basic types.
+     * @param[in] setLookupTable if true LookupTable = 1 is set in all the output signals (only valid for 8 and 16 bit integer inputs).
      */
     template<typename baseType>
     bool TestExecute(baseType typeValue,
                      bool setGain = false,
                      MARTe::float32 gainValue = 1.0,
                      bool setOffset = false,
-                     MARTe::float64 offsetValue = 0.0);
+                     MARTe::float64 offsetValue = 0.0,
+                     bool setLookupTable = false);
 
 private:
     /**
@@ -563,7 +580,8 @@ bool ConversionGAMTest::TestExecute(baseType typeValue,
                                     bool setGain,
                                     MARTe::float32 gainValue,
                                     bool setOffset,
-                                    MARTe::float64 offsetValue) {
+                                    MARTe::float64 offsetValue,
+                                    bool setLookupTable) {
     using namespace MARTe;
     ConfigurationDatabase cdb;
     StreamString configStream = configFromBasicTypeTemplate;
@@ -617,6 +635,26 @@ bool ConversionGAMTest::TestExecute(baseType typeValue,
             }
         }
     }
+    if (setLookupTable) {
+        if (ok) {
+            ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals");
+        }
+        if (ok) {
+            uint32 i;
+            StreamString signalName;
+            for (i = 0; (i < numberOfSignals) && (ok); i++) {
+                signalName = "";
+                signalName.Printf("Signal%d", (i + 1));
+                ok = cdb.MoveRelative(signalName.Buffer());
+                if (ok) {
+                    ok = cdb.Write("LookupTable", 1);
+                }
+                if (ok) {
+                    cdb.MoveToAncestor(1u);
+                }
+            }
+        }
+    }
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
 
     //Initialise the application
@@ -85,6 +85,51 @@ TEST(ConversionHelperTGTest,TestSetNumberOfSamples) {
     ASSERT_TRUE(test.TestSetNumberOfSamples());
 }
 
+TEST(ConversionHelperTGTest,TestSelectKernel_Copy) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestSelectKernel_Copy());
+}
+
+TEST(ConversionHelperTGTest,TestSelectKernel_Direct) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestSelectKernel_Direct());
+}
+
+TEST(ConversionHelperTGTest,TestSelectKernel_Saturate) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestSelectKernel_Saturate());
+}
+
+TEST(ConversionHelperTGTest,TestSelectKernel_Saturate_64Bit) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestSelectKernel_Saturate_64Bit());
+}
+
+TEST(ConversionHelperTGTest,TestSelectKernel_LookupTable) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestSelectKernel_LookupTable());
+}
+
+TEST(ConversionHelperTGTest,TestSelectKernel_LookupTable_Saturate) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestSelectKernel_LookupTable_Saturate());
+}
+
+TEST(ConversionHelperTGTest,TestSelectKernel_False_Saturate) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestSelectKernel_False_Saturate());
+}
+
+TEST(ConversionHelperTGTest,TestSelectKernel_False_LookupTable) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestSelectKernel_False_LookupTable());
+}
+
+TEST(ConversionHelperTGTest,TestGetKernel) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestGetKernel());
+}
+
 
 
 
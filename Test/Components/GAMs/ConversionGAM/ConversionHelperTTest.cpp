@@ -124,3 +124,234 @@ bool ConversionHelperTTest::TestGetOutputMemory() {
     }
     return ok;
 }
+
+bool ConversionHelperTTest::TestSelectKernel_Copy() {
+    using namespace MARTe;
+    uint32 input[4] = { 1u, 2u, 3u, 4u };
+    uint32 output[4] = { 0u, 0u, 0u, 0u };
+    ConversionHelperT<uint32, uint32> test(&input[0], &output[0]);
+    test.SetNumberOfElements(2u);
+    test.SetNumberOfSamples(2u);
+    ConfigurationDatabase cdb;
+    test.LoadGain(cdb);
+    test.LoadOffset(cdb);
+    bool ok = test.SelectKernel(cdb);
+    if (ok) {
+        ok = (test.GetKernel() == ConversionHelperKernelCopy);
+    }
+    if (ok) {
+        test.Convert();
+        uint32 i;
+        for (i = 0u; (i < 4u) && (ok); i++) {
+            ok = (output[i] == input[i]);
+        }
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestSelectKernel_Direct() {
+    using namespace MARTe;
+    //More than one block of the direct kernel and a remainder
+    const uint32 numberOfValues = 21u;
+    int16 input[numberOfValues];
+    float32 output[numberOfValues];
+    uint32 i;
+    for (i = 0u; i < numberOfValues; i++) {
+        input[i] = static_cast<int16>((static_cast<int32>(i) * 1000) - 10000);
+    }
+    ConversionHelperT<int16, float32> test(&input[0], &output[0]);
+    test.SetNumberOfElements(7u);
+    test.SetNumberOfSamples(3u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Gain", 0.5);
+    cdb.Write("Offset", 1.0);
+    test.LoadGain(cdb);
+    test.LoadOffset(cdb);
+    bool ok = test.SelectKernel(cdb);
+    if (ok) {
+        ok = (test.GetKernel() == ConversionHelperKernelDirect);
+    }
+    if (ok) {
+        test.Convert();
+        for (i = 0u; (i < numberOfValues) && (ok); i++) {
+            ok = (output[i] == ((0.5F * static_cast<float32>(input[i])) + 1.0F));
+        }
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestSelectKernel_Saturate() {
+    using namespace MARTe;
+    float32 input[5] = { -10.0F, -0.5F, 0.5F, 1.2F, 10.0F };
+    int8 output[5];
+    ConversionHelperT<float32, int8> test(&input[0], &output[0]);
+    test.SetNumberOfElements(5u);
+    test.SetNumberOfSamples(1u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Gain", 100);
+    cdb.Write("Saturate", 1);
+    test.LoadGain(cdb);
+    test.LoadOffset(cdb);
+    bool ok = test.SelectKernel(cdb);
+    if (ok) {
+        ok = (test.GetKernel() == ConversionHelperKernelSaturate);
+    }
+    if (ok) {
+        test.Convert();
+        ok = (output[0] == -128);
+        ok &= (output[1] == -50);
+        ok &= (output[2] == 50);
+        ok &= (output[3] == 120);
+        ok &= (output[4] == 127);
+    }
+    uint8 outputU[5];
+    ConversionHelperT<float32, uint8> testU(&input[0], &outputU[0]);
+    testU.SetNumberOfElements(5u);
+    testU.SetNumberOfSamples(1u);
+    testU.LoadGain(cdb);
+    testU.LoadOffset(cdb);
+    if (ok) {
+        ok = testU.SelectKernel(cdb);
+    }
+    if (ok) {
+        testU.Convert();
+        ok = (outputU[0] == 0u);
+        ok &= (outputU[1] == 0u);
+        ok &= (outputU[2] == 50u);
+        ok &= (outputU[3] == 120u);
+        ok &= (outputU[4] == 255u);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestSelectKernel_Saturate_64Bit() {
+    using namespace MARTe;
+    float64 input[3] = { -1e30, 1e30, -3.0 };
+    int64 output[3];
+    uint64 outputU[3];
+    ConfigurationDatabase cdb;
+    cdb.Write("Saturate", 1);
+    ConversionHelperT<float64, int64> test(&input[0], &output[0]);
+    test.SetNumberOfElements(3u);
+    test.SetNumberOfSamples(1u);
+    test.LoadGain(cdb);
+    test.LoadOffset(cdb);
+    bool ok = test.SelectKernel(cdb);
+    if (ok) {
+        test.Convert();
+        ok = (output[0] == static_cast<int64>(0x8000000000000000ull));
+        ok &= (output[1] == static_cast<int64>(0x7FFFFFFFFFFFFFFFull));
+        ok &= (output[2] == -3);
+    }
+    ConversionHelperT<float64, uint64> testU(&input[0], &outputU[0]);
+    testU.SetNumberOfElements(3u);
+    testU.SetNumberOfSamples(1u);
+    testU.LoadGain(cdb);
+    testU.LoadOffset(cdb);
+    if (ok) {
+        ok = testU.SelectKernel(cdb);
+    }
+    if (ok) {
+        testU.Convert();
+        ok = (outputU[0] == 0u);
+        ok &= (outputU[1] == 0xFFFFFFFFFFFFFFFFull);
+        ok &= (outputU[2] == 0u);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestSelectKernel_LookupTable() {
+    using namespace MARTe;
+    int16 input[8] = { -32768, -1, 0, 1, 100, 32767, 5, 6 };
+    float32 output[8];
+    float32 expected[8];
+    ConfigurationDatabase cdb;
+    cdb.Write("Gain", 0.5);
+    cdb.Write("Offset", 1.0);
+    ConversionHelperT<int16, float32> direct(&input[0], &expected[0]);
+    direct.SetNumberOfElements(8u);
+    direct.SetNumberOfSamples(1u);
+    direct.LoadGain(cdb);
+    direct.LoadOffset(cdb);
+    bool ok = direct.SelectKernel(cdb);
+    if (ok) {
+        direct.Convert();
+    }
+    cdb.Write("LookupTable", 1);
+    ConversionHelperT<int16, float32> test(&input[0], &output[0]);
+    test.SetNumberOfElements(8u);
+    test.SetNumberOfSamples(1u);
+    test.LoadGain(cdb);
+    test.LoadOffset(cdb);
+    if (ok) {
+        ok = test.SelectKernel(cdb);
+    }
+    if (ok) {
+        ok = (test.GetKernel() == ConversionHelperKernelLookupTable);
+    }
+    if (ok) {
+        test.Convert();
+        uint32 i;
+        for (i = 0u; (i < 8u) && (ok); i++) {
+            ok = (output[i] == expected[i]);
+        }
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestSelectKernel_LookupTable_Saturate() {
+    using namespace MARTe;
+    int8 input[4] = { -128, -1, 0, 127 };
+    uint8 output[4];
+    ConfigurationDatabase cdb;
+    cdb.Write("Gain", 2);
+    cdb.Write("Saturate", 1);
+    cdb.Write("LookupTable", 1);
+    ConversionHelperT<int8, uint8> test(&input[0], &output[0]);
+    test.SetNumberOfElements(4u);
+    test.SetNumberOfSamples(1u);
+    test.LoadGain(cdb);
+    test.LoadOffset(cdb);
+    bool ok = test.SelectKernel(cdb);
+    if (ok) {
+        ok = (test.GetKernel() == ConversionHelperKernelLookupTable);
+    }
+    if (ok) {
+        test.Convert();
+        ok = (output[0] == 0u);
+        ok &= (output[1] == 0u);
+        ok &= (output[2] == 0u);
+        ok &= (output[3] == 254u);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestSelectKernel_False_Saturate() {
+    using namespace MARTe;
+    ConversionHelperT<float64, float32> test(NULL, NULL);
+    ConfigurationDatabase cdb;
+    cdb.Write("Saturate", 1);
+    return !test.SelectKernel(cdb);
+}
+
+bool ConversionHelperTTest::TestSelectKernel_False_LookupTable() {
+    using namespace MARTe;
+    ConversionHelperT<uint32, float32> test(NULL, NULL);
+    ConfigurationDatabase cdb;
+    cdb.Write("LookupTable", 1);
+    return !test.SelectKernel(cdb);
+}
+
+bool ConversionHelperTTest::TestGetKernel() {
+    using namespace MARTe;
+    ConversionHelperT<uint32, float32> test(NULL, NULL);
+    bool ok = (test.GetKernel() == ConversionHelperKernelDirect);
+    ConfigurationDatabase cdb;
+    if (ok) {
+        ok = test.SelectKernel(cdb);
+    }
+    if (ok) {
+        ok = (test.GetKernel() == ConversionHelperKernelDirect);
+    }
+    return ok;
+}
@@ -86,6 +86,51 @@ public:
      */
     bool TestGetOutputMemory();
 
+    /**
+     * @brief Tests the SelectKernel method with the same input and output type and without gain or offset.
+     */
+    bool TestSelectKernel_Copy();
+
+    /**
+     * @brief Tests the SelectKernel method with a gain and an offset.
+     */
+    bool TestSelectKernel_Direct();
+
+    /**
+     * @brief Tests the SelectKernel method with Saturate = 1.
+     */
+    bool TestSelectKernel_Saturate();
+
+    /**
+     * @brief Tests the SelectKernel method with Saturate = 1 and 64 bit output types.
+     */
+    bool TestSelectKernel_Saturate_64Bit();
+
+    /**
+     * @brief Tests the SelectKernel method with LookupTable = 1.
+     */
+    bool TestSelectKernel_LookupTable();
+
+    /**
+     * @brief Tests the SelectKernel method with LookupTable = 1 and Saturate = 1.
+     */
+    bool TestSelectKernel_LookupTable_Saturate();
+
+    /**
+     * @brief Tests that the SelectKernel method fails with Saturate = 1 and a float output type.
+     */
+    bool TestSelectKernel_False_Saturate();
+
+    /**
+     * @brief Tests that the SelectKernel method fails with LookupTable = 1 and a 32 bit input type.
+     */
+    bool TestSelectKernel_False_LookupTable();
+
+    /**
+     * @brief Tests the GetKernel method.
+     */
+    bool TestGetKernel();
+
 };
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
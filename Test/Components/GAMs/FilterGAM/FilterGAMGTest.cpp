@@ -113,6 +113,16 @@ TEST(FilterGAMGTest,TestInitialise_CheckNormalisationBeforeInitialise) {
     ASSERT_TRUE(test.TestInitialise_CheckNormalisationBeforeInitialise());
 }
 
+TEST(FilterGAMGTest,TestInitialise_ProcessingModeBlock) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_ProcessingModeBlock());
+}
+
+TEST(FilterGAMGTest,TestInitialise_WrongProcessingMode) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_WrongProcessingMode());
+}
+
 TEST(FilterGAMGTest,TestConstructor) {
     FilterGAMTest test;
     ASSERT_TRUE(test.TestConstructor());
@@ -637,6 +647,41 @@ TEST(FilterGAMGTest,TestResetOnlyWhenRequiredMemoryNotInit) {
     ASSERT_TRUE(test.TestResetOnlyWhenRequiredMemoryNotInit<float32>());
 }
 
+TEST(FilterGAMGTest,TestExecuteBlockModeFloat32) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBlockMode<float32>(3u, 10u, 5u));
+}
+
+TEST(FilterGAMGTest,TestExecuteBlockModeFloat64) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBlockMode<float64>(3u, 10u, 5u));
+}
+
+TEST(FilterGAMGTest,TestExecuteBlockModeInt32) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBlockMode<int32>(3u, 10u, 5u));
+}
+
+TEST(FilterGAMGTest,TestExecuteBlockModeInt64) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBlockMode<int64>(3u, 10u, 5u));
+}
+
+TEST(FilterGAMGTest,TestExecuteBlockModeBenchmarkFloat32) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBlockMode<float32>(64u, 1u, 10000u));
+}
+
+TEST(FilterGAMGTest,TestExecuteBlockModeBenchmarkFloat64) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBlockMode<float64>(64u, 1u, 10000u));
+}
+
+TEST(FilterGAMGTest,TestAlwaysResetIIRBlockMode) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestAlwaysResetIIRBlockMode<float32>());
+}
+
 }
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -147,6 +147,28 @@ bool FilterGAMTest::TestInitialise_NoNum() {
     return ok;
 }
 
+bool FilterGAMTest::TestInitialise_ProcessingModeBlock() {
+    using namespace MARTe;
+    FilterGAMTestHelper<float32> gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.config.Write("ProcessingMode", "Block");
+    ok &= !gam.GetBlockMode();
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.GetBlockMode();
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialise_WrongProcessingMode() {
+    using namespace MARTe;
+    FilterGAMTestHelper<float32> gam;
+    gam.SetName("Test");
+    bool ok = gam.InitialiseFilterFIR();
+    ok &= gam.config.Write("ProcessingMode", "SIMD");
+    ok &= !gam.Initialise(gam.config);
+    return ok;
+}
+
 bool FilterGAMTest::TestConstructor() {
     using namespace MARTe;
     FilterGAM gam;
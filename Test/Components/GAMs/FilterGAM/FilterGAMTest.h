@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "FilterGAMTestHelper.h"
+#include "HighResolutionTimer.h"
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
 /*---------------------------------------------------------------------------*/
@@ -98,6 +99,16 @@ public:
      */
     bool TestInitialise_CheckNormalisationBeforeInitialise();
 
+    /**
+     * @brief Tests that ProcessingMode = Block enables the block mode.
+     */
+    bool TestInitialise_ProcessingModeBlock();
+
+    /**
+     * @brief Test initialise on error
+     */
+    bool TestInitialise_WrongProcessingMode();
+
     /**
      * @brief Tests default constructor.
      * @details checks all the post conditions
@@ -515,6 +526,26 @@ public:
      */
     template<typename T>
     bool TestResetOnlyWhenRequiredMemoryNotInit();
+
+    /**
+     * @brief Tests the block mode against the per signal mode.
+     * @details Configures two GAMs with the same IIR filter and numberOfSignals signals, one with ProcessingMode = Signal and the other
+     * with ProcessingMode = Block, executes both nOfCycles times with the same inputs and reports the average time per Execute() of each mode.
+     * @return true if both GAMs produce the same output.
+     */
+    template<typename T>
+    bool TestExecuteBlockMode(const uint32 numberOfSignals,
+                              const uint32 numberOfElements,
+                              const uint32 nOfCycles);
+
+    /**
+     * @brief Tests the reset of the IIR filter in block mode with resetInEachState = true.
+     * @details The sequence tested is filter, reset filter and then filter again. The output of
+     * the filter is check against the expected values
+     * @return true if the output values are as expected.
+     */
+    template<typename T>
+    bool TestAlwaysResetIIRBlockMode();
 private:
     bool MyIsEqual(MARTe::float32 f1,
                    MARTe::float32 f2);
@@ -2031,6 +2062,145 @@ bool FilterGAMTest::TestResetOnlyWhenRequiredMemoryNotInit() {
     return ok;
 }
 
+template<typename T>
+bool FilterGAMTest::TestExecuteBlockMode(const uint32 numberOfSignals,
+                                         const uint32 numberOfElements,
+                                         const uint32 nOfCycles) {
+    using namespace MARTe;
+    FilterGAMTestHelper<T> gamSignal(numberOfElements);
+    FilterGAMTestHelper<T> gamBlock(numberOfElements);
+    gamSignal.SetName("TestSignal");
+    gamBlock.SetName("TestBlock");
+    bool ok = true;
+    T num[3] = { 1, 2, 1 };
+    T den[2] = { 1, -1 };
+    Vector<T> numVec(&num[0], 3);
+    Vector<T> denVec(&den[0], 2);
+    T auxVar = 0;
+    StreamString typeStr = gamSignal.GetTypeString(auxVar);
+    ok &= gamSignal.config.Write("Num", numVec);
+    ok &= gamSignal.config.Write("Den", denVec);
+    ok &= gamSignal.config.Write("ResetInEachState", 0);
+    ok &= gamSignal.config.Write("ProcessingMode", "Signal");
+    ok &= gamSignal.config.CreateAbsolute("InputSignals.Input0");
+    ok &= gamSignal.config.Write("Type", typeStr.Buffer());
+    ok &= gamSignal.config.MoveToRoot();
+    ok &= gamBlock.config.Write("Num", numVec);
+    ok &= gamBlock.config.Write("Den", denVec);
+    ok &= gamBlock.config.Write("ResetInEachState", 0);
+    ok &= gamBlock.config.Write("ProcessingMode", "Block");
+    ok &= gamBlock.config.CreateAbsolute("InputSignals.Input0");
+    ok &= gamBlock.config.Write("Type", typeStr.Buffer());
+    ok &= gamBlock.config.MoveToRoot();
+
+    ok &= gamSignal.Initialise(gamSignal.config);
+    ok &= gamBlock.Initialise(gamBlock.config);
+    ok &= !gamSignal.GetBlockMode();
+    ok &= gamBlock.GetBlockMode();
+    ok &= gamSignal.InitialiseConfigDataBaseSignalN(numberOfSignals);
+    ok &= gamBlock.InitialiseConfigDataBaseSignalN(numberOfSignals);
+    ok &= gamSignal.SetConfiguredDatabase(gamSignal.configSignals);
+    ok &= gamBlock.SetConfiguredDatabase(gamBlock.configSignals);
+    ok &= gamSignal.AllocateInputSignalsMemory();
+    ok &= gamSignal.AllocateOutputSignalsMemory();
+    ok &= gamBlock.AllocateInputSignalsMemory();
+    ok &= gamBlock.AllocateOutputSignalsMemory();
+    ok &= gamSignal.Setup();
+    ok &= gamBlock.Setup();
+    if (ok) {
+        ok &= gamSignal.PrepareNextState("", "A");
+        ok &= gamBlock.PrepareNextState("", "A");
+    }
+    uint64 ticksSignal = 0u;
+    uint64 ticksBlock = 0u;
+    for (uint32 n = 0u; (n < nOfCycles) && ok; n++) {
+        for (uint32 s = 0u; s < numberOfSignals; s++) {
+            T *inSignal = static_cast<T*>(gamSignal.GetInputSignalsMemory(s));
+            T *inBlock = static_cast<T*>(gamBlock.GetInputSignalsMemory(s));
+            for (uint32 i = 0u; i < numberOfElements; i++) {
+                //Small integer values which are exactly represented by all the types and keep the integrator bounded.
+                T value = static_cast<T>(static_cast<int32>((n + s + i) % 7u) - 3);
+                inSignal[i] = value;
+                inBlock[i] = value;
+            }
+        }
+        uint64 t0 = HighResolutionTimer::Counter();
+        ok &= gamSignal.Execute();
+        uint64 t1 = HighResolutionTimer::Counter();
+        ok &= gamBlock.Execute();
+        uint64 t2 = HighResolutionTimer::Counter();
+        ticksSignal += (t1 - t0);
+        ticksBlock += (t2 - t1);
+        for (uint32 s = 0u; (s < numberOfSignals) && ok; s++) {
+            T *outSignal = static_cast<T*>(gamSignal.GetOutputSignalsMemory(s));
+            T *outBlock = static_cast<T*>(gamBlock.GetOutputSignalsMemory(s));
+            for (uint32 i = 0u; (i < numberOfElements) && ok; i++) {
+                ok = MyIsEqual(outSignal[i], outBlock[i]);
+            }
+        }
+    }
+    if (ok && (nOfCycles > 0u)) {
+        float64 usSignal = (static_cast<float64>(ticksSignal) * HighResolutionTimer::Period() * 1e6) / static_cast<float64>(nOfCycles);
+        float64 usBlock = (static_cast<float64>(ticksBlock) * HighResolutionTimer::Period() * 1e6) / static_cast<float64>(nOfCycles);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "%s filter with %u signals of %u elements: Signal mode %f us/cycle, Block mode %f us/cycle",
+                            typeStr.Buffer(), numberOfSignals, numberOfElements, usSignal, usBlock);
+    }
+    return ok;
+}
+
+template<typename T>
+bool FilterGAMTest::TestAlwaysResetIIRBlockMode() {
+    using namespace MARTe;
+    FilterGAMTestHelper<T> gam;
+    gam.SetName("Test");
+    bool ok = true;
+    ok &= gam.InitialiseFilterIIR();
+    ok &= gam.config.Write("ResetInEachState", true);
+    ok &= gam.config.Write("ProcessingMode", "Block");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.InitialiseConfigDataBaseSignal2();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    ok &= gam.Setup();
+    ok &= gam.GetBlockMode();
+
+    T *gamMemoryIn0 = static_cast<T*>(gam.GetInputSignalsMemory());
+    T *gamMemoryOut0 = static_cast<T*>(gam.GetOutputSignalsMemory());
+    T *gamMemoryIn1 = static_cast<T*>(gam.GetInputSignalsMemory(1));
+    T *gamMemoryOut1 = static_cast<T*>(gam.GetOutputSignalsMemory(1));
+    //assign inputs and outputs
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        gamMemoryIn0[i] = 1.0F;
+        gamMemoryOut0[i] = 0;
+        gamMemoryIn1[i] = 2.0F;
+        gamMemoryOut1[i] = 0;
+    }
+    if (ok) {
+        ok &= gam.PrepareNextState("", "A");
+        ok &= gam.Execute();
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        T auxRef = i + 1;
+        ok &= MyIsEqual(gamMemoryOut0[i], auxRef);
+        auxRef = 2 * (i + 1);
+        ok &= MyIsEqual(gamMemoryOut1[i], auxRef);
+    }
+    if (ok) {
+        ok &= gam.PrepareNextState("A", "B");
+        ok &= gam.Execute();
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        T auxRef = i + 1;
+        ok &= MyIsEqual(gamMemoryOut0[i], auxRef);
+        auxRef = 2 * (i + 1);
+        ok &= MyIsEqual(gamMemoryOut1[i], auxRef);
+    }
+    return ok;
+}
+
 }
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
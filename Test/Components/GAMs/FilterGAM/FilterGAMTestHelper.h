@@ -70,6 +70,8 @@ public:
     bool InitialiseConfigDataBaseSignal3();
     bool InitialiseConfigDataBaseSignal4();
 
+    bool InitialiseConfigDataBaseSignalN(MARTe::uint32 numberOfSignals);
+
     MARTe::uint32 numberOfElements;
     MARTe::uint32 numberOfSamples;
     MARTe::uint32 byteSize;
@@ -498,6 +500,77 @@ bool FilterGAMTestHelper<T>::InitialiseConfigDataBaseSignal4() {
     return ok;
 }
 template<typename T>
+bool FilterGAMTestHelper<T>::InitialiseConfigDataBaseSignalN(MARTe::uint32 numberOfSignals) {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 totalByteSize = byteSize * numberOfSignals;
+    T auxVar = 0;
+    StreamString typeString = GetTypeString(auxVar);
+    uint32 outputNumberOfElements = numberOfElements;
+    if (numberOfSamples > numberOfElements) {
+        outputNumberOfElements = numberOfSamples;
+    }
+    ok &= configSignals.CreateAbsolute("Signals.InputSignals");
+    for (uint32 i = 0u; i < numberOfSignals; i++) {
+        StreamString idx;
+        StreamString name;
+        (void) idx.Printf("%u", i);
+        (void) name.Printf("InputSignal%u", i);
+        ok &= configSignals.CreateRelative(idx.Buffer());
+        ok &= configSignals.Write("QualifiedName", name.Buffer());
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.Write("Type", typeString.Buffer());
+        ok &= configSignals.Write("NumberOfDimensions", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
+        ok &= configSignals.Write("ByteSize", byteSize);
+        ok &= configSignals.MoveToAncestor(1u);
+    }
+    ok &= configSignals.Write("ByteSize", totalByteSize);
+
+    ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
+    for (uint32 i = 0u; i < numberOfSignals; i++) {
+        StreamString idx;
+        StreamString name;
+        (void) idx.Printf("%u", i);
+        (void) name.Printf("OutputSignal%u", i);
+        ok &= configSignals.CreateRelative(idx.Buffer());
+        ok &= configSignals.Write("QualifiedName", name.Buffer());
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.Write("Type", typeString.Buffer());
+        ok &= configSignals.Write("NumberOfDimensions", 1);
+        ok &= configSignals.Write("NumberOfElements", outputNumberOfElements);
+        ok &= configSignals.Write("ByteSize", byteSize);
+        ok &= configSignals.MoveToAncestor(1u);
+    }
+    ok &= configSignals.Write("ByteSize", totalByteSize);
+
+    ok &= configSignals.CreateAbsolute("Memory.InputSignals.0");
+    ok &= configSignals.Write("DataSource", "TestDataSource");
+    ok &= configSignals.CreateRelative("Signals");
+    for (uint32 i = 0u; i < numberOfSignals; i++) {
+        StreamString idx;
+        (void) idx.Printf("%u", i);
+        ok &= configSignals.CreateRelative(idx.Buffer());
+        ok &= configSignals.Write("Samples", numberOfSamples);
+        ok &= configSignals.MoveToAncestor(1u);
+    }
+
+    ok &= configSignals.CreateAbsolute("Memory.OutputSignals.0");
+    ok &= configSignals.Write("DataSource", "TestDataSource");
+    ok &= configSignals.CreateRelative("Signals");
+    for (uint32 i = 0u; i < numberOfSignals; i++) {
+        StreamString idx;
+        (void) idx.Printf("%u", i);
+        ok &= configSignals.CreateRelative(idx.Buffer());
+        //The Filter GAM only support numberOfSamples 1 and numberOfElements>=1
+        ok &= configSignals.Write("Samples", 1);
+        ok &= configSignals.MoveToAncestor(1u);
+    }
+
+    ok &= configSignals.MoveToRoot();
+    return ok;
+}
+template<typename T>
 StreamString FilterGAMTestHelper<T>::GetTypeString(float32 var) {
     StreamString aux = "float32";
     return aux;
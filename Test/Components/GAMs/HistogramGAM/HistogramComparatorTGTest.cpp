@@ -192,3 +192,88 @@ TEST(HistogramComparatorTGTest,TestGetNumberOfBins) {
     HistogramComparatorTTest<uint8> test;
     ASSERT_TRUE(test.TestGetNumberOfBins());
 }
+
+TEST(HistogramComparatorTGTest,TestSetEdges_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestSetEdges());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestSetEdges());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_F32) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestSetEdges());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestSetEdges());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_False_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestSetEdges_False());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_False_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestSetEdges_False());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_False_F32) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestSetEdges_False());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_False_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestSetEdges_False());
+}
+
+TEST(HistogramComparatorTGTest,TestGetNumberOfEdges_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestGetNumberOfEdges());
+}
+
+TEST(HistogramComparatorTGTest,TestAddOccurrences_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestAddOccurrences());
+}
+
+TEST(HistogramComparatorTGTest,TestAddOccurrences_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestAddOccurrences());
+}
+
+TEST(HistogramComparatorTGTest,TestAddOccurrences_F32) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestAddOccurrences());
+}
+
+TEST(HistogramComparatorTGTest,TestAddOccurrences_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestAddOccurrences());
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_AllValues_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestInRange_AllValues());
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_AllValues_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestInRange_AllValues());
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_AllValues_F32) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestInRange_AllValues());
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_AllValues_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestInRange_AllValues());
+}
@@ -85,6 +85,31 @@ public:
                      T value,
                      uint32 expected);
 
+    /**
+     * @brief Tests that the HistogramComparatorT::SetEdges method and the InRange method with non-uniform bins.
+     */
+    bool TestSetEdges();
+
+    /**
+     * @brief Tests that the HistogramComparatorT::SetEdges method fails with non increasing edges.
+     */
+    bool TestSetEdges_False();
+
+    /**
+     * @brief Tests the HistogramComparatorT::GetNumberOfEdges method
+     */
+    bool TestGetNumberOfEdges();
+
+    /**
+     * @brief Tests the HistogramComparatorT::AddOccurrences method
+     */
+    bool TestAddOccurrences();
+
+    /**
+     * @brief Tests that the HistogramComparatorT::InRange returns the same bin as the linear scan of the bin bounds.
+     */
+    bool TestInRange_AllValues();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -140,5 +165,103 @@ bool HistogramComparatorTTest<T>::TestInRange(T min,
 
 }
 
+template<typename T>
+bool HistogramComparatorTTest<T>::TestSetEdges() {
+    HistogramComparatorT<T> test;
+    T edges[] = { 1, 2, 5, 10 };
+    test.SetNumberOfBins(5u);
+    bool ret = test.SetEdges((void*) edges, 4u);
+    T values[] = { 0, 1, 2, 4, 5, 9, 10, 100 };
+    uint32 expected[] = { 0u, 1u, 2u, 2u, 3u, 3u, 4u, 4u };
+    for (uint32 i = 0u; (i < 8u) && (ret); i++) {
+        ret = (test.InRange((void*) &values[i]) == expected[i]);
+    }
+    return ret;
+}
+
+template<typename T>
+bool HistogramComparatorTTest<T>::TestSetEdges_False() {
+    HistogramComparatorT<T> test;
+    T edges[] = { 1, 2, 2, 10 };
+    bool ret = !test.SetEdges((void*) edges, 4u);
+    if (ret) {
+        ret = !test.SetEdges((void*) edges, 1u);
+    }
+    if (ret) {
+        ret = (test.GetNumberOfEdges() == 0u);
+    }
+    return ret;
+}
+
+template<typename T>
+bool HistogramComparatorTTest<T>::TestGetNumberOfEdges() {
+    HistogramComparatorT<T> test;
+    T edges[] = { 1, 2, 5, 10 };
+    bool ret = (test.GetNumberOfEdges() == 0u);
+    if (ret) {
+        ret = test.SetEdges((void*) edges, 4u);
+    }
+    if (ret) {
+        ret = (test.GetNumberOfEdges() == 4u);
+    }
+    return ret;
+}
+
+template<typename T>
+bool HistogramComparatorTTest<T>::TestAddOccurrences() {
+    HistogramComparatorT<T> test;
+    T min = 10;
+    T max = 100;
+    test.SetMin((void*) &min);
+    test.SetMax((void*) &max);
+    test.SetNumberOfBins(11u);
+    T values[] = { 1, 10, 19, 20, 50, 99, 100, 120 };
+    uint32 histogram[11];
+    for (uint32 i = 0u; i < 11u; i++) {
+        histogram[i] = 0u;
+    }
+    test.AddOccurrences((void*) values, 8u, histogram);
+    uint32 expected[] = { 1u, 2u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 1u, 2u };
+    bool ret = true;
+    for (uint32 i = 0u; (i < 11u) && (ret); i++) {
+        ret = (histogram[i] == expected[i]);
+    }
+    return ret;
+}
+
+template<typename T>
+bool HistogramComparatorTTest<T>::TestInRange_AllValues() {
+    bool ret = true;
+    for (uint32 nBins = 3u; (nBins < 20u) && (ret); nBins++) {
+        HistogramComparatorT<T> test;
+        T min = 3;
+        T max = 100;
+        test.SetMin((void*) &min);
+        test.SetMax((void*) &max);
+        test.SetNumberOfBins(nBins);
+        T delta = static_cast<T>((max - min) / static_cast<T>(nBins - 2u));
+        for (uint32 v = 0u; (v < 110u) && (ret); v++) {
+            T value = static_cast<T>(v);
+            uint32 expected = (nBins - 2u);
+            if (value < min) {
+                expected = 0u;
+            }
+            else if (value >= max) {
+                expected = (nBins - 1u);
+            }
+            else {
+                for (uint32 i = 0u; i < (nBins - 2u); i++) {
+                    if ((value >= (min + static_cast<T>(i * delta))) && (value < (min + static_cast<T>((i + 1u) * delta)))) {
+                        expected = (i + 1u);
+                        break;
+                    }
+                }
+            }
+            ret = (test.InRange((void*) &value) == expected);
+        }
+    }
+    return ret;
+}
+
 #endif /* HISTOGRAM_COMPARATORTTEST_H_ */
 
@@ -119,4 +119,37 @@ TEST(HistogramGAMGTest,TestPrepareNextState_Reset_State) {
     ASSERT_TRUE(test.TestPrepareNextState_Reset_State());
 }
 
+TEST(HistogramGAMGTest,TestInitialise_False_MultiSample) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MultiSample());
+}
+
+TEST(HistogramGAMGTest,TestSetup_False_BadEdges) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_BadEdges());
+}
 
+TEST(HistogramGAMGTest,TestSetup_False_EdgesNumberOfElements) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_EdgesNumberOfElements());
+}
+
+TEST(HistogramGAMGTest,TestExecute_MultiSample) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_MultiSample());
+}
+
+TEST(HistogramGAMGTest,TestExecute_Edges) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Edges());
+}
+
+TEST(HistogramGAMGTest,TestExecute_Snapshot) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Snapshot());
+}
+
+TEST(HistogramGAMGTest,TestExecute_Snapshot_ReaderBusy) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Snapshot_ReaderBusy());
+}
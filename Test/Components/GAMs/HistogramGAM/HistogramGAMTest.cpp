@@ -67,6 +67,10 @@ HistogramGAMTestGAM    ();
 
     void *GetOutputSignalsMemory();
 
+    bool LockSnapshot();
+
+    void UnLockSnapshot();
+
 };
 
 HistogramGAMTestGAM::HistogramGAMTestGAM() {
@@ -97,6 +101,14 @@ void *HistogramGAMTestGAM::GetOutputSignalsMemory() {
     return GAM::GetOutputSignalsMemory();
 }
 
+bool HistogramGAMTestGAM::LockSnapshot() {
+    return (snapshotMux.FastLock() == ErrorManagement::NoError);
+}
+
+void HistogramGAMTestGAM::UnLockSnapshot() {
+    snapshotMux.FastUnLock();
+}
+
 CLASS_REGISTER(HistogramGAMTestGAM, "1.0")
 
 class HistogramGAMTestDS: public MemoryDataSourceI {
@@ -235,6 +247,63 @@ static bool InitialiseMemoryMapInputBrokerEnviroment(const char8 * const config)
     return ok;
 }
 
+/**
+ * Helper function to setup a MARTe execution environment with a single HistogramGAM.
+ */
+static bool InitialiseHistogramGAMEnviroment(const char8 * const gamParameters,
+                                             const char8 * const inputSignals,
+                                             const char8 * const outputSignals) {
+    StreamString config = ""
+            "$Application = {"
+            "   Class = RealTimeApplication"
+            "   +Functions = {"
+            "       Class = ReferenceContainer"
+            "       +GAM1 = {"
+            "           Class = HistogramGAMTestGAM";
+    config += gamParameters;
+    config += "         InputSignals = {";
+    config += inputSignals;
+    config += "         }"
+            "           OutputSignals = {";
+    config += outputSignals;
+    config += "         }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Input = {"
+            "            Class = HistogramGAMTestDS"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Idle = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    CPUs = 2"
+            "                    Functions = { GAM1 }"
+            "                }"
+            "            }"
+            "         }"
+            "     }"
+            "     +Scheduler = {"
+            "         Class = GAMScheduler"
+            "         TimingDataSource = Timings"
+            "     }"
+            "}";
+    return InitialiseMemoryMapInputBrokerEnviroment(config.Buffer());
+}
+
 HistogramGAMTest::HistogramGAMTest() {
 
 }
@@ -3686,3 +3755,303 @@ bool HistogramGAMTest::TestPrepareNextState_Reset_State() {
     god->Purge();
     return ret;
 }
+
+bool HistogramGAMTest::TestInitialise_False_MultiSample() {
+    ConfigurationDatabase cdb;
+    uint32 x = 2u;
+    cdb.Write("MultiSample", x);
+
+    HistogramGAMTestGAM test;
+
+    return !test.Initialise(cdb);
+}
+
+bool HistogramGAMTest::TestSetup_False_BadEdges() {
+    const char8 *inputSignals = ""
+            "                 Source_F32 = {"
+            "                     DataSource = Input"
+            "                     Frequency = 1"
+            "                     Edges = {1.0 1.0 5.0 10.0}"
+            "                     Type = float32"
+            "                 }";
+    const char8 *outputSignals = ""
+            "                 Statistics_F32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 5"
+            "                 }";
+    bool ret = !InitialiseHistogramGAMEnviroment("", inputSignals, outputSignals);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestSetup_False_EdgesNumberOfElements() {
+    const char8 *inputSignals = ""
+            "                 Source_F32 = {"
+            "                     DataSource = Input"
+            "                     Frequency = 1"
+            "                     Edges = {1.0 2.0 5.0 10.0}"
+            "                     Type = float32"
+            "                 }";
+    const char8 *outputSignals = ""
+            "                 Statistics_F32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 6"
+            "                 }";
+    bool ret = !InitialiseHistogramGAMEnviroment("", inputSignals, outputSignals);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestExecute_MultiSample() {
+    const char8 *inputSignals = ""
+            "                 Source_U32 = {"
+            "                     DataSource = Input"
+            "                     Frequency = 1"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
+            "                     Type = uint32"
+            "                 }"
+            "                 Source_F32 = {"
+            "                     DataSource = Input"
+            "                     MaxLim = 8"
+            "                     MinLim = 0"
+            "                     Type = float32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 4"
+            "                     Samples = 2"
+            "                 }";
+    const char8 *outputSignals = ""
+            "                 Statistics_U32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 6"
+            "                 }"
+            "                 Statistics_F32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 6"
+            "                 }";
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseHistogramGAMEnviroment("             MultiSample = 1", inputSignals, outputSignals);
+    ReferenceT<HistogramGAMTestGAM> gam;
+    if (ret) {
+        gam = god->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        uint32 *inMemU32 = (uint32*) gam->GetInputSignalsMemory();
+        float32 *inMemF32 = (float32*) (inMemU32 + 1);
+        float32 values[] = { -1.0, 0.0, 1.5, 2.0, 7.9, 8.0, 3.0, 5.0 };
+        *inMemU32 = 5u;
+        for (uint32 i = 0u; i < 8u; i++) {
+            inMemF32[i] = values[i];
+        }
+        ret = gam->Execute();
+        if (ret) {
+            ret = gam->Execute();
+        }
+    }
+    if (ret) {
+        uint32 *outMemU32 = (uint32*) gam->GetOutputSignalsMemory();
+        uint32 *outMemF32 = (outMemU32 + 6);
+        uint32 expectedU32[] = { 0u, 0u, 0u, 2u, 0u, 0u };
+        uint32 expectedF32[] = { 2u, 4u, 4u, 2u, 2u, 2u };
+        for (uint32 i = 0u; (i < 6u) && (ret); i++) {
+            ret = (outMemU32[i] == expectedU32[i]);
+            if (ret) {
+                ret = (outMemF32[i] == expectedF32[i]);
+            }
+        }
+    }
+    god->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestExecute_Edges() {
+    const char8 *inputSignals = ""
+            "                 Source_F64 = {"
+            "                     DataSource = Input"
+            "                     Frequency = 1"
+            "                     Edges = {0.0 1.0 10.0 100.0}"
+            "                     Type = float64"
+            "                 }";
+    const char8 *outputSignals = ""
+            "                 Statistics_F64 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 5"
+            "                 }";
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseHistogramGAMEnviroment("", inputSignals, outputSignals);
+    ReferenceT<HistogramGAMTestGAM> gam;
+    if (ret) {
+        gam = god->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = (gam->GetComps()[0]->GetNumberOfEdges() == 4u);
+    }
+    if (ret) {
+        float64 *inMem = (float64*) gam->GetInputSignalsMemory();
+        float64 values[] = { -1.0, 0.0, 0.5, 1.0, 9.99, 10.0, 99.0, 100.0, 1000.0 };
+        for (uint32 i = 0u; (i < 9u) && (ret); i++) {
+            *inMem = values[i];
+            ret = gam->Execute();
+        }
+    }
+    if (ret) {
+        uint32 *outMem = (uint32*) gam->GetOutputSignalsMemory();
+        uint32 expected[] = { 1u, 2u, 2u, 2u, 2u };
+        for (uint32 i = 0u; (i < 5u) && (ret); i++) {
+            ret = (outMem[i] == expected[i]);
+        }
+    }
+    god->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestExecute_Snapshot() {
+    const char8 *inputSignals = ""
+            "                 Source_U32 = {"
+            "                     DataSource = Input"
+            "                     Frequency = 1"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
+            "                     Type = uint32"
+            "                 }";
+    const char8 *outputSignals = ""
+            "                 Statistics_U32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }";
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseHistogramGAMEnviroment("", inputSignals, outputSignals);
+    ReferenceT<HistogramGAMTestGAM> gam;
+    if (ret) {
+        gam = god->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+    uint32 snapshot[12];
+    if (ret) {
+        uint32 *inMem = (uint32*) gam->GetInputSignalsMemory();
+        *inMem = 5u;
+        for (uint32 i = 0u; (i < 3u) && (ret); i++) {
+            ret = gam->Execute();
+        }
+    }
+    if (ret) {
+        ret = (!gam->IsSnapshotPending());
+    }
+    if (ret) {
+        gam->RequestSnapshot();
+        ret = (gam->IsSnapshotPending());
+    }
+    if (ret) {
+        ret = (gam->GetSnapshotCounter() == 0u);
+    }
+    if (ret) {
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (!gam->IsSnapshotPending());
+    }
+    if (ret) {
+        ret = (gam->GetSnapshotCounter() == 1u);
+    }
+    //The accumulation continues after the snapshot
+    for (uint32 i = 0u; (i < 2u) && (ret); i++) {
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = gam->GetSnapshot(0u, &snapshot[0], 12u);
+    }
+    if (ret) {
+        uint32 *outMem = (uint32*) gam->GetOutputSignalsMemory();
+        ret = (outMem[6] == 6u);
+        for (uint32 i = 0u; (i < 12u) && (ret); i++) {
+            if (i == 6u) {
+                ret = (snapshot[i] == 4u);
+            }
+            else {
+                ret = (snapshot[i] == 0u);
+            }
+        }
+    }
+    if (ret) {
+        ret = !gam->GetSnapshot(1u, &snapshot[0], 12u);
+    }
+    if (ret) {
+        ret = !gam->GetSnapshot(0u, &snapshot[0], 11u);
+    }
+    god->Purge();
+    return ret;
+}
+
+bool HistogramGAMTest::TestExecute_Snapshot_ReaderBusy() {
+    const char8 *inputSignals = ""
+            "                 Source_U32 = {"
+            "                     DataSource = Input"
+            "                     Frequency = 1"
+            "                     MaxLim = 10"
+            "                     MinLim = 0"
+            "                     Type = uint32"
+            "                 }";
+    const char8 *outputSignals = ""
+            "                 Statistics_U32 = {"
+            "                     DataSource = DDB1"
+            "                     Type = uint32"
+            "                     NumberOfDimensions = 1"
+            "                     NumberOfElements = 12"
+            "                 }";
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    bool ret = InitialiseHistogramGAMEnviroment("", inputSignals, outputSignals);
+    ReferenceT<HistogramGAMTestGAM> gam;
+    if (ret) {
+        gam = god->Find("Application.Functions.GAM1");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        uint32 *inMem = (uint32*) gam->GetInputSignalsMemory();
+        *inMem = 5u;
+        gam->RequestSnapshot();
+        //A reader is copying the snapshot: the Execute does not wait and keeps the snapshot pending
+        ret = gam->LockSnapshot();
+    }
+    if (ret) {
+        ret = gam->Execute();
+        gam->UnLockSnapshot();
+    }
+    if (ret) {
+        ret = (gam->IsSnapshotPending());
+    }
+    if (ret) {
+        ret = (gam->GetSnapshotCounter() == 0u);
+    }
+    if (ret) {
+        ret = gam->Execute();
+    }
+    if (ret) {
+        ret = (!gam->IsSnapshotPending());
+    }
+    if (ret) {
+        ret = (gam->GetSnapshotCounter() == 1u);
+    }
+    uint32 snapshot[12];
+    if (ret) {
+        ret = gam->GetSnapshot(0u, &snapshot[0], 12u);
+    }
+    if (ret) {
+        ret = (snapshot[6] == 2u);
+    }
+    god->Purge();
+    return ret;
+}
@@ -136,6 +136,41 @@ public:
      */
     bool TestPrepareNextState_Reset_State();
 
+    /**
+     * @brief Tests that the Initialise fails if MultiSample is not 0 or 1.
+     */
+    bool TestInitialise_False_MultiSample();
+
+    /**
+     * @brief Tests that the Setup fails if the Edges are not strictly increasing.
+     */
+    bool TestSetup_False_BadEdges();
+
+    /**
+     * @brief Tests that the Setup fails if the number of elements of the output signal is not the number of Edges + 1.
+     */
+    bool TestSetup_False_EdgesNumberOfElements();
+
+    /**
+     * @brief Tests the Execute method with MultiSample = 1 and an input signal with many elements and samples.
+     */
+    bool TestExecute_MultiSample();
+
+    /**
+     * @brief Tests the Execute method with non-uniform bins (Edges).
+     */
+    bool TestExecute_Edges();
+
+    /**
+     * @brief Tests the RequestSnapshot, IsSnapshotPending, GetSnapshotCounter and GetSnapshot methods.
+     */
+    bool TestExecute_Snapshot();
+
+    /**
+     * @brief Tests that the Execute method does not wait for a GetSnapshot and takes the snapshot in the next cycle.
+     */
+    bool TestExecute_Snapshot_ReaderBusy();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -107,3 +107,33 @@ TEST(Interleaved2FlatGAMGTest,TestExecute_MultiPacketNoSamples) {
     Interleaved2FlatGAMTest test;
     ASSERT_TRUE(test.TestExecute_MultiPacketNoSamples());
 }
+
+TEST(Interleaved2FlatGAMGTest,TestSetup_TransferPlan) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestSetup_TransferPlan());
+}
+
+TEST(Interleaved2FlatGAMGTest,TestSetup_TransferPlan_SingleSample) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestSetup_TransferPlan_SingleSample());
+}
+
+TEST(Interleaved2FlatGAMGTest,TestSetup_Workers) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestSetup_Workers());
+}
+
+TEST(Interleaved2FlatGAMGTest,TestExecute_Workers) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Workers());
+}
+
+TEST(Interleaved2FlatGAMGTest,TestExecute_Workers_Timeout) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Workers_Timeout());
+}
+
+TEST(Interleaved2FlatGAMGTest,TestExecute_Benchmark) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Benchmark());
+}
@@ -32,11 +32,13 @@
 #include "ConfigurationDatabase.h"
 #include "DataSourceI.h"
 #include "GAMSchedulerI.h"
+#include "HighResolutionTimer.h"
 #include "Interleaved2FlatGAMTest.h"
 #include "MemoryMapInputBroker.h"
 #include "MemoryMapOutputBroker.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
+#include "Sleep.h"
 #include "StandardParser.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -76,10 +78,31 @@ Interleaved2FlatGAMTestGAM    ();
     void *GetInputSignalsMemory1();
 
     void *GetOutputSignalsMemory1();
+
+    Interleaved2FlatGAMTransfer *GetTransfers();
+
+    uint32 GetNumberOfTransfers();
+
+    uint32 *GetPartitionStart();
+
+    uint32 GetNumberOfPartitions();
+
+    using Interleaved2FlatGAM::Execute;
+
+    /**
+     * @brief Keeps the workers idle (i.e. they do not wait for a new cycle) while SetWorkersStalled(true).
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    void SetWorkersStalled(const bool stalled);
+
+private:
+
+    volatile int32 workersStalled;
 };
 
 Interleaved2FlatGAMTestGAM::Interleaved2FlatGAMTestGAM() {
-
+    workersStalled = 0;
 }
 
 Interleaved2FlatGAMTestGAM::~Interleaved2FlatGAMTestGAM() {
@@ -130,6 +153,37 @@ void *Interleaved2FlatGAMTestGAM::GetOutputSignalsMemory1() {
     return GAM::GetOutputSignalsMemory();
 }
 
+Interleaved2FlatGAMTransfer *Interleaved2FlatGAMTestGAM::GetTransfers() {
+    return transfers;
+}
+
+uint32 Interleaved2FlatGAMTestGAM::GetNumberOfTransfers() {
+    return numberOfTransfers;
+}
+
+uint32 *Interleaved2FlatGAMTestGAM::GetPartitionStart() {
+    return partitionStart;
+}
+
+uint32 Interleaved2FlatGAMTestGAM::GetNumberOfPartitions() {
+    return numberOfPartitions;
+}
+
+ErrorManagement::ErrorType Interleaved2FlatGAMTestGAM::Execute(ExecutionInfo &info) {
+    ErrorManagement::ErrorType err;
+    if (workersStalled != 0) {
+        Sleep::MSec(1u);
+    }
+    else {
+        err = Interleaved2FlatGAM::Execute(info);
+    }
+    return err;
+}
+
+void Interleaved2FlatGAMTestGAM::SetWorkersStalled(const bool stalled) {
+    workersStalled = stalled ? 1 : 0;
+}
+
 CLASS_REGISTER(Interleaved2FlatGAMTestGAM, "1.0")
 
 /**
@@ -985,6 +1039,102 @@ static bool InitialiseMemoryMapInputBrokerEnviroment(const char8 * const config)
     return ok;
 }
 
+/**
+ * @brief Builds a configuration where an interleaved packet of four uint16 channels is split into four flat signals.
+ */
+static void BuildChannelsConfig(StreamString &cfg,
+                                const uint32 numberOfSamples,
+                                const uint32 numberOfWorkers,
+                                const uint32 workerThreshold,
+                                const uint32 workerTimeout = 1000000u) {
+    cfg = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = Interleaved2FlatGAMTestGAM";
+    (void) cfg.Printf("            NumberOfWorkers = %u", numberOfWorkers);
+    (void) cfg.Printf("            WorkerThreshold = %u", workerThreshold);
+    (void) cfg.Printf("            WorkerTimeout = %u", workerTimeout);
+    cfg += ""
+            "            InputSignals = {"
+            "               Signal = {"
+            "                   DataSource = DDB1"
+            "                   Type = uint16"
+            "                   NumberOfDimensions = 1";
+    //GAMDataSource signals have one sample, the packets are given by the NumberOfElements
+    (void) cfg.Printf("                   NumberOfElements = %u", (numberOfSamples * 4u));
+    cfg += ""
+            "                   PacketMemberSizes = {2, 2, 2, 2}"
+            "               }"
+            "            }"
+            "            OutputSignals = {";
+    for (uint32 c = 0u; c < 4u; c++) {
+        (void) cfg.Printf("               Channel%u = {", c);
+        cfg += ""
+                "                   DataSource = DDB1"
+                "                   Type = uint16"
+                "                   NumberOfDimensions = 1";
+        (void) cfg.Printf("                   NumberOfElements = %u", numberOfSamples);
+        cfg += "               }";
+    }
+    cfg += ""
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "            AllowNoProducers = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        TimingDataSource = Timings"
+            "        Class = GAMScheduler"
+            "    }"
+            "}";
+}
+
+/**
+ * @brief Fills the interleaved input with a known pattern, executes the GAM and checks the flat output.
+ */
+static bool ExecuteChannels(ReferenceT<Interleaved2FlatGAMTestGAM> gam,
+                            const uint32 numberOfSamples,
+                            const uint16 seed) {
+    uint16 *input = reinterpret_cast<uint16 *>(gam->GetInputSignalsMemory1());
+    for (uint32 k = 0u; k < numberOfSamples; k++) {
+        for (uint32 c = 0u; c < 4u; c++) {
+            input[(k * 4u) + c] = static_cast<uint16>(((k * 4u) + c) + seed);
+        }
+    }
+    bool ret = gam->Execute();
+    const uint16 *output = reinterpret_cast<uint16 *>(gam->GetOutputSignalsMemory1());
+    for (uint32 c = 0u; (c < 4u) && (ret); c++) {
+        for (uint32 k = 0u; (k < numberOfSamples) && (ret); k++) {
+            ret = (output[(c * numberOfSamples) + k] == static_cast<uint16>(((k * 4u) + c) + seed));
+        }
+    }
+    return ret;
+}
+
 Interleaved2FlatGAMTest::Interleaved2FlatGAMTest() {
 }
 
@@ -2994,3 +3144,166 @@ bool Interleaved2FlatGAMTest::TestExecute_MultiPacketNoSamples() {
     }
     return ret;
 }
+
+bool Interleaved2FlatGAMTest::TestSetup_TransferPlan() {
+    StreamString cfg;
+    BuildChannelsConfig(cfg, 3u, 0u, 1024u);
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(cfg.Buffer());
+    ReferenceT<Interleaved2FlatGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = (gam->GetNumberOfTransfers() == 4u);
+        ret &= (gam->GetNumberOfPartitions() == 1u);
+    }
+    Interleaved2FlatGAMTransfer *transfers = NULL_PTR(Interleaved2FlatGAMTransfer *);
+    if (ret) {
+        transfers = gam->GetTransfers();
+    }
+    for (uint32 c = 0u; (c < 4u) && (ret); c++) {
+        ret = (transfers[c].sourceOffset == (2u * c));
+        ret &= (transfers[c].destinationOffset == (6u * c));
+        ret &= (transfers[c].size == 2u);
+        ret &= (transfers[c].count == 3u);
+        ret &= (transfers[c].sourceStride == 8u);
+        ret &= (transfers[c].destinationStride == 2u);
+    }
+    if (ret) {
+        ret = ExecuteChannels(gam, 3u, 0u);
+    }
+    return ret;
+}
+
+bool Interleaved2FlatGAMTest::TestSetup_TransferPlan_SingleSample() {
+    StreamString cfg;
+    BuildChannelsConfig(cfg, 1u, 0u, 1024u);
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(cfg.Buffer());
+    ReferenceT<Interleaved2FlatGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = (gam->GetNumberOfTransfers() == 1u);
+    }
+    if (ret) {
+        Interleaved2FlatGAMTransfer *transfers = gam->GetTransfers();
+        ret = (transfers[0u].sourceOffset == 0u);
+        ret &= (transfers[0u].destinationOffset == 0u);
+        ret &= (transfers[0u].size == 8u);
+        ret &= (transfers[0u].count == 1u);
+    }
+    if (ret) {
+        ret = ExecuteChannels(gam, 1u, 0u);
+    }
+    return ret;
+}
+
+bool Interleaved2FlatGAMTest::TestSetup_Workers() {
+    const uint32 numberOfSamples = 1000u;
+    StreamString cfg;
+    BuildChannelsConfig(cfg, numberOfSamples, 2u, 1024u);
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(cfg.Buffer());
+    ReferenceT<Interleaved2FlatGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = (gam->GetNumberOfPartitions() == 3u);
+    }
+    //each partition shall copy (almost) one third of the bytes
+    uint32 *partitionStart = NULL_PTR(uint32 *);
+    Interleaved2FlatGAMTransfer *transfers = NULL_PTR(Interleaved2FlatGAMTransfer *);
+    if (ret) {
+        partitionStart = gam->GetPartitionStart();
+        transfers = gam->GetTransfers();
+        ret = (partitionStart[3u] == gam->GetNumberOfTransfers());
+    }
+    const uint32 share = ((numberOfSamples * 8u) + 2u) / 3u;
+    for (uint32 p = 0u; (p < 3u) && (ret); p++) {
+        uint32 bytes = 0u;
+        for (uint32 t = partitionStart[p]; t < partitionStart[p + 1u]; t++) {
+            bytes += (transfers[t].size * transfers[t].count);
+        }
+        ret = (bytes <= (share + 2u)) && ((bytes + 2u) >= share);
+    }
+    return ret;
+}
+
+bool Interleaved2FlatGAMTest::TestExecute_Workers() {
+    const uint32 numberOfSamples = 1000u;
+    StreamString cfg;
+    BuildChannelsConfig(cfg, numberOfSamples, 2u, 1024u);
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(cfg.Buffer());
+    ReferenceT<Interleaved2FlatGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    for (uint16 i = 0u; (i < 10u) && (ret); i++) {
+        ret = ExecuteChannels(gam, numberOfSamples, i);
+    }
+    return ret;
+}
+
+bool Interleaved2FlatGAMTest::TestExecute_Workers_Timeout() {
+    const uint32 numberOfSamples = 1000u;
+    StreamString cfg;
+    BuildChannelsConfig(cfg, numberOfSamples, 2u, 1024u, 20000u);
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(cfg.Buffer());
+    ReferenceT<Interleaved2FlatGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    if (ret) {
+        ret = ExecuteChannels(gam, numberOfSamples, 0u);
+    }
+    //Wait for the workers to leave the EventSem (which has a 100 ms timeout) and to be stalled: the 20 ms timeout expires
+    if (ret) {
+        gam->SetWorkersStalled(true);
+        Sleep::MSec(200u);
+        ret = !gam->Execute();
+    }
+    //The workers are back
+    if (ret) {
+        gam->SetWorkersStalled(false);
+        Sleep::MSec(10u);
+        ret = ExecuteChannels(gam, numberOfSamples, 1u);
+    }
+    return ret;
+}
+
+bool Interleaved2FlatGAMTest::TestExecute_Benchmark() {
+    //4 MB frame
+    const uint32 numberOfSamples = 524288u;
+    const uint32 numberOfCycles = 20u;
+    bool ret = true;
+    for (uint32 numberOfWorkers = 0u; (numberOfWorkers < 3u) && (ret); numberOfWorkers += 2u) {
+        StreamString cfg;
+        BuildChannelsConfig(cfg, numberOfSamples, numberOfWorkers, 1048576u);
+        ret = InitialiseMemoryMapInputBrokerEnviroment(cfg.Buffer());
+        ReferenceT<Interleaved2FlatGAMTestGAM> gam;
+        if (ret) {
+            gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+            ret = gam.IsValid();
+        }
+        if (ret) {
+            ret = ExecuteChannels(gam, numberOfSamples, 0u);
+        }
+        if (ret) {
+            uint64 start = HighResolutionTimer::Counter();
+            for (uint32 i = 0u; (i < numberOfCycles) && (ret); i++) {
+                ret = gam->Execute();
+            }
+            float64 elapsed = static_cast<float64>(HighResolutionTimer::Counter() - start) * HighResolutionTimer::Period();
+            float64 bytes = static_cast<float64>(numberOfSamples) * 8.0 * static_cast<float64>(numberOfCycles);
+            float64 throughput = (bytes / elapsed) / 1e9;
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Interleaved2FlatGAM with %u workers: %f GB/s", numberOfWorkers, throughput);
+        }
+    }
+    return ret;
+}
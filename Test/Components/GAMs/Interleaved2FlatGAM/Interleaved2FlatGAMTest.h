@@ -121,6 +121,36 @@ public:
      */
     bool TestExecute_MultiPacketNoSamples();
 
+    /**
+     * @brief Tests that the Setup computes one strided transfer for each member of the packet.
+     */
+    bool TestSetup_TransferPlan();
+
+    /**
+     * @brief Tests that the Setup merges all the chunks in a single copy when there is only one sample.
+     */
+    bool TestSetup_TransferPlan_SingleSample();
+
+    /**
+     * @brief Tests that the Setup splits the transfer plan across the workers.
+     */
+    bool TestSetup_Workers();
+
+    /**
+     * @brief Tests the Execute method with the transfer plan split across the workers.
+     */
+    bool TestExecute_Workers();
+
+    /**
+     * @brief Tests that the Execute method returns false if the workers do not complete within the WorkerTimeout.
+     */
+    bool TestExecute_Workers_Timeout();
+
+    /**
+     * @brief Measures the throughput (in GB/s) of the Execute method for a 4 MB frame with and without workers.
+     */
+    bool TestExecute_Benchmark();
+
 };
 
 /*---------------------------------------------------------------------------*/
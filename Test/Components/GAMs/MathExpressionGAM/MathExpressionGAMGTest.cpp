@@ -114,6 +114,51 @@ TEST(MathExpressionGAMGTest,TestExecute_MultipleExpressions) {
     ASSERT_TRUE(test.TestExecute_MultipleExpressions());
 }
 
+TEST(MathExpressionGAMGTest,TestInitialise_Failed_WrongFastPath) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_Failed_WrongFastPath());
+}
+
+TEST(MathExpressionGAMGTest,TestSetup_FastPath) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FastPath());
+}
+
+TEST(MathExpressionGAMGTest,TestSetup_FastPath_Fallback) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_FastPath_Fallback());
+}
+
+TEST(MathExpressionGAMGTest,TestSetup_Failed_FastPathVectorFallback) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_Failed_FastPathVectorFallback());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_FastPath) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_FastPath());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_FastPath_Vector) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_FastPath_Vector());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_FastPath_Benchmark) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_FastPath_Benchmark());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_FastPath_SaturationInt8) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_FastPath_SaturationInt8());
+}
+
+TEST(MathExpressionGAMGTest,TestExecute_FastPath_SaturationUInt32) {
+    MathExpressionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_FastPath_SaturationUInt32());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
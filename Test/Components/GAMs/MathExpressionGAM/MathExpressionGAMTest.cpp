@@ -33,6 +33,7 @@
 
 #include "DataSourceI.h"
 #include "GAMScheduler.h"
+#include "HighResolutionTimer.h"
 #include "MathExpressionGAM.h"
 #include "MathExpressionGAMTest.h"
 #include "MathExpressionParser.h"
@@ -76,6 +77,10 @@ public:
         return evaluator;
     } 
     
+    MARTe::MathExpressionFastEvaluator* GetFastEvaluator() {
+        return fastEvaluator;
+    }
+    
 };
 CLASS_REGISTER(MathExpressionGAMHelper, "1.0");
 
@@ -188,6 +193,173 @@ static bool TestIntegratedInApplication(const MARTe::char8 * const config,
     return ok;
 }
 
+/**
+ * Builds a configuration with a MathExpressionGAMHelper with the input
+ *  signals A, B and C and the output signal Y, all of the same type and size.
+ */
+static MARTe::StreamString GetFastPathConfig(const MARTe::char8 * const expression,
+                                             const MARTe::char8 * const type,
+                                             const MARTe::uint32 fastPath,
+                                             const MARTe::uint32 nOfElements) {
+    using namespace MARTe;
+    StreamString config;
+    (void) config.Printf("%s", ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = MathExpressionGAMHelper");
+    (void) config.Printf("            Expression = \"%s\"", expression);
+    (void) config.Printf("            FastPath = %u", fastPath);
+    (void) config.Printf("%s", "            InputSignals = {");
+    const char8 * const inputNames[] = { "A", "B", "C" };
+    for (uint32 i = 0u; i < 3u; i++) {
+        (void) config.Printf("               %s = {"
+                             "                   DataSource = Drv1"
+                             "                   Type = %s"
+                             "                   NumberOfDimensions = 1"
+                             "                   NumberOfElements = %u"
+                             "               }", inputNames[i], type, nOfElements);
+    }
+    (void) config.Printf("            }"
+                         "            OutputSignals = {"
+                         "               Y = {"
+                         "                   DataSource = Drv1"
+                         "                   Type = %s"
+                         "                   NumberOfDimensions = 1"
+                         "                   NumberOfElements = %u"
+                         "               }"
+                         "            }"
+                         "        }"
+                         "    }", type, nOfElements);
+    (void) config.Printf("%s", ""
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +DDB1 = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = IOGAMDataSourceHelper"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}");
+    return config;
+}
+
+/**
+ * Runs the expression Y = A * B + C * (2.0 + 1.0) - A / B on float64 signals
+ *  and checks the result against the values computed here.
+ */
+static bool TestFastPathExpression(const MARTe::uint32 fastPath,
+                                   const MARTe::uint32 nOfElements,
+                                   const MARTe::uint32 nOfCycles,
+                                   MARTe::uint64 &elapsedTicks) {
+    using namespace MARTe;
+    StreamString config = GetFastPathConfig("Y = A * B + C * (2.0 + 1.0) - A / B;", "float64", fastPath, nOfElements);
+    bool ok = TestIntegratedInApplication(config.Buffer(), false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = (gam->IsFastPathActive() == (fastPath == 1u));
+    }
+    float64 *a = NULL_PTR(float64 *);
+    float64 *b = NULL_PTR(float64 *);
+    float64 *c = NULL_PTR(float64 *);
+    float64 *y = NULL_PTR(float64 *);
+    if (ok) {
+        a = static_cast<float64 *>(gam->GetInputSignalMemory(0u));
+        b = static_cast<float64 *>(gam->GetInputSignalMemory(1u));
+        c = static_cast<float64 *>(gam->GetInputSignalMemory(2u));
+        y = static_cast<float64 *>(gam->GetOutputSignalMemory(0u));
+        for (uint32 i = 0u; i < nOfElements; i++) {
+            a[i] = 1.5 + static_cast<float64>(i);
+            b[i] = 0.5 - static_cast<float64>(i);
+            c[i] = 2.0 * static_cast<float64>(i);
+        }
+    }
+    elapsedTicks = 0u;
+    for (uint32 n = 0u; (n < nOfCycles) && (ok); n++) {
+        uint64 start = HighResolutionTimer::Counter();
+        ok = gam->Execute();
+        elapsedTicks += (HighResolutionTimer::Counter() - start);
+    }
+    for (uint32 i = 0u; (i < nOfElements) && (ok); i++) {
+        float64 expected = a[i] * b[i] + c[i] * (2.0 + 1.0) - a[i] / b[i];
+        ok = (y[i] == expected);
+    }
+    god->Purge();
+    return ok;
+}
+
+/**
+ * Runs the expression on scalar signals with FastPath = 0 and FastPath = 1
+ *  and checks that both evaluators produce the same (saturated) result
+ *  and report the saturation in the same way.
+ */
+template<typename T>
+static bool TestFastPathSaturation(const MARTe::char8 * const expression,
+                                   const MARTe::char8 * const type,
+                                   const T a,
+                                   const T b,
+                                   const T expected) {
+    using namespace MARTe;
+    bool ok = true;
+    bool executeOk[2] = { true, true };
+    T result[2] = { 0, 0 };
+    for (uint32 fastPath = 0u; (fastPath < 2u) && (ok); fastPath++) {
+        StreamString config = GetFastPathConfig(expression, type, fastPath, 1u);
+        ok = TestIntegratedInApplication(config.Buffer(), false);
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+        if (ok) {
+            ok = gam.IsValid();
+        }
+        if (ok) {
+            ok = (gam->IsFastPathActive() == (fastPath == 1u));
+        }
+        if (ok) {
+            *static_cast<T *>(gam->GetInputSignalMemory(0u)) = a;
+            *static_cast<T *>(gam->GetInputSignalMemory(1u)) = b;
+            *static_cast<T *>(gam->GetInputSignalMemory(2u)) = static_cast<T>(0);
+            executeOk[fastPath] = gam->Execute();
+            result[fastPath] = *static_cast<T *>(gam->GetOutputSignalMemory(0u));
+        }
+        god->Purge();
+    }
+    if (ok) {
+        ok = (result[0] == expected) && (result[1] == expected);
+    }
+    if (ok) {
+        ok = (executeOk[0] == executeOk[1]);
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1089,3 +1261,106 @@ bool MathExpressionGAMTest::TestExecute_MultipleExpressions() {
     god->Purge();
     return ok;
 }
+
+bool MathExpressionGAMTest::TestInitialise_Failed_WrongFastPath() {
+    StreamString config = GetFastPathConfig("Y = A + B + C;", "float64", 2u, 1u);
+    bool ok = TestIntegratedInApplication(config.Buffer());
+    return !ok;
+}
+
+bool MathExpressionGAMTest::TestSetup_FastPath() {
+    StreamString config = GetFastPathConfig("Y = A + B * (2.0 * 3.0) + C;", "float64", 1u, 1u);
+    bool ok = TestIntegratedInApplication(config.Buffer(), false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = gam->IsFastPathActive();
+    }
+    if (ok) {
+        MathExpressionFastEvaluator *fastEvaluator = gam->GetFastEvaluator();
+        ok = (fastEvaluator != NULL_PTR(MathExpressionFastEvaluator *));
+        if (ok) {
+            //2.0 * 3.0 is folded and the last addition writes directly into Y
+            ok = (fastEvaluator->GetNumberOfFoldedOperations() == 1u);
+        }
+        if (ok) {
+            ok = (fastEvaluator->GetNumberOfFusedWrites() == 1u);
+        }
+        if (ok) {
+            ok = (fastEvaluator->GetNumberOfInstructions() == 3u);
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestSetup_FastPath_Fallback() {
+    //Integer division is not supported by the fast path
+    StreamString config = GetFastPathConfig("Y = A / B + C;", "uint32", 1u, 1u);
+    bool ok = TestIntegratedInApplication(config.Buffer(), false);
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    ReferenceT<MathExpressionGAMHelper> gam = god->Find("Test.Functions.GAM1");
+    if (ok) {
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        ok = !gam->IsFastPathActive();
+    }
+    if (ok) {
+        uint32 *a = static_cast<uint32 *>(gam->GetInputSignalMemory(0u));
+        uint32 *b = static_cast<uint32 *>(gam->GetInputSignalMemory(1u));
+        uint32 *c = static_cast<uint32 *>(gam->GetInputSignalMemory(2u));
+        *a = 10u;
+        *b = 3u;
+        *c = 1u;
+        ok = gam->Execute();
+        if (ok) {
+            ok = (*static_cast<uint32 *>(gam->GetOutputSignalMemory(0u)) == 4u);
+        }
+    }
+    god->Purge();
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestSetup_Failed_FastPathVectorFallback() {
+    StreamString config = GetFastPathConfig("Y = A / B + C;", "uint32", 1u, 4u);
+    bool ok = TestIntegratedInApplication(config.Buffer());
+    return !ok;
+}
+
+bool MathExpressionGAMTest::TestExecute_FastPath() {
+    uint64 elapsedTicks;
+    return TestFastPathExpression(1u, 1u, 1u, elapsedTicks);
+}
+
+bool MathExpressionGAMTest::TestExecute_FastPath_Vector() {
+    uint64 elapsedTicks;
+    return TestFastPathExpression(1u, 16u, 1u, elapsedTicks);
+}
+
+bool MathExpressionGAMTest::TestExecute_FastPath_Benchmark() {
+    const uint32 nOfCycles = 100000u;
+    uint64 runtimeTicks = 0u;
+    uint64 fastTicks = 0u;
+    bool ok = TestFastPathExpression(0u, 1u, nOfCycles, runtimeTicks);
+    if (ok) {
+        ok = TestFastPathExpression(1u, 1u, nOfCycles, fastTicks);
+    }
+    if (ok) {
+        float64 runtimeNs = (static_cast<float64>(runtimeTicks) * HighResolutionTimer::Period() * 1e9) / static_cast<float64>(nOfCycles);
+        float64 fastNs = (static_cast<float64>(fastTicks) * HighResolutionTimer::Period() * 1e9) / static_cast<float64>(nOfCycles);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Execute() RuntimeEvaluator: %f ns, fast path: %f ns", runtimeNs, fastNs);
+    }
+    return ok;
+}
+
+bool MathExpressionGAMTest::TestExecute_FastPath_SaturationInt8() {
+    return TestFastPathSaturation<int8>("Y = A + B + C;", "int8", 100, 100, 127);
+}
+
+bool MathExpressionGAMTest::TestExecute_FastPath_SaturationUInt32() {
+    return TestFastPathSaturation<uint32>("Y = A - B + C;", "uint32", 0u, 1u, 0u);
+}
@@ -133,6 +133,64 @@ public:
      */
     bool TestExecute_MultipleExpressions();
 
+    /**
+     * @brief   Tests the Initialise method.
+     * @details This test fails since FastPath can only be 0 or 1.
+     */
+    bool TestInitialise_Failed_WrongFastPath();
+
+    /**
+     * @brief   Tests the Setup method with FastPath = 1.
+     * @details Checks that the expression is compiled with the constants
+     *          folded and the write to the output fused.
+     */
+    bool TestSetup_FastPath();
+
+    /**
+     * @brief   Tests the Setup method with FastPath = 1.
+     * @details Checks that an expression with scalar signals which cannot
+     *          be compiled falls back to the RuntimeEvaluator.
+     */
+    bool TestSetup_FastPath_Fallback();
+
+    /**
+     * @brief   Tests the Setup method with FastPath = 1.
+     * @details This test fails since an expression with vector signals
+     *          cannot fall back to the RuntimeEvaluator.
+     */
+    bool TestSetup_Failed_FastPathVectorFallback();
+
+    /**
+     * @brief Tests the Execute method with FastPath = 1.
+     */
+    bool TestExecute_FastPath();
+
+    /**
+     * @brief Tests the Execute method with FastPath = 1 and vector signals.
+     */
+    bool TestExecute_FastPath_Vector();
+
+    /**
+     * @brief   Tests the Execute method with FastPath = 0 and FastPath = 1.
+     * @details Checks that both produce the same result and reports the
+     *          average execution time of each.
+     */
+    bool TestExecute_FastPath_Benchmark();
+
+    /**
+     * @brief   Tests the Execute method with FastPath = 0 and FastPath = 1.
+     * @details Checks that the int8 addition 100 + 100 saturates to 127
+     *          with both evaluators.
+     */
+    bool TestExecute_FastPath_SaturationInt8();
+
+    /**
+     * @brief   Tests the Execute method with FastPath = 0 and FastPath = 1.
+     * @details Checks that the uint32 subtraction 0 - 1 saturates to 0
+     *          with both evaluators.
+     */
+    bool TestExecute_FastPath_SaturationUInt32();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -493,3 +493,28 @@ TEST(MuxGAMGTest,TestExecute4I2OInvalidSelectorSingle) {
 
 
 	
+
+TEST(MuxGAMGTest,TestExecute4I2OSelectorArrayRunsuint8) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OSelectorArrayRuns<uint8>("uint8", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OSelectorArrayRunsint16) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OSelectorArrayRuns<int16>("int16", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OSelectorArrayRunsuint32) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OSelectorArrayRuns<uint32>("uint32", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OSelectorArrayRunsfloat32) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OSelectorArrayRuns<float32>("float32", 80, 80));
+}
+
+TEST(MuxGAMGTest,TestExecute4I2OSelectorArrayRunsfloat64) {
+    MuxGAMTest test;
+    ASSERT_TRUE(test.TestExecute4I2OSelectorArrayRuns<float64>("float64", 80, 80));
+}
@@ -312,6 +312,18 @@ public:
                                         uint32 nOfElements,
                                         uint32 nOfSelectorElements);
 
+    /**
+     * @brief Test MuxGAM::Execute() configured with 4 inputs two outputs.
+     * @details Test a selector array where the selector values change with runs of one and three elements.
+     * @param[in] strType indicates the type of the input and output signals of the MuxGAM.
+     * @param[in] nOfElements indicates the elements of the input and output signals of the MuxGAM.
+     * @param[in] nOfSelectorElements indicates the elements of the selector signals of the MuxGAM.
+     */
+    template<typename T>
+    bool TestExecute4I2OSelectorArrayRuns(StreamString strType,
+                                          uint32 nOfElements,
+                                          uint32 nOfSelectorElements);
+
     /**
      * @brief Test MuxGAM::Execute() configured with 4 inputs two outputs.
      * @details Test all valid types, all selector combinations and with a single selector element.
@@ -674,6 +686,54 @@ bool MuxGAMTest::TestExecute4I2OSelectorArray_2(StreamString strType,
 }
 
 
+template<typename T>
+bool MuxGAMTest::TestExecute4I2OSelectorArrayRuns(StreamString strType,
+                                                  uint32 nOfElements,
+                                                  uint32 nOfSelectorElements) {
+    MuxGAMTestHelper gam;
+    bool ok = gam.Initialise(gam.config);
+    ok &= gam.Setup4Inputs2Outputs(strType, nOfElements, nOfSelectorElements);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    if (ok) {
+        ok &= gam.Setup();
+    }
+    if (ok) {
+        uint32 * selector0 = static_cast<uint32 *>(gam.GetInputSignalsMemory(0u));
+        uint32 * selector1 = static_cast<uint32 *>(gam.GetInputSignalsMemory(1u));
+        T * input0 = static_cast<T *>(gam.GetInputSignalsMemory(2u));
+        T * input1 = static_cast<T *>(gam.GetInputSignalsMemory(3u));
+        T * Output0 = static_cast<T *>(gam.GetOutputSignalsMemory(0u));
+        T * Output1 = static_cast<T *>(gam.GetOutputSignalsMemory(1u));
+        //initialize inputs
+        for (uint32 i = 0u; i < nOfElements; i++) {
+            input0[i] = static_cast<T>(i + 1.1);
+            input1[i] = 2.0 * static_cast<T>(i + 0.7);
+            Output0[i] = static_cast<T>(0.0);
+            Output1[i] = static_cast<T>(0.0);
+        }
+        //runs of one element in the first output and of three elements in the second
+        for (uint32 i = 0u; i < nOfSelectorElements; i++) {
+            selector0[i] = (i % 2u);
+            selector1[i] = ((i / 3u) % 2u);
+        }
+        if (ok) {
+            ok &= gam.Execute();
+        }
+        //Verify outputs
+        for (uint32 i = 0u; (i < nOfSelectorElements) && ok; i++) {
+            ok &= (Output0[i] == ((selector0[i] == 0u) ? input0[i] : input1[i]));
+            if (ok) {
+                ok &= (Output1[i] == ((selector1[i] == 0u) ? input0[i] : input1[i]));
+            }
+        }
+    }
+    return ok;
+}
+
 template<typename T>
 bool MuxGAMTest::TestExecute4I2OSelector(StreamString strType,
                                               uint32 nOfElements,
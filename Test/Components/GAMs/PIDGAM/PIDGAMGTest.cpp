@@ -315,5 +315,37 @@ TEST(PIDGAMGTest, TestExecuteSaturationki3) {
     ASSERT_TRUE(test.TestExecuteSaturationki3());
 }
 
+TEST(PIDGAMGTest, TestInitialiseWrongNumberOfParameters) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongNumberOfParameters());
+}
+
+TEST(PIDGAMGTest, TestInitialiseMultiLoopZeroGains) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseMultiLoopZeroGains());
+}
+
+TEST(PIDGAMGTest, TestSetupWrongNumberOfLoopParameters) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongNumberOfLoopParameters());
+}
+
+TEST(PIDGAMGTest, TestGetNumberOfLoops) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestGetNumberOfLoops());
+}
 
+TEST(PIDGAMGTest, TestExecuteMultiLoop) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMultiLoop());
+}
 
+TEST(PIDGAMGTest, TestRequestLoopReset) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestRequestLoopReset());
+}
+
+TEST(PIDGAMGTest, TestResetLoop) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestResetLoop());
+}
@@ -97,7 +97,7 @@ public:
 
         ok = configSignals.CreateAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -116,7 +116,7 @@ public:
         ok &= configSignals.MoveToRoot();
         ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -145,14 +145,14 @@ public:
 
         ok = configSignals.CreateAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
         ok &= configSignals.Write("ByteSize", byteSizePerSignal);
         ok &= configSignals.MoveAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("1");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Measurement");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -177,7 +177,7 @@ public:
         ok &= configSignals.MoveToRoot();
         ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -2415,5 +2415,230 @@ bool PIDGAMTest::TestExecuteSaturationki3() {
     return ret;
 }
 
+bool PIDGAMTest::TestInitialiseWrongNumberOfParameters() {
+    PIDGAM gam;
+    ConfigurationDatabase config;
+    float64 kpArr[] = { 1.0, 2.0, 3.0 };
+    float64 kiArr[] = { 1.0, 2.0 };
+    Vector<float64> kpVec(kpArr, 3u);
+    Vector<float64> kiVec(kiArr, 2u);
+    config.Write("Kp", kpVec);
+    config.Write("Ki", kiVec);
+    float64 sampleTime = 0.001;
+    config.Write("SampleTime", sampleTime);
+    return !gam.Initialise(config);
+}
+
+bool PIDGAMTest::TestInitialiseMultiLoopZeroGains() {
+    PIDGAM gam;
+    ConfigurationDatabase config;
+    float64 kpArr[] = { 1.0, 0.0, 3.0 };
+    float64 kiArr[] = { 1.0, 0.0, 0.0 };
+    Vector<float64> kpVec(kpArr, 3u);
+    Vector<float64> kiVec(kiArr, 3u);
+    config.Write("Kp", kpVec);
+    config.Write("Ki", kiVec);
+    float64 sampleTime = 0.001;
+    config.Write("SampleTime", sampleTime);
+    return !gam.Initialise(config);
+}
+
+bool PIDGAMTest::TestSetupWrongNumberOfLoopParameters() {
+    PIDGAMTestHelper gam(1.0, 1.2, 1.3, 0.001, 0x1.FFFFFFFFFFFFFp1023, -0x1.FFFFFFFFFFFFFp1023, 2u);
+    bool ret = gam.HelperInitialise();
+    float64 kpArr[] = { 1.0, 2.0, 3.0 };
+    Vector<float64> kpVec(kpArr, 3u);
+    ret &= gam.config.Delete("Kp");
+    ret &= gam.config.Write("Kp", kpVec);
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup1();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    if (ret) {
+        ret = !gam.Setup();
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestGetNumberOfLoops() {
+    PIDGAMTestHelper gam(1.0, 1.2, 1.3, 0.001, 0x1.FFFFFFFFFFFFFp1023, -0x1.FFFFFFFFFFFFFp1023, 4u);
+    bool ret = (gam.GetNumberOfLoops() == 0u);
+    ret &= gam.HelperInitialise();
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup2();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+    if (ret) {
+        ret = (gam.GetNumberOfLoops() == 4u);
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestExecuteMultiLoop() {
+    const uint32 nOfLoops = 3u;
+    float64 kpArr[] = { 0.5, 1.0, 2.0 };
+    float64 kiArr[] = { 500, 1.2, 0.0 };
+    float64 kdArr[] = { 0.00001, 0.0, 0.3 };
+    float64 maxArr[] = { 0.8, 10.0, 1.5 };
+    float64 minArr[] = { -0.8, -10.0, -0.1 };
+
+    PIDGAMTestHelper gam(1.0, 1.0, 1.0, 0.001, 1.0, -1.0, nOfLoops);
+    bool ret = gam.HelperInitialise();
+    Vector<float64> kpVec(kpArr, nOfLoops);
+    Vector<float64> kiVec(kiArr, nOfLoops);
+    Vector<float64> kdVec(kdArr, nOfLoops);
+    Vector<float64> maxVec(maxArr, nOfLoops);
+    Vector<float64> minVec(minArr, nOfLoops);
+    ret &= gam.config.Delete("Kp");
+    ret &= gam.config.Delete("Ki");
+    ret &= gam.config.Delete("Kd");
+    ret &= gam.config.Delete("MaxOutput");
+    ret &= gam.config.Delete("MinOutput");
+    ret &= gam.config.Write("Kp", kpVec);
+    ret &= gam.config.Write("Ki", kiVec);
+    ret &= gam.config.Write("Kd", kdVec);
+    ret &= gam.config.Write("MaxOutput", maxVec);
+    ret &= gam.config.Write("MinOutput", minVec);
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup2();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+
+    PIDGAMTestHelper *singles[nOfLoops];
+    for (uint32 l = 0u; l < nOfLoops; l++) {
+        singles[l] = new PIDGAMTestHelper(kpArr[l], kiArr[l], kdArr[l], 0.001, maxArr[l], minArr[l]);
+        ret &= singles[l]->HelperInitialise();
+        ret &= singles[l]->Initialise(singles[l]->config);
+        ret &= singles[l]->HelperSetup2();
+        ret &= singles[l]->SetConfiguredDatabase(singles[l]->configSignals);
+        ret &= singles[l]->AllocateInputSignalsMemory();
+        ret &= singles[l]->AllocateOutputSignalsMemory();
+        ret &= singles[l]->Setup();
+    }
+    if (ret) {
+        float64 *inR = static_cast<float64 *>(gam.GetInputSignalsMemory(0u));
+        float64 *inM = static_cast<float64 *>(gam.GetInputSignalsMemory(1u));
+        float64 *out = static_cast<float64 *>(gam.GetOutputSignalsMemory(0u));
+        for (uint32 i = 0u; (i < 1000u) && (ret); i++) {
+            for (uint32 l = 0u; l < nOfLoops; l++) {
+                float64 *singleInR = static_cast<float64 *>(singles[l]->GetInputSignalsMemory(0u));
+                float64 *singleInM = static_cast<float64 *>(singles[l]->GetInputSignalsMemory(1u));
+                inR[l] = ((i / 100u) % 2u == 0u) ? (1.0) : (-1.0);
+                inM[l] = out[l] * 0.5;
+                *singleInR = inR[l];
+                *singleInM = inM[l];
+                singles[l]->Execute();
+            }
+            gam.Execute();
+            for (uint32 l = 0u; (l < nOfLoops) && (ret); l++) {
+                float64 *singleOut = static_cast<float64 *>(singles[l]->GetOutputSignalsMemory(0u));
+                ret = (out[l] == *singleOut);
+                if (!ret) {
+                    printf("loop %u output = %.17lf. expected = %.17lf. index = %u \n", l, out[l], *singleOut, i);
+                }
+            }
+        }
+    }
+    for (uint32 l = 0u; l < nOfLoops; l++) {
+        delete singles[l];
+    }
+    return ret;
 }
 
+bool PIDGAMTest::TestRequestLoopReset() {
+    PIDGAMTestHelper gam(1.0, 100.0, 0.0, 0.001, 0x1.FFFFFFFFFFFFFp1023, -0x1.FFFFFFFFFFFFFp1023, 2u);
+    bool ret = gam.HelperInitialise();
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup1();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+    float64 *in = static_cast<float64 *>(gam.GetInputSignalsMemory());
+    float64 *out = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+    if (ret) {
+        in[0] = 1.0;
+        in[1] = 1.0;
+        for (uint32 i = 0u; i < 10u; i++) {
+            gam.Execute();
+        }
+        //proportional = 1, integral = 10 * 0.1
+        ret = gam.IsEqualLargerMargins(out[0], 2.0);
+        ret &= gam.IsEqualLargerMargins(out[1], 2.0);
+    }
+    if (ret) {
+        ret = !gam.RequestLoopReset(2u);
+    }
+    if (ret) {
+        ret = gam.RequestLoopReset(1u);
+    }
+    if (ret) {
+        gam.Execute();
+        //The integral of the loop 0 keeps accumulating (rounding errors of 11 additions)
+        ret = ((out[0] - 2.1) < 1e-12) && ((out[0] - 2.1) > -1e-12);
+        ret &= gam.IsEqualLargerMargins(out[1], 1.1);
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestResetLoop() {
+    PIDGAMTestHelper gam(1.0, 100.0, 0.0, 0.001, 0x1.FFFFFFFFFFFFFp1023, -0x1.FFFFFFFFFFFFFp1023, 2u);
+    bool ret = gam.HelperInitialise();
+    ret &= gam.Initialise(gam.config);
+    ret &= gam.HelperSetup1();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+    float64 *in = static_cast<float64 *>(gam.GetInputSignalsMemory());
+    float64 *out = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+    if (ret) {
+        in[0] = 1.0;
+        in[1] = 1.0;
+        for (uint32 i = 0u; i < 10u; i++) {
+            gam.Execute();
+        }
+    }
+    if (ret) {
+        ReferenceContainer message;
+        ReferenceT<ConfigurationDatabase> data(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        uint32 loop = 0u;
+        ret = data->Write("Loop", loop);
+        if (ret) {
+            ret = message.Insert(data);
+        }
+        if (ret) {
+            ret = (gam.ResetLoop(message) == ErrorManagement::NoError);
+        }
+    }
+    if (ret) {
+        ReferenceContainer message;
+        ReferenceT<ConfigurationDatabase> data(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+        uint32 loop = 2u;
+        ret = data->Write("Loop", loop);
+        if (ret) {
+            ret = message.Insert(data);
+        }
+        if (ret) {
+            ret = (gam.ResetLoop(message) == ErrorManagement::ParametersError);
+        }
+    }
+    if (ret) {
+        ReferenceContainer message;
+        ret = (gam.ResetLoop(message) == ErrorManagement::ParametersError);
+    }
+    if (ret) {
+        gam.Execute();
+        ret = gam.IsEqualLargerMargins(out[0], 1.1);
+        //The integral of the loop 1 keeps accumulating (rounding errors of 11 additions)
+        ret &= ((out[1] - 2.1) < 1e-12) && ((out[1] - 2.1) > -1e-12);
+    }
+    return ret;
+}
+
+}
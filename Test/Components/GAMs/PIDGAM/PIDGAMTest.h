@@ -345,6 +345,41 @@ public:
      */
     bool TestExecuteSaturationki3();
 
+    /**
+     * @brief Test the PIDGAM::Initialise() with array parameters of different number of elements.
+     */
+    bool TestInitialiseWrongNumberOfParameters();
+
+    /**
+     * @brief Test the PIDGAM::Initialise() with array gains where one of the loops has kp = ki = kd = 0.
+     */
+    bool TestInitialiseMultiLoopZeroGains();
+
+    /**
+     * @brief Test the PIDGAM::Setup() with array parameters whose number of elements is not the number of loops.
+     */
+    bool TestSetupWrongNumberOfLoopParameters();
+
+    /**
+     * @brief Test the PIDGAM::GetNumberOfLoops()
+     */
+    bool TestGetNumberOfLoops();
+
+    /**
+     * @brief Test the PIDGAM::Execute() with three loops (array gains and limits) against three single loop instances.
+     */
+    bool TestExecuteMultiLoop();
+
+    /**
+     * @brief Test the PIDGAM::RequestLoopReset() only resets the requested loop.
+     */
+    bool TestRequestLoopReset();
+
+    /**
+     * @brief Test the PIDGAM::ResetLoop() registered method.
+     */
+    bool TestResetLoop();
+
 
 };
 
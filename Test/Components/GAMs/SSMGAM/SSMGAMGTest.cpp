@@ -244,6 +244,66 @@ TEST(SSMGAMGTest, TestPrepareNextStateNoMemoryAllocated2) {
     ASSERT_TRUE(test.TestPrepareNextStateNoMemoryAllocated(1));
 }
 
+TEST(SSMGAMGTest, TestInitialiseWrongEngine) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongEngine());
+}
+
+TEST(SSMGAMGTest, TestInitialiseWrongCoefficientsType) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongCoefficientsType());
+}
+
+TEST(SSMGAMGTest, TestInitialiseFloat32CoefficientsMatrixEngine) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseFloat32CoefficientsMatrixEngine());
+}
+
+TEST(SSMGAMGTest, TestExecuteSpring_Matrix) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSpringEngine("Matrix", "float64"));
+}
+
+TEST(SSMGAMGTest, TestExecuteSpring_Contiguous) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSpringEngine("Contiguous", "float64"));
+}
+
+TEST(SSMGAMGTest, TestExecuteSpring_Contiguous_Float32) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSpringEngine("Contiguous", "float32"));
+}
+
+TEST(SSMGAMGTest, TestExecuteDense) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteDense());
+}
+
+TEST(SSMGAMGTest, TestExecuteDense_Float32) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteDense_Float32());
+}
+
+TEST(SSMGAMGTest, TestExecuteSparse) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSparse());
+}
+
+TEST(SSMGAMGTest, TestStateSpaceKernelSparse) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestStateSpaceKernelSparse());
+}
+
+TEST(SSMGAMGTest, TestStateSpaceKernelWrongInitialise) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestStateSpaceKernelWrongInitialise());
+}
+
+TEST(SSMGAMGTest, TestExecute_Benchmark) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Benchmark());
+}
+
 
 }
 
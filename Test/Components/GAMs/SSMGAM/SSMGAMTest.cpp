@@ -26,12 +26,15 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include "math.h"
 #include "stdio.h"
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 
+#include "HighResolutionTimer.h"
 #include "SSMGAMTest.h"
+#include "StateSpaceKernelT.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -352,6 +355,191 @@ SSMGAMTestHelper    () {
         ok &= configSignals.MoveToRoot();
         return ok;
     }
+    /**
+     * Configures a model with n states, p inputs and q outputs. The dense model has all the coefficients different from zero,
+     * the sparse model only the diagonal and the upper diagonal of A and one coefficient per row of B, C and D.
+     */
+    bool InitialiseConfigN(const uint32 n,
+                           const uint32 p,
+                           const uint32 q,
+                           const bool sparseModel,
+                           const char8 * const engine,
+                           const char8 * const coefficientsType) {
+        bool ok = true;
+        float64 *stateMatrix = new float64[n * n];
+        float64 *inputMatrix = new float64[n * p];
+        float64 *outputMatrix = new float64[q * n];
+        float64 *feedthroughMatrix = new float64[q * p];
+        for (uint32 i = 0u; i < n; i++) {
+            for (uint32 j = 0u; j < n; j++) {
+                float64 coefficient = 0.0;
+                if (sparseModel) {
+                    if (i == j) {
+                        coefficient = 0.5;
+                    }
+                    else if ((i + 1u) == j) {
+                        coefficient = 0.25;
+                    }
+                    else {
+                        coefficient = 0.0;
+                    }
+                }
+                else {
+                    //Row sum < 1 so that the system is stable
+                    coefficient = (0.9 / static_cast<float64>(n)) * static_cast<float64>(((i * 7u + j * 3u) % 11u) + 1u) / 11.0;
+                }
+                stateMatrix[(i * n) + j] = coefficient;
+            }
+            for (uint32 j = 0u; j < p; j++) {
+                if (sparseModel) {
+                    inputMatrix[(i * p) + j] = ((i % p) == j) ? 1.0 : 0.0;
+                }
+                else {
+                    inputMatrix[(i * p) + j] = static_cast<float64>((i + j) % 5u) - 2.0;
+                }
+            }
+        }
+        for (uint32 i = 0u; i < q; i++) {
+            for (uint32 j = 0u; j < n; j++) {
+                if (sparseModel) {
+                    outputMatrix[(i * n) + j] = ((j % q) == i) ? 1.0 : 0.0;
+                }
+                else {
+                    outputMatrix[(i * n) + j] = static_cast<float64>((i * 3u + j) % 7u) / 7.0;
+                }
+            }
+            for (uint32 j = 0u; j < p; j++) {
+                feedthroughMatrix[(i * p) + j] = (i == j) ? 2.0 : 0.0;
+            }
+        }
+        Matrix<float64> matrix(stateMatrix, n, n);
+        ok &= config.Write("StateMatrix", matrix);
+        Matrix<float64> matrix2(inputMatrix, n, p);
+        ok &= config.Write("InputMatrix", matrix2);
+        Matrix<float64> matrix3(outputMatrix, q, n);
+        ok &= config.Write("OutputMatrix", matrix3);
+        Matrix<float64> matrix4(feedthroughMatrix, q, p);
+        ok &= config.Write("FeedthroughMatrix", matrix4);
+        ok &= config.Write("ResetInEachState", 0);
+        ok &= config.Write("Engine", engine);
+        ok &= config.Write("CoefficientsType", coefficientsType);
+        delete[] stateMatrix;
+        delete[] inputMatrix;
+        delete[] outputMatrix;
+        delete[] feedthroughMatrix;
+        return ok;
+    }
+
+    /**
+     * Configures p float64 inputs, q outputs and n states.
+     */
+    bool InitialiseConfigSignalsN(const uint32 n,
+                                  const uint32 p,
+                                  const uint32 q) {
+        bool ok = true;
+        ok &= configSignals.CreateAbsolute("Signals.InputSignals");
+        for (uint32 i = 0u; i < p; i++) {
+            StreamString name;
+            ok &= name.Printf("%u", i);
+            ok &= configSignals.CreateRelative(name.Buffer());
+            ok &= configSignals.Write("Type", "float64");
+            ok &= configSignals.Write("NumberOfElements", 1);
+            ok &= configSignals.Write("NumberOfDimensions", 0);
+            ok &= configSignals.Write("DataSource", "TestDataSource");
+            ok &= configSignals.Write("ByteSize", 8);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.Write("ByteSize", 8u * p);
+
+        ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
+        for (uint32 i = 0u; i < (q + n); i++) {
+            StreamString name;
+            ok &= name.Printf("%u", i);
+            ok &= configSignals.CreateRelative(name.Buffer());
+            StreamString qualifiedName;
+            if (i < q) {
+                ok &= qualifiedName.Printf("outputVector%u", i);
+                ok &= configSignals.Write("DataSource", "DataSourceOutputVector");
+            }
+            else {
+                ok &= qualifiedName.Printf("stateVector%u", i - q);
+                ok &= configSignals.Write("DataSource", "DataSourceStateVector");
+            }
+            ok &= configSignals.Write("QualifiedName", qualifiedName.Buffer());
+            ok &= configSignals.Write("Type", "float64");
+            ok &= configSignals.Write("NumberOfElements", 1);
+            ok &= configSignals.Write("NumberOfDimensions", 0);
+            ok &= configSignals.Write("ByteSize", 8);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.Write("ByteSize", 8u * (q + n));
+
+        ok &= configSignals.CreateAbsolute("Memory.InputSignals.0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = 0u; i < p; i++) {
+            StreamString name;
+            ok &= name.Printf("%u", i);
+            ok &= configSignals.CreateRelative(name.Buffer());
+            ok &= configSignals.Write("Samples", 1);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+
+        ok &= configSignals.CreateAbsolute("Memory.OutputSignals.0");
+        ok &= configSignals.Write("DataSource", "DataSourceOutputVector");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = 0u; i < q; i++) {
+            StreamString name;
+            ok &= name.Printf("%u", i);
+            ok &= configSignals.CreateRelative(name.Buffer());
+            ok &= configSignals.Write("Samples", 1);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.CreateAbsolute("Memory.OutputSignals.1");
+        ok &= configSignals.Write("DataSource", "DataSourceStateVector");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = q; i < (q + n); i++) {
+            StreamString name;
+            ok &= name.Printf("%u", i);
+            ok &= configSignals.CreateRelative(name.Buffer());
+            ok &= configSignals.Write("Samples", 1);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
+
+    bool SetupN(const uint32 n,
+                const uint32 p,
+                const uint32 q,
+                const bool sparseModel,
+                const char8 * const engine,
+                const char8 * const coefficientsType) {
+        bool ok = InitialiseConfigN(n, p, q, sparseModel, engine, coefficientsType);
+        if (ok) {
+            ok = Initialise(config);
+        }
+        if (ok) {
+            ok = InitialiseConfigSignalsN(n, p, q);
+        }
+        if (ok) {
+            ok = SetConfiguredDatabase(configSignals);
+        }
+        if (ok) {
+            ok = AllocateInputSignalsMemory();
+        }
+        if (ok) {
+            ok = AllocateOutputSignalsMemory();
+        }
+        if (ok) {
+            ok = Setup();
+        }
+        if (ok) {
+            ok = PrepareNextState("A", "B");
+        }
+        return ok;
+    }
+
     bool IsEqualLargerMargins(const float64 f1, const float64 f2) {
         float64 *min=reinterpret_cast<float64*>(const_cast<uint64*>(&EPSILON_FLOAT64));
         float64 minLarger = 2 * *min;
@@ -363,6 +551,41 @@ SSMGAMTestHelper    () {
 
 CLASS_REGISTER(SSMGAMTestHelper, "1.0")
 
+/**
+ * Executes both GAMs with the same inputs and compares the outputs and the states.
+ */
+static bool CompareEngines(SSMGAMTestHelper &reference,
+                           SSMGAMTestHelper &gam,
+                           const uint32 n,
+                           const uint32 p,
+                           const uint32 q,
+                           const float64 tolerance,
+                           const uint32 nOfCycles) {
+    bool ok = true;
+    float64 *referenceIn = static_cast<float64 *>(reference.GetInputSignalsMemory());
+    float64 *gamIn = static_cast<float64 *>(gam.GetInputSignalsMemory());
+    for (uint32 k = 0u; (k < nOfCycles) && ok; k++) {
+        for (uint32 i = 0u; i < p; i++) {
+            referenceIn[i] = sin(static_cast<float64>(k + i));
+            gamIn[i] = referenceIn[i];
+        }
+        ok = reference.Execute();
+        if (ok) {
+            ok = gam.Execute();
+        }
+        for (uint32 i = 0u; (i < (q + n)) && ok; i++) {
+            float64 expected = *static_cast<float64 *>(reference.GetOutputSignalsMemory(i));
+            float64 value = *static_cast<float64 *>(gam.GetOutputSignalsMemory(i));
+            float64 error = value - expected;
+            ok = ((error < tolerance) && (error > -tolerance));
+            if (!ok) {
+                printf("cycle %u output %u: %.16lf != %.16lf\n", k, i, value, expected);
+            }
+        }
+    }
+    return ok;
+}
+
 SSMGAMTest::SSMGAMTest() {
 //Auto-generated constructor stub for SSMGAMTest
 
@@ -2011,5 +2234,253 @@ bool SSMGAMTest::TestPrepareNextStateNoMemoryAllocated(uint32 resetEachStateConf
     return ok;
 }
 
+bool SSMGAMTest::TestInitialiseWrongEngine() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfig1();
+    ok &= gam.config.Write("Engine", "Vector");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestInitialiseWrongCoefficientsType() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfig1();
+    ok &= gam.config.Write("CoefficientsType", "int32");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestInitialiseFloat32CoefficientsMatrixEngine() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    ok &= gam.InitialiseConfig1();
+    ok &= gam.config.Write("Engine", "Matrix");
+    ok &= gam.config.Write("CoefficientsType", "float32");
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
 }
 
+bool SSMGAMTest::TestExecuteSpringEngine(const char8 * const engine,
+                                         const char8 * const coefficientsType) {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    //n = 2, p = 1 and q = 1
+    ok &= gam.InitialiseConfigSpring();
+    ok &= gam.config.Write("Engine", engine);
+    ok &= gam.config.Write("CoefficientsType", coefficientsType);
+    if (ok) {
+        ok &= gam.Initialise(gam.config);
+    }
+    ok &= gam.InitialiseConfigSignalsSpring();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    if (ok) {
+        ok &= gam.AllocateInputSignalsMemory();
+        ok &= gam.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gam.Setup();
+    }
+    //float32 coefficients are only accurate to the float32 precision
+    StreamString type = coefficientsType;
+    const bool isFloat32 = (type == "float32");
+    const float64 tolerance = 1e-6;
+    float64 expected[] = { 0.0, 0.340299846608298, 0.509125788245814 };
+    float64 *gamMemoryIn = NULL_PTR(float64 *);
+    float64 *gamMemoryOutVector = NULL_PTR(float64 *);
+    if (ok) {
+        gamMemoryIn = static_cast<float64 *>(gam.GetInputSignalsMemory());
+        gamMemoryOutVector = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+        *gamMemoryOutVector = 0.0;
+        gamMemoryIn[0] = 1.0;
+    }
+    for (uint32 k = 0u; (k < 3u) && ok; k++) {
+        ok = gam.Execute();
+        if (ok) {
+            if (isFloat32) {
+                float64 error = *gamMemoryOutVector - expected[k];
+                ok = ((error < tolerance) && (error > -tolerance));
+            }
+            else {
+                ok = gam.IsEqualLargerMargins(*gamMemoryOutVector, expected[k]);
+            }
+            if (!ok) {
+                printf("*gamMemoryOutVector = %.16lf\n", *gamMemoryOutVector);
+            }
+        }
+        gamMemoryIn[0] = 0.0;
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestExecuteDense() {
+    const uint32 n = 37u;
+    const uint32 p = 3u;
+    const uint32 q = 5u;
+    SSMGAMTestHelper reference;
+    SSMGAMTestHelper gam;
+    bool ok = reference.SetupN(n, p, q, false, "Matrix", "float64");
+    if (ok) {
+        ok = gam.SetupN(n, p, q, false, "Contiguous", "float64");
+    }
+    if (ok) {
+        ok = CompareEngines(reference, gam, n, p, q, 1e-9, 50u);
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestExecuteDense_Float32() {
+    const uint32 n = 37u;
+    const uint32 p = 3u;
+    const uint32 q = 5u;
+    SSMGAMTestHelper reference;
+    SSMGAMTestHelper gam;
+    bool ok = reference.SetupN(n, p, q, false, "Matrix", "float64");
+    if (ok) {
+        ok = gam.SetupN(n, p, q, false, "Contiguous", "float32");
+    }
+    if (ok) {
+        ok = CompareEngines(reference, gam, n, p, q, 1e-4, 50u);
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestExecuteSparse() {
+    const uint32 n = 40u;
+    const uint32 p = 2u;
+    const uint32 q = 3u;
+    SSMGAMTestHelper reference;
+    SSMGAMTestHelper gam;
+    bool ok = reference.SetupN(n, p, q, true, "Matrix", "float64");
+    if (ok) {
+        ok = gam.SetupN(n, p, q, true, "Contiguous", "float64");
+    }
+    if (ok) {
+        ok = CompareEngines(reference, gam, n, p, q, 1e-9, 50u);
+    }
+    if (ok) {
+        ok = gam.PrepareNextState("C", "D");
+    }
+    if (ok) {
+        ok = reference.PrepareNextState("C", "D");
+    }
+    if (ok) {
+        ok = CompareEngines(reference, gam, n, p, q, 1e-9, 10u);
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestStateSpaceKernelSparse() {
+    const uint32 n = 8u;
+    float64 stateMatrixValues[n][n];
+    float64 inputMatrixValues[n][1];
+    float64 outputMatrixValues[1][n];
+    float64 *stateMatrix[n];
+    float64 *inputMatrix[n];
+    float64 *outputMatrix[1];
+    for (uint32 i = 0u; i < n; i++) {
+        for (uint32 j = 0u; j < n; j++) {
+            stateMatrixValues[i][j] = (i == j) ? 0.5 : 0.0;
+        }
+        inputMatrixValues[i][0] = (i == 0u) ? 1.0 : 0.0;
+        outputMatrixValues[0][i] = (i == (n - 1u)) ? 1.0 : 0.0;
+        stateMatrix[i] = &stateMatrixValues[i][0];
+        inputMatrix[i] = &inputMatrixValues[i][0];
+    }
+    outputMatrix[0] = &outputMatrixValues[0][0];
+    StateSpaceKernelT<float64> kernel;
+    bool ok = kernel.Initialise(stateMatrix, inputMatrix, outputMatrix, NULL_PTR(float64 **), n, 1u, 1u);
+    if (ok) {
+        ok = kernel.IsSparse();
+    }
+    if (ok) {
+        ok = (kernel.GetNumberOfStates() == n) && (kernel.GetNumberOfInputs() == 1u) && (kernel.GetNumberOfOutputs() == 1u);
+    }
+    float64 u = 1.0;
+    float64 y = -1.0;
+    float64 x[n];
+    const float64 *input[] = { &u };
+    float64 *output[] = { &y };
+    float64 *state[n];
+    for (uint32 i = 0u; i < n; i++) {
+        state[i] = &x[i];
+    }
+    //x0[k] = 1 + 0.5 + ... + 0.5^(k-1)
+    float64 expected = 0.0;
+    for (uint32 k = 0u; (k < 4u) && ok; k++) {
+        kernel.Update(&input[0], &output[0], &state[0]);
+        ok = (x[0] == expected) && (y == 0.0);
+        expected = (expected * 0.5) + 1.0;
+    }
+    if (ok) {
+        kernel.Reset();
+        kernel.Update(&input[0], &output[0], &state[0]);
+        ok = (x[0] == 0.0);
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestStateSpaceKernelWrongInitialise() {
+    float64 value = 1.0;
+    float64 *matrix[] = { &value };
+    StateSpaceKernelT<float64> kernel;
+    bool ok = !kernel.Initialise(NULL_PTR(float64 **), matrix, matrix, matrix, 1u, 1u, 1u);
+    if (ok) {
+        ok = !kernel.Initialise(matrix, matrix, matrix, matrix, 0u, 1u, 1u);
+    }
+    if (ok) {
+        ok = kernel.Initialise(matrix, matrix, matrix, matrix, 1u, 1u, 1u);
+    }
+    if (ok) {
+        ok = !kernel.IsSparse();
+    }
+    if (ok) {
+        ok = !kernel.Initialise(matrix, matrix, matrix, matrix, 1u, 1u, 1u);
+    }
+    return ok;
+}
+
+bool SSMGAMTest::TestExecute_Benchmark() {
+    const uint32 n = 200u;
+    const uint32 p = 4u;
+    const uint32 q = 4u;
+    const uint32 nOfCycles = 2000u;
+    const char8 * const engines[] = { "Matrix", "Contiguous", "Contiguous" };
+    const char8 * const coefficientsTypes[] = { "float64", "float64", "float32" };
+    const bool sparseModels[] = { false, true };
+    float64 ns[2][3];
+    bool ok = true;
+    for (uint32 m = 0u; (m < 2u) && ok; m++) {
+        for (uint32 e = 0u; (e < 3u) && ok; e++) {
+            SSMGAMTestHelper gam;
+            ok = gam.SetupN(n, p, q, sparseModels[m], engines[e], coefficientsTypes[e]);
+            uint64 elapsedTicks = 0u;
+            if (ok) {
+                float64 *gamMemoryIn = static_cast<float64 *>(gam.GetInputSignalsMemory());
+                for (uint32 i = 0u; i < p; i++) {
+                    gamMemoryIn[i] = 1.0;
+                }
+                uint64 start = HighResolutionTimer::Counter();
+                for (uint32 k = 0u; (k < nOfCycles) && ok; k++) {
+                    ok = gam.Execute();
+                }
+                elapsedTicks = (HighResolutionTimer::Counter() - start);
+            }
+            ns[m][e] = (static_cast<float64>(elapsedTicks) * HighResolutionTimer::Period() * 1e9) / static_cast<float64>(nOfCycles);
+        }
+    }
+    if (ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Execute() n = %u dense Matrix: %f ns, Contiguous: %f ns, Contiguous float32: %f ns", n, ns[0][0], ns[0][1], ns[0][2]);
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Execute() n = %u sparse Matrix: %f ns, Contiguous: %f ns, Contiguous float32: %f ns", n, ns[1][0], ns[1][1], ns[1][2]);
+    }
+    return ok;
+}
+
+}
@@ -276,6 +276,62 @@ public:
      */
     bool TestPrepareNextStateNoMemoryAllocated(uint32 resetEachState);
 
+    /**
+     * @brief Test SSMGAM::Initialise() error messages.
+     * @details Engine is not Contiguous or Matrix.
+     */
+    bool TestInitialiseWrongEngine();
+
+    /**
+     * @brief Test SSMGAM::Initialise() error messages.
+     * @details CoefficientsType is not float64 or float32.
+     */
+    bool TestInitialiseWrongCoefficientsType();
+
+    /**
+     * @brief Test SSMGAM::Initialise() error messages.
+     * @details CoefficientsType = float32 with Engine = Matrix.
+     */
+    bool TestInitialiseFloat32CoefficientsMatrixEngine();
+
+    /**
+     * @brief Test SSM::Execute() with the spring system of TestExecuteSpring() and a given Engine and CoefficientsType.
+     * @return true if the output is as expected (1e-6 tolerance with float32 coefficients).
+     */
+    bool TestExecuteSpringEngine(const char8 * const engine,
+                                 const char8 * const coefficientsType);
+
+    /**
+     * @brief Test SSM::Execute() with a dense model (n = 37) against the Matrix engine.
+     */
+    bool TestExecuteDense();
+
+    /**
+     * @brief Test SSM::Execute() with a dense model (n = 37) and float32 coefficients against the Matrix engine.
+     */
+    bool TestExecuteDense_Float32();
+
+    /**
+     * @brief Test SSM::Execute() with a sparse model (n = 40) against the Matrix engine, also after a reset.
+     */
+    bool TestExecuteSparse();
+
+    /**
+     * @brief Test StateSpaceKernelT with a diagonal system (sparse storage), including StateSpaceKernelT::Reset().
+     */
+    bool TestStateSpaceKernelSparse();
+
+    /**
+     * @brief Test StateSpaceKernelT::Initialise() error messages.
+     */
+    bool TestStateSpaceKernelWrongInitialise();
+
+    /**
+     * @brief Measures SSMGAM::Execute() (n = 200) with the Matrix engine and with the Contiguous engine (float64 and float32),
+     * for a dense and for a sparse model.
+     */
+    bool TestExecute_Benchmark();
+
 };
 
 }
@@ -467,6 +467,16 @@ TEST(SimulinkWrapperGAMGTest, TestLinearIndexToSubscripts) {
     ASSERT_TRUE(test.TestLinearIndexToSubscripts());
 }
 
+TEST(SimulinkWrapperGAMGTest, TestTransposeAndCopy_Tiled) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestTransposeAndCopy_Tiled());
+}
+
+TEST(SimulinkWrapperGAMGTest, TestCopyPlan) {
+    SimulinkWrapperGAMTest test;
+    ASSERT_TRUE(test.TestCopyPlan());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -6265,3 +6265,99 @@ bool SimulinkWrapperGAMTest::TestLinearIndexToSubscripts() {
     return ok;
 
 }
+
+bool SimulinkWrapperGAMTest::TestTransposeAndCopy_Tiled() {
+
+    const uint32 numberOfRows    = 37u;
+    const uint32 numberOfColumns = 21u;
+
+    SimulinkInterface matrix;
+    matrix.typeDesc = Float64Bit;
+    matrix.dimensions.SetSize(2u);
+    matrix.dimensions[0u] = numberOfRows;
+    matrix.dimensions[1u] = numberOfColumns;
+
+    float64 rowMajor[numberOfRows * numberOfColumns];
+    float64 colMajor[numberOfRows * numberOfColumns];
+    float64 backToRowMajor[numberOfRows * numberOfColumns];
+    for (uint32 idx = 0u; idx < (numberOfRows * numberOfColumns); idx++) {
+        rowMajor[idx] = static_cast<float64>(idx);
+    }
+
+    bool ok = matrix.TransposeAndCopy(&colMajor[0u], &rowMajor[0u], InputPort);
+    for (uint32 rowIdx = 0u; (rowIdx < numberOfRows) && ok; rowIdx++) {
+        for (uint32 colIdx = 0u; (colIdx < numberOfColumns) && ok; colIdx++) {
+            ok = (colMajor[rowIdx + (numberOfRows * colIdx)] == rowMajor[colIdx + (numberOfColumns * rowIdx)]);
+        }
+    }
+    if (ok) {
+        ok = matrix.TransposeAndCopy(&backToRowMajor[0u], &colMajor[0u], OutputPort);
+    }
+    if (ok) {
+        ok = (MemoryOperationsHelper::Compare(&backToRowMajor[0u], &rowMajor[0u], sizeof(rowMajor)) == 0);
+    }
+    if (ok) {
+        ok = !matrix.IsTransposeTrivial();
+    }
+    if (ok) {
+        matrix.dimensions[0u] = 1u;
+        ok = matrix.IsTransposeTrivial();
+    }
+
+    return ok;
+}
+
+bool SimulinkWrapperGAMTest::TestCopyPlan() {
+
+    uint32 source[4u]      = { 1u, 2u, 3u, 4u };
+    uint32 destination[4u] = { 0u, 0u, 0u, 0u };
+
+    // Four scalar interfaces, contiguous in both memories
+    SimulinkRootInterface interfaces[4u];
+    for (uint32 idx = 0u; idx < 4u; idx++) {
+        interfaces[idx].interfaceType = OutputPort;
+        interfaces[idx].typeDesc      = UnsignedInteger32Bit;
+        interfaces[idx].transpose     = false;
+        interfaces[idx].byteSize      = sizeof(uint32);
+        interfaces[idx].sourcePtr     = &source[idx];
+        interfaces[idx].destPtr       = &destination[idx];
+    }
+    interfaces[2u].decimation = 2u;
+    interfaces[3u].decimation = 0u;
+
+    SimulinkCopyPlan plan;
+    bool ok = true;
+    for (uint32 idx = 0u; (idx < 4u) && ok; idx++) {
+        ok = plan.Add(interfaces[idx], ByteArrayBusMode);
+    }
+    if (ok) {
+        ok = plan.Finalise();
+    }
+    if (ok) {
+        // The first two are merged, the decimated ones are kept apart
+        ok = (plan.GetNumberOfOperations() == 3u);
+    }
+    if (ok) {
+        ok = plan.Execute();
+    }
+    if (ok) {
+        ok = (destination[0u] == 1u) && (destination[1u] == 2u) && (destination[2u] == 3u) && (destination[3u] == 0u);
+    }
+    if (ok) {
+        source[0u] = 10u;
+        source[2u] = 30u;
+        ok = plan.Execute();
+    }
+    if (ok) {
+        // Decimated interface not copied at the second execution
+        ok = (destination[0u] == 10u) && (destination[2u] == 3u) && (destination[3u] == 0u);
+    }
+    if (ok) {
+        ok = plan.Execute();
+    }
+    if (ok) {
+        ok = (destination[2u] == 30u) && (destination[3u] == 0u);
+    }
+
+    return ok;
+}
@@ -538,6 +538,17 @@ public:
 #endif
 
     bool TestLinearIndexToSubscripts();
+
+    /**
+     * @brief Tests that the tiled SimulinkInterface::TransposeAndCopy() matches the element-wise transposition
+     *        for matrices which are not a multiple of the tile size.
+     */
+    bool TestTransposeAndCopy_Tiled();
+
+    /**
+     * @brief Tests that SimulinkCopyPlan merges contiguous copies and honours the decimation of each interface.
+     */
+    bool TestCopyPlan();
     
     /**
      * @brief A general template for the GAM configuration.
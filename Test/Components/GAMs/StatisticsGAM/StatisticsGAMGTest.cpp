@@ -74,9 +74,9 @@ TEST(StatisticsGAMGTest,TestSetup_NoOutputSignal) {
     ASSERT_TRUE(test.TestSetup_NoOutputSignal());
 }
 
-TEST(StatisticsGAMGTest,TestSetup_NotAScalarInput) {
+TEST(StatisticsGAMGTest,TestSetup_ArrayInput) {
     StatisticsGAMTest test;
-    ASSERT_TRUE(test.TestSetup_NotAScalarInput());
+    ASSERT_TRUE(test.TestSetup_ArrayInput());
 }
 
 TEST(StatisticsGAMGTest,TestSetup_NotAScalarOutput) {
@@ -169,6 +169,16 @@ TEST(StatisticsGAMGTest,TestExecute_uint32_withAbsoluteMaxMin) {
     ASSERT_TRUE(test.TestExecute_uint32_withAbsoluteMaxMin());
 }
 
+TEST(StatisticsGAMGTest,TestExecute_ArrayInput_int32) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestExecute_ArrayInput_int32());
+}
+
+TEST(StatisticsGAMGTest,TestExecute_ArrayInput_float64) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestExecute_ArrayInput_float64());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
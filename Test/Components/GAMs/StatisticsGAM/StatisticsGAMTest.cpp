@@ -707,7 +707,7 @@ bool StatisticsGAMTest::TestSetup_NoOutputSignal() {
     return !ok; // Expect failure 
 }
 
-bool StatisticsGAMTest::TestSetup_NotAScalarInput() {
+bool StatisticsGAMTest::TestSetup_ArrayInput() {
     const MARTe::char8 * const config = ""
             "$Test = {"
             "    Class = RealTimeApplication"
@@ -784,7 +784,7 @@ bool StatisticsGAMTest::TestSetup_NotAScalarInput() {
             "}";
 
     bool ok = StatisticsGAMTestHelper::ConfigureApplication(config);
-    return !ok; // Expect failure 
+    return ok;
 }
 
 bool StatisticsGAMTest::TestSetup_NotAScalarOutput() {
@@ -1217,6 +1217,186 @@ bool StatisticsGAMTest::TestExecute_AnyType(Type value, MARTe::uint32 cycleCount
     return ok;
 }
 
+template<typename Type>
+bool StatisticsGAMTest::TestExecute_ArrayInput_AnyType() {
+
+    const MARTe::char8 * const config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +Constants = {"
+            "            Class = StatisticsGAMTestHelper_Constant"
+            "            OutputSignals = {"
+            "                Constant_in = {"
+            "                    DataSource = DDB"
+            "                    Type = uint64"
+            "                    NumberOfDimensions = 1"
+            "                    NumberOfElements = 4"
+            "                    Default = {1 5 1 5}"
+            "                }"
+            "            }"
+            "        }"
+            "        +Statistics = {"
+            "            Class = StatisticsGAM"
+            "            WindowSize = 16"
+            "            InputSignals = {"
+            "               Constant_in = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "                   NumberOfDimensions = 1"
+            "                   NumberOfElements = 4"
+            "               }"
+            "            }"
+            "            OutputSignals = {"
+            "               Average_ExecTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "               Stdev_ExecTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "               Max_ExecTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "               Min_ExecTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "            }"
+            "        }"
+            "        +Sink = {"
+            "            Class = SinkGAM"
+            "            InputSignals = {"
+            "               Average_ExecTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "               Stdev_ExecTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "               Max_ExecTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "               Min_ExecTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +Running = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {Constants Statistics Sink}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+    using namespace MARTe;
+
+    Type value = 0;
+    AnyType at(value);
+    bool ok = StatisticsGAMTestHelper::ConfigureApplication(config, at.GetTypeDescriptor());
+
+    if (ok) {
+
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<RealTimeApplication> application = god->Find("Test");
+        ReferenceT<StatisticsGAM> gam = application->Find("Functions.Statistics");
+        ReferenceT<SinkGAM> sink = application->Find("Functions.Sink");
+
+        ok = (gam.IsValid() && sink.IsValid());
+
+        if (ok) {
+            ok = StatisticsGAMTestHelper::StartApplication();
+        }
+
+        /* Each cycle inserts the 4 elements {1 5 1 5} in the window of 16 samples */
+        if (ok) {
+            Sleep::Sec(1.0);
+        }
+
+        Type avg = 0;
+        Type std = 0;
+        Type min = 0;
+        Type max = 0;
+
+        if (ok) {
+            ok = sink->GetInput<Type>(0u, avg);
+        }
+
+        if (ok) {
+            ok = sink->GetInput<Type>(1u, std);
+        }
+
+        if (ok) {
+            ok = sink->GetInput<Type>(2u, min);
+        }
+
+        if (ok) {
+            ok = sink->GetInput<Type>(3u, max);
+        }
+
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::InternalSetupError, "SinkGAM::GetInput<> failed");
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::Information, "Statistics - %! %! %! %!", avg, std, min, max);
+        }
+
+        if (ok) {
+            ok = (avg == static_cast<Type>(3));
+        }
+
+        if (ok) {
+            ok = (std == static_cast<Type>(2));
+        }
+
+        if (ok) {
+            ok = (min == static_cast<Type>(1));
+        }
+
+        if (ok) {
+            ok = (max == static_cast<Type>(5));
+        }
+
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::InternalSetupError, "Failure in ConfigureApplication");
+    }
+
+    if (ok) {
+        ok = StatisticsGAMTestHelper::StopApplication();
+    }
+
+    return ok;
+}
+
 bool StatisticsGAMTest::TestExecute_uint8() {
     return TestExecute_AnyType<MARTe::uint8>(2);
 }
@@ -1400,3 +1580,11 @@ bool StatisticsGAMTest::TestExecute_uint32_withCycleCounter() {
 bool StatisticsGAMTest::TestExecute_uint32_withAbsoluteMaxMin() {
     return TestExecute_AnyType<MARTe::uint32>(324, 1, true);
 }
+
+bool StatisticsGAMTest::TestExecute_ArrayInput_int32() {
+    return TestExecute_ArrayInput_AnyType<MARTe::int32>();
+}
+
+bool StatisticsGAMTest::TestExecute_ArrayInput_float64() {
+    return TestExecute_ArrayInput_AnyType<MARTe::float64>();
+}
@@ -96,11 +96,11 @@ public:
     bool TestSetup_NoOutputSignal();
 
     /**
-     * @brief Tests the Setup() method
+     * @brief Tests the Setup() method with an array input signal.
      * @details Verify the post-conditions
-     * @return true if Setup() fails.
+     * @return true if Setup() succeeds.
      */
-    bool TestSetup_NotAScalarInput();
+    bool TestSetup_ArrayInput();
 
     /**
      * @brief Tests the Setup() method
@@ -219,6 +219,23 @@ public:
      * @brief Tests the absolute Max/Min handling mode
      */
     bool TestExecute_uint32_withAbsoluteMaxMin();
+
+    /**
+     * @brief Tests the execute method with an array input signal (and scalar output signals) against anytype.
+     */
+    template<typename Type> bool TestExecute_ArrayInput_AnyType();
+
+    /**
+     * @brief Tests the Execute method with an int32 array input signal.
+     * @return true if the statistics of all the elements inserted on each cycle are as expected.
+     */
+    bool TestExecute_ArrayInput_int32();
+
+    /**
+     * @brief Tests the Execute method with a float64 array input signal.
+     * @return true if the statistics of all the elements inserted on each cycle are as expected.
+     */
+    bool TestExecute_ArrayInput_float64();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -113,6 +113,26 @@ TEST(StatisticsHelperTGTest,TestGetStd_uint8) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetMax_Sliding_uint8) {
+    StatisticsHelperTTest<uint8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMax_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMin_Sliding_uint8) {
+    StatisticsHelperTTest<uint8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMin_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_uint8) {
+    StatisticsHelperTTest<uint8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, false));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_InfiniteMaxMin_uint8) {
+    StatisticsHelperTTest<uint8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, true));
+}
+
 /* uint16 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_uint16_32) {
@@ -185,6 +205,26 @@ TEST(StatisticsHelperTGTest,TestGetStd_uint16) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetMax_Sliding_uint16) {
+    StatisticsHelperTTest<uint16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMax_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMin_Sliding_uint16) {
+    StatisticsHelperTTest<uint16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMin_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_uint16) {
+    StatisticsHelperTTest<uint16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, false));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_InfiniteMaxMin_uint16) {
+    StatisticsHelperTTest<uint16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, true));
+}
+
 /* uint32 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_uint32_32) {
@@ -257,6 +297,26 @@ TEST(StatisticsHelperTGTest,TestGetStd_uint32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetMax_Sliding_uint32) {
+    StatisticsHelperTTest<uint32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMax_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMin_Sliding_uint32) {
+    StatisticsHelperTTest<uint32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMin_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_uint32) {
+    StatisticsHelperTTest<uint32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, false));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_InfiniteMaxMin_uint32) {
+    StatisticsHelperTTest<uint32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, true));
+}
+
 /* uint64 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_uint64_32) {
@@ -329,6 +389,26 @@ TEST(StatisticsHelperTGTest,TestGetStd_uint64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetMax_Sliding_uint64) {
+    StatisticsHelperTTest<uint64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMax_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMin_Sliding_uint64) {
+    StatisticsHelperTTest<uint64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMin_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_uint64) {
+    StatisticsHelperTTest<uint64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, false));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_InfiniteMaxMin_uint64) {
+    StatisticsHelperTTest<uint64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, true));
+}
+
 /* int8 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_int8_32) {
@@ -401,6 +481,26 @@ TEST(StatisticsHelperTGTest,TestGetStd_int8) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetMax_Sliding_int8) {
+    StatisticsHelperTTest<int8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMax_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMin_Sliding_int8) {
+    StatisticsHelperTTest<int8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMin_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_int8) {
+    StatisticsHelperTTest<int8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, false));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_InfiniteMaxMin_int8) {
+    StatisticsHelperTTest<int8> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, true));
+}
+
 /* int16 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_int16_32) {
@@ -473,6 +573,26 @@ TEST(StatisticsHelperTGTest,TestGetStd_int16) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetMax_Sliding_int16) {
+    StatisticsHelperTTest<int16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMax_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMin_Sliding_int16) {
+    StatisticsHelperTTest<int16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMin_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_int16) {
+    StatisticsHelperTTest<int16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, false));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_InfiniteMaxMin_int16) {
+    StatisticsHelperTTest<int16> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, true));
+}
+
 /* int32 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_int32_32) {
@@ -545,6 +665,26 @@ TEST(StatisticsHelperTGTest,TestGetStd_int32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetMax_Sliding_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMax_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMin_Sliding_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMin_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, false));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_InfiniteMaxMin_int32) {
+    StatisticsHelperTTest<int32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, true));
+}
+
 /* int64 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_int64_32) {
@@ -617,6 +757,26 @@ TEST(StatisticsHelperTGTest,TestGetStd_int64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetMax_Sliding_int64) {
+    StatisticsHelperTTest<int64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMax_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMin_Sliding_int64) {
+    StatisticsHelperTTest<int64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMin_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_int64) {
+    StatisticsHelperTTest<int64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, false));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_InfiniteMaxMin_int64) {
+    StatisticsHelperTTest<int64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, true));
+}
+
 /* float32 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_float32_32) {
@@ -689,6 +849,26 @@ TEST(StatisticsHelperTGTest,TestGetStd_float32) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetMax_Sliding_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMax_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMin_Sliding_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMin_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, false));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_InfiniteMaxMin_float32) {
+    StatisticsHelperTTest<float32> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, true));
+}
+
 /* float64 */
 
 TEST(StatisticsHelperTGTest,TestConstructor_float64_32) {
@@ -761,3 +941,23 @@ TEST(StatisticsHelperTGTest,TestGetStd_float64) {
     ASSERT_TRUE(statisticsHelperTTest.TestGetStd());
 }
 
+TEST(StatisticsHelperTGTest,TestGetMax_Sliding_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMax_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestGetMin_Sliding_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestGetMin_Sliding(32));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, false));
+}
+
+TEST(StatisticsHelperTGTest,TestPushSamples_InfiniteMaxMin_float64) {
+    StatisticsHelperTTest<float64> statisticsHelperTTest;
+    ASSERT_TRUE(statisticsHelperTTest.TestPushSamples(32, true));
+}
+
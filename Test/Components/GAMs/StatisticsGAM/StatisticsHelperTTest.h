@@ -107,6 +107,23 @@ public:
      */
     bool TestGetSum(const uint32 windowSize);
 
+    /**
+     * @brief Tests the GetMax method after the maximum leaves the window.
+     */
+    bool TestGetMax_Sliding(const uint32 windowSize);
+
+    /**
+     * @brief Tests the GetMin method after the minimum leaves the window.
+     */
+    bool TestGetMin_Sliding(const uint32 windowSize);
+
+    /**
+     * @brief Tests that the PushSamples method is equivalent to the PushSample method,
+     * also for batches larger than the window.
+     */
+    bool TestPushSamples(const uint32 windowSize,
+                         const bool infiniteMaxMin);
+
 };
 }
 /*---------------------------------------------------------------------------*/
@@ -273,6 +290,78 @@ bool StatisticsHelperTTest<Type>::TestGetSum(const uint32 windowSize) {
     return (myStatisticsHelper.GetSum() == sum);
 }
 
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetMax_Sliding(const uint32 windowSize) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize);
+    const uint32 size = myStatisticsHelper.GetSize();
+    bool ok = true;
+    /* Decreasing samples, the maximum leaves the window on every push once it is full */
+    for (uint32 i = 0; (i < 3u * size) && (ok); i++) {
+        ok = myStatisticsHelper.PushSample(static_cast<Type>(3u * size - i));
+        if (ok) {
+            uint32 oldest = (i < size) ? 0u : (i - size + 1u);
+            ok = (myStatisticsHelper.GetMax() == static_cast<Type>(3u * size - oldest));
+        }
+    }
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetMin_Sliding(const uint32 windowSize) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize);
+    const uint32 size = myStatisticsHelper.GetSize();
+    bool ok = true;
+    /* Increasing samples, the minimum leaves the window on every push once it is full */
+    for (uint32 i = 0; (i < 3u * size) && (ok); i++) {
+        ok = myStatisticsHelper.PushSample(static_cast<Type>(i));
+        if (ok) {
+            uint32 oldest = (i < size) ? 0u : (i - size + 1u);
+            ok = (myStatisticsHelper.GetMin() == static_cast<Type>(oldest));
+        }
+    }
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestPushSamples(const uint32 windowSize,
+                                                  const bool infiniteMaxMin) {
+    StatisticsHelperT<Type> single(windowSize);
+    StatisticsHelperT<Type> batch(windowSize);
+    const uint32 nOfSamples = 3u * windowSize + 1u;
+    Type *samples = new Type[nOfSamples];
+    for (uint32 i = 0u; i < nOfSamples; i++) {
+        samples[i] = static_cast<Type>((i * 37u) % 101u);
+    }
+    /* Batches of increasing size, up to larger than the window */
+    bool ok = true;
+    uint32 done = 0u;
+    for (uint32 n = 1u; (done < nOfSamples) && (ok); n *= 2u) {
+        uint32 nOfBatch = ((done + n) > nOfSamples) ? (nOfSamples - done) : n;
+        ok = batch.PushSamples(&samples[done], nOfBatch, infiniteMaxMin);
+        for (uint32 i = 0u; (i < nOfBatch) && (ok); i++) {
+            ok = single.PushSample(samples[done + i], infiniteMaxMin);
+        }
+        done += nOfBatch;
+        if (ok) {
+            ok = (batch.GetCounter() == single.GetCounter());
+        }
+        if (ok) {
+            ok = (batch.GetSum() == single.GetSum());
+        }
+        if (ok) {
+            ok = (batch.GetMax() == single.GetMax());
+        }
+        if (ok) {
+            ok = (batch.GetMin() == single.GetMin());
+        }
+        if (ok) {
+            ok = (batch.GetSample() == single.GetSample());
+        }
+    }
+    delete[] samples;
+    return ok;
+}
+
 } /*namespace MARTe*/
 #endif /* STATISTICSHELPERTTEST_H_ */
 
@@ -326,6 +326,11 @@ TEST(WaveformChirpGAMTest, TestExecute1ElementPerCycleFloat64) {
     ASSERT_TRUE(test.TestExecute1ElementPerCycle<float64>(auxStr));
 }
 
+TEST(WaveformChirpGAMTest, TestExecuteFastGeneration) {
+    WaveformChirpGAMTest test;
+    ASSERT_TRUE(test.TestExecuteFastGeneration());
+}
+
 
 
 
@@ -283,5 +283,75 @@ bool WaveformChirpGAMTest::TestExecuteNyquistViolation() {
     return ok;
 }
 
+bool WaveformChirpGAMTest::TestExecuteFastGeneration() {
+    using namespace MARTe;
+    bool ok = true;
+    const uint32 sizeOutput = 1000u;
+    const uint32 timeIterationIncrement = 100000u;
+    const uint32 numberOfIteration = 60u;
+    WaveformChirpGAMTestHelper gam(1, 1, sizeOutput, 1, "float64");
+    WaveformChirpGAMTestHelper gamFast(1, 1, sizeOutput, 1, "float64");
+    gam.SetName("Test");
+    gamFast.SetName("TestFast");
+    ok &= gam.InitialiseChirp1Trigger();
+    ok &= gamFast.InitialiseChirp1Trigger();
+    ok &= gamFast.config.Write("FastGeneration", 1u);
+    gam.config.MoveToRoot();
+    gamFast.config.MoveToRoot();
+    if (ok) {
+        ok &= gam.Initialise(gam.config);
+        ok &= gamFast.Initialise(gamFast.config);
+    }
+    if (ok) {
+        ok &= gam.InitialiseConfigDataBaseSignal1();
+        ok &= gamFast.InitialiseConfigDataBaseSignal1();
+    }
+    if (ok) {
+        ok &= gam.SetConfiguredDatabase(gam.configSignals);
+        ok &= gamFast.SetConfiguredDatabase(gamFast.configSignals);
+    }
+    if (ok) {
+        ok &= gam.AllocateInputSignalsMemory();
+        ok &= gam.AllocateOutputSignalsMemory();
+        ok &= gamFast.AllocateInputSignalsMemory();
+        ok &= gamFast.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gam.Setup();
+        ok &= gamFast.Setup();
+    }
+    uint32 *timeIteration = NULL;
+    uint32 *timeIterationFast = NULL;
+    float64 *output = NULL;
+    float64 *outputFast = NULL;
+    if (ok) {
+        timeIteration = static_cast<uint32 *>(gam.GetInputSignalsMemory());
+        timeIterationFast = static_cast<uint32 *>(gamFast.GetInputSignalsMemory());
+        output = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+        outputFast = static_cast<float64 *>(gamFast.GetOutputSignalsMemory());
+        *timeIteration = 0u;
+        *timeIterationFast = 0u;
+    }
+    //The difference is dominated by the rounding of the sample time in the sin() generation
+    const float64 tolerance = 1e-8 * gam.amplitude;
+    for (uint32 n = 0u; (n < numberOfIteration) && ok; n++) {
+        ok &= gam.Execute();
+        ok &= gamFast.Execute();
+        for (uint32 i = 0u; (i < sizeOutput) && ok; i++) {
+            float64 error = output[i] - outputFast[i];
+            ok = (error < tolerance) && (error > -tolerance);
+            if (output[i] == 0.0) {
+                //Same trigger state
+                ok = (outputFast[i] == 0.0);
+            }
+        }
+        if (!ok) {
+            REPORT_ERROR_STATIC_PARAMETERS(ErrorManagement::FatalError, "iteration which fails %u\n", n);
+        }
+        *timeIteration += timeIterationIncrement;
+        *timeIterationFast += timeIterationIncrement;
+    }
+    return ok;
 }
 
+}
@@ -125,6 +125,11 @@ public:
     template<typename T>
     bool TestExecute1ElementPerCycle(StreamString str);
 
+    /**
+     * @brief Verifies that the output generated with FastGeneration = 1 matches the sin() output, with the trigger mechanism enabled.
+     */
+    bool TestExecuteFastGeneration();
+
 };
 
 }
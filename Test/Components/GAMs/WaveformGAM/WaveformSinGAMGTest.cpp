@@ -308,6 +308,16 @@ TEST(WaveformSinGAMTest, TestExecuteNegativeInput_2) {
     ASSERT_TRUE(test.TestExecuteNegativeInput_2());
 }
 
+TEST(WaveformSinGAMTest, TestInitialise_WrongFastGeneration) {
+    WaveformSinGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_WrongFastGeneration());
+}
+
+TEST(WaveformSinGAMTest, TestFloat64Execute_FastGeneration) {
+    WaveformSinGAMTest test;
+    ASSERT_TRUE(test.TestFloat64Execute_FastGeneration());
+}
+
 
 
 
@@ -3698,3 +3698,84 @@ bool WaveformSinGAMTest::TestExecuteNegativeInput_2() {
     }
     return ok;
 }
+
+bool WaveformSinGAMTest::TestInitialise_WrongFastGeneration() {
+    using namespace MARTe;
+    bool ok = true;
+    WaveformSinGAMTestHelper gam;
+    gam.SetName("Test");
+    ok &= gam.InitialiseWaveSin();
+    ok &= gam.config.Write("FastGeneration", 2u);
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
+bool WaveformSinGAMTest::TestFloat64Execute_FastGeneration() {
+    using namespace MARTe;
+    bool ok = true;
+    const uint32 numberOfElements = 1000u;
+    const uint32 timeIterationIncrement = 100000u;
+    const uint32 numberOfIterations = 60u;
+    WaveformSinGAMTestHelper gam(1, 1, numberOfElements, 1);
+    WaveformSinGAMTestHelper gamFast(1, 1, numberOfElements, 1);
+    gam.SetName("Test");
+    gamFast.SetName("TestFast");
+    ok &= gam.InitialiseWaveSinTrigger(10.0, 1000.0, 0.3, 1.0);
+    ok &= gamFast.InitialiseWaveSinTrigger(10.0, 1000.0, 0.3, 1.0);
+    ok &= gamFast.config.Write("FastGeneration", 1u);
+    gam.config.MoveToRoot();
+    gamFast.config.MoveToRoot();
+    if (ok) {
+        ok &= gam.Initialise(gam.config);
+        ok &= gamFast.Initialise(gamFast.config);
+    }
+    if (ok) {
+        ok &= gam.InitialiseConfigDataBaseSignal1(Float64Bit);
+        ok &= gamFast.InitialiseConfigDataBaseSignal1(Float64Bit);
+    }
+    if (ok) {
+        ok &= gam.SetConfiguredDatabase(gam.configSignals);
+        ok &= gamFast.SetConfiguredDatabase(gamFast.configSignals);
+    }
+    if (ok) {
+        ok &= gam.AllocateInputSignalsMemory();
+        ok &= gam.AllocateOutputSignalsMemory();
+        ok &= gamFast.AllocateInputSignalsMemory();
+        ok &= gamFast.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gam.Setup();
+        ok &= gamFast.Setup();
+    }
+    uint32 *gamMemoryIn = NULL_PTR(uint32 *);
+    uint32 *gamFastMemoryIn = NULL_PTR(uint32 *);
+    float64 *gamMemoryOut = NULL_PTR(float64 *);
+    float64 *gamFastMemoryOut = NULL_PTR(float64 *);
+    if (ok) {
+        gamMemoryIn = static_cast<uint32 *>(gam.GetInputSignalsMemory());
+        gamFastMemoryIn = static_cast<uint32 *>(gamFast.GetInputSignalsMemory());
+        gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+        gamFastMemoryOut = static_cast<float64 *>(gamFast.GetOutputSignalsMemory());
+        *gamMemoryIn = 0u;
+        *gamFastMemoryIn = 0u;
+    }
+    //The difference is dominated by the rounding of the sample time in the sin() generation
+    const float64 tolerance = 1e-8 * gam.amplitude;
+    for (uint32 n = 0u; (n < numberOfIterations) && ok; n++) {
+        ok &= gam.Execute();
+        ok &= gamFast.Execute();
+        for (uint32 i = 0u; (i < numberOfElements) && ok; i++) {
+            float64 error = gamMemoryOut[i] - gamFastMemoryOut[i];
+            ok = (error < tolerance) && (error > -tolerance);
+            if (gamMemoryOut[i] == 0.0) {
+                //Same trigger state
+                ok = (gamFastMemoryOut[i] == 0.0);
+            }
+        }
+        *gamMemoryIn += timeIterationIncrement;
+        *gamFastMemoryIn += timeIterationIncrement;
+    }
+    return ok;
+}
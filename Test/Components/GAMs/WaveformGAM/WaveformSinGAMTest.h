@@ -319,6 +319,16 @@ public:
      */
     bool TestExecuteNegativeInput_2();
 
+    /**
+     * @brief Test the error message of Initialise() when FastGeneration is neither 0 nor 1.
+     */
+    bool TestInitialise_WrongFastGeneration();
+
+    /**
+     * @brief Test that the output generated with FastGeneration = 1 matches the sin() output, with the trigger mechanism enabled.
+     */
+    bool TestFloat64Execute_FastGeneration();
+
 };
 
 /*---------------------------------------------------------------------------*/
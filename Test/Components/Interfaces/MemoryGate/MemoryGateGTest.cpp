@@ -94,3 +94,28 @@ TEST(MemoryGateGTest,TestMemoryWrite_Overflow) {
     ASSERT_TRUE(test.TestMemoryWrite_Overflow());
 }
 
+TEST(MemoryGateGTest,TestInitialise_Versioned) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestInitialise_Versioned());
+}
+
+TEST(MemoryGateGTest,TestMemoryReadWrite_Versioned) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryReadWrite_Versioned());
+}
+
+TEST(MemoryGateGTest,TestMemoryWrite_Versioned_NeverFails) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryWrite_Versioned_NeverFails());
+}
+
+TEST(MemoryGateGTest,TestMemoryReadSnapshot) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryReadSnapshot());
+}
+
+TEST(MemoryGateGTest,TestMemoryReadSnapshot_False_NotVersioned) {
+    MemoryGateTest test;
+    ASSERT_TRUE(test.TestMemoryReadSnapshot_False_NotVersioned());
+}
+
@@ -977,3 +977,142 @@ bool MemoryGateTest::TestMemoryWrite_Overflow() {
     return ok;
 }
 
+static bool InitialiseVersionedGate(MemoryGate &gate,
+                                    const char8 * const config) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = gate.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestInitialise_Versioned() {
+    MemoryGate test;
+    bool ok = !test.IsVersioned();
+    if (ok) {
+        ok = InitialiseVersionedGate(test, "NumberOfBuffers = 4\n Versioned = 1\n MemorySize = 4");
+    }
+    if (ok) {
+        ok = test.IsVersioned();
+        ok &= (test.GetReadRetries() == 0u);
+        ok &= (test.GetWriteRetries() == 0u);
+        ok &= (test.GetSkippedVersions() == 0u);
+    }
+    if (ok) {
+        //Nothing written yet
+        uint32 value = 1u;
+        ok = test.MemoryRead(reinterpret_cast<uint8 *>(&value));
+        if (ok) {
+            ok = (value == 0u);
+        }
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestMemoryReadWrite_Versioned() {
+    MemoryGate test;
+    bool ok = InitialiseVersionedGate(test, "NumberOfBuffers = 4\n Versioned = 1");
+    if (ok) {
+        ok = test.SetMemorySize(sizeof(uint32));
+    }
+    for (uint32 i = 1u; (i <= 3u) && (ok); i++) {
+        ok = test.MemoryWrite(reinterpret_cast<const uint8 *>(&i));
+    }
+    uint32 value = 0u;
+    if (ok) {
+        ok = test.MemoryRead(reinterpret_cast<uint8 *>(&value));
+    }
+    if (ok) {
+        //Versions 1 and 2 were never read
+        ok = (value == 3u);
+        ok &= (test.GetSkippedVersions() == 2u);
+    }
+    if (ok) {
+        value = 0u;
+        ok = test.MemoryRead(reinterpret_cast<uint8 *>(&value));
+    }
+    if (ok) {
+        ok = (value == 3u);
+        ok &= (test.GetSkippedVersions() == 2u);
+    }
+    if (ok) {
+        uint32 newValue = 4u;
+        ok = test.MemoryWrite(reinterpret_cast<const uint8 *>(&newValue));
+    }
+    if (ok) {
+        ok = test.MemoryRead(reinterpret_cast<uint8 *>(&value));
+    }
+    if (ok) {
+        ok = (value == 4u);
+        ok &= (test.GetSkippedVersions() == 2u);
+        ok &= (test.GetReadRetries() == 0u);
+        ok &= (test.GetWriteRetries() == 0u);
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestMemoryWrite_Versioned_NeverFails() {
+    MemoryGate test;
+    bool ok = InitialiseVersionedGate(test, "NumberOfBuffers = 1\n Versioned = 1\n MemorySize = 4");
+    for (uint32 i = 1u; (i <= 100u) && (ok); i++) {
+        ok = test.MemoryWrite(reinterpret_cast<const uint8 *>(&i));
+    }
+    uint32 value = 0u;
+    if (ok) {
+        ok = test.MemoryRead(reinterpret_cast<uint8 *>(&value));
+    }
+    if (ok) {
+        ok = (value == 100u);
+        ok &= (test.GetSkippedVersions() == 99u);
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestMemoryReadSnapshot() {
+    MemoryGate gate1;
+    MemoryGate gate2;
+    bool ok = InitialiseVersionedGate(gate1, "NumberOfBuffers = 2\n Versioned = 1\n MemorySize = 4");
+    if (ok) {
+        ok = InitialiseVersionedGate(gate2, "NumberOfBuffers = 3\n Versioned = 1\n MemorySize = 8");
+    }
+    uint32 value1 = 7u;
+    uint64 value2 = 11u;
+    if (ok) {
+        ok = gate1.MemoryWrite(reinterpret_cast<const uint8 *>(&value1));
+    }
+    if (ok) {
+        ok = gate2.MemoryWrite(reinterpret_cast<const uint8 *>(&value2));
+    }
+    uint32 read1 = 0u;
+    uint64 read2 = 0u;
+    if (ok) {
+        MemoryGate *gates[] = { &gate1, &gate2 };
+        uint8 *buffers[] = { reinterpret_cast<uint8 *>(&read1), reinterpret_cast<uint8 *>(&read2) };
+        ok = MemoryGate::MemoryReadSnapshot(&gates[0], &buffers[0], 2u);
+    }
+    if (ok) {
+        ok = (read1 == 7u) && (read2 == 11u);
+    }
+    return ok;
+}
+
+bool MemoryGateTest::TestMemoryReadSnapshot_False_NotVersioned() {
+    MemoryGate gate1;
+    MemoryGate gate2;
+    bool ok = InitialiseVersionedGate(gate1, "NumberOfBuffers = 2\n Versioned = 1\n MemorySize = 4");
+    if (ok) {
+        ok = InitialiseVersionedGate(gate2, "NumberOfBuffers = 2\n MemorySize = 4");
+    }
+    if (ok) {
+        uint32 read1 = 0u;
+        uint32 read2 = 0u;
+        MemoryGate *gates[] = { &gate1, &gate2 };
+        uint8 *buffers[] = { reinterpret_cast<uint8 *>(&read1), reinterpret_cast<uint8 *>(&read2) };
+        ok = !MemoryGate::MemoryReadSnapshot(&gates[0], &buffers[0], 2u);
+    }
+    return ok;
+}
@@ -114,6 +114,32 @@ public:
      */
     bool TestMemoryWrite_Overflow();
 
+    /**
+     * @brief Tests the MemoryGateTest::Initialise method with Versioned = 1
+     */
+    bool TestInitialise_Versioned();
+
+    /**
+     * @brief Tests the MemoryGateTest::MemoryRead and MemoryGateTest::MemoryWrite methods with Versioned = 1
+     * and the skipped versions counter.
+     */
+    bool TestMemoryReadWrite_Versioned();
+
+    /**
+     * @brief Tests that with Versioned = 1 the writers never fail, also with a single buffer.
+     */
+    bool TestMemoryWrite_Versioned_NeverFails();
+
+    /**
+     * @brief Tests the MemoryGateTest::MemoryReadSnapshot method
+     */
+    bool TestMemoryReadSnapshot();
+
+    /**
+     * @brief Tests that the MemoryGateTest::MemoryReadSnapshot method fails if a gate is not versioned
+     */
+    bool TestMemoryReadSnapshot_False_NotVersioned();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,375 @@
+/**
+ * @file SharedMemoryGateTest.cpp
+ * @brief Source file for class SharedMemoryGateTest
+ * @date 18/10/2026
+ * @author Giuseppe Ferro
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SharedMemoryGateTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "SharedMemoryGateTest.h"
+#include "Sleep.h"
+#include "StandardParser.h"
+#include "Threads.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Initialises a SharedMemoryGate from a configuration string.
+ */
+static bool InitialiseSharedMemoryGate(SharedMemoryGate &gate,
+                                       const char8 * const config) {
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = gate.Initialise(cdb);
+    }
+    return ok;
+}
+
+/**
+ * Number of uint32 words in the buffers of the multiple writers test.
+ */
+static const uint32 SHARED_MEMORY_GATE_TEST_WORDS = 64u;
+
+/**
+ * Number of writes of each writer of the multiple writers test.
+ */
+static const uint32 SHARED_MEMORY_GATE_TEST_WRITES = 20000u;
+
+/**
+ * Shared state of the multiple writers test.
+ */
+struct SharedMemoryGateTestParameters {
+    SharedMemoryGate *gate;
+    uint32 writerId;
+    volatile int32 *running;
+};
+
+/**
+ * Writes buffers whose words are all derived from the same value.
+ */
+static void SharedMemoryGateTestWriter(const void * const params) {
+    const SharedMemoryGateTestParameters *parameters = static_cast<const SharedMemoryGateTestParameters *>(params);
+    uint32 buffer[SHARED_MEMORY_GATE_TEST_WORDS];
+    for (uint32 i = 1u; i <= SHARED_MEMORY_GATE_TEST_WRITES; i++) {
+        uint32 value = (i << 1u) | parameters->writerId;
+        for (uint32 k = 0u; k < SHARED_MEMORY_GATE_TEST_WORDS; k++) {
+            buffer[k] = value + k;
+        }
+        (void) parameters->gate->MemoryWrite(reinterpret_cast<uint8 *>(&buffer[0]));
+    }
+    Atomic::Decrement(parameters->running);
+}
+
+/**
+ * Offset of the sequence of the first buffer in the shared memory (i.e. the header size aligned to 64 bytes).
+ */
+static const uint32 SHARED_MEMORY_GATE_TEST_FIRST_SEQUENCE = 64u;
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool SharedMemoryGateTest::TestConstructor() {
+    SharedMemoryGate gate;
+    return (gate.GetReadRetries() == 0u);
+}
+
+bool SharedMemoryGateTest::TestInitialise() {
+    const char8* config = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_Initialise\"\n"
+            "NumberOfBuffers = 4\n"
+            "MemorySize = 16\n"
+            "UnlinkOnExit = 1";
+
+    SharedMemoryGate gate;
+    bool ok = InitialiseSharedMemoryGate(gate, config);
+    if (ok) {
+        //Already declared
+        ok = gate.SetMemorySize(16u);
+    }
+    if (ok) {
+        ok = !gate.SetMemorySize(8u);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestInitialise_False_NoSharedMemoryName() {
+    const char8* config = ""
+            "NumberOfBuffers = 4\n"
+            "MemorySize = 16";
+
+    SharedMemoryGate gate;
+    return !InitialiseSharedMemoryGate(gate, config);
+}
+
+bool SharedMemoryGateTest::TestInitialise_False_InvalidSharedMemoryName() {
+    const char8* config = ""
+            "SharedMemoryName = \"SharedMemoryGateTest\"\n"
+            "MemorySize = 16";
+
+    SharedMemoryGate gate;
+    return !InitialiseSharedMemoryGate(gate, config);
+}
+
+bool SharedMemoryGateTest::TestSetMemorySize() {
+    const char8* config = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_SetMemorySize\"\n"
+            "UnlinkOnExit = 1";
+
+    SharedMemoryGate gate;
+    bool ok = InitialiseSharedMemoryGate(gate, config);
+    if (ok) {
+        ok = gate.SetMemorySize(32u);
+    }
+    if (ok) {
+        ok = gate.SetMemorySize(32u);
+    }
+    if (ok) {
+        ok = !gate.SetMemorySize(16u);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestSetMemorySize_False_Mismatch() {
+    const char8* config1 = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_Mismatch\"\n"
+            "NumberOfBuffers = 2\n"
+            "UnlinkOnExit = 1";
+    const char8* config2 = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_Mismatch\"\n"
+            "NumberOfBuffers = 2";
+
+    SharedMemoryGate gate1;
+    SharedMemoryGate gate2;
+    bool ok = InitialiseSharedMemoryGate(gate1, config1);
+    if (ok) {
+        ok = InitialiseSharedMemoryGate(gate2, config2);
+    }
+    if (ok) {
+        ok = gate1.SetMemorySize(32u);
+    }
+    if (ok) {
+        ok = !gate2.SetMemorySize(16u);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestMemoryWriteRead() {
+    const char8* config1 = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_WriteRead\"\n"
+            "NumberOfBuffers = 2\n"
+            "MemorySize = 8\n"
+            "UnlinkOnExit = 1";
+    const char8* config2 = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_WriteRead\"\n"
+            "NumberOfBuffers = 2\n"
+            "MemorySize = 8";
+
+    SharedMemoryGate writer;
+    SharedMemoryGate reader;
+    bool ok = InitialiseSharedMemoryGate(writer, config1);
+    if (ok) {
+        ok = InitialiseSharedMemoryGate(reader, config2);
+    }
+    uint32 written[2] = { 0x12345678u, 0x9ABCDEF0u };
+    uint32 read[2] = { 0u, 0u };
+    if (ok) {
+        ok = writer.MemoryWrite(reinterpret_cast<uint8 *>(&written[0]));
+    }
+    if (ok) {
+        ok = reader.MemoryRead(reinterpret_cast<uint8 *>(&read[0]));
+    }
+    if (ok) {
+        ok = (read[0] == written[0]) && (read[1] == written[1]);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestMemoryRead_Newest() {
+    const char8* config1 = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_Newest\"\n"
+            "NumberOfBuffers = 3\n"
+            "MemorySize = 4\n"
+            "UnlinkOnExit = 1";
+    const char8* config2 = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_Newest\"\n"
+            "NumberOfBuffers = 3\n"
+            "MemorySize = 4";
+
+    SharedMemoryGate writer;
+    SharedMemoryGate reader;
+    bool ok = InitialiseSharedMemoryGate(writer, config1);
+    if (ok) {
+        ok = InitialiseSharedMemoryGate(reader, config2);
+    }
+    for (uint32 i = 1u; (i < 10u) && (ok); i++) {
+        ok = writer.MemoryWrite(reinterpret_cast<uint8 *>(&i));
+        uint32 read = 0u;
+        if (ok) {
+            ok = reader.MemoryRead(reinterpret_cast<uint8 *>(&read));
+        }
+        if (ok) {
+            ok = (read == i);
+        }
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestMemoryWrite_MultipleWriters() {
+    const char8* config1 = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_MultipleWriters\"\n"
+            "NumberOfBuffers = 4\n"
+            "MemorySize = 256\n"
+            "UnlinkOnExit = 1";
+    const char8* config2 = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_MultipleWriters\"\n"
+            "NumberOfBuffers = 4\n"
+            "MemorySize = 256";
+
+    SharedMemoryGate gates[3];
+    bool ok = InitialiseSharedMemoryGate(gates[0], config1);
+    if (ok) {
+        ok = InitialiseSharedMemoryGate(gates[1], config2);
+    }
+    if (ok) {
+        ok = InitialiseSharedMemoryGate(gates[2], config2);
+    }
+    volatile int32 running = 2;
+    SharedMemoryGateTestParameters parameters[2];
+    if (ok) {
+        for (uint32 w = 0u; w < 2u; w++) {
+            parameters[w].gate = &gates[w];
+            parameters[w].writerId = w;
+            parameters[w].running = &running;
+            (void) Threads::BeginThread(&SharedMemoryGateTestWriter, &parameters[w]);
+        }
+        uint32 buffer[SHARED_MEMORY_GATE_TEST_WORDS];
+        while (running > 0) {
+            if (gates[2].MemoryRead(reinterpret_cast<uint8 *>(&buffer[0]))) {
+                for (uint32 k = 0u; (k < SHARED_MEMORY_GATE_TEST_WORDS) && (ok); k++) {
+                    ok = (buffer[k] == (buffer[0] + k));
+                }
+            }
+        }
+    }
+    while (running > 0) {
+        Sleep::MSec(1u);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestSetMemorySize_False_NotSized() {
+    const char8* config = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_NotSized\"\n"
+            "NumberOfBuffers = 2\n"
+            "UnlinkOnExit = 1";
+
+    //Simulates a creator that died before sizing the object
+    int32 fd = shm_open("/SharedMemoryGateTest_NotSized", O_RDWR | O_CREAT | O_EXCL, static_cast<mode_t>(0666));
+    bool ok = (fd >= 0);
+    SharedMemoryGate gate;
+    if (ok) {
+        ok = InitialiseSharedMemoryGate(gate, config);
+    }
+    if (ok) {
+        ok = !gate.SetMemorySize(16u);
+    }
+    if (fd >= 0) {
+        (void) close(fd);
+    }
+    return ok;
+}
+
+bool SharedMemoryGateTest::TestMemoryRead_False_DeadWriter() {
+    const char8* config1 = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_DeadWriter\"\n"
+            "NumberOfBuffers = 1\n"
+            "MemorySize = 4\n"
+            "UnlinkOnExit = 1";
+    const char8* config2 = ""
+            "SharedMemoryName = \"/SharedMemoryGateTest_DeadWriter\"\n"
+            "NumberOfBuffers = 1\n"
+            "MemorySize = 4";
+
+    SharedMemoryGate writer;
+    SharedMemoryGate reader;
+    bool ok = InitialiseSharedMemoryGate(writer, config1);
+    if (ok) {
+        ok = InitialiseSharedMemoryGate(reader, config2);
+    }
+    uint32 value = 7u;
+    if (ok) {
+        ok = writer.MemoryWrite(reinterpret_cast<uint8 *>(&value));
+    }
+    int32 fd = -1;
+    void *address = MAP_FAILED;
+    if (ok) {
+        fd = shm_open("/SharedMemoryGateTest_DeadWriter", O_RDWR, static_cast<mode_t>(0666));
+        ok = (fd >= 0);
+    }
+    if (ok) {
+        address = mmap(NULL_PTR(void *), static_cast<size_t>(SHARED_MEMORY_GATE_TEST_FIRST_SEQUENCE + sizeof(int32)), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ok = (address != MAP_FAILED);
+    }
+    volatile int32 *sequence = NULL_PTR(volatile int32 *);
+    if (ok) {
+        //Leave the buffer as a writer that died in the middle of the copy would
+        sequence = reinterpret_cast<volatile int32 *>(&(reinterpret_cast<uint8 *>(address)[SHARED_MEMORY_GATE_TEST_FIRST_SEQUENCE]));
+        *sequence = *sequence + 1;
+        uint32 read = 0u;
+        ok = !reader.MemoryRead(reinterpret_cast<uint8 *>(&read));
+        if (ok) {
+            ok = !writer.MemoryWrite(reinterpret_cast<uint8 *>(&value));
+        }
+        if (ok) {
+            ok = (reader.GetReadRetries() > 0u);
+        }
+        *sequence = *sequence + 1;
+        if (ok) {
+            ok = reader.MemoryRead(reinterpret_cast<uint8 *>(&read));
+        }
+        if (ok) {
+            ok = (read == value);
+        }
+    }
+    if (address != MAP_FAILED) {
+        (void) munmap(address, static_cast<size_t>(SHARED_MEMORY_GATE_TEST_FIRST_SEQUENCE + sizeof(int32)));
+    }
+    if (fd >= 0) {
+        (void) close(fd);
+    }
+    return ok;
+}
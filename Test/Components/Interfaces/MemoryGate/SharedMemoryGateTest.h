@@ -0,0 +1,110 @@
+/**
+ * @file SharedMemoryGateTest.h
+ * @brief Header file for class SharedMemoryGateTest
+ * @date 18/10/2026
+ * @author Giuseppe Ferro
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SharedMemoryGateTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef MEMORYGATE_SHAREDMEMORYGATETEST_H_
+#define MEMORYGATE_SHAREDMEMORYGATETEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SharedMemoryGate.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Test all the SharedMemoryGate methods
+ * @details Two SharedMemoryGate instances with the same SharedMemoryName are used
+ * to emulate two processes linked to the same shared memory.
+ */
+class SharedMemoryGateTest {
+public:
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the SharedMemoryGate::Initialise method
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the SharedMemoryGate::Initialise method fails if SharedMemoryName is not set
+     */
+    bool TestInitialise_False_NoSharedMemoryName();
+
+    /**
+     * @brief Tests that the SharedMemoryGate::Initialise method fails if SharedMemoryName does not start with '/'
+     */
+    bool TestInitialise_False_InvalidSharedMemoryName();
+
+    /**
+     * @brief Tests the SharedMemoryGate::SetMemorySize method when the size is not declared in the configuration
+     */
+    bool TestSetMemorySize();
+
+    /**
+     * @brief Tests that the SharedMemoryGate::SetMemorySize method fails if another instance declared a different size
+     */
+    bool TestSetMemorySize_False_Mismatch();
+
+    /**
+     * @brief Tests that data written by one instance is read by the other one
+     */
+    bool TestMemoryWriteRead();
+
+    /**
+     * @brief Tests that the reader gets the newest written data after more writes than buffers
+     */
+    bool TestMemoryRead_Newest();
+
+    /**
+     * @brief Tests two writer threads and one reader thread on different instances, checking that no read is torn
+     */
+    bool TestMemoryWrite_MultipleWriters();
+
+    /**
+     * @brief Tests that SetMemorySize fails (after waiting) if the creator never sized the shared memory
+     */
+    bool TestSetMemorySize_False_NotSized();
+
+    /**
+     * @brief Tests that the reads and the writes fail (after a bounded number of retries) while a buffer is left half written
+     */
+    bool TestMemoryRead_False_DeadWriter();
+
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* MEMORYGATE_SHAREDMEMORYGATETEST_H_ */
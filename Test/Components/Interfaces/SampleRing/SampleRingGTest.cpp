@@ -0,0 +1,76 @@
+/**
+ * @file SampleRingGTest.cpp
+ * @brief Source file for class SampleRingGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SampleRingGTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SampleRingTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+TEST(SampleRingGTest,TestConstructor) {
+    SampleRingTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(SampleRingGTest,TestInitialise) {
+    SampleRingTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(SampleRingGTest,TestInitialise_False) {
+    SampleRingTest test;
+    ASSERT_TRUE(test.TestInitialise_False());
+}
+
+TEST(SampleRingGTest,TestGetWriteSlot_Full) {
+    SampleRingTest test;
+    ASSERT_TRUE(test.TestGetWriteSlot_Full());
+}
+
+TEST(SampleRingGTest,TestGetWriteSlot_NotInitialised) {
+    SampleRingTest test;
+    ASSERT_TRUE(test.TestGetWriteSlot_NotInitialised());
+}
+
+TEST(SampleRingGTest,TestGetReadSlot) {
+    SampleRingTest test;
+    ASSERT_TRUE(test.TestGetReadSlot());
+}
+
+TEST(SampleRingGTest,TestRelease) {
+    SampleRingTest test;
+    ASSERT_TRUE(test.TestRelease());
+}
+
@@ -0,0 +1,195 @@
+/**
+ * @file SampleRingTest.cpp
+ * @brief Source file for class SampleRingTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class SampleRingTest (public, protected, and private). Be aware that some 
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "SampleRingTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool SampleRingTest::TestConstructor() {
+    SampleRing ring;
+    bool ret = !ring.IsInitialised();
+    if (ret) {
+        ret = (ring.GetSampleSize() == 0u);
+    }
+    if (ret) {
+        ret = (ring.GetNumberOfSamples() == 0u);
+    }
+    if (ret) {
+        ret = (ring.GetReadSlot(0u) == NULL_PTR(const char8 *));
+    }
+    return ret;
+}
+
+bool SampleRingTest::TestInitialise() {
+    SampleRing ring;
+    bool ret = ring.Initialise(4u, 8u);
+    if (ret) {
+        ret = ring.IsInitialised();
+    }
+    if (ret) {
+        ret = (ring.GetSampleSize() == 8u);
+    }
+    if (ret) {
+        ret = (ring.GetNumberOfSamples() == 0u);
+    }
+    return ret;
+}
+
+bool SampleRingTest::TestInitialise_False() {
+    SampleRing ring1;
+    bool ret = !ring1.Initialise(0u, 8u);
+    if (ret) {
+        SampleRing ring2;
+        ret = !ring2.Initialise(4u, 0u);
+    }
+    if (ret) {
+        SampleRing ring3;
+        ret = ring3.Initialise(4u, 8u);
+        if (ret) {
+            ret = !ring3.Initialise(4u, 8u);
+        }
+    }
+    return ret;
+}
+
+bool SampleRingTest::TestGetWriteSlot_Full() {
+    SampleRing ring;
+    const uint32 numberOfSamples = 3u;
+    bool ret = ring.Initialise(numberOfSamples, sizeof(uint32));
+    uint32 n;
+    for (n = 0u; (n < numberOfSamples) && (ret); n++) {
+        char8 *slot = ring.GetWriteSlot();
+        ret = (slot != NULL_PTR(char8 *));
+        if (ret) {
+            ring.Commit();
+        }
+    }
+    if (ret) {
+        ret = (ring.GetNumberOfSamples() == numberOfSamples);
+    }
+    if (ret) {
+        ret = (ring.GetWriteSlot() == NULL_PTR(char8 *));
+    }
+    if (ret) {
+        ring.Release(1u);
+        ret = (ring.GetWriteSlot() != NULL_PTR(char8 *));
+    }
+    return ret;
+}
+
+bool SampleRingTest::TestGetWriteSlot_NotInitialised() {
+    SampleRing ring;
+    return (ring.GetWriteSlot() == NULL_PTR(char8 *));
+}
+
+bool SampleRingTest::TestGetReadSlot() {
+    SampleRing ring;
+    const uint32 numberOfSamples = 4u;
+    bool ret = ring.Initialise(numberOfSamples, sizeof(uint32));
+    uint32 n;
+    for (n = 0u; (n < numberOfSamples) && (ret); n++) {
+        char8 *slot = ring.GetWriteSlot();
+        ret = (slot != NULL_PTR(char8 *));
+        if (ret) {
+            *reinterpret_cast<uint32 *>(slot) = (n + 1u) * 10u;
+            //Not visible before the Commit
+            ret = (ring.GetNumberOfSamples() == n);
+        }
+        if (ret) {
+            ring.Commit();
+        }
+    }
+    for (n = 0u; (n < numberOfSamples) && (ret); n++) {
+        const char8 *slot = ring.GetReadSlot(n);
+        ret = (slot != NULL_PTR(const char8 *));
+        if (ret) {
+            ret = (*reinterpret_cast<const uint32 *>(slot) == ((n + 1u) * 10u));
+        }
+    }
+    if (ret) {
+        ret = (ring.GetReadSlot(numberOfSamples) == NULL_PTR(const char8 *));
+    }
+    return ret;
+}
+
+bool SampleRingTest::TestRelease() {
+    SampleRing ring;
+    const uint32 numberOfSamples = 3u;
+    bool ret = ring.Initialise(numberOfSamples, sizeof(uint32));
+    uint32 value = 0u;
+    uint32 expected = 0u;
+    uint32 i;
+    //Go around the ring several times with a different number of samples in flight
+    for (i = 0u; (i < 10u) && (ret); i++) {
+        uint32 toWrite = (i % numberOfSamples) + 1u;
+        uint32 n;
+        for (n = 0u; (n < toWrite) && (ret); n++) {
+            char8 *slot = ring.GetWriteSlot();
+            ret = (slot != NULL_PTR(char8 *));
+            if (ret) {
+                *reinterpret_cast<uint32 *>(slot) = value;
+                value++;
+                ring.Commit();
+            }
+        }
+        if (ret) {
+            ret = (ring.GetNumberOfSamples() == toWrite);
+        }
+        if (ret) {
+            //The newest sample
+            const char8 *slot = ring.GetReadSlot(toWrite - 1u);
+            ret = (slot != NULL_PTR(const char8 *));
+            if (ret) {
+                ret = (*reinterpret_cast<const uint32 *>(slot) == (value - 1u));
+            }
+        }
+        if (ret) {
+            //Release one by one...
+            const char8 *slot = ring.GetReadSlot(0u);
+            ret = (*reinterpret_cast<const uint32 *>(slot) == expected);
+            ring.Release(1u);
+            expected++;
+        }
+        if (ret) {
+            //...and then all the others (asking for more than available)
+            ring.Release(numberOfSamples + 1u);
+            expected = value;
+            ret = (ring.GetNumberOfSamples() == 0u);
+        }
+    }
+    return ret;
+}
+
@@ -0,0 +1,88 @@
+/**
+ * @file SampleRingTest.h
+ * @brief Header file for class SampleRingTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class SampleRingTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SAMPLERING_SAMPLERINGTEST_H_
+#define SAMPLERING_SAMPLERINGTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "SampleRing.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Test all the SampleRing methods
+ */
+class SampleRingTest {
+public:
+
+    /**
+     * @brief Tests the constructor
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the SampleRing::Initialise method
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the SampleRing::Initialise method fails with zero samples, zero size or if called twice
+     */
+    bool TestInitialise_False();
+
+    /**
+     * @brief Tests that the SampleRing::GetWriteSlot method returns NULL when the ring is full
+     */
+    bool TestGetWriteSlot_Full();
+
+    /**
+     * @brief Tests that the SampleRing::GetWriteSlot method returns NULL if the ring is not initialised
+     */
+    bool TestGetWriteSlot_NotInitialised();
+
+    /**
+     * @brief Tests that the SampleRing::GetReadSlot method returns the samples from the oldest to the newest
+     */
+    bool TestGetReadSlot();
+
+    /**
+     * @brief Tests the SampleRing::Release method, also wrapping around the end of the ring
+     */
+    bool TestRelease();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SAMPLERING_SAMPLERINGTEST_H_ */
+